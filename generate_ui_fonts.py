@@ -0,0 +1,514 @@
+#!/usr/bin/env python3
+"""Generate subset UI fonts from LVGL's built-in Montserrat fonts.
+
+Only Montserrat 14 and 16 are compiled in whole (lv_conf.h). The larger sizes the
+screens use are cut down here to the characters the UI can show. These are the string
+literals of the UI sources plus digits and the degree sign. Each font gets its own bpp
+(requantized from the 4 bpp source) and optional RLE compression (LV_USE_FONT_COMPRESSED).
+The glyph tables come from lib/lvgl/src/font/lv_font_montserrat_<size>.c, so no font
+toolchain is needed.
+
+Outputs lib/ui_fonts/ (a PlatformIO library):
+  ui_fonts.h                    LV_FONT_DECLARE of every font, flash bytes of subset and full font
+  ui_font_montserrat_<size>.c   one font each, in lv_font_conv's layout
+
+Files are only rewritten when their content changes.
+"""
+import pathlib
+import re
+import os, sys
+
+try:
+    ROOT = pathlib.Path(__file__).resolve().parent
+except NameError:
+    # Fallback when __file__ not provided by execution context (PlatformIO SCons), as in generate_version_header.py
+    if len(sys.argv) and sys.argv[0]:
+        ROOT = pathlib.Path(sys.argv[0]).resolve().parent
+    else:
+        ROOT = pathlib.Path(os.getcwd())
+SRC_FONTS = ROOT / 'lib' / 'lvgl' / 'src' / 'font'
+OUT = ROOT / 'lib' / 'ui_fonts'
+
+# Sources whose string literals make up the "ui" character set
+UI_SOURCES = [ROOT / 'src' / 'display' / 'ui_screens.cpp']
+# Always present: readings, units, separators
+BASE_CHARS = ' 0123456789+-.,:%°C'
+# Text that is not in the sources (error messages passed to showError())
+ASCII_CHARS = ''.join(chr(c) for c in range(0x20, 0x7F)) + '°'
+
+# size: pixel size of the source font; chars: 'ui', 'ascii' or a literal set; bpp: 1, 2 or 4;
+# compress: RLE with line prefilter (smaller, decoded on every uncached draw of a glyph)
+FONTS = [
+    dict(size=48, chars='0123456789-.°C ', bpp=4, compress=False),   # Temperature readout (redrawn most)
+    dict(size=32, chars='ui', bpp=4, compress=False),                 # Screen titles
+    dict(size=28, chars='ui', bpp=4, compress=False),                 # Control status
+    dict(size=24, chars='ui', bpp=4, compress=False),                 # Target, error title
+    dict(size=20, chars='ui', bpp=2, compress=False),                 # Fault banner
+    dict(size=18, chars='ascii', bpp=4, compress=True),               # Error message
+]
+FALLBACK = 'lv_font_montserrat_16'   # Draws characters a subset lacks
+
+# Approximate sizes on the 32 bit target, for the flash report
+SIZEOF_GLYPH_DSC = 8
+SIZEOF_CMAP = 20
+SIZEOF_FONT = 64   # lv_font_t + lv_font_fmt_txt_dsc_t + kern classes
+
+
+def ui_chars():
+    chars = set()
+    for path in UI_SOURCES:
+        text = path.read_text(encoding='utf-8')
+        for line in text.splitlines():
+            if line.lstrip().startswith('#include'):
+                continue
+            for lit in re.findall(r'"((?:[^"\\\n]|\\.)*)"', line):
+                lit = re.sub(r'\\(x[0-9a-fA-F]{2}|.)', '', lit)   # Escapes are control characters
+                chars.update(lit)
+    return chars
+
+
+class SourceFont:
+    """Glyph tables parsed from an lv_font_conv generated C file (plain bitmaps)"""
+
+    def __init__(self, path):
+        text = path.read_text(encoding='utf-8')
+        self.name = path.stem
+        self.bpp = self._field(text, 'bpp')
+        if self._field(text, 'bitmap_format') != 0:
+            raise ValueError(f'{path}: compressed source fonts are not supported')
+        self.kern_scale = self._field(text, 'kern_scale')
+        self.line_height = self._field(text, 'line_height')
+        self.base_line = self._field(text, 'base_line')
+        self.underline_position = self._field(text, 'underline_position')
+        self.underline_thickness = self._field(text, 'underline_thickness')
+        self.bitmap = self._array(text, 'glyph_bitmap')
+        self.glyph_dsc = [tuple(int(v) for v in m) for m in re.findall(
+            r'\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), '
+            r'\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}', text)]
+        self.cmap = {}   # code point -> glyph id
+        for m in re.finditer(r'\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*'
+                             r'\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), '
+                             r'\.type = (\w+)', text):
+            start, length, gid0 = int(m[1]), int(m[2]), int(m[3])
+            if m[7] == 'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY':
+                for i in range(length):
+                    self.cmap[start + i] = gid0 + i
+            elif m[7] == 'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY':
+                for i, ofs in enumerate(self._array(text, m[4])):
+                    self.cmap[start + ofs] = gid0 + i
+            else:
+                raise ValueError(f'{path}: cmap type {m[7]} is not supported')
+        self.kern_left = self._array(text, 'kern_left_class_mapping')
+        self.kern_right = self._array(text, 'kern_right_class_mapping')
+        self.kern_values = self._array(text, 'kern_class_values')
+        self.left_cnt = self._field(text, 'left_class_cnt')
+        self.right_cnt = self._field(text, 'right_class_cnt')
+
+    @staticmethod
+    def _field(text, name):
+        return int(re.search(r'\.' + name + r'\s*=\s*(-?\d+)', text)[1])
+
+    @staticmethod
+    def _array(text, name):
+        body = re.search(name + r'\[\] = \{(.*?)\};', text, re.S)[1]
+        body = re.sub(r'/\*.*?\*/', '', body, flags=re.S)
+        return [int(v, 0) for v in body.replace('\n', ' ').split(',') if v.strip()]
+
+    def pixels(self, gid):
+        """Pixel values of a glyph, row by row"""
+        index, _, w, h, _, _ = self.glyph_dsc[gid]
+        bits = self.bpp
+        px = []
+        for i in range(w * h):
+            byte = self.bitmap[index + i * bits // 8]
+            shift = 8 - bits - (i * bits) % 8
+            px.append((byte >> shift) & ((1 << bits) - 1))
+        return px
+
+    def flash_bytes(self):
+        lists = sum(1 for cp in self.cmap if cp > 0x7E) * 2
+        return (len(self.bitmap) + len(self.glyph_dsc) * SIZEOF_GLYPH_DSC + 2 * SIZEOF_CMAP + lists +
+                len(self.kern_left) + len(self.kern_right) + len(self.kern_values) + SIZEOF_FONT)
+
+
+def requantize(px, src_bpp, bpp):
+    if bpp == src_bpp:
+        return px
+    top_src, top = (1 << src_bpp) - 1, (1 << bpp) - 1
+    return [(v * top + top_src // 2) // top_src for v in px]
+
+
+def pack(px, bpp):
+    out = bytearray((len(px) * bpp + 7) // 8)
+    for i, v in enumerate(px):
+        bit = i * bpp
+        out[bit // 8] |= v << (8 - bpp - bit % 8)
+    return bytes(out)
+
+
+class BitWriter:
+    def __init__(self):
+        self.bits = []
+
+    def put(self, value, n):
+        self.bits.extend((value >> (n - 1 - i)) & 1 for i in range(n))
+
+    def data(self):
+        out = bytearray((len(self.bits) + 7) // 8)
+        for i, b in enumerate(self.bits):
+            out[i // 8] |= b << (7 - i % 8)
+        return bytes(out)
+
+
+def compress(px, w, bpp):
+    """RLE of the prefiltered lines as read by rle_next() in lv_font_fmt_txt.c: a literal equal to the
+    previous one starts a repeat; then one 1 bit per repeated pixel, after 10 of them a 6 bit count,
+    and a 0 bit or the end of a count is followed by the next literal."""
+    v = list(px)
+    for i in range(len(v) - 1, w - 1, -1):   # Prefilter: XOR with the line above
+        v[i] ^= px[i - w]
+    out = BitWriter()
+    single, prev, cnt, i, n = True, 0, 0, 0, len(v)
+    while i < n:
+        if single:
+            out.put(v[i], bpp)
+            if i and v[i] == prev:
+                single, cnt = False, 0
+            prev = v[i]
+            i += 1
+            continue
+        if v[i] != prev:
+            out.put(0, 1)
+            out.put(v[i], bpp)
+            prev, single = v[i], True
+            i += 1
+            continue
+        cnt += 1
+        out.put(1, 1)
+        if cnt < 11:
+            i += 1
+            continue
+        run = 0
+        while i + run < n and v[i + run] == prev and run < 63:
+            run += 1
+        out.put(run, 6)   # `run` repeats including this one, then a literal
+        i += run
+        if i < n:
+            out.put(v[i], bpp)
+            prev = v[i]
+            i += 1
+        single = True
+    return out.data()
+
+
+def decompress(data, w, h, bpp):
+    """Python model of lv_font_fmt_txt.c's decompress(), to check compress()"""
+    def bits(pos, n):
+        return sum(((data[(pos + k) // 8] >> (7 - (pos + k) % 8)) & 1 if (pos + k) // 8 < len(data) else 0)
+                   << (n - 1 - k) for k in range(n))
+    out, rdp, state, prev, cnt = [], 0, 0, 0, 0
+    for _ in range(w * h):
+        if state == 0:
+            ret = bits(rdp, bpp)
+            if rdp != 0 and prev == ret:
+                cnt, state = 0, 1
+            prev = ret
+            rdp += bpp
+        elif state == 1:
+            b = bits(rdp, 1)
+            cnt += 1
+            rdp += 1
+            if b:
+                ret = prev
+                if cnt == 11:
+                    cnt = bits(rdp, 6)
+                    rdp += 6
+                    if cnt:
+                        state = 2
+                    else:
+                        ret = prev = bits(rdp, bpp)
+                        rdp += bpp
+                        state = 0
+            else:
+                ret = prev = bits(rdp, bpp)
+                rdp += bpp
+                state = 0
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = prev = bits(rdp, bpp)
+                rdp += bpp
+                state = 0
+        out.append(ret)
+    for i in range(w, len(out)):
+        out[i] ^= out[i - w]
+    return out
+
+
+def c_array(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(fmt(v) for v in values[i:i + per_line]))
+    return ',\n'.join(lines)
+
+
+def describe(cp):
+    ch = chr(cp)
+    return '\\\\' if ch == '\\' else ch
+
+
+def build_font(spec, ui):
+    size, bpp, compressed = spec['size'], spec['bpp'], spec['compress']
+    src = SourceFont(SRC_FONTS / f'lv_font_montserrat_{size}.c')
+    if spec['chars'] == 'ui':
+        chars = ui | set(BASE_CHARS)
+    elif spec['chars'] == 'ascii':
+        chars = set(ASCII_CHARS)
+    else:
+        chars = set(spec['chars'])
+    chars.add(' ')   # '\t' is drawn as a space
+    missing = sorted(c for c in chars if ord(c) not in src.cmap)
+    cps = sorted(ord(c) for c in chars if ord(c) in src.cmap)
+    name = f'ui_font_montserrat_{size}'
+
+    # Code points: runs of 3 or more as format 0, the rest in one sparse list searched last (a sparse
+    # range that matches returns even if the code point is not in the list)
+    runs, singles, k = [], [], 0
+    while k < len(cps):
+        j = k
+        while j + 1 < len(cps) and cps[j + 1] == cps[j] + 1:
+            j += 1
+        if j - k >= 2:
+            runs.append(cps[k:j + 1])
+        else:
+            singles.extend(cps[k:j + 1])
+        k = j + 1
+    order = [cp for run in runs for cp in run] + singles   # Glyph ids from 1; 0 is reserved
+
+    bitmap, dsc, src_gids, bitmap_lines = bytearray(), [(0, 0, 0, 0, 0, 0)], [0], []
+    for cp in order:
+        gid = src.cmap[cp]
+        _, adv_w, w, h, ofs_x, ofs_y = src.glyph_dsc[gid]
+        px = requantize(src.pixels(gid), src.bpp, bpp)
+        if compressed and w * h:
+            data = compress(px, w, bpp)
+            assert decompress(data, w, h, bpp) == px, f'{name} U+{cp:04X}: RLE round trip failed'
+        else:
+            data = pack(px, bpp)
+        dsc.append((len(bitmap), adv_w, w, h, ofs_x, ofs_y))
+        src_gids.append(gid)
+        bitmap_lines.append(f'    /* U+{cp:04X} "{describe(cp)}" */')
+        if data:
+            bitmap_lines.append(c_array(list(data), 8, hex) + ',')
+        bitmap_lines.append('')
+        bitmap += data
+    if compressed:
+        # The decoder reads a byte ahead when a value ends on a byte boundary
+        bitmap_lines.append('    /* Padding */')
+        bitmap_lines.append('    0x0')
+        bitmap += b'\0'
+
+    cmap_src, cmap_entries, gid0 = [], [], 1
+    for run in runs:
+        cmap_entries.append(f'    {{\n        .range_start = {run[0]}, .range_length = {len(run)}, .glyph_id_start = {gid0},\n'
+                            f'        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, '
+                            f'.type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n    }}')
+        gid0 += len(run)
+    sparse = [cp - singles[0] for cp in singles]
+    if singles:
+        cmap_src.append(f'static const uint16_t unicode_list_{len(runs)}[] = {{\n'
+                        f'{c_array(sparse, 8, hex)}\n}};\n')
+        cmap_entries.append(f'    {{\n        .range_start = {singles[0]}, .range_length = {sparse[-1] + 1}, '
+                            f'.glyph_id_start = {gid0},\n'
+                            f'        .unicode_list = unicode_list_{len(runs)}, .glyph_id_ofs_list = NULL, '
+                            f'.list_length = {len(sparse)}, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY\n    }}')
+
+    # Kerning: keep the classes used by the subset, renumbered
+    left = [src.kern_left[g] for g in src_gids]
+    right = [src.kern_right[g] for g in src_gids]
+    used_l = sorted(set(c for c in left if c))
+    used_r = sorted(set(c for c in right if c))
+    map_l = {c: i + 1 for i, c in enumerate(used_l)}
+    map_r = {c: i + 1 for i, c in enumerate(used_r)}
+    left = [map_l.get(c, 0) for c in left]
+    right = [map_r.get(c, 0) for c in right]
+    values = [src.kern_values[(l - 1) * src.right_cnt + (r - 1)] for l in used_l for r in used_r]
+    kern = bool(values) and any(values)
+
+    flash = (len(bitmap) + len(dsc) * SIZEOF_GLYPH_DSC + len(cmap_entries) * SIZEOF_CMAP +
+             len(sparse) * 2 + (len(left) + len(right) + len(values) if kern else 0) + SIZEOF_FONT)
+    chars_desc = ''.join(chr(cp) for cp in cps).replace('*/', '* /')
+
+    out = []
+    out.append(f'''/*******************************************************************************
+ * Size: {size} px
+ * Bpp: {bpp}
+ * Opts: generated by generate_ui_fonts.py from lv_font_montserrat_{size}.c, {"RLE compressed" if compressed else "plain"}
+ * Characters: {chars_desc}
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {{
+''')
+    out.append('\n'.join(bitmap_lines).rstrip().rstrip(',') + '\n};\n')
+    out.append('''
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+''')
+    rows = []
+    for i, (index, adv_w, w, h, ox, oy) in enumerate(dsc):
+        row = f'    {{.bitmap_index = {index}, .adv_w = {adv_w}, .box_w = {w}, .box_h = {h}, .ofs_x = {ox}, .ofs_y = {oy}}}'
+        rows.append(row + (' /* id = 0 reserved */' if i == 0 else ''))
+    out.append(',\n'.join(rows) + '\n};\n')
+    out.append('''
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+''')
+    out.append('\n'.join(cmap_src))
+    out.append('\n/*Collect the unicode lists and glyph_id offsets*/\n'
+               'static const lv_font_fmt_txt_cmap_t cmaps[] = {\n' + ',\n'.join(cmap_entries) + '\n};\n')
+    if kern:
+        out.append(f'''
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {{
+{c_array(left, 8, str)}
+}};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {{
+{c_array(right, 8, str)}
+}};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {{
+{c_array(values, 8, str)}
+}};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {{
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = {len(used_l)},
+    .right_class_cnt     = {len(used_r)},
+}};
+''')
+    out.append(f'''
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {{
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = {"&kern_classes" if kern else "NULL"},
+    .kern_scale = {src.kern_scale if kern else 0},
+    .cmap_num = {len(cmap_entries)},
+    .bpp = {bpp},
+    .kern_classes = {1 if kern else 0},
+    .bitmap_format = {1 if compressed else 0},
+    .cache = &cache
+}};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t {name} = {{
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = {src.line_height},          /*The maximum line height required by the font*/
+    .base_line = {src.base_line},             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = {src.underline_position},
+    .underline_thickness = {src.underline_thickness},
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &{FALLBACK},   /*Characters outside the subset*/
+}};
+''')
+    info = dict(name=name, size=size, bpp=bpp, compressed=compressed, glyphs=len(cps), flash=flash,
+                full_flash=src.flash_bytes(), full_glyphs=len(src.cmap), missing=missing)
+    return ''.join(out), info
+
+
+def header(infos):
+    lines = ['// Auto-generated by generate_ui_fonts.py. Do not edit.',
+             '// Subsets of lib/lvgl/src/font/lv_font_montserrat_<size>.c with the characters the UI shows;',
+             '// others are drawn with the fallback font. Flash bytes are estimates for the 32 bit target.',
+             '#pragma once',
+             '',
+             '#include <lvgl.h>',
+             '',
+             '#ifdef __cplusplus',
+             'extern "C" {',
+             '#endif',
+             '']
+    for i in infos:
+        lines.append(f'// {i["size"]} px, {i["bpp"]} bpp{", compressed" if i["compressed"] else ""}: '
+                     f'{i["glyphs"]} of {i["full_glyphs"]} glyphs, {i["flash"]} of {i["full_flash"]} bytes')
+        lines.append(f'LV_FONT_DECLARE({i["name"]})')
+        lines.append(f'#define {i["name"].upper()}_BYTES      {i["flash"]}')
+        lines.append(f'#define {i["name"].upper()}_FULL_BYTES {i["full_flash"]}')
+        lines.append('')
+    if any(i['compressed'] for i in infos):
+        lines += ['#if !LV_USE_FONT_COMPRESSED',
+                  '#error "Compressed UI fonts need LV_USE_FONT_COMPRESSED 1 in lv_conf.h"',
+                  '#endif',
+                  '']
+    lines += ['#ifdef __cplusplus',
+              '} /*extern "C"*/',
+              '#endif',
+              '']
+    return '\n'.join(lines)
+
+
+def write(path, content):
+    if path.exists() and path.read_text(encoding='utf-8') == content:
+        return False
+    path.write_text(content, encoding='utf-8')
+    return True
+
+
+def main():
+    OUT.mkdir(parents=True, exist_ok=True)
+    ui = ui_chars()
+    infos, changed = [], 0
+    for spec in FONTS:
+        src, info = build_font(spec, ui)
+        changed += write(OUT / f'{info["name"]}.c', src)
+        infos.append(info)
+        if info['missing']:
+            print(f'[fonts] {info["name"]}: not in the source font, drawn with {FALLBACK}: '
+                  f'{"".join(info["missing"])!r}')
+    changed += write(OUT / 'ui_fonts.h', header(infos))
+    if changed:
+        for i in infos:
+            print(f'[fonts] {i["name"]}: {i["glyphs"]} glyphs {i["bpp"]} bpp{" RLE" if i["compressed"] else ""}, '
+                  f'{i["flash"]} B (full font {i["full_flash"]} B)')
+        print(f'[fonts] Wrote {OUT}')
+
+
+if __name__ == '__main__':
+    main()
@@ -27,6 +27,19 @@
 #define DISPLAY_BL_PWM_CHANNEL 0
 #define DISPLAY_BL_PWM_FREQ 5000
 #define DISPLAY_BL_PWM_RESOLUTION 8
+#define DISPLAY_BL_GAMMA 2.2f           // Perceived brightness -> PWM duty
+#define DISPLAY_DIM_AFTER_MS 60000      // Idle (no touch) time before dimming
+#define DISPLAY_OFF_AFTER_MS 300000     // Idle time before backlight off and rendering suspended
+#define DISPLAY_DIM_LEVEL 20            // Dimmed perceived brightness, %
+#define DISPLAY_FADE_MS 400             // Length of a full 0..100 % backlight fade
+#define DISPLAY_FADE_STEP_MS 15         // Backlight update period during a fade
+#define DISPLAY_FLIP_TIMEOUT_MS 50      // Direct mode: longest wait for VSYNC before forcing the flip
+#define DISPLAY_DRAW_BUF_STRATEGY DRAW_BUF_DIRECT   // Boot-time draw buffers (see DrawBufferStrategy)
+#define DISPLAY_DRAW_BUF_LINES 48       // Band height for the band strategies (48 = old 1/10 frame)
+#define DISPLAY_DRAW_BUF_MIN_LINES 8    // Smaller bands fall back to PSRAM
+#define DISPLAY_SRAM_RESERVE_BYTES (64 * 1024)  // Internal RAM left for stacks, WiFi and drivers
+#define FRAME_PROFILE_FRAMES 128        // Rendered frames kept for the per-frame profile (~4 s at 30 FPS)
+#define INPUT_LATENCY_TARGET_MS 50      // Touch to visual response (docs/Master_Implementation_Log.md)
 
 // I2C Configuration (Critical for Type B)
 #define I2C_SDA_PIN 8
@@ -47,10 +60,18 @@
 // Touch Configuration
 #define TOUCH_IRQ_PIN 4
 #define TOUCH_MAX_POINTS 5
+#define TOUCH_QUEUE_DEPTH 16         // GT911 reports buffered between the touch task and LVGL
+#define TOUCH_RELEASE_POLL_MS 60     // Poll while a finger is down in case a release IRQ is missed
 
 // Temperature Sensor Configuration
 // Note: GPIO 15 is conflicted with display B7, using GPIO 33 instead
 #define DS18B20_PIN 33
+// Additional 1-Wire buses (walk-in rooms): list every bus pin, first entry is the primary bus
+#define DS18B20_BUS_PINS { DS18B20_PIN }
+#define MAX_ONEWIRE_BUSES 4
+#define MAX_PROBES_PER_BUS 32
+#define MAX_REGISTRY_SENSORS 64   // All probes across all buses (SensorRegistry capacity)
+#define MAX_SENSOR_ZONES 16
 
 // DHT Sensor Configuration
 #define DHT_PIN 32              // DHT22 sensor pin
@@ -63,9 +84,21 @@
 #ifndef DEBUG_MODE
 #define DEBUG_MODE
 #endif
-#define MAX_SENSORS 4
+#define MAX_SENSORS 4           // Probes averaged by one controller (per zone)
+// Control zones (ZoneManager): one TemperatureController per cold room, stepped by the control task.
+// Per zone: { sensor zone, { relay bank, compressor line, heater line, fan line } }; bank n is the
+// PCF8574 at PCF8574_ADDRESS + n, lines are 0..7 or ZONE_RELAY_NONE.
+#define MAX_CONTROL_ZONES 16
+#define MAX_RELAY_BANKS 8
+#define CONTROL_ZONES { { 0, { 0, 0, 2, 3 } } }
 #define TEMP_READ_INTERVAL 1000 // ms
 #define SENSOR_TIMEOUT 5000     // ms
+#define DS18B20_DEFAULT_RESOLUTION 12  // bits (9..12); per-sensor override via TemperatureSensor::setResolution
+#define DS18B20_CRC_RETRIES 2           // Scratchpad re-reads after a CRC failure before the reading is dropped
+// Per-probe filter defaults (every zone; override with SensorRegistry::setZoneFilter)
+#define SENSOR_FILTER_MEDIAN_WINDOW 3       // Samples (odd); 1 = off
+#define SENSOR_FILTER_EMA_ALPHA 0.5f        // Weight of the new sample; 1 = off
+#define SENSOR_FILTER_MAX_RATE_C_PER_S 0.5f // Clamp on the per-second change; 0 = off
 
 // Control Pins (using available GPIOs)
 #define RELAY_HEAT_PIN 34       // USER_GPIO_2
@@ -90,6 +123,7 @@
 #define FAULT_DEBOUNCE_MS 5000                // Generic debounce for persistent condition (5s)
 #define SENSOR_MISSING_DEBOUNCE_MS 3000       // Time without any valid sensor before fault
 #define RANGE_FAULT_DEBOUNCE_MS 1000          // Out-of-safe-range persistence
+#define FAULT_CLEAR_DEBOUNCE_MS 5000          // Sensor missing / range faults must be resolved this long before clearing
 #define DEFROST_TIMEOUT_GRACE_MS 60000        // Additional grace after configured duration before timeout fault
 #define MIN_COMPRESSOR_OFF_TIME_MS 180000     // 3 minutes minimum off time (short cycle protection)
 #define MIN_COMPRESSOR_ON_TIME_MS 60000       // 1 minute minimum on time (avoid rapid toggling)
@@ -102,6 +136,8 @@
   #define SENSOR_MISSING_DEBOUNCE_MS 30
   #undef RANGE_FAULT_DEBOUNCE_MS
   #define RANGE_FAULT_DEBOUNCE_MS 30
+  #undef FAULT_CLEAR_DEBOUNCE_MS
+  #define FAULT_CLEAR_DEBOUNCE_MS 30
   #undef DEFROST_TIMEOUT_GRACE_MS
   #define DEFROST_TIMEOUT_GRACE_MS 120
   #undef MIN_COMPRESSOR_OFF_TIME_MS
@@ -116,6 +152,9 @@
   #define TEMP_UPDATE_INTERVAL 50
 #endif
 
+// Controller event stream (SpscRing, PSRAM-backed): entries buffered between logTask drains
+#define CONTROLLER_EVENT_RING_CAPACITY 1024
+
 // Alarm System Timing
 #define ALARM_TRIGGER_GRACE_MS 60000          // Over/under temp fault must persist this long before escalating to alarm state
 #define ALARM_SILENCE_DURATION_MS 900000      // 15 minutes silence period default
@@ -7,6 +7,23 @@
 // When enabled, uses real ESP32-S3 RGB panel (LovyanGFX Bus_RGB + Panel_RGB)
 // When disabled, a stub LGFX placeholder compiles for logic/UI development.
 #define ENABLE_RGB_PANEL  // Real RGB bus enabled after lgfx_rgb.h refactor
+// LVGL draws directly into two full-frame panel framebuffers flipped at VSYNC (requires
+// ENABLE_RGB_PANEL). Falls back to partial buffers + flush copy if the bus layout is not usable.
+#define ENABLE_LVGL_DIRECT_MODE
+// Partial-buffer mode: band copies run on a flush task on the other core and signal
+// lv_disp_flush_ready() when done, so LVGL renders the next band while the previous one transfers
+#define ENABLE_ASYNC_FLUSH
+// Each refresh is split into row bands (LV_REFR_BAND_UNITS in lv_conf.h): a band task on CORE_APP
+// renders one share while the LVGL task renders the other, in both direct and partial-buffer mode
+#define ENABLE_PARALLEL_RENDER
+// lvglTask sleeps until lv_timer_handler()'s next deadline, a touch IRQ or a display.unlock()
+// instead of running every PERIOD_LVGL; the touch read timer is paused while nothing is pressed
+#define ENABLE_ADAPTIVE_LVGL_PACING
+// Dim after DISPLAY_DIM_AFTER_MS idle, switch off after DISPLAY_OFF_AFTER_MS: backlight faded out,
+// lv_timer_handler() and the panel scan-out stopped until the next touch (or DisplayDriver::wake())
+#define ENABLE_DISPLAY_POWER
+// Print a render throughput table for every draw buffer strategy at boot (DisplayDriver::benchmarkDrawBuffers)
+// #define DISPLAY_BENCHMARK_AT_BOOT
 
 // Touch (GT911) input
 #define ENABLE_TOUCH 1
@@ -32,3 +49,8 @@
 
 // Diagnostic performance overlay (FPS, heap, touch events)
 #define ENABLE_DIAG_OVERLAY
+
+// Host (native) builds of the UI: the overlay reads board-only metrics (DisplayDriver, heap caps)
+#ifdef UNIT_TEST_NATIVE
+#undef ENABLE_DIAG_OVERLAY
+#endif
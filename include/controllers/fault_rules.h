@@ -0,0 +1,125 @@
+#pragma once
+// Table-driven fault evaluation.
+// Each rule is a set predicate, a clear predicate (hysteresis), a debounce for each direction and an
+// event code. The controller reduces its sensor inputs to one FaultInputs record per cycle and
+// evaluateFaultRules() makes a single pass over the table: an inactive fault arms its timer while
+// the set predicate holds and latches after setDebounceMs; an active fault arms its timer while the
+// clear predicate holds and releases after clearDebounceMs. Bits not named by a rule are untouched
+// (the compressor short-cycle fault is driven by gateShortCycle()).
+
+#include <stdint.h>
+#include "types/types.h"
+
+// Per-cycle inputs shared by every rule (computed once, in one pass over the sensors)
+struct FaultInputs {
+    float avgTemp;          // Mean of valid probes (0 when none)
+    float minTemp;          // Coldest / warmest valid probe
+    float maxTemp;
+    uint8_t validCount;
+    float targetTemp;
+    float hysteresis;
+    bool defrostActive;
+    uint32_t defrostElapsedMs;
+    uint32_t defrostLimitMs;   // Configured duration + DEFROST_TIMEOUT_GRACE_MS
+};
+
+typedef bool (*FaultPredicate)(const FaultInputs& in);
+
+struct FaultRule {
+    FaultCodeBits bit;
+    FaultPredicate set;
+    FaultPredicate clear;
+    uint32_t setDebounceMs;
+    uint32_t clearDebounceMs;
+    uint16_t eventCode;        // Logged when the fault latches; eventCode | FAULT_EVENT_CLEARED on release
+};
+
+struct FaultRuleTimer {
+    uint32_t since;            // Start of the pending transition
+    bool pending;
+};
+
+constexpr uint16_t FAULT_EVENT_CLEARED = 0x0100;
+
+// One pass over rules[0..n). Updates mask and timers; onEvent(code) fires for every latch/release.
+// Returns the mask bits that changed.
+template <typename EventFn>
+uint32_t evaluateFaultRules(const FaultRule* rules, uint8_t n, FaultRuleTimer* timers,
+                            const FaultInputs& in, uint32_t nowMs, uint32_t& mask, EventFn onEvent) {
+    uint32_t changed = 0;
+    for (uint8_t i = 0; i < n; ++i) {
+        const FaultRule& r = rules[i];
+        FaultRuleTimer& t = timers[i];
+        const uint32_t bit = FaultBit(r.bit);
+        const bool active = (mask & bit) != 0;
+        if (!(active ? r.clear(in) : r.set(in))) {
+            t.pending = false;
+            continue;
+        }
+        if (!t.pending) {
+            t.pending = true;
+            t.since = nowMs;
+        }
+        if (nowMs - t.since < (active ? r.clearDebounceMs : r.setDebounceMs)) continue;
+        mask ^= bit;
+        changed |= bit;
+        t.pending = false;
+        onEvent((uint16_t)(active ? (r.eventCode | FAULT_EVENT_CLEARED) : r.eventCode));
+    }
+    return changed;
+}
+
+// Earliest time a pending transition completes, relative to nowMs; maxWaitMs when none is pending
+inline uint32_t faultRulesNextDeadline(const FaultRule* rules, uint8_t n, const FaultRuleTimer* timers,
+                                       uint32_t mask, uint32_t nowMs, uint32_t maxWaitMs) {
+    uint32_t wait = maxWaitMs;
+    for (uint8_t i = 0; i < n; ++i) {
+        if (!timers[i].pending) continue;
+        uint32_t debounce = (mask & FaultBit(rules[i].bit)) ? rules[i].clearDebounceMs : rules[i].setDebounceMs;
+        uint32_t elapsed = nowMs - timers[i].since;
+        uint32_t remaining = elapsed >= debounce ? 0 : debounce - elapsed;
+        if (remaining < wait) wait = remaining;
+    }
+    return wait;
+}
+
+namespace fault_rules {
+
+inline bool sensorMissing(const FaultInputs& in) { return in.validCount == 0; }
+inline bool sensorPresent(const FaultInputs& in) { return in.validCount > 0; }
+inline bool outOfRange(const FaultInputs& in) {
+    return in.validCount && (in.minTemp < TEMP_MIN_SAFE || in.maxTemp > TEMP_MAX_SAFE);
+}
+inline bool inRange(const FaultInputs& in) { return in.validCount && !outOfRange(in); }
+inline bool overTemp(const FaultInputs& in) {
+    return in.validCount && in.avgTemp > in.targetTemp + OVER_TEMPERATURE_MARGIN;
+}
+// Over/under release once back within half the hysteresis band of the target
+inline bool overTempResolved(const FaultInputs& in) {
+    return in.validCount && in.avgTemp <= in.targetTemp + in.hysteresis * 0.5f;
+}
+inline bool underTemp(const FaultInputs& in) {
+    return in.validCount && in.avgTemp < in.targetTemp - UNDER_TEMPERATURE_MARGIN;
+}
+inline bool underTempResolved(const FaultInputs& in) {
+    return in.validCount && in.avgTemp >= in.targetTemp - in.hysteresis * 0.5f;
+}
+inline bool defrostOverrun(const FaultInputs& in) { return in.defrostActive && in.defrostElapsedMs > in.defrostLimitMs; }
+inline bool defrostEnded(const FaultInputs& in) { return !in.defrostActive; }
+
+} // namespace fault_rules
+
+// Controller rule table (evaluation order = table order)
+constexpr FaultRule FAULT_RULES[] = {
+    {FAULT_SENSOR_MISSING_BIT,    fault_rules::sensorMissing,  fault_rules::sensorPresent,
+     SENSOR_MISSING_DEBOUNCE_MS, FAULT_CLEAR_DEBOUNCE_MS, 0xF000 | FAULT_SENSOR_MISSING_BIT},
+    {FAULT_SENSOR_RANGE_BIT,      fault_rules::outOfRange,     fault_rules::inRange,
+     RANGE_FAULT_DEBOUNCE_MS, FAULT_CLEAR_DEBOUNCE_MS, 0xF000 | FAULT_SENSOR_RANGE_BIT},
+    {FAULT_OVER_TEMPERATURE_BIT,  fault_rules::overTemp,       fault_rules::overTempResolved,
+     FAULT_DEBOUNCE_MS, 0, 0xF000 | FAULT_OVER_TEMPERATURE_BIT},
+    {FAULT_UNDER_TEMPERATURE_BIT, fault_rules::underTemp,      fault_rules::underTempResolved,
+     FAULT_DEBOUNCE_MS, 0, 0xF000 | FAULT_UNDER_TEMPERATURE_BIT},
+    {FAULT_DEFROST_TIMEOUT_BIT,   fault_rules::defrostOverrun, fault_rules::defrostEnded,
+     FAULT_DEBOUNCE_MS, 0, 0xF000 | FAULT_DEFROST_TIMEOUT_BIT},
+};
+constexpr uint8_t FAULT_RULE_COUNT = sizeof(FAULT_RULES) / sizeof(FAULT_RULES[0]);
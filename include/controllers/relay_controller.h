@@ -31,11 +31,12 @@ enum RelayLine : uint8_t {
 
 class RelayController {
 public:
-    RelayController() : _bus(nullptr), _present(false), _shadow(0xFF) {}
+    // Bank n of a multi-zone installation sits at PCF8574_ADDRESS + n (A0..A2 straps)
+    explicit RelayController(uint8_t address = PCF8574_ADDRESS) : _bus(nullptr), _address(address), _present(false), _shadow(0xFF) {}
 
     bool begin(TwoWire &bus = Wire) {
         _bus = &bus;
-        _bus->beginTransmission(PCF8574_ADDRESS);
+        _bus->beginTransmission(_address);
         if (_bus->endTransmission() == 0) {
             _present = true;
             _shadow = 0xFF; // all HIGH (inactive)
@@ -66,6 +67,24 @@ public:
         return (_shadow & (1 << bit)) == 0; // LOW = ON
     }
 
+    // Sets every line at once (bit n = line n energised); one I2C write, skipped when unchanged
+    void setMask(uint8_t onMask) {
+        if (!_present) return;
+        uint8_t shadow = (uint8_t)~onMask;
+        if (shadow == _shadow) return;
+        _shadow = shadow;
+        writeShadow();
+    }
+
+    // Sets only the lines in `lines` (bit n = line n), leaving the others as they are
+    void setLines(uint8_t lines, uint8_t onMask) {
+        if (!_present) return;
+        uint8_t shadow = (uint8_t)((_shadow & ~lines) | (~onMask & lines));
+        if (shadow == _shadow) return;
+        _shadow = shadow;
+        writeShadow();
+    }
+
     void allOff() {
         if (!_present) return;
         _shadow = 0xFF;
@@ -76,12 +95,13 @@ public:
 
 private:
     TwoWire *_bus;
+    uint8_t _address;
     bool _present;
     uint8_t _shadow; // Active LOW bitmap
 
     void writeShadow() {
         if (!_bus) return;
-        _bus->beginTransmission(PCF8574_ADDRESS);
+        _bus->beginTransmission(_address);
         _bus->write(_shadow);
         _bus->endTransmission();
     }
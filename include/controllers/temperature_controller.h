@@ -8,6 +8,9 @@
 #endif
 #include "types/types.h"
 #include "config/config.h"
+#include "rtos/seqlock.h"
+#include "rtos/event_ring.h"
+#include "controllers/fault_rules.h"
 
 class TemperatureController {
 public:
@@ -16,6 +19,11 @@ public:
     bool init();
     void update(const SensorData& sensor);
     void updateWithMultipleSensors(const SensorData sensors[], uint8_t count);
+    // Unthrottled control pass for event-driven callers (new sample or expired deadline)
+    void runControlCycle(const SensorData sensors[], uint8_t count);
+    // Time until the next hard deadline (min compressor on/off, defrost start/end, fault debounce,
+    // alarm grace/silence, buzzer phase). 0 = due now; capped at maxWaitMs.
+    uint32_t msUntilNextDeadline(uint32_t maxWaitMs) const;
     void setMode(SystemMode mode);
     void setTargetTemperature(float temp);
     void setTargetTemperatureFull(float temp) { setTargetTemperature(temp); }
@@ -29,27 +37,41 @@ public:
     bool hasFault() const { return _state.faultMask != 0 || _state.status == STATUS_ERROR; }
     bool faultActive(uint32_t bit) const { return (_state.faultMask & bit) != 0; }
     
-    // Getters
-    SystemConfig getConfig() const { return _config; }
-    ControlState getState() const { return _state; }
+    // Getters – torn-free snapshots for other tasks/cores (seqlock, no mutex on the control path)
+    SystemConfig getConfig() const { return _configPub.read(); }
+    ControlState getState() const { return _statePub.read(); }
+    uint32_t getStateSequence() const { return _statePub.sequence(); }
     bool isDefrosting() const { return _state.defrostActive; }
-    void evaluateFaults(const SensorData sensors[], uint8_t count);
-    void clearResolvedFaults();
-    void silenceAlarm();
+    // Buzzer pattern phase right now (alarm active, not silenced, buzzer enabled); control task only
+    bool buzzerOn() const;
+    // Which shared pins updateOutputs() writes (both by default). ZoneManager keeps the GPIO relays
+    // on zone 0 only and drives the buzzer itself from every zone's buzzerOn().
+    void setPinOutputs(bool relayPins, bool buzzerPin) { _relayPins = relayPins; _buzzerPin = buzzerPin; }
+    void silenceAlarm();   // Request only; applied by the next control cycle (single writer of _state)
 
     // Alarm / Fault event record
     struct EventRecord {
         unsigned long ts;
         uint32_t mask;      // snapshot of fault mask
-        uint16_t code;      // reserved for future (alarm type)
+        uint16_t code;      // 0xA1xx alarm, 0xF0xx fault (see fault_rules.h)
     };
-    static constexpr size_t EVENT_LOG_SIZE = 32;
-    size_t getEventLogCount() const { return _eventCount; }
-    EventRecord getEvent(size_t idx) const { return _eventLog[idx % EVENT_LOG_SIZE]; }
+    typedef SpscRing<EventRecord>::Entry EventEntry;
+    // Event stream: the control task produces, one consumer task (logTask) drains in batches.
+    // Sequence numbers are gap-free except where dropped() counts a full-ring overflow.
+    size_t drainEvents(EventEntry out[], size_t max) { return _events.drain(out, max); }
+    uint32_t eventSequence() const { return _events.nextSequence(); }   // Events produced so far
+    uint32_t eventsDropped() const { return _events.dropped(); }
+    uint32_t eventCapacity() const { return _events.capacity(); }
     
 private:
     SystemConfig _config;
     ControlState _state;
+    // Published copies: _state by the control task at the end of each cycle, _config by the setters
+    SeqLock<ControlState> _statePub;
+    SeqLock<SystemConfig> _configPub;
+    std::atomic<bool> _silenceRequested {false};
+    bool _relayPins = true;
+    bool _buzzerPin = true;
     
     // PID control variables
     float _pidLastError;
@@ -63,22 +85,21 @@ private:
     unsigned long _lastCompressorChange;
     unsigned long _lastCoolingRequest;
     unsigned long _lastHeatingRequest;
-    // Fault debounce timers
-    unsigned long _overTempSince;
-    unsigned long _underTempSince;
-    unsigned long _sensorMissingSince;
-    unsigned long _rangeFaultSince;
-    unsigned long _defrostOverrunSince;
+    unsigned long _coolingHeldUntil;   // Cooling demand waiting out the min off time (0 = none)
+    // Debounce timers, one per FAULT_RULES entry
+    FaultRuleTimer _faultTimers[FAULT_RULE_COUNT];
 
-    // Event log
-    EventRecord _eventLog[EVENT_LOG_SIZE];
-    size_t _eventHead = 0;
-    size_t _eventCount = 0;
+    // Event stream (PSRAM-backed on target)
+    SpscRing<EventRecord> _events;   // Storage allocated by init(), not the (static) constructor
 
     void logEvent(uint16_t code);
+    void applySilenceRequest();
 
     // Internal helpers
-    bool hasValidSensor(const SensorData sensors[], uint8_t count) const;
+    FaultInputs gatherFaultInputs(const SensorData sensors[], uint8_t count) const;   // One pass over the probes
+    void evaluateFaults(const FaultInputs& in);
+    // Every compressor on/off request goes through here: starts wait out the min off time,
+    // stops the min on time
     void gateShortCycle(bool wantCooling);
     
     // Private methods
@@ -89,11 +110,9 @@ private:
     void activateCooling(bool enable);
     void activateFan(uint8_t speed);
     void updateOutputs();
-    void safetyCheck(const SensorData sensors[], uint8_t count);
     void updateFault(uint32_t bit, bool active);
     void clearAllFaults();
     float calculatePID(float error);
-    float calculateAverageTemp(const SensorData sensors[], uint8_t count);
     bool shouldStartDefrost();
 };
 
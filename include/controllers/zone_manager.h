@@ -0,0 +1,113 @@
+#ifndef ZONE_MANAGER_H
+#define ZONE_MANAGER_H
+
+// Runs up to MAX_CONTROL_ZONES independent TemperatureController instances (one per cold room) from
+// the single control task. Each zone has its own config, faults, defrost and event stream, reads one
+// registry sensor zone and drives three lines on one relay bank.
+// The per-cycle scan only touches the hot columns (due time, last sample time, pending bits, relay
+// bytes); a controller is stepped only when its zone has a fresh sample or one of its deadlines
+// expired. Zone 0 is the global `controller` that the UI and logging already read.
+// Shared outputs: only zone 0 drives the GPIO relay pins, the buzzer sounds when any zone's alarm
+// does (written once per step), and each zone only owns the bank lines it maps.
+
+#ifdef UNIT_TEST_NATIVE
+#include "test_support/arduino_stub.h"
+#include <chrono>
+#else
+#include <Arduino.h>
+#endif
+#include "types/types.h"
+#include "config/config.h"
+#include "controllers/temperature_controller.h"
+
+constexpr uint8_t ZONE_RELAY_NONE = 0xFF;
+
+// Relay wiring of one zone: expander bank (PCF8574_ADDRESS + bank) and line per output
+struct ZoneRelayMap {
+    uint8_t bank;
+    uint8_t compressor;
+    uint8_t heater;
+    uint8_t fan;
+};
+
+struct ZoneSetup {
+    uint8_t sensorZone;     // SensorRegistry zone feeding this controller
+    ZoneRelayMap relays;
+};
+
+// Update cost per zone in cost ticks (CPU cycles on target, ns on host); see ZoneManager::ticksPerUs()
+struct ZoneCost {
+    uint32_t steps;
+    uint32_t lastTicks;
+    uint32_t maxTicks;
+    uint64_t totalTicks;
+};
+
+class ZoneManager {
+public:
+    static constexpr uint8_t CAPACITY = MAX_CONTROL_ZONES;
+    static constexpr uint8_t NO_ZONE = 0xFF;
+
+    ZoneManager();
+    ~ZoneManager();
+    ZoneManager(const ZoneManager&) = delete;
+    ZoneManager& operator=(const ZoneManager&) = delete;
+
+    // Setup only (before the control task starts). Zone 0 is the global controller; later zones get
+    // their own controller, allocated once here. Returns the zone index or NO_ZONE when full.
+    uint8_t addZone(const ZoneSetup& setup);
+    uint8_t count() const { return _count; }
+    TemperatureController& zone(uint8_t z) { return *_ctl[z]; }
+    const TemperatureController& zone(uint8_t z) const { return *_ctl[z]; }
+    uint8_t sensorZone(uint8_t z) const { return _setup[z].sensorZone; }
+    const ZoneRelayMap& relayMap(uint8_t z) const { return _setup[z].relays; }
+
+    // Control task: hand over a zone's new sample (stepped by the next step() call)
+    void submit(uint8_t z, const SensorData sensors[], uint8_t count, uint32_t nowMs);
+    // Steps every zone with a fresh sample or an expired deadline. Returns ms until the earliest
+    // zone deadline (capped at maxWaitMs).
+    uint32_t step(uint32_t nowMs, uint32_t maxWaitMs);
+
+    // Relay lines to energise on a bank after the last step() (bit n = expander line n)
+    uint8_t bankOutputs(uint8_t bank) const { return bank < MAX_RELAY_BANKS ? _bankOn[bank] : 0; }
+    // Lines of a bank mapped by some zone; the others (hot gas, alarm, spares) are not the zones' to set
+    uint8_t bankLines(uint8_t bank) const { return bank < MAX_RELAY_BANKS ? _bankLines[bank] : 0; }
+    bool buzzerOn() const { return _buzzing != 0; }
+    uint8_t banksUsed() const { return _banksUsed; }
+
+    const ZoneCost& cost(uint8_t z) const { return _cost[z]; }
+    static uint32_t ticksPerUs();
+    float meanCostUs(uint8_t z) const;
+    void resetCost();
+
+private:
+    static_assert(CAPACITY <= 16, "zone bitmasks are 16 bits wide");
+
+    // Hot: scanned every wakeup
+    uint32_t _dueAt[CAPACITY];        // Absolute ms of the zone's next controller deadline
+    uint32_t _sampleAt[CAPACITY];     // Last submit(); inputs are invalidated SENSOR_TIMEOUT later
+    uint16_t _pending;                // Zones with a sample not yet stepped
+    uint16_t _stale;                  // Zones whose inputs were already invalidated
+    uint16_t _buzzing;                // Zones whose buzzer pattern is on
+    uint8_t _count;
+    uint8_t _banksUsed;
+    uint8_t _bankOn[MAX_RELAY_BANKS];
+    uint8_t _bankLines[MAX_RELAY_BANKS];
+    int8_t _buzzerPin;                // Level last written to BUZZER_PIN, -1 = not yet
+
+    // Cold: touched only when a zone runs
+    TemperatureController* _ctl[CAPACITY];
+    ZoneSetup _setup[CAPACITY];
+    SensorData _input[CAPACITY][MAX_SENSORS];
+    uint8_t _inputCount[CAPACITY];
+    ZoneCost _cost[CAPACITY];
+
+    void runZone(uint8_t z, uint32_t nowMs, uint32_t maxWaitMs);
+    void applyOutputs(uint8_t z);
+    void writeBuzzer();
+    static uint32_t costTicks();
+};
+
+extern ZoneManager zones;
+
+#endif // ZONE_MANAGER_H
@@ -12,11 +12,36 @@
 #endif
 #include <lvgl.h>
 #include "config/config.h"
+#include "display/rgb_scanout.h"
+#include "display/frame_profiler.h"
+#include "display/touch_pipeline.h"
+#include "display/input_latency.h"
+#include "display/display_power.h"
+#include "rtos/seqlock.h"
 #include "types/types.h"
 
 // Forward declarations
 struct TouchEvent;
 
+// Where LVGL renders. Selectable at runtime with DisplayDriver::setDrawBuffers().
+enum DrawBufferStrategy : uint8_t {
+    DRAW_BUF_DIRECT = 0,     // Two full-frame panel framebuffers flipped at VSYNC (ENABLE_LVGL_DIRECT_MODE)
+    DRAW_BUF_PSRAM_BANDS,    // Two PSRAM bands copied into the panel framebuffer
+    DRAW_BUF_SRAM_TILES      // Two internal DMA-capable SRAM bands sized to the free heap, bounced into PSRAM
+};
+
+// Display pipeline time over the last one-second FPS window (microseconds summed over the window).
+// With the async flush, flushUs - waitUs is transfer time hidden behind rendering.
+struct DisplayTiming {
+    uint32_t renderUs;   // Inside lv_timer_handler(), minus time blocked on a flush
+    uint32_t flushUs;    // Copying bands into the panel framebuffer (flush task or inline)
+    uint32_t waitUs;     // Render side blocked until a band transfer finished
+    uint32_t flushes;
+    uint32_t busyUs;     // Whole update() calls (LVGL task CPU time on core 0)
+    uint32_t wakeups;    // update() calls
+    uint32_t windowMs;   // Length of the window these totals cover
+};
+
 #ifndef ENABLE_RGB_PANEL
 // Stub LGFX class (no hardware) used when RGB panel disabled.
 class LGFX : public lgfx::LGFX_Device {
@@ -44,9 +69,70 @@ private:
     lv_disp_t* disp;
     lv_indev_drv_t indev_drv;
     lv_indev_t* indev;
-    // Frame buffers
+    // Frame buffers (partial mode; in direct mode LVGL draws into the scan-out framebuffers)
     lv_color_t* buf1;
     lv_color_t* buf2;
+    RgbScanout _scanout;
+    bool _directMode {false};
+    DrawBufferStrategy _bufStrategy {DRAW_BUF_PSRAM_BANDS};
+    uint16_t _bufLines {0};
+    int32_t _dirtyY1 {INT32_MAX};     // Rows drawn this frame / last frame (cache write-back span)
+    int32_t _dirtyY2 {-1};
+    int32_t _prevDirtyY1 {INT32_MAX};
+    int32_t _prevDirtyY2 {-1};
+    // Async band flush: flush_cb hands one band to the flush task and returns; the task copies it
+    // and calls lv_disp_flush_ready(). LVGL renders the next band into the other buffer meanwhile.
+    TaskHandle_t _flushTask {nullptr};
+    SemaphoreHandle_t _flushDone {nullptr};
+    lv_area_t _flushArea;
+    lv_color_t* _flushPixels {nullptr};
+#if defined(ENABLE_PARALLEL_RENDER) && LV_REFR_BAND_UNITS > 1
+    // Parallel render: LVGL hands band unit 1 to the band task (band_start_cb) and joins it
+    // (band_wait_cb). In partial mode the unit renders into its own pair of band buffers.
+    TaskHandle_t _bandTask {nullptr};
+    SemaphoreHandle_t _bandDone {nullptr};
+    lv_color_t* _unitBuf1 {nullptr};
+    lv_color_t* _unitBuf2 {nullptr};
+#endif
+    volatile uint32_t _flushUsTotal {0};    // Written by whoever copies, read by update()
+    volatile uint32_t _flushCountTotal {0};
+    uint32_t _flushPxTotal {0};            // Counted in flush_cb (LVGL task)
+    uint32_t _waitUsTotal {0};
+    uint32_t _renderUsTotal {0};
+    uint32_t _busyUsTotal {0};
+    uint32_t _wakeupsTotal {0};
+    uint32_t _windowStart[6] {};           // Totals at the start of the FPS window
+    // Adaptive pacing: the LVGL task sleeps until this is notified (touch IRQ, unlock(), requestRender())
+    TaskHandle_t _renderTask {nullptr};
+    bool _touchIrqAttached {false};
+    // Touch task: woken by the GT911 IRQ, burst-reads reports into _touch; lvgl_touch_cb only drains
+    TouchPipeline<TwoWire> _touch;
+    TaskHandle_t _touchTask {nullptr};
+    volatile uint32_t _touchIrqUs {0};     // micros() of the last IRQ edge
+    TouchFrame _touchState {};             // Last report handed to LVGL
+    DisplayTiming _timing {};
+    // Per-frame profile, recorded by the refresh timer wrapper (LVGL task, under _mutex)
+    FrameProfiler _profiler;
+    uint32_t _refreshSeq {0};
+    uint32_t _monitorPx {0};
+    bool _monitorHit {false};
+    // Touch-to-photon trace (LVGL task). The flush side only stamps when a frame's last band is done.
+    InputLatencyTrace _latency;
+    uint32_t _renderingSeq {0};            // Refresh being rendered (_refreshSeq + 1 while it runs)
+    uint32_t _flushLastSeq {0};            // Refresh whose last band is with the flush task, else 0
+    // Last band of refresh `seq` flushed at `us`, read as a pair. One writer per flush mode: the flush
+    // task with the async flush, the LVGL task otherwise.
+    struct PhotonStamp { uint32_t seq; uint32_t us; };
+    SeqLock<PhotonStamp> _photon;
+    void photonFlushed() { const PhotonStamp p = _photon.read(); _latency.flushed(p.seq, p.us); }
+    // Backlight / idle state machine (LVGL task, under _mutex). Other tasks only post requests.
+    DisplayPower _power;
+    volatile bool _wakeRequest {false};
+    volatile bool _sleepRequest {false};
+    volatile int16_t _brightnessRequest {-1};   // Percent, -1 = none
+    bool _swallowTouch {false};                 // The touch that woke the screen is not passed to LVGL
+    uint16_t _appliedDuty {0xFFFF};
+    bool _panelOff {false};
     bool _needsRedraw;
     unsigned long _lastUpdate;
     volatile bool _touchIRQFlag {false};
@@ -61,23 +147,56 @@ private:
     bool initDisplay();
     bool initTouch();
     bool initLVGL();
+    bool initDirectMode();
+    bool applyDrawBuffers(DrawBufferStrategy strategy, uint16_t lines);
+    bool allocBands(uint16_t lines, uint32_t caps, bool fitToHeap);
+    void releaseDrawBuffers();
+    bool startFlushTask();
+    bool startBandTask();
+    bool allocUnitBands(uint32_t caps);
+    bool startTouchTask();
+    static void touchTaskLoop(void* arg);
+    void writeArea(const lv_area_t& area, lv_color_t* pixels);
+    uint32_t servicePower(uint32_t nowMs);
+    void applyBacklight(uint16_t duty);
+    void setPanelScan(bool on);
+    void framePresented(uint32_t seq) { _photon.publish(PhotonStamp{seq, micros()}); }
+    static void flushTaskLoop(void* arg);
+    static void bandTaskLoop(void* arg);
 
     static void lvgl_flush_cb(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p);
+    static void lvgl_direct_flush_cb(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p);
+    static void lvgl_wait_cb(lv_disp_drv_t* disp_drv);
+    static void lvgl_band_start_cb(lv_disp_drv_t* disp_drv, uint8_t units);
+    static void lvgl_band_wait_cb(lv_disp_drv_t* disp_drv);
+    static void lvgl_monitor_cb(lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px);
+    static void profiledRefrTimer(lv_timer_t* timer);
     static void lvgl_touch_cb(lv_indev_drv_t* indev_drv, lv_indev_data_t* data);
+    static void lvgl_feedback_cb(lv_indev_drv_t* indev_drv, uint8_t code);
+    static void lvgl_rounder_cb(lv_disp_drv_t* disp_drv, lv_area_t* area);
 
 public:
     DisplayDriver();
     ~DisplayDriver();
 
     bool init();
-    void update();
+    // Runs LVGL once; returns ms until LVGL's next timer is due (LV_NO_TIMER_READY if none)
+    uint32_t update();
+    // Brightness, sleep and wake are requests served by the next update(); callable from any task
     void setBrightness(uint8_t brightness);
     void clear();
     void sleep();
     void wake();
+    PowerState getPowerState() const { return _power.state(); }
+    const DisplayPower& getPower() const { return _power; }
 
     void lock() { xSemaphoreTake(_mutex, portMAX_DELAY); }
-    void unlock() { xSemaphoreGive(_mutex); }
+    // Widgets may have been invalidated under the lock: wake the LVGL task to render them
+    void unlock() { xSemaphoreGive(_mutex); requestRender(); }
+
+    // Task that calls update() and sleeps on its notification between LVGL deadlines
+    void setRenderTask(TaskHandle_t task) { _renderTask = task; }
+    void requestRender() { if (_renderTask) xTaskNotifyGive(_renderTask); }
 
     bool isInitialized() const { return _initialized; }
     uint16_t getWidth() const { return DISPLAY_WIDTH; }
@@ -91,9 +210,32 @@ public:
     void drawMainScreen(const SensorData& data, const SystemConfig& config, const ControlState& state);
     void forceRedraw() { _needsRedraw = true; }
     // For ISR to set flag
-    void setTouchIRQFlag() { _touchIRQFlag = true; }
-    float getFPS() const { return _lastFps; }
+    void IRAM_ATTR setTouchIRQFlag();
+    float getFPS() const { return _lastFps; }             // Frames actually flushed per second
     uint32_t getFrameCount() const { return _frameCount; }
+    bool isDirectMode() const { return _directMode; }
+    bool isAsyncFlush() const { return _flushTask != nullptr; }
+    bool isParallelRender() const;   // Band task running and the current draw buffers allow it
+    // Switches draw buffers (lines ignored for DRAW_BUF_DIRECT; SRAM tiles may come out shorter).
+    // Returns false if the strategy could not be set up and PSRAM bands were used instead.
+    bool setDrawBuffers(DrawBufferStrategy strategy, uint16_t lines);
+    DrawBufferStrategy getDrawBufferStrategy() const { return _bufStrategy; }
+    uint16_t getDrawBufferLines() const { return _bufLines; }
+    // Renders a test scene `frames` times per strategy/band height and prints ms/frame over Serial
+    void benchmarkDrawBuffers(uint16_t frames);
+    const DisplayTiming& getTiming() const { return _timing; }
+    // Last FRAME_PROFILE_FRAMES rendered frames (read from the LVGL task or under lock())
+    const FrameProfiler& getFrameProfile() const { return _profiler; }
+    // Prints p50/p90/p99/max per stage over Serial; withFrames adds one line per frame held
+    void dumpFrameProfile(bool withFrames);
+    uint32_t getFlipCount() const { return _scanout.flips(); }
+    uint32_t getMissedVsync() const { return _scanout.missedVsync(); }
+    uint32_t getTouchReports() const { return _touch.queued(); }
+    uint32_t getTouchDropped() const { return _touch.dropped(); }
+    // Touch-to-photon histogram (read from the LVGL task or under lock())
+    const InputLatencyTrace& getInputLatency() const { return _latency; }
+    // Prints traced/unanswered counts and p50/p90/p99 per stage; withHistogram adds the bins
+    void dumpInputLatency(bool withHistogram);
 };
 
 extern DisplayDriver display;
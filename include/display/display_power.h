@@ -0,0 +1,138 @@
+#pragma once
+// Display power state machine: active -> dimmed -> off on idle time, back to active on activity.
+// Brightness moves by fades that are linear in perceived brightness and mapped to PWM duty through
+// a gamma curve, so a fade looks even instead of jumping at the bottom. Nothing blocks: service()
+// advances the fade and the idle timers and returns how long the caller may sleep before the next
+// step. Once the fade to off has finished, renderSuspended() tells the driver to stop LVGL and the
+// panel scan-out until activity().
+
+#include <stdint.h>
+#include <math.h>
+#include "config/config.h"
+
+enum PowerState : uint8_t {
+    POWER_ACTIVE = 0,
+    POWER_DIMMED,
+    POWER_OFF,
+};
+
+struct PowerConfig {
+    uint32_t dimAfterMs;   // Idle time before dimming (0 = never)
+    uint32_t offAfterMs;   // Idle time before switching off (0 = never)
+    uint8_t activePct;     // Perceived brightness when active / dimmed
+    uint8_t dimPct;
+    uint16_t fadeMs;       // Duration of a 0..100 % fade; shorter steps take proportionally less
+};
+
+class DisplayPower {
+public:
+    static constexpr uint32_t NO_DEADLINE = 0xFFFFFFFF;
+
+    void begin(const PowerConfig& cfg, uint16_t maxDuty, uint32_t nowMs) {
+        _cfg = cfg;
+        _maxDuty = maxDuty;
+        _state = POWER_ACTIVE;
+        _lastActivityMs = _stateSinceMs = nowMs;
+        _level = _from = _to = (uint16_t)(cfg.activePct * 10);
+        _fadeMs = 0;
+        _duty = dutyFor(_level);
+    }
+
+    // Touch, alarm or explicit wake(). Returns true when the screen was off (or fading out to off),
+    // i.e. the user could not see what they touched.
+    bool activity(uint32_t nowMs) {
+        _lastActivityMs = nowMs;
+        const bool wasDark = _state == POWER_OFF;
+        if (_state != POWER_ACTIVE) {
+            enter(POWER_ACTIVE, nowMs);
+            _wakes += wasDark ? 1 : 0;
+        }
+        return wasDark;
+    }
+
+    // Fade out and suspend now (DisplayDriver::sleep())
+    void sleep(uint32_t nowMs) {
+        if (_state != POWER_OFF) enter(POWER_OFF, nowMs);
+    }
+
+    // Active brightness (setBrightness()); fades there if active
+    void setActiveLevel(uint8_t pct, uint32_t nowMs) {
+        _cfg.activePct = pct > 100 ? 100 : pct;
+        if (_state == POWER_ACTIVE) fadeTo((uint16_t)(_cfg.activePct * 10), nowMs);
+    }
+
+    // Advances the fade and the idle timers. Returns ms until it needs to run again.
+    uint32_t service(uint32_t nowMs) {
+        const uint32_t idle = nowMs - _lastActivityMs;
+        if (_state == POWER_ACTIVE && _cfg.dimAfterMs && idle >= _cfg.dimAfterMs) enter(POWER_DIMMED, nowMs);
+        if (_state != POWER_OFF && _cfg.offAfterMs && idle >= _cfg.offAfterMs) enter(POWER_OFF, nowMs);
+
+        if (_fadeMs) {
+            const uint32_t t = nowMs - _fadeStartMs;
+            if (t >= _fadeMs) {
+                _level = _to;
+                _fadeMs = 0;
+            } else {
+                _level = (uint16_t)((int32_t)_from + ((int32_t)_to - (int32_t)_from) * (int32_t)t / (int32_t)_fadeMs);
+            }
+            _duty = dutyFor(_level);
+            if (_fadeMs) return DISPLAY_FADE_STEP_MS;
+        }
+        // Next idle transition
+        uint32_t due = NO_DEADLINE;
+        if (_state == POWER_ACTIVE && _cfg.dimAfterMs) due = _cfg.dimAfterMs - idle;
+        if (_state != POWER_OFF && _cfg.offAfterMs && _cfg.offAfterMs - idle < due) due = _cfg.offAfterMs - idle;
+        return due;
+    }
+
+    PowerState state() const { return _state; }
+    bool fading() const { return _fadeMs != 0; }
+    bool renderSuspended() const { return _state == POWER_OFF && !_fadeMs; }
+    uint16_t level() const { return _level; }   // Perceived brightness, 0.1 % steps
+    uint16_t duty() const { return _duty; }
+    uint32_t wakes() const { return _wakes; }    // Woken from off
+    uint32_t lastActivityMs() const { return _lastActivityMs; }
+    uint32_t stateSinceMs() const { return _stateSinceMs; }
+    const PowerConfig& config() const { return _cfg; }
+
+    uint16_t dutyFor(uint16_t permille) const {
+        if (!permille) return 0;
+        float d = _maxDuty * powf(permille / 1000.0f, DISPLAY_BL_GAMMA);
+        uint16_t q = (uint16_t)lroundf(d);
+        return q ? q : 1;   // Lowest visible step rather than off
+    }
+
+private:
+    PowerConfig _cfg {};
+    uint16_t _maxDuty {255};
+    PowerState _state {POWER_ACTIVE};
+    uint32_t _lastActivityMs {0};
+    uint32_t _stateSinceMs {0};
+    uint16_t _level {1000};
+    uint16_t _from {1000};
+    uint16_t _to {1000};
+    uint32_t _fadeStartMs {0};
+    uint32_t _fadeMs {0};
+    uint16_t _duty {0};
+    uint32_t _wakes {0};
+
+    void enter(PowerState s, uint32_t nowMs) {
+        _state = s;
+        _stateSinceMs = nowMs;
+        const uint8_t pct = s == POWER_ACTIVE ? _cfg.activePct : (s == POWER_DIMMED ? _cfg.dimPct : 0);
+        fadeTo((uint16_t)(pct * 10), nowMs);
+    }
+
+    // From wherever the current fade is, so a wake during a fade-out turns around smoothly
+    void fadeTo(uint16_t permille, uint32_t nowMs) {
+        _from = _level;
+        _to = permille;
+        const uint32_t delta = _from > _to ? _from - _to : _to - _from;
+        _fadeMs = (uint32_t)_cfg.fadeMs * delta / 1000;
+        _fadeStartMs = nowMs;
+        if (!_fadeMs) {
+            _level = _to;
+            _duty = dutyFor(_level);
+        }
+    }
+};
@@ -0,0 +1,98 @@
+#pragma once
+// Per-frame render pipeline profile.
+// One FrameSample per LVGL refresh that drew something: pixels rendered and flushed, time spent rendering
+// (blending/drawing on the LVGL task), copying bands to the panel, and blocked on a busy buffer.
+// Kept in a fixed ring of the last FRAME_PROFILE_FRAMES frames; percentiles are computed on demand
+// from a scratch copy so recording stays O(1).
+
+#include <stdint.h>
+#include <string.h>
+#include <algorithm>
+#include "config/config.h"
+
+struct FrameSample {
+    uint32_t seq;        // Refresh number (gaps = refreshes that drew nothing)
+    uint32_t pixels;     // Pixels rendered this frame (sum of the areas drawn)
+    uint32_t flushedPixels;   // Pixels handed to flush_cb
+    uint32_t renderUs;   // totalUs - waitUs
+    uint32_t flushUs;    // Band copies / flip completed during the frame
+    uint32_t waitUs;     // Blocked on a flush or VSYNC
+    uint32_t totalUs;    // Whole refresh timer callback
+    uint16_t flushes;    // flush_cb calls
+};
+
+enum FrameField : uint8_t {
+    FRAME_PIXELS = 0,
+    FRAME_RENDER,
+    FRAME_FLUSH,
+    FRAME_WAIT,
+    FRAME_TOTAL,
+    FRAME_FLUSHED,
+};
+
+struct FramePercentiles {
+    uint32_t p50;
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t max;
+};
+
+class FrameProfiler {
+public:
+    static constexpr uint16_t CAPACITY = FRAME_PROFILE_FRAMES;
+
+    void record(const FrameSample& s) {
+        _ring[_head] = s;
+        _head = (uint16_t)((_head + 1) % CAPACITY);
+        if (_count < CAPACITY) _count++;
+        _recorded++;
+    }
+
+    void clear() { _head = 0; _count = 0; }
+    uint16_t count() const { return _count; }
+    uint32_t recorded() const { return _recorded; }   // Frames since boot
+
+    // i = 0 is the oldest frame still held
+    const FrameSample& at(uint16_t i) const {
+        return _ring[(uint16_t)((_head + CAPACITY - _count + i) % CAPACITY)];
+    }
+    const FrameSample* latest() const { return _count ? &at(_count - 1) : nullptr; }
+
+    static uint32_t field(const FrameSample& s, FrameField f) {
+        switch (f) {
+            case FRAME_PIXELS: return s.pixels;
+            case FRAME_RENDER: return s.renderUs;
+            case FRAME_FLUSH:  return s.flushUs;
+            case FRAME_WAIT:   return s.waitUs;
+            case FRAME_TOTAL:  return s.totalUs;
+            case FRAME_FLUSHED: return s.flushedPixels;
+        }
+        return 0;
+    }
+
+    // Nearest-rank percentiles over the frames held
+    FramePercentiles percentiles(FrameField f) const {
+        FramePercentiles p {0, 0, 0, 0};
+        if (!_count) return p;
+        for (uint16_t i = 0; i < _count; i++) _scratch[i] = field(at(i), f);
+        p.p50 = rank(50);
+        p.p90 = rank(90);
+        p.p99 = rank(99);
+        p.max = *std::max_element(_scratch, _scratch + _count);
+        return p;
+    }
+
+private:
+    FrameSample _ring[CAPACITY];
+    mutable uint32_t _scratch[CAPACITY];
+    uint16_t _head {0};
+    uint16_t _count {0};
+    uint32_t _recorded {0};
+
+    uint32_t rank(uint8_t pct) const {
+        uint16_t k = (uint16_t)(((uint32_t)pct * _count + 99) / 100);
+        if (k) k--;
+        std::nth_element(_scratch, _scratch + k, _scratch + _count);
+        return _scratch[k];
+    }
+};
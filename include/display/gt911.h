@@ -1,15 +1,47 @@
-// Minimal GT911 capacitive touch controller driver (5-point) for Waveshare ESP32-S3 4.3" panel
-// Provides init, readTouch querying first touch point. Expansion ready for multi-point.
+// GT911 capacitive touch controller (5-point) for the Waveshare ESP32-S3 4.3" panel.
+// One report is the status byte at 0x814E followed by TOUCH_MAX_POINTS 8-byte point records. The
+// status and first point come in one burst (register address, repeated start, 9-byte read), the
+// other points down, if any, in a second one; the report is then acknowledged by clearing the status
+// so the controller latches the next one.
+//
+// Bus requirements (TwoWire on target, Gt911Sim in native tests):
+//   void beginTransmission(uint8_t addr); size_t write(uint8_t b); uint8_t endTransmission(bool stop = true);
+//   uint8_t requestFrom(int addr, int len); int read();
 
 #pragma once
 
+#ifdef UNIT_TEST_NATIVE
+#include "test_support/arduino_stub.h"
+#else
 #include <Arduino.h>
 #include <Wire.h>
+#endif
+#include "types/types.h"
 #include "config/config.h"
 
-class GT911 {
+// One controller report. Points are in report order (oldest contact first).
+struct TouchFrame {
+    uint32_t us;                          // IRQ edge (or poll time) the report belongs to
+    uint32_t readUs;                      // I2C read of the report complete
+    uint8_t count;                        // Points down; 0 = released
+    TouchPoint points[TOUCH_MAX_POINTS];
+};
+
+enum Gt911Read : uint8_t {
+    GT911_READ_ERROR = 0,   // Bus error or controller absent
+    GT911_READ_IDLE,        // No new report latched
+    GT911_READ_OK,
+};
+
+template <typename Bus>
+class GT911T {
 public:
-    bool begin(TwoWire &bus = Wire, uint8_t addr1 = GT911_ADDRESS_1, uint8_t addr2 = GT911_ADDRESS_2) {
+    static constexpr uint16_t REG_STATUS = 0x814E;     // bit 7 report ready, bits 0..3 points down
+    static constexpr uint8_t STATUS_READY = 0x80;
+    static constexpr uint8_t POINT_LEN = 8;            // track id, x lo/hi, y lo/hi, size lo/hi, reserved
+    static constexpr uint8_t REPORT_LEN = 1 + POINT_LEN * TOUCH_MAX_POINTS;
+
+    bool begin(Bus& bus, uint8_t addr1 = GT911_ADDRESS_1, uint8_t addr2 = GT911_ADDRESS_2) {
         _wire = &bus;
         // Try primary then secondary
         _address = addr1;
@@ -26,43 +58,73 @@ public:
 
     bool isPresent() const { return _present; }
 
-    bool readTouch(uint16_t &x, uint16_t &y, bool &pressed) {
-        if (!_present) { pressed = false; return false; }
-        // GT911 data register 0x814E: status, then points starting at 0x8150
-        if (!writeReg16(0x814E)) { pressed = false; return false; }
-        uint8_t buf[8];
-        if (_wire->requestFrom((int)_address, 8) != 8) { pressed = false; return false; }
-        uint8_t status = buf[0] = _wire->read();
-        uint8_t points = status & 0x0F;
-        for (int i=1;i<8;i++) buf[i] = _wire->read();
-        if (points == 0) { pressed = false; clearStatus(); return true; }
-        // First point data at 0x8150 (after status read we already have first 7 bytes starting at 0x814E)
-        uint16_t tx = (uint16_t)buf[3] << 8 | buf[2];
-        uint16_t ty = (uint16_t)buf[5] << 8 | buf[4];
-        if (tx >= DISPLAY_WIDTH || ty >= DISPLAY_HEIGHT) { pressed = false; clearStatus(); return false; }
-        x = tx; y = ty; pressed = true; clearStatus();
-        return true;
+    // Reads the latched report into f (stamped stampUs) and acknowledges it. Points outside the panel
+    // are dropped from the frame.
+    Gt911Read readFrame(TouchFrame& f, uint32_t stampUs) {
+        if (!_present) return GT911_READ_ERROR;
+        uint8_t buf[REPORT_LEN];
+        if (!readRegs(REG_STATUS, buf, 1 + POINT_LEN)) return GT911_READ_ERROR;
+        _reads++;
+        const uint8_t status = buf[0];
+        if (!(status & STATUS_READY)) return GT911_READ_IDLE;   // Nothing new; leave the status alone
+        uint8_t n = status & 0x0F;
+        if (n > TOUCH_MAX_POINTS) n = TOUCH_MAX_POINTS;
+        // Still latched on error, so the next call reads the whole report again
+        if (n > 1 && !readRegs(REG_STATUS + 1 + POINT_LEN, buf + 1 + POINT_LEN, (uint8_t)((n - 1) * POINT_LEN))) return GT911_READ_ERROR;
+        clearStatus();
+        f.us = stampUs;
+        f.count = 0;
+        for (uint8_t i = 0; i < n; i++) {
+            const uint8_t* p = buf + 1 + i * POINT_LEN;
+            uint16_t x = (uint16_t)(p[2] << 8 | p[1]);
+            uint16_t y = (uint16_t)(p[4] << 8 | p[3]);
+            if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) continue;
+            TouchPoint& tp = f.points[f.count++];
+            tp.x = x;
+            tp.y = y;
+            tp.id = p[0];
+            tp.touched = true;
+        }
+        _reports++;
+        return GT911_READ_OK;
     }
 
+    uint32_t reads() const { return _reads; }       // Status reads issued
+    uint32_t reports() const { return _reports; }   // Reads that returned a new report
+    uint32_t errors() const { return _errors; }
+
 private:
-    TwoWire *_wire {nullptr};
+    Bus *_wire {nullptr};
     uint8_t _address {0};
     bool _present {false};
+    uint32_t _reads {0};
+    uint32_t _reports {0};
+    uint32_t _errors {0};
 
     bool probe() {
         _wire->beginTransmission(_address);
         return _wire->endTransmission() == 0; }
 
-    bool writeReg16(uint16_t reg) {
+    bool readRegs(uint16_t reg, uint8_t* out, uint8_t len) {
         _wire->beginTransmission(_address);
-        _wire->write(reg >> 8); _wire->write(reg & 0xFF);
-        return _wire->endTransmission(false) == 0; }
+        _wire->write((uint8_t)(reg >> 8));
+        _wire->write((uint8_t)(reg & 0xFF));
+        if (_wire->endTransmission(false) != 0 || _wire->requestFrom((int)_address, (int)len) != len) {
+            _errors++;
+            return false;
+        }
+        for (uint8_t i = 0; i < len; i++) out[i] = (uint8_t)_wire->read();
+        return true;
+    }
 
     void clearStatus() {
         _wire->beginTransmission(_address);
-        _wire->write(0x81); _wire->write(0x4E); _wire->write(0x00);
+        _wire->write((uint8_t)(REG_STATUS >> 8)); _wire->write((uint8_t)(REG_STATUS & 0xFF)); _wire->write(0x00);
         _wire->endTransmission();
     }
 };
 
+#ifndef UNIT_TEST_NATIVE
+typedef GT911T<TwoWire> GT911;
 extern GT911 gt911;
+#endif
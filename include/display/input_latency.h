@@ -0,0 +1,135 @@
+#pragma once
+// Touch-to-photon latency trace.
+// Follows one touch report at a time through the input pipeline, as delays from its GT911 IRQ edge:
+// the touch task's I2C read, the LVGL read callback taking it, the first LVGL event sent for it, the
+// first area invalidated while LVGL was processing it, and the end of the flush of the last band of
+// the frame that drew that area. Completed traces go into a fixed-bin histogram per stage.
+// A report that sends no event or redraws nothing is counted as unanswered when the next report is
+// handed over. Reports arriving while a trace waits for its frame are not traced.
+
+#include <stdint.h>
+#include "config/config.h"
+#include "display/gt911.h"
+
+enum LatencyStage : uint8_t {
+    LAT_READ = 0,     // I2C read of the report complete
+    LAT_INDEV,        // Handed to LVGL by the read callback
+    LAT_DISPATCH,     // First LVGL event sent
+    LAT_INVALIDATE,   // First area invalidated
+    LAT_PHOTON,       // Frame with that area flushed to the panel
+    LAT_STAGES,
+};
+
+struct LatencySample {
+    uint32_t irqUs;
+    uint32_t stageUs[LAT_STAGES];   // Delay from irqUs to each stage
+    uint8_t points;                 // Points down in the report; 0 = release
+};
+
+class InputLatencyTrace {
+public:
+    static constexpr uint8_t BINS = 12;
+    static constexpr uint32_t STALE_US = 1000000;   // A trace still without its frame after this is dropped
+
+    // Upper edge of a histogram bin; the last bin is open-ended
+    static uint32_t binEdgeUs(uint8_t bin) {
+        static const uint32_t edges[BINS - 1] = { 1000, 2000, 5000, 10000, 16000, 20000, 30000, 40000, 50000, 75000, 100000 };
+        return bin < BINS - 1 ? edges[bin] : UINT32_MAX;
+    }
+
+    static const char* stageName(LatencyStage s) {
+        static const char* const names[LAT_STAGES] = { "read", "indev", "dispatch", "invalidate", "photon" };
+        return s < LAT_STAGES ? names[s] : "?";
+    }
+
+    // LVGL read callback: f handed to LVGL at nowUs. Starts a trace unless one is waiting for its frame.
+    void delivered(const TouchFrame& f, uint32_t nowUs) {
+        if (_state == WAIT_PHOTON && nowUs - _cur.irqUs < STALE_US) return;
+        if (_state != IDLE) _unanswered++;
+        _cur.irqUs = f.us;
+        for (uint8_t s = 0; s < LAT_STAGES; s++) _cur.stageUs[s] = 0;
+        _cur.stageUs[LAT_READ] = f.readUs - f.us;
+        _cur.stageUs[LAT_INDEV] = nowUs - f.us;
+        _cur.points = f.count;
+        _state = WAIT_DISPATCH;
+    }
+
+    bool awaitingDispatch() const { return _state == WAIT_DISPATCH; }
+    void dispatched(uint32_t nowUs) {
+        if (_state != WAIT_DISPATCH) return;
+        _cur.stageUs[LAT_DISPATCH] = nowUs - _cur.irqUs;
+        _state = WAIT_INVALIDATE;
+    }
+
+    // frame = refresh number that will draw the area
+    bool awaitingInvalidation() const { return _state == WAIT_INVALIDATE; }
+    void invalidated(uint32_t nowUs, uint32_t frame) {
+        if (_state != WAIT_INVALIDATE) return;
+        _cur.stageUs[LAT_INVALIDATE] = nowUs - _cur.irqUs;
+        _frame = frame;
+        _state = WAIT_PHOTON;
+    }
+
+    // The last band of refresh `frame` finished flushing at nowUs
+    void flushed(uint32_t frame, uint32_t nowUs) {
+        if (_state != WAIT_PHOTON || (int32_t)(frame - _frame) < 0) return;
+        _cur.stageUs[LAT_PHOTON] = nowUs - _cur.irqUs;
+        for (uint8_t s = 0; s < LAT_STAGES; s++) {
+            _hist[s][bin(_cur.stageUs[s])]++;
+            if (_cur.stageUs[s] > _max[s]) _max[s] = _cur.stageUs[s];
+        }
+        if (_cur.stageUs[LAT_PHOTON] > INPUT_LATENCY_TARGET_MS * 1000UL) _overTarget++;
+        _last = _cur;
+        _completed++;
+        _state = IDLE;
+    }
+
+    void clear() {
+        for (uint8_t s = 0; s < LAT_STAGES; s++) {
+            for (uint8_t b = 0; b < BINS; b++) _hist[s][b] = 0;
+            _max[s] = 0;
+        }
+        _completed = _unanswered = _overTarget = 0;
+        _state = IDLE;
+    }
+
+    uint32_t completed() const { return _completed; }
+    uint32_t unanswered() const { return _unanswered; }    // No event or no redraw
+    uint32_t overTarget() const { return _overTarget; }    // Photon later than INPUT_LATENCY_TARGET_MS
+    const LatencySample* last() const { return _completed ? &_last : nullptr; }
+    uint32_t binCount(LatencyStage s, uint8_t b) const { return _hist[s][b]; }
+    uint32_t maxUs(LatencyStage s) const { return _max[s]; }
+
+    // Upper bound of the pct-th percentile of a stage: the upper edge of its bin, or the largest
+    // delay seen if that is lower (0 with no traces)
+    uint32_t percentileUs(LatencyStage s, uint8_t pct) const {
+        if (!_completed) return 0;
+        uint32_t k = (uint32_t)(((uint64_t)pct * _completed + 99) / 100);
+        if (!k) k = 1;
+        uint32_t seen = 0;
+        for (uint8_t b = 0; b < BINS; b++) {
+            seen += _hist[s][b];
+            if (seen >= k) return binEdgeUs(b) < _max[s] ? binEdgeUs(b) : _max[s];
+        }
+        return _max[s];
+    }
+
+private:
+    enum State : uint8_t { IDLE, WAIT_DISPATCH, WAIT_INVALIDATE, WAIT_PHOTON };
+
+    State _state {IDLE};
+    LatencySample _cur {};
+    LatencySample _last {};
+    uint32_t _frame {0};
+    uint32_t _hist[LAT_STAGES][BINS] {};
+    uint32_t _max[LAT_STAGES] {};
+    uint32_t _completed {0};
+    uint32_t _unanswered {0};
+    uint32_t _overTarget {0};
+
+    static uint8_t bin(uint32_t us) {
+        uint8_t b = 0;
+        while (b < BINS - 1 && us > binEdgeUs(b)) b++;
+        return b;
+    }
+};
@@ -0,0 +1,65 @@
+// Double-buffered scan-out for the ESP32-S3 RGB panel (LovyanGFX Bus_RGB).
+// Bus_RGB streams its framebuffer to LCD_CAM through a ring of GDMA descriptors. RgbScanout finds
+// that ring, adds a second framebuffer of the same size in PSRAM and flips the descriptors between
+// the two at the VSYNC edge. LVGL renders straight into whichever buffer is off screen
+// (direct_mode), so nothing is copied per frame.
+
+#pragma once
+
+#include <Arduino.h>
+#include <hal/dma_types.h>
+#include "config/config.h"
+
+class RgbScanout {
+public:
+    RgbScanout() = default;
+    ~RgbScanout() { end(); }
+    RgbScanout(const RgbScanout&) = delete;
+    RgbScanout& operator=(const RgbScanout&) = delete;
+
+    // After the panel is running. Returns false (and leaves the bus untouched) when the descriptor
+    // ring does not cover exactly one width x height x 16bpp framebuffer or PSRAM is short.
+    bool begin(uint16_t width, uint16_t height, uint8_t vsyncPin, bool vsyncActiveLow);
+    // Back to single-buffer scan-out of the bus's own framebuffer; frees the second buffer
+    void end();
+    bool isActive() const { return _active; }
+
+    uint16_t* buffer(uint8_t i) const { return i < 2 ? _fb[i] : nullptr; }
+    uint16_t* front() const { return _fb[_front]; }
+
+    // Writes back CPU cache lines for rows y1..y2 of fb so the DMA reads what LVGL drew
+    void writeBack(const uint16_t* fb, int32_t y1, int32_t y2) const;
+    // Shows fb from the next VSYNC on. Blocks until the flip happened (at most timeoutMs); on
+    // timeout the flip is forced from task context and counted in missedVsync().
+    void flip(uint16_t* fb, uint32_t timeoutMs);
+
+    // Stops / restarts LCD_CAM output and its GDMA channel (also without begin()). The framebuffers
+    // keep their contents, so the restarted scan shows the last frame again.
+    bool pauseScan();
+    bool resumeScan();
+    bool isScanPaused() const { return _scanPaused; }
+
+    uint32_t flips() const { return _flips; }
+    uint32_t missedVsync() const { return _missedVsync; }
+
+private:
+    dma_descriptor_t* _ring {nullptr};   // Any descriptor of Bus_RGB's circular list
+    uint16_t* _fb[2] {nullptr, nullptr};
+    uint8_t _front {0};
+    uint8_t _vsyncPin {0};
+    bool _ownsFb1 {false};
+    bool _active {false};
+    size_t _fbBytes {0};
+    uint16_t _stride {0};
+    uint16_t* volatile _pendingFb {nullptr};
+    SemaphoreHandle_t _flipped {nullptr};
+    volatile uint32_t _flips {0};
+    uint32_t _missedVsync {0};
+    dma_descriptor_t* _scanHead {nullptr};   // Descriptor of the first framebuffer line
+    int _scanChannel {-1};
+    bool _scanPaused {false};
+
+    static int findLcdChannel();
+    void retarget(uint16_t* to);
+    static void IRAM_ATTR vsyncIsr(void* arg);
+};
@@ -0,0 +1,53 @@
+// Touch producer/consumer around a GT911.
+// The touch task calls service() when the GT911 IRQ (or its poll timeout) wakes it; that is the
+// only place the I2C bus is used. Reports go into an SpscRing with their IRQ timestamp, and the LVGL
+// read callback takes them with next() without touching the bus. While a finger is down the task
+// also polls every TOUCH_RELEASE_POLL_MS, so a lost IRQ cannot leave a press stuck.
+
+#pragma once
+
+#include <stdint.h>
+#include "display/gt911.h"
+#include "rtos/event_ring.h"
+
+template <typename Bus>
+class TouchPipeline {
+public:
+    static constexpr uint32_t WAIT_FOREVER = 0xFFFFFFFF;
+
+    TouchPipeline(GT911T<Bus>& dev, uint32_t depth) : _dev(dev), _queue(depth) {}
+    // Global instances: no queue storage until begin(), so nothing is allocated at static init
+    explicit TouchPipeline(GT911T<Bus>& dev) : _dev(dev) {}
+
+    // Allocates the queue of a pipeline built without one; before the touch task starts
+    bool begin(uint32_t depth) { return _queue.begin(depth); }
+
+    // Touch task. Reads the latched report, if any, and queues it stamped stampUs.
+    // Returns ms the task may sleep before the next poll (WAIT_FOREVER while released).
+    uint32_t service(uint32_t stampUs) {
+        TouchFrame f;
+        if (_dev.readFrame(f, stampUs) == GT911_READ_OK) {
+            f.readUs = micros();
+            _down = f.count > 0;
+            _queue.push(f);
+        }
+        return _down ? TOUCH_RELEASE_POLL_MS : WAIT_FOREVER;
+    }
+
+    // LVGL side: oldest queued report; false when none is waiting
+    bool next(TouchFrame& out) {
+        typename SpscRing<TouchFrame>::Entry e;
+        if (!_queue.drain(&e, 1)) return false;
+        out = e.value;
+        return true;
+    }
+
+    bool pending() const { return _queue.size() != 0; }
+    uint32_t queued() const { return _queue.nextSequence(); }
+    uint32_t dropped() const { return _queue.dropped(); }
+
+private:
+    GT911T<Bus>& _dev;
+    SpscRing<TouchFrame> _queue;
+    bool _down {false};
+};
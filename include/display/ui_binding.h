@@ -0,0 +1,146 @@
+#pragma once
+// Change-detecting bindings between UIScreens state and LVGL widgets.
+// Every LVGL setter invalidates (and a text change re-lays out) even when the value is the same.
+// A binding keeps what it last handed to LVGL, numbers quantized to the precision shown, and only
+// calls LVGL when that changes. InvalidationMeter measures what a block of UI updates invalidated.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <lvgl.h>
+
+// Bound setter calls that reached LVGL vs. were dropped as unchanged (all bindings)
+struct UiBindingStats {
+    uint32_t writes;
+    uint32_t skips;
+};
+inline UiBindingStats& uiBindingStats() {
+    static UiBindingStats s {0, 0};
+    return s;
+}
+
+// Fixed-point text: value quantized to `decimals` places, formatted without going through float
+// printf (the LVGL formatter has no float support).
+inline int32_t quantize(float v, uint8_t decimals) {
+    static const float scale[] = { 1.0f, 10.0f, 100.0f, 1000.0f };
+    return (int32_t)lroundf(v * scale[decimals > 3 ? 3 : decimals]);
+}
+
+inline void formatFixed(char* buf, size_t len, int32_t q, uint8_t decimals, const char* prefix, const char* suffix) {
+    static const int32_t scale[] = { 1, 10, 100, 1000 };
+    const int32_t div = scale[decimals > 3 ? 3 : decimals];
+    const uint32_t mag = q < 0 ? (uint32_t)(-(int64_t)q) : (uint32_t)q;
+    if (decimals) {
+        snprintf(buf, len, "%s%s%lu.%0*lu%s", prefix, q < 0 ? "-" : "", (unsigned long)(mag / div), (int)decimals,
+                 (unsigned long)(mag % div), suffix);
+    } else {
+        snprintf(buf, len, "%s%s%lu%s", prefix, q < 0 ? "-" : "", (unsigned long)mag, suffix);
+    }
+}
+
+class BoundLabel {
+public:
+    static constexpr int32_t NO_KEY = INT32_MIN;
+
+    void bind(lv_obj_t* label) {
+        _obj = label;
+        _key = NO_KEY;
+        _hasColor = false;
+    }
+    lv_obj_t* obj() const { return _obj; }
+
+    // Number shown as prefix + value (decimals places) + suffix; unchanged at that precision = no-op
+    bool setFixed(float v, uint8_t decimals, const char* prefix, const char* suffix) {
+        const int32_t q = quantize(v, decimals);
+        if (!_obj || q == _key) return skip();
+        char buf[32];
+        formatFixed(buf, sizeof(buf), q, decimals, prefix, suffix);
+        _key = q;
+        lv_label_set_text(_obj, buf);
+        return write();
+    }
+
+    // Text chosen by a small key (enum value, state); text is only looked at when the key changes
+    bool setKeyed(int32_t key, const char* text) {
+        if (!_obj || key == _key) return skip();
+        _key = key;
+        lv_label_set_text(_obj, text);
+        return write();
+    }
+
+    // Free text, compared with what the label currently shows
+    bool setText(const char* text) {
+        if (!_obj || strcmp(lv_label_get_text(_obj), text) == 0) return skip();
+        _key = NO_KEY;
+        lv_label_set_text(_obj, text);
+        return write();
+    }
+
+    bool setColor(lv_color_t c) {
+        if (!_obj || (_hasColor && _color.full == c.full)) return skip();
+        _color = c;
+        _hasColor = true;
+        lv_obj_set_style_text_color(_obj, c, 0);
+        return write();
+    }
+
+private:
+    lv_obj_t* _obj {nullptr};
+    int32_t _key {NO_KEY};
+    lv_color_t _color;
+    bool _hasColor {false};
+
+    static bool skip() { uiBindingStats().skips++; return false; }
+    static bool write() { uiBindingStats().writes++; return true; }
+};
+
+class BoundVisibility {
+public:
+    void bind(lv_obj_t* obj) {
+        _obj = obj;
+        _state = obj ? (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) ? 0 : 1) : -1;
+    }
+
+    bool set(bool visible) {
+        if (!_obj || _state == (visible ? 1 : 0)) { uiBindingStats().skips++; return false; }
+        _state = visible ? 1 : 0;
+        if (visible) lv_obj_clear_flag(_obj, LV_OBJ_FLAG_HIDDEN);
+        else lv_obj_add_flag(_obj, LV_OBJ_FLAG_HIDDEN);
+        uiBindingStats().writes++;
+        return true;
+    }
+
+private:
+    lv_obj_t* _obj {nullptr};
+    int8_t _state {-1};
+};
+
+// Pixels newly marked dirty on a display between begin() and end(). Overlapping areas count twice;
+// LVGL falling back to a full-screen area counts the whole screen.
+class InvalidationMeter {
+public:
+    void begin(lv_disp_t* disp) {
+        _disp = disp;
+        _start = disp ? disp->inv_p : 0;
+        _fullBefore = disp && disp->inv_p && isFullScreen(disp->inv_areas[0]);
+    }
+
+    uint32_t end() const {
+        if (!_disp || _fullBefore) return 0;
+        uint32_t px = 0;
+        uint16_t from = _start;
+        if (_disp->inv_p < _start || (_disp->inv_p && isFullScreen(_disp->inv_areas[0]))) from = 0;
+        for (uint16_t i = from; i < _disp->inv_p; i++) px += lv_area_get_size(&_disp->inv_areas[i]);
+        return px;
+    }
+
+private:
+    lv_disp_t* _disp {nullptr};
+    uint16_t _start {0};
+    bool _fullBefore {false};
+
+    bool isFullScreen(const lv_area_t& a) const {
+        return a.x1 == 0 && a.y1 == 0 && a.x2 == lv_disp_get_hor_res(_disp) - 1 && a.y2 == lv_disp_get_ver_res(_disp) - 1;
+    }
+};
@@ -5,6 +5,14 @@
 #include "types/types.h"
 #include "config/config.h"
 #include "config/feature_flags.h"
+#include "display/ui_binding.h"
+
+// What update() cost in LVGL invalidation (see InvalidationMeter)
+struct UiUpdateStats {
+    uint32_t updates;
+    uint32_t lastInvalidatedPx;   // Pixels the last update() marked dirty (0 = nothing to redraw)
+    uint64_t invalidatedPx;       // Sum over all updates
+};
 
 class UIScreens {
 private:
@@ -18,7 +26,7 @@ private:
     lv_obj_t* tempLabel;
     lv_obj_t* targetTempLabel;
     lv_obj_t* statusLabel;
-    lv_obj_t* sensorLabels[4];
+    lv_obj_t* sensorList;        // One line per registered probe (SensorRegistry::formatZoneList)
     lv_obj_t* timeLabel;
     lv_obj_t* modeLabel;
     lv_obj_t* compressorIcon;
@@ -46,6 +54,17 @@ private:
     bool serviceMenuActive;
     lv_obj_t* alarmZone;
     lv_obj_t* alarmZoneLabel;
+
+    // Everything update() writes goes through a binding: LVGL is only called on a visible change
+    BoundLabel tempBinding;
+    BoundLabel targetBinding;
+    BoundLabel statusBinding;
+    BoundLabel timeBinding;
+    BoundLabel sensorBinding;
+    BoundLabel faultBinding;
+    BoundLabel alarmBinding;
+    BoundVisibility faultVisibility;
+    UiUpdateStats updateStats;
     
 #ifdef ENABLE_DIAG_OVERLAY
     lv_obj_t* diagLabel;
@@ -57,7 +76,7 @@ private:
     void createServiceHotspot();
     void updateFaultOverlay(const SystemData& data);
     static void serviceHotspotEvent(lv_event_t* e);
-    void updateAlarmVisuals(const SystemData& data);
+    void updateAlarmVisuals(const SystemData& data, lv_color_t& tempColor);
     
     void createStyles();
     void createMainScreen();
@@ -84,6 +103,7 @@ public:
     void showAlert(const char* message);
     
     lv_obj_t* getCurrentScreen() { return currentScreen; }
+    const UiUpdateStats& getUpdateStats() const { return updateStats; }
 };
 
 // Global UI instance
@@ -0,0 +1,112 @@
+#pragma once
+// Single-producer / single-consumer event ring.
+// Every push() is stamped with a monotonic sequence number, including pushes dropped because the
+// ring was full, so the consumer sees drops as gaps in the sequence and dropped() says how many.
+// The producer only writes _head and the consumer only writes _tail; a slot is published by the
+// release store of _head and handed back by the release store of _tail. Neither side blocks.
+// Storage is allocated once, from PSRAM on target when available: by the sized constructor, or by
+// begin() for instances that are globals (no heap work in static constructors). One producer task
+// and one consumer task per instance.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <atomic>
+#include <type_traits>
+#ifndef UNIT_TEST_NATIVE
+#include <esp_heap_caps.h>
+#endif
+
+template <typename T>
+class SpscRing {
+    static_assert(std::is_trivially_copyable<T>::value, "SpscRing payload must be trivially copyable");
+public:
+    struct Entry {
+        uint32_t seq;
+        T value;
+    };
+
+    SpscRing() {}
+    explicit SpscRing(uint32_t capacity) { allocate(capacity); }
+    // Copies get their own empty ring of the same capacity (events belong to the original's consumer)
+    SpscRing(const SpscRing& other) { if (other._capacity) allocate(other._capacity); }
+    SpscRing& operator=(const SpscRing& other) {
+        if (this != &other) { release(); if (other._capacity) allocate(other._capacity); }
+        return *this;
+    }
+    ~SpscRing() { release(); }
+
+    // Allocates storage for a ring constructed without; before the producer and consumer start.
+    // Until then every push() is a counted drop.
+    bool begin(uint32_t capacity) {
+        if (!_slots) allocate(capacity);
+        return _slots != nullptr;
+    }
+
+    // Producer. Returns false (and counts a drop) when the ring is full or has no storage.
+    bool push(const T& value) {
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        if (!_slots || head - _tail.load(std::memory_order_acquire) >= _capacity) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        Entry& e = _slots[head & (_capacity - 1)];
+        e.seq = seq;
+        e.value = value;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer. Copies up to max oldest entries into out and frees their slots; returns the count.
+    size_t drain(Entry* out, size_t max) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        uint32_t avail = _head.load(std::memory_order_acquire) - tail;
+        size_t n = avail < max ? avail : max;
+        for (size_t i = 0; i < n; ++i) out[i] = _slots[(tail + i) & (_capacity - 1)];
+        _tail.store(tail + (uint32_t)n, std::memory_order_release);
+        return n;
+    }
+
+    uint32_t size() const { return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire); }
+    uint32_t capacity() const { return _capacity; }
+    uint32_t nextSequence() const { return _seq.load(std::memory_order_relaxed); }   // Events produced so far
+    uint32_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+    bool inPsram() const { return _psram; }
+
+private:
+    Entry* _slots = nullptr;
+    uint32_t _capacity = 0;
+    bool _psram = false;
+    std::atomic<uint32_t> _head {0};
+    std::atomic<uint32_t> _tail {0};
+    std::atomic<uint32_t> _seq {0};
+    std::atomic<uint32_t> _dropped {0};
+
+    void allocate(uint32_t capacity) {
+        uint32_t cap = 1;
+        while (cap < capacity) cap <<= 1;   // Power of two so indices wrap with a mask
+        size_t bytes = (size_t)cap * sizeof(Entry);
+#ifndef UNIT_TEST_NATIVE
+        _slots = (Entry*)heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+        _psram = _slots != nullptr;
+#endif
+        if (!_slots) _slots = (Entry*)malloc(bytes);
+        _capacity = _slots ? cap : 0;
+        _head.store(0, std::memory_order_relaxed);
+        _tail.store(0, std::memory_order_relaxed);
+        _seq.store(0, std::memory_order_relaxed);
+        _dropped.store(0, std::memory_order_relaxed);
+    }
+
+    void release() {
+        if (!_slots) return;
+#ifndef UNIT_TEST_NATIVE
+        heap_caps_free(_slots);
+#else
+        free(_slots);
+#endif
+        _slots = nullptr;
+        _capacity = 0;
+    }
+};
@@ -0,0 +1,60 @@
+#pragma once
+// Single-writer sequence lock for publishing small POD snapshots across cores.
+// The writer never blocks; readers retry while a publish is in flight (odd sequence) or when the
+// sequence moved underneath them. Payload words are relaxed atomics so a concurrent copy is not a
+// data race; the sequence fences order them. One writer task per instance.
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock payload must be trivially copyable");
+public:
+    SeqLock() { publish(T()); }
+    explicit SeqLock(const T& initial) { publish(initial); }
+    // Copies are a snapshot of the source; only meaningful while no writer is active (e.g. test resets)
+    SeqLock(const SeqLock& other) { publish(other.read()); }
+    SeqLock& operator=(const SeqLock& other) { if (this != &other) publish(other.read()); return *this; }
+
+    void publish(const T& value) {
+        uint32_t words[WORDS] = {};
+        memcpy(words, &value, sizeof(T));
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORDS; ++i) _words[i].store(words[i], std::memory_order_relaxed);
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    // Single attempt; false if a publish overlapped the copy.
+    bool tryRead(T& out) const {
+        uint32_t before = _seq.load(std::memory_order_acquire);
+        if (before & 1u) return false;
+        uint32_t words[WORDS];
+        for (size_t i = 0; i < WORDS; ++i) words[i] = _words[i].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_seq.load(std::memory_order_relaxed) != before) return false;
+        memcpy(&out, words, sizeof(T));
+        return true;
+    }
+
+    T read() const {
+        T out;
+        while (!tryRead(out)) {
+            _retries.fetch_add(1, std::memory_order_relaxed);
+        }
+        return out;
+    }
+
+    uint32_t sequence() const { return _seq.load(std::memory_order_acquire) >> 1; }   // Completed publishes
+    uint32_t retries() const { return _retries.load(std::memory_order_relaxed); }     // Reader contention counter
+
+private:
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    std::atomic<uint32_t> _seq {0};
+    std::atomic<uint32_t> _words[WORDS];
+    mutable std::atomic<uint32_t> _retries {0};
+};
@@ -11,14 +11,18 @@ constexpr BaseType_t CORE_APP = 1;     // Core 1 for control logic, sensors, net
 // Stack sizes (adjust after profiling)
 constexpr uint32_t STACK_LVGL_TASK    = 6144;   // LVGL rendering / flush
 constexpr uint32_t STACK_DISPLAY_TASK = 4096;   // Non-LVGL display housekeeping (if split)
-constexpr uint32_t STACK_TOUCH_TASK   = 2048;   // Touch polling (if separate)
+constexpr uint32_t STACK_FLUSH_TASK   = 3072;   // LVGL band copy into the panel framebuffer
+constexpr uint32_t STACK_BAND_TASK    = 6144;   // LVGL band unit 1: draws like the LVGL task
+constexpr uint32_t STACK_TOUCH_TASK   = 3072;   // GT911 report reads (IRQ-woken, DisplayDriver)
 constexpr uint32_t STACK_CONTROL_TASK = 4096;   // Control loop
 constexpr uint32_t STACK_SENSOR_TASK  = 4096;   // Sensor acquisition
 constexpr uint32_t STACK_LOG_TASK     = 3072;   // Logging / SD
 
 // Periods (ms)
-constexpr uint32_t PERIOD_LVGL    = 10;   // 100Hz handler
-constexpr uint32_t PERIOD_CONTROL = 250;  // 4Hz control loop (adjust)
+constexpr uint32_t PERIOD_LVGL    = 10;   // 100Hz handler (fixed pacing, ENABLE_ADAPTIVE_LVGL_PACING off)
+constexpr uint32_t PERIOD_LVGL_MAX_SLEEP = 1000; // Adaptive pacing: longest sleep with no LVGL timer due
+constexpr uint32_t PERIOD_CONTROL = 250;  // 4Hz control loop (legacy polling cadence, native replay baseline)
+constexpr uint32_t PERIOD_CONTROL_MAX_SLEEP = 2000; // Event-driven control: longest sleep without sample/deadline
 constexpr uint32_t PERIOD_SENSOR  = 1000; // 1Hz sensors
 constexpr uint32_t PERIOD_LOG     = 5000; // 0.2Hz logging
 
@@ -26,6 +30,11 @@ constexpr uint32_t PERIOD_LOG     = 5000; // 0.2Hz logging
 constexpr UBaseType_t PRIO_LVGL    = configMAX_PRIORITIES - 1;
 constexpr UBaseType_t PRIO_DISPLAY = configMAX_PRIORITIES - 2;
 constexpr UBaseType_t PRIO_TOUCH   = configMAX_PRIORITIES - 3;
-constexpr UBaseType_t PRIO_CONTROL = tskIDLE_PRIORITY + 3;
-constexpr UBaseType_t PRIO_SENSOR  = tskIDLE_PRIORITY + 2;
+// CORE_APP: control and sensors preempt the display work lent to this core, never the reverse.
+// Worst case, a frame's band or flush copy waits out one control pass and the ~11 ms of sensor
+// scratchpad reads (the 750 ms conversion sleeps), once per second at the sensor period.
+constexpr UBaseType_t PRIO_CONTROL = tskIDLE_PRIORITY + 5;
+constexpr UBaseType_t PRIO_SENSOR  = tskIDLE_PRIORITY + 4;
+constexpr UBaseType_t PRIO_FLUSH   = tskIDLE_PRIORITY + 3;   // Short copies, ahead of the band unit
+constexpr UBaseType_t PRIO_BAND    = tskIDLE_PRIORITY + 2;
 constexpr UBaseType_t PRIO_LOG     = tskIDLE_PRIORITY + 1;
@@ -0,0 +1,225 @@
+// Non-blocking DS18B20 conversion pipeline.
+// One Convert T is broadcast to every probe, then each probe's scratchpad is collected once its own
+// resolution-specific conversion time has elapsed (9-bit probes are read long before 12-bit ones).
+// service() does at most one bus transaction per call and returns how long the caller may sleep,
+// so the sensor task never spins through the 750 ms 12-bit conversion.
+//
+// Bus requirements (DallasBus on target, MockOneWireBus in native tests):
+//   bool startConversion();                                   // reset, skip ROM, 0x44
+//   bool readScratchpad(const uint8_t rom[8], uint8_t sp[9]); // reset, match ROM, 0xBE, 9 bytes
+//   bool writeResolution(const uint8_t rom[8], uint8_t bits);
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+namespace ds18b20 {
+
+constexpr uint8_t ROM_LEN = 8;
+constexpr uint8_t SCRATCHPAD_LEN = 9;
+
+// Dallas/Maxim CRC-8 (x^8 + x^5 + x^4 + 1, reflected)
+inline uint8_t crc8(const uint8_t* data, uint8_t len) {
+    uint8_t crc = 0;
+    while (len--) {
+        uint8_t in = *data++;
+        for (uint8_t i = 0; i < 8; i++) {
+            uint8_t mix = (crc ^ in) & 0x01;
+            crc >>= 1;
+            if (mix) crc ^= 0x8C;
+            in >>= 1;
+        }
+    }
+    return crc;
+}
+
+// Datasheet maximum conversion time per resolution (t_CONV), rounded up
+inline uint32_t conversionMs(uint8_t bits) {
+    switch (bits) {
+        case 9:  return 94;
+        case 10: return 188;
+        case 11: return 375;
+        default: return 750;
+    }
+}
+
+// Configuration register value (scratchpad byte 4) for a resolution
+inline uint8_t configRegister(uint8_t bits) { return (uint8_t)(((bits - 9) << 5) | 0x1F); }
+
+// Temperature register after power-on (+85 C). A probe that reset after Convert T (brown-out, loose
+// supply) never converted and returns it with a valid CRC.
+inline bool powerOnValue(const uint8_t sp[SCRATCHPAD_LEN]) {
+    return sp[0] == 0x50 && sp[1] == 0x05 && crc8(sp, SCRATCHPAD_LEN - 1) == sp[SCRATCHPAD_LEN - 1];
+}
+
+// Validates and decodes a scratchpad. Rejects CRC mismatches, the all-zero pattern a missing probe
+// produces (its CRC is also zero) and, unless the conversion is confirmed, the power-on value.
+inline bool decode(const uint8_t sp[SCRATCHPAD_LEN], float& outC, bool conversionConfirmed = false) {
+    bool allZero = true;
+    for (uint8_t i = 0; i < SCRATCHPAD_LEN; i++) if (sp[i]) { allZero = false; break; }
+    if (allZero || crc8(sp, SCRATCHPAD_LEN - 1) != sp[SCRATCHPAD_LEN - 1]) return false;
+    if (!conversionConfirmed && powerOnValue(sp)) return false;
+    int16_t raw = (int16_t)((sp[1] << 8) | sp[0]);
+    uint8_t bits = (uint8_t)(9 + ((sp[4] >> 5) & 0x03));
+    raw &= (int16_t)(0xFFFF << (12 - bits));   // Low bits are undefined below 12-bit
+    outC = raw / 16.0f;
+    return true;
+}
+
+} // namespace ds18b20
+
+struct Ds18b20Channel {
+    uint8_t rom[ds18b20::ROM_LEN];
+    uint8_t resolution;
+    uint8_t attempts;          // Scratchpad reads this cycle
+    bool collected;            // Finished this cycle (good reading or retries exhausted)
+    bool ok;                   // Last cycle produced a CRC-valid reading
+    float tempC;
+    uint32_t readyAt;          // Conversion complete (ms, caller clock)
+    uint32_t collectedAt;
+    uint16_t crcErrors;        // Lifetime counters
+    uint16_t failures;
+    uint16_t notReady;         // Power-on value read back: probe reset, no conversion this cycle
+};
+
+template <typename Bus, uint8_t N>
+class Ds18b20Pipeline {
+public:
+    explicit Ds18b20Pipeline(Bus& bus, uint32_t periodMs = 1000, uint8_t crcRetries = 2)
+        : _bus(bus), _periodMs(periodMs), _crcRetries(crcRetries) {}
+
+    // Registers a probe; returns its channel index or -1 when full / resolution write failed
+    int add(const uint8_t rom[ds18b20::ROM_LEN], uint8_t bits) {
+        if (_count >= N) return -1;
+        Ds18b20Channel& ch = _ch[_count];
+        memset(&ch, 0, sizeof(ch));
+        memcpy(ch.rom, rom, ds18b20::ROM_LEN);
+        ch.collected = true;
+        if (!setResolution(_count, bits)) return -1;
+        return _count++;
+    }
+
+    bool setResolution(uint8_t idx, uint8_t bits) {
+        if (idx >= N) return false;
+        if (bits < 9) bits = 9;
+        if (bits > 12) bits = 12;
+        if (!_bus.writeResolution(_ch[idx].rom, bits)) return false;
+        _ch[idx].resolution = bits;
+        return true;
+    }
+
+    void setPeriod(uint32_t periodMs) { _periodMs = periodMs; }
+
+    // Advances the pipeline; returns ms until the next bus action is due (0 = call again now)
+    uint32_t service(uint32_t nowMs) {
+        if (_count == 0) return _periodMs;
+        if (!_converting) {
+            if (_started && (uint32_t)(nowMs - _cycleStart) < _periodMs) return _periodMs - (nowMs - _cycleStart);
+            startCycle(nowMs);
+            return nextWait(nowMs);
+        }
+        // Collect the due probe that became ready first
+        int due = -1;
+        for (uint8_t i = 0; i < _count; i++) {
+            const Ds18b20Channel& ch = _ch[i];
+            if (ch.collected || (int32_t)(nowMs - ch.readyAt) < 0) continue;
+            if (due < 0 || (int32_t)(ch.readyAt - _ch[due].readyAt) < 0) due = i;
+        }
+        if (due >= 0) collect(_ch[due], nowMs);
+        bool pending = false;
+        for (uint8_t i = 0; i < _count; i++) if (!_ch[i].collected) { pending = true; break; }
+        if (!pending) {
+            _converting = false;
+            _cycleDone = true;
+            _cycles++;
+        }
+        return nextWait(nowMs);
+    }
+
+    // True once per completed cycle (all probes collected or given up)
+    bool takeCycle() { bool d = _cycleDone; _cycleDone = false; return d; }
+
+    uint8_t count() const { return _count; }
+    const Ds18b20Channel& channel(uint8_t idx) const { return _ch[idx]; }
+    bool converting() const { return _converting; }
+    uint32_t cycleStart() const { return _cycleStart; }
+    uint32_t cycles() const { return _cycles; }
+
+private:
+    Bus& _bus;
+    Ds18b20Channel _ch[N] = {};
+    uint8_t _count = 0;
+    uint32_t _periodMs;
+    uint8_t _crcRetries;
+    uint32_t _cycleStart = 0;
+    uint32_t _cycles = 0;
+    bool _started = false;
+    bool _converting = false;
+    bool _cycleDone = false;
+
+    void startCycle(uint32_t nowMs) {
+        _started = true;
+        _cycleStart = nowMs;
+        if (!_bus.startConversion()) {
+            // No presence pulse: every probe fails this cycle, try again next period
+            for (uint8_t i = 0; i < _count; i++) { _ch[i].ok = false; _ch[i].failures++; }
+            _cycleDone = true;
+            _cycles++;
+            return;
+        }
+        _converting = true;
+        for (uint8_t i = 0; i < _count; i++) {
+            _ch[i].readyAt = nowMs + ds18b20::conversionMs(_ch[i].resolution);
+            _ch[i].collected = false;
+            _ch[i].attempts = 0;
+        }
+    }
+
+    void collect(Ds18b20Channel& ch, uint32_t nowMs) {
+        uint8_t sp[ds18b20::SCRATCHPAD_LEN];
+        ch.attempts++;
+        float t;
+        bool read = _bus.readScratchpad(ch.rom, sp);
+        // +85 C only counts as a conversion when the probe was already reading about that
+        bool confirmed = ch.ok && ch.tempC > 84.0f;
+        if (read && ds18b20::decode(sp, t, confirmed)) {
+            ch.tempC = t;
+            ch.ok = true;
+            ch.collected = true;
+            ch.collectedAt = nowMs;
+            return;
+        }
+        if (read && ds18b20::powerOnValue(sp)) {
+            // Not ready rather than corrupt: a re-read returns the same bytes until the next Convert T
+            ch.ok = false;
+            ch.notReady++;
+            ch.collected = true;
+            ch.collectedAt = nowMs;
+            return;
+        }
+        ch.crcErrors++;
+        if (ch.attempts > _crcRetries) {
+            ch.ok = false;
+            ch.failures++;
+            ch.collected = true;
+            ch.collectedAt = nowMs;
+        }
+        // Otherwise stays due: re-read on the next service() call
+    }
+
+    uint32_t nextWait(uint32_t nowMs) const {
+        if (!_converting) {
+            uint32_t elapsed = nowMs - _cycleStart;
+            return elapsed >= _periodMs ? 0 : _periodMs - elapsed;
+        }
+        uint32_t wait = _periodMs;
+        for (uint8_t i = 0; i < _count; i++) {
+            if (_ch[i].collected) continue;
+            int32_t r = (int32_t)(_ch[i].readyAt - nowMs);
+            if (r <= 0) return 0;
+            if ((uint32_t)r < wait) wait = (uint32_t)r;
+        }
+        return wait;
+    }
+};
@@ -0,0 +1,98 @@
+// Streaming per-probe filter stage between the DS18B20 readings and the controller.
+// Each good sample goes through a rolling median (drops single-sample glitches such as the 85 °C
+// power-on value), then a rate-of-change clamp (limits how far a reading may move per second), then
+// an EMA. State is a fixed-size POD per probe; no allocation, no floating-point division per sample.
+// Configuration is per zone (SensorRegistry::setZoneFilter); a window of 1, alpha of 1 and rate of 0
+// pass samples through unchanged. With the median on, output starts only once three samples are in,
+// so a bad first reading cannot become the baseline the rate clamp then holds on to.
+
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef SENSOR_FILTER_MAX_WINDOW
+#define SENSOR_FILTER_MAX_WINDOW 7   // Largest median window (odd)
+#endif
+
+struct SensorFilterConfig {
+    uint8_t medianWindow;   // 1..SENSOR_FILTER_MAX_WINDOW, odd; 1 = off
+    float emaAlpha;         // (0, 1]; 1 = off
+    float maxRateCPerS;     // Largest accepted change per second; 0 = off
+};
+
+struct SensorFilterState {
+    float window[SENSOR_FILTER_MAX_WINDOW];
+    float out;              // Last filtered value
+    uint32_t lastMs;        // Time of the last filtered sample
+    uint8_t head;
+    uint8_t fill;
+    bool primed;
+    uint16_t clamped;       // Samples limited by the rate clamp (diagnostics)
+};
+
+namespace sensor_filter {
+
+inline SensorFilterConfig sanitize(SensorFilterConfig c) {
+    if (c.medianWindow < 1) c.medianWindow = 1;
+    if (c.medianWindow > SENSOR_FILTER_MAX_WINDOW) c.medianWindow = SENSOR_FILTER_MAX_WINDOW;
+    if ((c.medianWindow & 1) == 0) c.medianWindow--;
+    if (!(c.emaAlpha > 0.0f) || c.emaAlpha > 1.0f) c.emaAlpha = 1.0f;
+    if (!(c.maxRateCPerS > 0.0f)) c.maxRateCPerS = 0.0f;
+    return c;
+}
+
+inline void reset(SensorFilterState& s) { memset(&s, 0, sizeof(s)); }
+
+// Median of the newest n window entries (n <= SENSOR_FILTER_MAX_WINDOW); insertion sort on a copy
+inline float median(const SensorFilterState& s, uint8_t n) {
+    float v[SENSOR_FILTER_MAX_WINDOW];
+    for (uint8_t i = 0; i < n; i++) {
+        uint8_t slot = (uint8_t)((s.head + SENSOR_FILTER_MAX_WINDOW - 1 - i) % SENSOR_FILTER_MAX_WINDOW);
+        float x = s.window[slot];
+        uint8_t j = i;
+        while (j && v[j - 1] > x) { v[j] = v[j - 1]; j--; }
+        v[j] = x;
+    }
+    return v[n / 2];
+}
+
+// Samples after reset() before the first output: the median of 3 outvotes one bad reading
+inline uint8_t primeCount(const SensorFilterConfig& c) { return c.medianWindow >= 3 ? 3 : 1; }
+
+// Feeds one good reading taken at nowMs; returns the filtered value, or NAN while the filter is
+// still priming (primeCount() samples after reset(); s.primed tells them apart).
+inline float step(SensorFilterState& s, const SensorFilterConfig& c, float x, uint32_t nowMs) {
+    s.window[s.head] = x;
+    s.head = (uint8_t)((s.head + 1) % SENSOR_FILTER_MAX_WINDOW);
+    if (s.fill < SENSOR_FILTER_MAX_WINDOW) s.fill++;
+    if (!s.primed) {
+        const uint8_t p = primeCount(c);
+        if (s.fill < p) return NAN;
+        s.out = p > 1 ? median(s, p) : x;
+        s.lastMs = nowMs;
+        s.primed = true;
+        return s.out;
+    }
+
+    // Median over what is available until the window fills (odd count so it stays a real sample).
+    // Clamped here too: an unsanitized window of 0 must not index past the window.
+    uint8_t n = s.fill < c.medianWindow ? s.fill : c.medianWindow;
+    if (n == 0) n = 1;
+    if ((n & 1) == 0) n--;
+    float m = n > 1 ? median(s, n) : x;
+
+    if (c.maxRateCPerS > 0.0f) {
+        float maxStep = c.maxRateCPerS * (float)(nowMs - s.lastMs) * 0.001f;
+        float d = m - s.out;
+        if (d > maxStep) { m = s.out + maxStep; s.clamped++; }
+        else if (d < -maxStep) { m = s.out - maxStep; s.clamped++; }
+    }
+
+    s.out += c.emaAlpha * (m - s.out);
+    s.lastMs = nowMs;
+    return s.out;
+}
+
+} // namespace sensor_filter
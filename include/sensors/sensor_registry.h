@@ -0,0 +1,101 @@
+#ifndef SENSOR_REGISTRY_H
+#define SENSOR_REGISTRY_H
+
+// Registry of every DS18B20 probe across all 1-Wire buses.
+// Struct-of-arrays so per-cycle passes (update, expiry, zone averages, log rows) touch only the
+// columns they need; ROM codes are indexed by an open-addressing hash (load factor <= 0.5) for
+// O(1) lookup. Good readings pass through the zone's filter stage (sensor_filter.h) before they are
+// stored, so everything downstream (controller, UI, log) sees filtered values. Written by the
+// sensor task only; readers (UI, logging) see per-probe word-sized values and may mix readings
+// from adjacent cycles across probes.
+
+#ifdef UNIT_TEST_NATIVE
+#include "test_support/arduino_stub.h"
+#else
+#include <Arduino.h>
+#endif
+#include "types/types.h"
+#include "config/config.h"
+#include "sensors/sensor_filter.h"
+
+class SensorRegistry {
+public:
+    static constexpr uint16_t CAPACITY = MAX_REGISTRY_SENSORS;
+    static constexpr uint16_t NOT_FOUND = 0xFFFF;
+    static constexpr uint8_t ALL_ZONES = 0xFF;
+
+    SensorRegistry();
+    void clear();
+
+    // Registers a probe; a known ROM returns its existing index. NOT_FOUND when full.
+    uint16_t add(const uint8_t rom[SENSOR_ROM_LEN], uint8_t bus, uint8_t zone);
+    uint16_t find(const uint8_t rom[SENSOR_ROM_LEN]) const;
+    bool setZone(uint16_t idx, uint8_t zone);   // Restarts the probe's filter
+    // Filter settings for every probe in a zone (sanitized; applies from the next sample)
+    bool setZoneFilter(uint8_t zone, const SensorFilterConfig& cfg);
+    const SensorFilterConfig& zoneFilter(uint8_t zone) const {
+        return _zoneFilter[zone < MAX_SENSOR_ZONES ? zone : 0];
+    }
+
+    // Writer side (sensor task)
+    // Raw reading; stores the filtered value. A new or timed-out probe turns valid once its filter
+    // is primed.
+    void setReading(uint16_t idx, float tempC, uint32_t nowMs);
+    void markFailed(uint16_t idx, uint32_t nowMs);   // Invalid once SENSOR_TIMEOUT passes without a good reading
+
+    uint16_t count() const { return _count; }
+    uint32_t layoutVersion() const { return _layout; }   // Bumps on add/zone change (log header, UI rebuild)
+    float temperature(uint16_t i) const { return _tempC[i]; }   // Filtered
+    float rawTemperature(uint16_t i) const { return _rawC[i]; }
+    uint16_t filterClamped(uint16_t i) const { return _filter[i].clamped; }
+    bool valid(uint16_t i) const { return _valid[i]; }
+    uint8_t zone(uint16_t i) const { return _zone[i]; }
+    uint8_t bus(uint16_t i) const { return _bus[i]; }
+    const uint8_t* rom(uint16_t i) const { return _rom[i]; }
+    uint32_t lastValidMs(uint16_t i) const { return _lastValid[i]; }
+    uint16_t validCount() const;
+    uint16_t zoneCount(uint8_t zone) const;
+
+    SensorData get(uint16_t i) const;
+    // Copies up to max probes of a zone into controller input records; returns the number copied
+    uint8_t collectZone(uint8_t zone, SensorData out[], uint8_t max) const;
+
+    // Variable-width output, one column/line per probe. Return chars written (excluding NUL);
+    // output is cut on a whole-column boundary when len is too small.
+    size_t formatLogHeader(char* buf, size_t len) const;   // "t_<16 hex ROM>,..."
+    size_t formatLogValues(char* buf, size_t len) const;   // "-18.06,,..." (empty = invalid)
+    size_t formatZoneList(char* buf, size_t len, uint8_t zone = ALL_ZONES) const;   // UI text
+
+    // Hash probe statistics (benchmark: stays ~1 probe per lookup as the registry fills)
+    uint32_t lookups() const { return _lookups; }
+    uint32_t probes() const { return _probes; }
+
+private:
+    static_assert((CAPACITY & (CAPACITY - 1)) == 0, "MAX_REGISTRY_SENSORS must be a power of two");
+    static constexpr uint16_t SLOTS = CAPACITY * 2;
+    static constexpr uint16_t EMPTY = 0xFFFF;
+
+    // Columns
+    uint8_t _rom[CAPACITY][SENSOR_ROM_LEN];
+    float _tempC[CAPACITY];
+    float _rawC[CAPACITY];
+    SensorFilterState _filter[CAPACITY];
+    uint32_t _lastValid[CAPACITY];
+    uint8_t _zone[CAPACITY];
+    uint8_t _bus[CAPACITY];
+    bool _valid[CAPACITY];
+    uint16_t _count;
+    uint32_t _layout;
+    SensorFilterConfig _zoneFilter[MAX_SENSOR_ZONES];
+    // ROM -> index
+    uint16_t _slots[SLOTS];
+    mutable uint32_t _lookups;
+    mutable uint32_t _probes;
+
+    static uint32_t hashRom(const uint8_t rom[SENSOR_ROM_LEN]);
+    uint16_t slotFor(const uint8_t rom[SENSOR_ROM_LEN]) const;
+};
+
+extern SensorRegistry sensorRegistry;
+
+#endif // SENSOR_REGISTRY_H
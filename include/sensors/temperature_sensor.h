@@ -6,13 +6,29 @@
 #include <DallasTemperature.h>
 #include "types/types.h"
 #include "config/config.h"
+#include "sensors/ds18b20_pipeline.h"
+#include "sensors/sensor_registry.h"
 
+// Raw bus access for Ds18b20Pipeline through DallasTemperature (conversion waits disabled in init)
+struct DallasBus {
+    DallasTemperature* dallas = nullptr;
+    bool startConversion() { dallas->requestTemperatures(); return true; }   // Absent probes fail at readback
+    bool readScratchpad(const uint8_t rom[8], uint8_t sp[9]) { return dallas->readScratchPad(rom, sp); }
+    bool writeResolution(const uint8_t rom[8], uint8_t bits) { return dallas->setResolution(rom, bits, true); }
+};
+
+// One 1-Wire bus. Probes found by the scan are registered in sensorRegistry (zone = bus by
+// default) and every completed conversion cycle is pushed there.
 class TemperatureSensor {
 public:
     TemperatureSensor();
     
-    bool init();
-    void update();
+    bool init(uint8_t pin = DS18B20_PIN, uint8_t busId = 0, SensorRegistry* registry = &sensorRegistry);
+    // Non-blocking: advances the conversion pipeline, returns ms until it next needs the bus
+    uint32_t update();
+    // True once per completed conversion cycle (fresh readings in getAllSensorData())
+    bool takeSample() { bool r = _sampleReady; _sampleReady = false; return r; }
+    bool setResolution(uint8_t index, uint8_t bits);
     uint8_t getSensorCount() const { return _sensorCount; }
     SensorData getSensorData(uint8_t index) const;
     SensorData* getAllSensorData() { return _sensors; }
@@ -22,17 +38,29 @@ public:
 private:
     OneWire* _oneWire;
     DallasTemperature* _dallas;
-    SensorData _sensors[MAX_SENSORS];
+    SensorData _sensors[MAX_PROBES_PER_BUS];
+    uint16_t _regIndex[MAX_PROBES_PER_BUS];
     uint8_t _sensorCount;
-    DeviceAddress _addresses[MAX_SENSORS];
+    uint8_t _busId;
+    SensorRegistry* _registry;
+    DeviceAddress _addresses[MAX_PROBES_PER_BUS];
     unsigned long _lastReadTime;
+    DallasBus _bus;
+    Ds18b20Pipeline<DallasBus, MAX_PROBES_PER_BUS> _pipeline {_bus, TEMP_READ_INTERVAL, DS18B20_CRC_RETRIES};
+    bool _sampleReady = false;
     
     void scanSensors();
-    String addressToString(DeviceAddress addr);
     bool isValidReading(float temp);
 };
 
-// Global sensor instance
-extern TemperatureSensor tempSensor;
+// One instance per pin in DS18B20_BUS_PINS
+extern TemperatureSensor tempSensors[MAX_ONEWIRE_BUSES];
+extern uint8_t tempSensorBusCount;
+
+// Scans every configured bus; returns the number of probes registered
+uint16_t initTemperatureBuses();
+// Services every bus; cycleDone is set once all populated buses have completed a cycle since the
+// last time it was reported. Returns ms until any bus next needs attention.
+uint32_t updateTemperatureBuses(bool& cycleDone);
 
 #endif // TEMPERATURE_SENSOR_H
\ No newline at end of file
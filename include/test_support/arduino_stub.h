@@ -14,9 +14,19 @@ using String = std::string;
 #ifndef LOW
 #define LOW  0x0
 #endif
+#ifndef INPUT
+#define INPUT 0x01
+#endif
+#ifndef OUTPUT
+#define OUTPUT 0x03
+#endif
+#ifndef INPUT_PULLUP
+#define INPUT_PULLUP 0x05
+#endif
 
 static unsigned long __fakeMillis = 0;
 inline unsigned long millis() { return __fakeMillis; }
+inline unsigned long micros() { return __fakeMillis * 1000UL; }
 inline void delay(unsigned long ms) { __fakeMillis += ms; }
 inline void pinMode(int, int) {}
 inline void digitalWrite(int, int) {}
@@ -25,9 +35,8 @@ inline void ledcAttachPin(int,int) {}
 inline void ledcWrite(int,int) {}
 inline long map(long x,long in_min,long in_max,long out_min,long out_max){return (x-in_min)*(out_max-out_min)/(in_max-in_min)+out_min;}
 
-template <typename T> inline T constrainT(T x,T a,T b){return x<a?a:(x>b?b:x);} 
-inline long constrain(long x,long a,long b){return constrainT<long>(x,a,b);} 
-inline float constrain(float x,float a,float b){return constrainT<float>(x,a,b);} 
+// Same macro form as Arduino.h so mixed argument types (uint8_t vs int literals) resolve identically
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
 inline float fabsf_wrap(float v){return v<0?-v:v;}
 #define fabs fabsf_wrap
 
@@ -0,0 +1,227 @@
+#pragma once
+// Deterministic freezer cabinet model + closed-loop replay harness (native tests only).
+// Two lumped thermal nodes (cabinet air, stored product) are driven by the controller's
+// compressor / heater / fan outputs and a seeded door-opening schedule. Plant time advances
+// on the stub virtual clock (__fakeMillis), so weeks of operation replay in seconds.
+
+#include <stdint.h>
+#include <chrono>
+#include "test_support/arduino_stub.h"
+#include "controllers/temperature_controller.h"
+
+struct FreezerPlantParams {
+    float ambientC = 25.0f;
+    float airCapacityJPerK = 60000.0f;       // Cabinet air + shelving + evaporator mass
+    float productCapacityJPerK = 600000.0f;  // Stored load (~150 kg frozen goods)
+    float wallUAWPerK = 3.0f;                // Insulation losses to ambient
+    float doorUAWPerK = 45.0f;               // Extra exchange while the door is open
+    float airProductUAWPerK = 20.0f;         // Air <-> product coupling
+    float compressorW = 380.0f;              // Heat extracted at 100% fan
+    float heaterW = 600.0f;                  // Defrost / heat relay element
+    float heaterToAirFraction = 0.05f;       // Remainder goes into melting coil ice
+    float fanW = 10.0f;                      // Motor heat at 100% PWM
+    float sensorNoiseC = 0.05f;              // Peak uniform noise before DS18B20 quantisation
+    uint32_t doorOpeningsPerDay = 24;
+    uint32_t doorOpenMs = 20000;
+    uint32_t seed = 0x5EED1234u;
+};
+
+class FreezerPlant {
+public:
+    explicit FreezerPlant(const FreezerPlantParams& p = FreezerPlantParams(), float initialC = DEFAULT_TARGET_TEMP)
+        : _p(p), _air(initialC), _product(initialC), _rng(p.seed) {
+        _doorInterval = _p.doorOpeningsPerDay ? (86400000UL / _p.doorOpeningsPerDay) : 0;
+        scheduleDoor(0);
+    }
+
+    // Advance the plant by dtMs at virtual time nowMs with the given actuator outputs.
+    void step(unsigned long nowMs, uint32_t dtMs, bool compressor, bool heater, uint8_t fanPct) {
+        if (_doorInterval) {
+            if (!_doorOpen && nowMs >= _doorAt) { _doorOpen = true; _doorOpenings++; }
+            if (_doorOpen && nowMs >= _doorAt + _p.doorOpenMs) { _doorOpen = false; scheduleDoor(nowMs); }
+        }
+        float dt = dtMs * 0.001f;
+        float fan = fanPct * 0.01f;
+        float q = _p.wallUAWPerK * (_p.ambientC - _air)
+                + _p.airProductUAWPerK * (_product - _air)
+                + _p.fanW * fan;
+        if (_doorOpen) q += _p.doorUAWPerK * (_p.ambientC - _air);
+        if (compressor) q -= _p.compressorW * (0.3f + 0.7f * fan); // Coil starves without airflow
+        if (heater) q += _p.heaterW * _p.heaterToAirFraction;
+        _air += q * dt / _p.airCapacityJPerK;
+        _product += _p.airProductUAWPerK * (_air - _product) * dt / _p.productCapacityJPerK;
+    }
+
+    // DS18B20-like reading of the air node: per-probe offset, bounded noise, 1/16 degC steps.
+    float sampleSensor(uint8_t idx) {
+        float noise = ((next() >> 8) * (1.0f / 16777216.0f) * 2.0f - 1.0f) * _p.sensorNoiseC;
+        float offset = (idx & 1) ? 0.1f : -0.1f;
+        return floorf((_air + offset + noise) * 16.0f + 0.5f) / 16.0f;
+    }
+
+    float airTemp() const { return _air; }
+    float productTemp() const { return _product; }
+    bool doorOpen() const { return _doorOpen; }
+    uint32_t doorOpenings() const { return _doorOpenings; }
+
+private:
+    FreezerPlantParams _p;
+    float _air;
+    float _product;
+    uint32_t _rng;
+    uint32_t _doorInterval {0};
+    unsigned long _doorAt {0};
+    bool _doorOpen {false};
+    uint32_t _doorOpenings {0};
+
+    uint32_t next() { _rng = _rng * 1664525u + 1013904223u; return _rng; }
+    void scheduleDoor(unsigned long fromMs) {
+        if (!_doorInterval) return;
+        _doorAt = fromMs + _doorInterval / 2 + (next() % _doorInterval);
+    }
+};
+
+struct PlantReplayOptions {
+    uint32_t days = 30;
+    uint32_t controlPeriodMs = 250;   // Polling cadence (PERIOD_CONTROL) when !eventDriven
+    uint32_t samplePeriodMs = 1000;   // sensorTask cadence (PERIOD_SENSOR)
+    uint32_t samplePhaseMs = 130;     // Sensor task is not phase-locked to the control task
+    uint32_t maxSleepMs = 2000;       // Event-driven idle cap (PERIOD_CONTROL_MAX_SLEEP)
+    uint32_t plantStepMs = 250;       // Max integration step
+    bool eventDriven = false;         // true: runControlCycle on new sample or deadline expiry
+    uint8_t sensorCount = 2;
+    float bandHalfWidthC = 2.0f;      // Time-in-band window around target
+};
+
+struct PlantRunStats {
+    uint64_t updates = 0;             // Controller invocations (one per control task wakeup)
+    uint64_t hostNs = 0;              // Host time for the whole replay loop (plant step included)
+    uint64_t plantMs = 0;
+    uint64_t inBandMs = 0;
+    uint64_t samples = 0;
+    uint64_t latencySumMs = 0;        // Sample taken -> control cycle that consumed it
+    uint32_t latencyMaxMs = 0;
+    uint32_t compressorCycles = 0;    // OFF -> ON transitions
+    uint32_t heaterCycles = 0;
+    uint32_t defrostCycles = 0;
+    uint32_t alarmCount = 0;          // alarmActive rising edges
+    uint32_t faultEdges[8] = {};      // Rising edges per FaultCodeBits position
+    uint32_t doorOpenings = 0;
+    uint32_t shortestCompressorOnMs = 0xFFFFFFFFu;
+    uint32_t shortestCompressorOffMs = 0xFFFFFFFFu;
+    float minAirC = 1000.0f;
+    float maxAirC = -1000.0f;
+
+    double nsPerUpdate() const { return updates ? (double)hostNs / (double)updates : 0.0; }
+    double timeInBand() const { return plantMs ? (double)inBandMs / (double)plantMs : 0.0; }
+    double wakeupsPerMinute() const { return plantMs ? updates * 60000.0 / (double)plantMs : 0.0; }
+    double meanLatencyMs() const { return samples ? (double)latencySumMs / (double)samples : 0.0; }
+};
+
+// Closed loop: plant -> sensors -> controller -> relays -> plant. Virtual time jumps between
+// events (sample, poll tick or controller deadline); the plant integrates across each gap.
+inline PlantRunStats runPlantReplay(TemperatureController& c, FreezerPlant& plant, const PlantReplayOptions& opt = PlantReplayOptions()) {
+    PlantRunStats st;
+    SensorData sensors[MAX_SENSORS] = {};
+    uint8_t count = opt.sensorCount > MAX_SENSORS ? MAX_SENSORS : opt.sensorCount;
+    const unsigned long endMs = __fakeMillis + (unsigned long)opt.days * 86400000UL;
+    const float target = c.getConfig().targetTemp;
+    bool lastCool = false, lastHeat = false, lastDefrost = false, lastAlarm = false;
+    uint32_t lastFaults = 0;
+    unsigned long compressorEdgeAt = __fakeMillis;
+    unsigned long nextSampleAt = __fakeMillis + opt.samplePhaseMs;
+    unsigned long nextPollAt = __fakeMillis;
+    unsigned long deadlineAt = __fakeMillis;
+    unsigned long sampleAt = 0;
+    bool pending = false;
+
+    auto t0 = std::chrono::steady_clock::now();
+    while (__fakeMillis < endMs) {
+        const unsigned long now = __fakeMillis;
+        if (now >= nextSampleAt) {
+            for (uint8_t i = 0; i < count; ++i) {
+                sensors[i].temperature = plant.sampleSensor(i);
+                sensors[i].valid = true;
+                sensors[i].timestamp = now;
+                sensors[i].lastValidReading = now;
+                sensors[i].sensorId = i;
+            }
+            sampleAt = now;
+            pending = true;
+            nextSampleAt += opt.samplePeriodMs;
+        }
+        bool wake = opt.eventDriven ? (pending || now >= deadlineAt) : (now >= nextPollAt);
+        if (wake) {
+            if (opt.eventDriven) {
+                c.runControlCycle(sensors, count);
+                deadlineAt = now + c.msUntilNextDeadline(opt.maxSleepMs);
+            } else {
+                c.updateWithMultipleSensors(sensors, count);
+                nextPollAt += opt.controlPeriodMs;
+            }
+            st.updates++;
+
+            const ControlState& s = c.getState();
+            if (pending && s.lastUpdate == now) { // Cycle actually ran on this sample
+                uint32_t lat = (uint32_t)(now - sampleAt);
+                st.samples++;
+                st.latencySumMs += lat;
+                if (lat > st.latencyMaxMs) st.latencyMaxMs = lat;
+                pending = false;
+            }
+            if (s.coolingActive != lastCool) {
+                uint32_t held = (uint32_t)(now - compressorEdgeAt);
+                if (s.coolingActive) {
+                    st.compressorCycles++;
+                    if (st.compressorCycles > 1 && held < st.shortestCompressorOffMs) st.shortestCompressorOffMs = held;
+                } else if (held < st.shortestCompressorOnMs) {
+                    st.shortestCompressorOnMs = held;
+                }
+                compressorEdgeAt = now;
+            }
+            if (s.heatingActive && !lastHeat) st.heaterCycles++;
+            if (s.defrostActive && !lastDefrost) st.defrostCycles++;
+            if (s.alarmActive && !lastAlarm) st.alarmCount++;
+            uint32_t risen = s.faultMask & ~lastFaults;
+            for (uint8_t b = 0; b < 8; ++b) if (risen & (1u << b)) st.faultEdges[b]++;
+            lastCool = s.coolingActive; lastHeat = s.heatingActive;
+            lastDefrost = s.defrostActive; lastAlarm = s.alarmActive;
+            lastFaults = s.faultMask;
+        }
+
+        unsigned long next = nextSampleAt;
+        unsigned long wakeAt = opt.eventDriven ? deadlineAt : nextPollAt;
+        if (wakeAt > now && wakeAt < next) next = wakeAt;
+        if (next > endMs) next = endMs;
+        if (next <= now) next = now + 1;
+        const ControlState& s = c.getState();
+        while (__fakeMillis < next) {
+            uint32_t dt = (uint32_t)(next - __fakeMillis);
+            if (dt > opt.plantStepMs) dt = opt.plantStepMs;
+            plant.step(__fakeMillis, dt, s.coolingActive, s.heatingActive, s.fanPWM);
+            __fakeMillis += dt;
+            st.plantMs += dt;
+            float air = plant.airTemp();
+            if (fabsf(air - target) <= opt.bandHalfWidthC) st.inBandMs += dt;
+            if (air < st.minAirC) st.minAirC = air;
+            if (air > st.maxAirC) st.maxAirC = air;
+        }
+    }
+    st.hostNs = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count();
+    st.doorOpenings = plant.doorOpenings();
+    return st;
+}
+
+inline void printPlantReport(const char* name, const PlantRunStats& st) {
+    printf("[plant] %s: %.1f days, %llu updates (%.1f wakeups/min), %.1f ns/update, %.2f s host\n", name,
+           st.plantMs / 86400000.0, (unsigned long long)st.updates, st.wakeupsPerMinute(), st.nsPerUpdate(), st.hostNs / 1e9);
+    printf("[plant]   sample->control latency mean %.1f ms, max %u ms\n", st.meanLatencyMs(), st.latencyMaxMs);
+    printf("[plant]   compressor cycles %u (shortest on %u ms, off %u ms), heater cycles %u, defrosts %u, doors %u\n",
+           st.compressorCycles, st.shortestCompressorOnMs, st.shortestCompressorOffMs,
+           st.heaterCycles, st.defrostCycles, st.doorOpenings);
+    printf("[plant]   time-in-band %.1f%%, air %.2f..%.2f C, alarms %u, fault edges [miss %u range %u over %u under %u defrost %u short %u]\n",
+           st.timeInBand() * 100.0, st.minAirC, st.maxAirC, st.alarmCount,
+           st.faultEdges[FAULT_SENSOR_MISSING_BIT], st.faultEdges[FAULT_SENSOR_RANGE_BIT],
+           st.faultEdges[FAULT_OVER_TEMPERATURE_BIT], st.faultEdges[FAULT_UNDER_TEMPERATURE_BIT],
+           st.faultEdges[FAULT_DEFROST_TIMEOUT_BIT], st.faultEdges[FAULT_COMPRESSOR_SHORT_CYCLE_BIT]);
+}
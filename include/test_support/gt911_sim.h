@@ -0,0 +1,100 @@
+#pragma once
+// Native GT911 register model behind a TwoWire-shaped bus, for test/native_touch.
+// Answers at one 7-bit address, keeps a register pointer set by the first two written bytes, and
+// serves the status byte (0x814E) followed by the point records. report() latches a new report
+// with the ready bit set and counts an IRQ edge; writing 0 to 0x814E acknowledges it. Every
+// transaction is counted with its bytes and its wire time at I2C_FREQ (9 clocks per byte plus
+// start/stop), which is the time the calling task holds the bus.
+
+#include <stdint.h>
+#include <string.h>
+#include "display/gt911.h"
+
+class Gt911Sim {
+public:
+    static constexpr uint16_t REG_POINTS = 0x814F;
+    static constexpr uint16_t REG_END = REG_POINTS + GT911T<Gt911Sim>::POINT_LEN * TOUCH_MAX_POINTS;
+
+    uint8_t address = GT911_ADDRESS_1;
+    bool present = true;
+    // Observations
+    uint32_t transactions = 0;   // Address phases (write or read)
+    uint32_t bytes = 0;          // Data bytes on the wire, both directions
+    uint64_t busUs = 0;
+    uint32_t irqs = 0;
+    uint32_t acks = 0;           // Status clears
+
+    // Latches a report of n points; overwrites an unacknowledged one like the controller does
+    void report(const TouchPoint* pts, uint8_t n) {
+        memset(_regs + 1, 0, sizeof(_regs) - 1);
+        for (uint8_t i = 0; i < n && i < TOUCH_MAX_POINTS; i++) {
+            uint8_t* p = _regs + 1 + i * GT911T<Gt911Sim>::POINT_LEN;
+            p[0] = pts[i].id;
+            p[1] = (uint8_t)(pts[i].x & 0xFF);
+            p[2] = (uint8_t)(pts[i].x >> 8);
+            p[3] = (uint8_t)(pts[i].y & 0xFF);
+            p[4] = (uint8_t)(pts[i].y >> 8);
+            p[5] = 0x20;   // Contact size
+        }
+        _regs[0] = (uint8_t)(GT911T<Gt911Sim>::STATUS_READY | n);
+        irqs++;
+    }
+    void release() { report(nullptr, 0); }
+    bool latched() const { return (_regs[0] & GT911T<Gt911Sim>::STATUS_READY) != 0; }
+
+    // Bus interface (subset of TwoWire)
+    void beginTransmission(uint8_t addr) {
+        _txAddr = addr;
+        _txLen = 0;
+    }
+    size_t write(uint8_t b) {
+        if (_txLen < sizeof(_tx)) _tx[_txLen++] = b;
+        return 1;
+    }
+    uint8_t endTransmission(bool stop = true) {
+        wire(_txLen, stop);
+        if (!present || _txAddr != address) return 2;   // Address NACK
+        if (_txLen >= 2) _ptr = (uint16_t)(_tx[0] << 8 | _tx[1]);
+        for (uint8_t i = 2; i < _txLen; i++) {
+            if (_ptr == GT911T<Gt911Sim>::REG_STATUS && _tx[i] == 0) {
+                _regs[0] = 0;
+                acks++;
+            }
+            _ptr++;
+        }
+        return 0;
+    }
+    uint8_t requestFrom(int addr, int len) {
+        wire((uint32_t)len, true);
+        _rxLen = _rxPos = 0;
+        if (!present || addr != address) return 0;
+        for (int i = 0; i < len && _rxLen < sizeof(_rx); i++, _ptr++) _rx[_rxLen++] = reg(_ptr);
+        return (uint8_t)_rxLen;
+    }
+    int read() { return _rxPos < _rxLen ? _rx[_rxPos++] : -1; }
+
+    void resetCounters() { transactions = bytes = irqs = acks = 0; busUs = 0; }
+
+private:
+    uint8_t _regs[1 + GT911T<Gt911Sim>::POINT_LEN * TOUCH_MAX_POINTS] = {};
+    uint16_t _ptr = 0;
+    uint8_t _txAddr = 0;
+    uint8_t _tx[16] = {};
+    uint8_t _txLen = 0;
+    uint8_t _rx[64] = {};
+    uint8_t _rxLen = 0;
+    uint8_t _rxPos = 0;
+
+    uint8_t reg(uint16_t r) const {
+        if (r >= GT911T<Gt911Sim>::REG_STATUS && r < REG_END) return _regs[r - GT911T<Gt911Sim>::REG_STATUS];
+        return 0;
+    }
+
+    // Address byte + data bytes (+ stop), 9 SCL clocks each
+    void wire(uint32_t n, bool stop) {
+        transactions++;
+        bytes += n;
+        const uint32_t clocks = 9 * (n + 1) + (stop ? 2 : 1);
+        busUs += (uint64_t)clocks * 1000000ULL / I2C_FREQ;
+    }
+};
@@ -0,0 +1,399 @@
+#pragma once
+// Headless LVGL display for host builds (test/native_ui).
+// A RAM framebuffer the size of the panel fed through DISPLAY_DRAW_BUF_LINES bands, like the
+// psram-bands strategy on the board, and a pointer device that replays a script of timed touches.
+// Time is virtual: advance() moves __fakeMillis and lv_tick_inc() together and runs the timer
+// handler, so animations and screenshots are reproducible. Every refresh that draws something is
+// recorded in a FrameProfiler (pixels rendered and flushed, render, flush, total), same fields as on
+// the board, and
+// scripted touches are traced to the frame that shows their effect with the board's
+// InputLatencyTrace hooks (feedback_cb, rounder_cb, last flush), in virtual time.
+// setBandUnits() renders in parallel like the band task on the board (LV_REFR_BAND_UNITS): units
+// 1.. are std::threads with their own band buffers. setDirectMode() swaps the bands for two
+// full-screen buffers in LVGL direct mode, like DRAW_BUF_DIRECT. recordInvalidations() keeps the
+// invalidated areas of every refresh as a trace to replay.
+//
+// Screenshots are RGB565 run-length files ("RL565", width, height, then count/value pairs of
+// little-endian uint16), small enough to keep as references next to the suite.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <string>
+#include <vector>
+#include <filesystem>
+#include <lvgl.h>
+#include "test_support/arduino_stub.h"
+#include "config/config.h"
+#include "display/frame_profiler.h"
+#include "display/input_latency.h"
+
+struct ScriptedTouch {
+    uint32_t atMs;       // Virtual time the state takes effect
+    int16_t x;
+    int16_t y;
+    bool pressed;
+};
+
+struct ShotDiff {
+    bool loaded;          // Reference found and of the same size
+    uint32_t pixels;      // Pixels that differ
+    lv_area_t bounds;     // Bounding box of the differing pixels
+};
+
+class HeadlessLvgl {
+public:
+    static constexpr int32_t W = DISPLAY_WIDTH;
+    static constexpr int32_t H = DISPLAY_HEIGHT;
+
+    ~HeadlessLvgl() { setBandUnits(1); }
+
+    // lv_init() and driver registration; call once per process
+    void begin(uint16_t bandLines = DISPLAY_DRAW_BUF_LINES) {
+        _fb.assign((size_t)W * H, 0);
+        _bandLines = bandLines;
+        _band1.resize((size_t)W * bandLines);
+        _band2.resize((size_t)W * bandLines);
+        lv_init();
+        lv_disp_draw_buf_init(&_drawBuf, _band1.data(), _band2.data(), (uint32_t)W * bandLines);
+        lv_disp_drv_init(&_dispDrv);
+#if LV_REFR_BAND_UNITS > 1
+        _dispDrv.band_units = 1;
+#endif
+        _dispDrv.hor_res = W;
+        _dispDrv.ver_res = H;
+        _dispDrv.draw_buf = &_drawBuf;
+        _dispDrv.flush_cb = flushCb;
+        _dispDrv.monitor_cb = monitorCb;
+        _dispDrv.rounder_cb = rounderCb;
+        _dispDrv.user_data = this;
+        _disp = lv_disp_drv_register(&_dispDrv);
+        lv_timer_set_cb(_lv_disp_get_refr_timer(_disp), refrTimerCb);
+        lv_indev_drv_init(&_indevDrv);
+        _indevDrv.type = LV_INDEV_TYPE_POINTER;
+        _indevDrv.read_cb = readCb;
+        _indevDrv.feedback_cb = feedbackCb;
+        _indevDrv.user_data = this;
+        _indev = lv_indev_drv_register(&_indevDrv);
+    }
+
+    lv_disp_t* disp() const { return _disp; }
+    const uint16_t* framebuffer() const { return _fb.data(); }
+    uint16_t pixel(int32_t x, int32_t y) const { return _fb[(size_t)y * W + x]; }
+    FrameProfiler& profile() { return _profile; }
+    InputLatencyTrace& latency() { return _latency; }
+    uint64_t pixelsRendered() const { return _pixelsTotal; }
+    uint32_t framesRendered() const { return _framesTotal; }
+    uint32_t nowMs() const { return (uint32_t)__fakeMillis; }
+    uint8_t bandUnits() const { return (uint8_t)(_bandThreads.size() + 1); }
+    bool directMode() const { return _dispDrv.direct_mode; }
+    // Appends the areas invalidated before each refresh to trace (nullptr stops)
+    void recordInvalidations(std::vector<std::vector<lv_area_t>>* trace) { _invTrace = trace; }
+
+    // 1..LV_REFR_BAND_UNITS band units; 1 stops the worker threads. False if out of range.
+    bool setBandUnits(uint8_t units) {
+#if LV_REFR_BAND_UNITS > 1
+        if (units < 1 || units > LV_REFR_BAND_UNITS) return false;
+        if (!_bandThreads.empty()) {
+            {
+                std::lock_guard<std::mutex> lock(_bandMutex);
+                _bandQuit = true;
+            }
+            _bandCv.notify_all();
+            for (std::thread& t : _bandThreads) t.join();
+            _bandThreads.clear();
+            _bandQuit = false;
+        }
+        _dispDrv.band_units = units;
+        _dispDrv.band_start_cb = units > 1 ? bandStartCb : nullptr;
+        _dispDrv.band_wait_cb = units > 1 ? bandWaitCb : nullptr;
+        _unitBands.resize((size_t)(LV_REFR_BAND_UNITS - 1) * 2);
+        for (uint8_t u = 1; u < units; u++) {
+            for (int b = 0; b < 2; b++) _unitBands[(u - 1) * 2 + b].resize((size_t)W * _bandLines);
+            _bandThreads.emplace_back(&HeadlessLvgl::bandLoop, this, u, _bandRound);
+        }
+        setUnitBuffers();
+        return true;
+#else
+        return units == 1;
+#endif
+    }
+
+    // Direct mode on two full-screen buffers, or back to the bands; the screen is redrawn
+    void setDirectMode(bool on) {
+        if (on) {
+            _full1.assign((size_t)W * H, lv_color_t{});
+            _full2.assign((size_t)W * H, lv_color_t{});
+            lv_disp_draw_buf_init(&_drawBuf, _full1.data(), _full2.data(), (uint32_t)W * H);
+        } else {
+            lv_disp_draw_buf_init(&_drawBuf, _band1.data(), _band2.data(), (uint32_t)W * _bandLines);
+        }
+        _dispDrv.direct_mode = on ? 1 : 0;
+        setUnitBuffers();
+        _lv_ll_clear(&_disp->sync_areas);   // Sync areas refer to the old buffers
+        lv_obj_invalidate(lv_scr_act());
+    }
+
+    // Runs LVGL for ms of virtual time in stepMs ticks
+    void advance(uint32_t ms, uint32_t stepMs = 5) {
+        while (ms) {
+            uint32_t dt = ms < stepMs ? ms : stepMs;
+            __fakeMillis += dt;
+            lv_tick_inc(dt);
+            lv_timer_handler();
+            ms -= dt;
+        }
+    }
+
+    // Renders whatever is invalidated right now (timed like a refresh timer run)
+    void refreshNow() { timedRefresh(nullptr); }
+
+    // Queues a touch state change at now + delayMs
+    void script(int16_t x, int16_t y, bool pressed, uint32_t delayMs = 0) {
+        _script.push_back(ScriptedTouch{ nowMs() + delayMs, x, y, pressed });
+    }
+    // Press, hold, release, then let LVGL settle
+    void tap(int16_t x, int16_t y, uint32_t holdMs = 100) {
+        script(x, y, true);
+        script(x, y, false, holdMs);
+        advance(holdMs + 2 * LV_INDEV_DEF_READ_PERIOD + LV_DISP_DEF_REFR_PERIOD);
+    }
+
+    // Screenshot I/O
+    bool saveShot(const std::string& path) const {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+        FILE* f = fopen(path.c_str(), "wb");
+        if (!f) return false;
+        const uint16_t hdr[4] = { 0x4C52, 0x3635, (uint16_t)W, (uint16_t)H };   // "RL56", size
+        fwrite(hdr, sizeof(hdr), 1, f);
+        size_t i = 0;
+        const size_t n = _fb.size();
+        while (i < n) {
+            uint16_t v = _fb[i];
+            uint16_t run = 1;
+            while (i + run < n && run < 0xFFFF && _fb[i + run] == v) run++;
+            const uint16_t pair[2] = { run, v };
+            fwrite(pair, sizeof(pair), 1, f);
+            i += run;
+        }
+        return fclose(f) == 0;
+    }
+
+    static bool loadShot(const std::string& path, std::vector<uint16_t>& out) {
+        FILE* f = fopen(path.c_str(), "rb");
+        if (!f) return false;
+        uint16_t hdr[4];
+        bool ok = fread(hdr, sizeof(hdr), 1, f) == 1 && hdr[0] == 0x4C52 && hdr[1] == 0x3635 && hdr[2] == W && hdr[3] == H;
+        out.clear();
+        uint16_t pair[2];
+        while (ok && fread(pair, sizeof(pair), 1, f) == 1) {
+            if (out.size() + pair[0] > (size_t)W * H) { ok = false; break; }
+            out.insert(out.end(), pair[0], pair[1]);
+        }
+        fclose(f);
+        return ok && out.size() == (size_t)W * H;
+    }
+
+    ShotDiff compareShot(const std::string& refPath) const {
+        ShotDiff d { false, 0, { W, H, -1, -1 } };
+        std::vector<uint16_t> ref;
+        if (!loadShot(refPath, ref)) return d;
+        d.loaded = true;
+        for (int32_t y = 0; y < H; y++) {
+            for (int32_t x = 0; x < W; x++) {
+                if (ref[(size_t)y * W + x] == _fb[(size_t)y * W + x]) continue;
+                d.pixels++;
+                if (x < d.bounds.x1) d.bounds.x1 = x;
+                if (y < d.bounds.y1) d.bounds.y1 = y;
+                if (x > d.bounds.x2) d.bounds.x2 = x;
+                if (y > d.bounds.y2) d.bounds.y2 = y;
+            }
+        }
+        return d;
+    }
+
+    // Binary PPM for looking at a failed comparison
+    bool savePpm(const std::string& path) const {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+        FILE* f = fopen(path.c_str(), "wb");
+        if (!f) return false;
+        fprintf(f, "P6\n%d %d\n255\n", (int)W, (int)H);
+        for (uint16_t c : _fb) {
+            const uint8_t rgb[3] = { (uint8_t)(((c >> 11) & 0x1F) * 255 / 31), (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+                                     (uint8_t)((c & 0x1F) * 255 / 31) };
+            fwrite(rgb, sizeof(rgb), 1, f);
+        }
+        return fclose(f) == 0;
+    }
+
+private:
+    std::vector<uint16_t> _fb;
+    std::vector<lv_color_t> _band1;
+    std::vector<lv_color_t> _band2;
+    std::vector<lv_color_t> _full1;
+    std::vector<lv_color_t> _full2;
+    uint16_t _bandLines {0};
+    std::vector<std::vector<lv_color_t>> _unitBands;   // Unit u: [(u - 1) * 2], [(u - 1) * 2 + 1]
+    std::vector<std::thread> _bandThreads;
+    std::mutex _bandMutex;
+    std::condition_variable _bandCv;
+    std::condition_variable _bandDoneCv;
+    uint32_t _bandRound {0};
+    uint8_t _bandActive {0};
+    uint8_t _bandPending {0};
+    bool _bandQuit {false};
+    lv_disp_draw_buf_t _drawBuf;
+    lv_disp_drv_t _dispDrv;
+    lv_disp_t* _disp {nullptr};
+    lv_indev_drv_t _indevDrv;
+    lv_indev_t* _indev {nullptr};
+    std::deque<ScriptedTouch> _script;
+    ScriptedTouch _touch { 0, 0, 0, false };
+    FrameProfiler _profile;
+    InputLatencyTrace _latency;
+    uint32_t _refreshSeq {0};
+    uint32_t _renderingSeq {0};
+    uint32_t _monitorPx {0};
+    bool _monitorHit {false};
+    uint64_t _flushNs {0};
+    uint32_t _flushCount {0};
+    uint32_t _flushPx {0};
+    std::vector<std::vector<lv_area_t>>* _invTrace {nullptr};
+    uint64_t _pixelsTotal {0};
+    uint32_t _framesTotal {0};
+
+    static uint64_t nowNs() {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void setUnitBuffers() {
+#if LV_REFR_BAND_UNITS > 1
+        for (uint8_t u = 1; u < bandUnits(); u++) {
+            lv_disp_draw_buf_set_band_bufs(&_drawBuf, u, _unitBands[(u - 1) * 2].data(), _unitBands[(u - 1) * 2 + 1].data());
+        }
+#endif
+    }
+
+#if LV_REFR_BAND_UNITS > 1
+    // Band unit `unit`: waits for a round that includes it, renders its band, reports back
+    void bandLoop(uint8_t unit, uint32_t seen) {
+        std::unique_lock<std::mutex> lock(_bandMutex);
+        while (true) {
+            _bandCv.wait(lock, [&] { return _bandQuit || _bandRound != seen; });
+            if (_bandQuit) return;
+            seen = _bandRound;
+            if (unit >= _bandActive) continue;
+            lock.unlock();
+            lv_refr_band_unit(_disp, unit);
+            lock.lock();
+            if (--_bandPending == 0) _bandDoneCv.notify_one();
+        }
+    }
+
+    static void bandStartCb(lv_disp_drv_t* drv, uint8_t units) {
+        HeadlessLvgl* self = (HeadlessLvgl*)drv->user_data;
+        {
+            std::lock_guard<std::mutex> lock(self->_bandMutex);
+            self->_bandActive = units;
+            self->_bandPending = (uint8_t)(units - 1);
+            self->_bandRound++;
+        }
+        self->_bandCv.notify_all();
+    }
+
+    static void bandWaitCb(lv_disp_drv_t* drv) {
+        HeadlessLvgl* self = (HeadlessLvgl*)drv->user_data;
+        std::unique_lock<std::mutex> lock(self->_bandMutex);
+        self->_bandDoneCv.wait(lock, [&] { return self->_bandPending == 0; });
+    }
+#endif
+
+    static void flushCb(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* px) {
+        HeadlessLvgl* self = (HeadlessLvgl*)drv->user_data;
+        uint64_t t0 = nowNs();
+        const int32_t w = area->x2 - area->x1 + 1;
+        // Direct mode hands over the whole buffer with the area drawn in place
+        const int32_t stride = drv->direct_mode ? W : w;
+        if (drv->direct_mode) px += (size_t)area->y1 * W + area->x1;
+        for (int32_t y = area->y1; y <= area->y2; y++) {
+            memcpy(&self->_fb[(size_t)y * W + area->x1], px, (size_t)w * sizeof(uint16_t));
+            px += stride;
+        }
+        self->_flushNs += nowNs() - t0;
+        self->_flushCount++;
+        self->_flushPx += (uint32_t)w * (area->y2 - area->y1 + 1);
+        if (lv_disp_flush_is_last(drv)) self->_latency.flushed(self->_renderingSeq, micros());
+        lv_disp_flush_ready(drv);
+    }
+
+    static void monitorCb(lv_disp_drv_t* drv, uint32_t, uint32_t px) {
+        HeadlessLvgl* self = (HeadlessLvgl*)drv->user_data;
+        self->_monitorPx = px;
+        self->_monitorHit = true;
+    }
+
+    static void rounderCb(lv_disp_drv_t* drv, lv_area_t*) {
+        HeadlessLvgl* self = (HeadlessLvgl*)drv->user_data;
+        if (self->_latency.awaitingInvalidation() && lv_indev_get_act()) self->_latency.invalidated(micros(), self->_refreshSeq + 1);
+    }
+
+    static void feedbackCb(lv_indev_drv_t* drv, uint8_t) {
+        HeadlessLvgl* self = (HeadlessLvgl*)drv->user_data;
+        if (self->_latency.awaitingDispatch()) self->_latency.dispatched(micros());
+    }
+
+    static void refrTimerCb(lv_timer_t* t) {
+        HeadlessLvgl* self = (HeadlessLvgl*)((lv_disp_t*)t->user_data)->driver->user_data;
+        self->timedRefresh(t);
+    }
+
+    void timedRefresh(lv_timer_t* t) {
+        const uint64_t flush0 = _flushNs;
+        const uint32_t flushes0 = _flushCount;
+        const uint32_t flushPx0 = _flushPx;
+        if (_invTrace && _disp->inv_p) _invTrace->emplace_back(_disp->inv_areas, _disp->inv_areas + _disp->inv_p);
+        _monitorHit = false;
+        _renderingSeq = _refreshSeq + 1;
+        uint64_t t0 = nowNs();
+        if (t) _lv_disp_refr_timer(t);
+        else lv_refr_now(_disp);
+        uint32_t totalUs = (uint32_t)((nowNs() - t0) / 1000);
+        _refreshSeq++;
+        if (!_monitorHit) return;
+        FrameSample s {};
+        s.seq = _refreshSeq;
+        s.pixels = _monitorPx;
+        s.flushedPixels = _flushPx - flushPx0;
+        s.flushUs = (uint32_t)((_flushNs - flush0) / 1000);
+        s.waitUs = 0;   // Flush is a synchronous copy, counted in flushUs
+        s.renderUs = totalUs > s.flushUs ? totalUs - s.flushUs : 0;
+        s.totalUs = totalUs;
+        s.flushes = (uint16_t)(_flushCount - flushes0);
+        _profile.record(s);
+        _pixelsTotal += s.pixels;
+        _framesTotal++;
+    }
+
+    static void readCb(lv_indev_drv_t* drv, lv_indev_data_t* data) {
+        HeadlessLvgl* self = (HeadlessLvgl*)drv->user_data;
+        // One state per read, so LVGL sees every press and release even if they are due together
+        if (!self->_script.empty() && self->_script.front().atMs <= self->nowMs()) {
+            self->_touch = self->_script.front();
+            self->_script.pop_front();
+            // The scripted change stands in for a report read at its due time
+            TouchFrame f {};
+            f.us = f.readUs = self->_touch.atMs * 1000;
+            f.count = self->_touch.pressed ? 1 : 0;
+            self->_latency.delivered(f, micros());
+        }
+        data->point.x = self->_touch.x;
+        data->point.y = self->_touch.y;
+        data->state = self->_touch.pressed ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    }
+};
@@ -0,0 +1,107 @@
+#pragma once
+// Native mock of a 1-Wire bus with DS18B20 probes, for test/native_ds18b20.
+// Keeps its own microsecond clock: every bus transaction advances it by the standard-speed wire
+// time (reset + bytes), which is exactly the time the calling task is blocked. Conversions run in
+// the background against the same clock, so reading a probe before its t_CONV returns the previous
+// value and is counted as an early read.
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "sensors/ds18b20_pipeline.h"
+
+struct MockOneWireTiming {
+    uint32_t resetUs = 960;    // Reset pulse + presence window
+    uint32_t byteUs = 520;     // 8 slots x 65 us
+};
+
+struct MockDs18b20 {
+    uint8_t rom[ds18b20::ROM_LEN] = {};
+    uint8_t resolution = 12;
+    float tempC = -18.0f;            // Value the next conversion will latch
+    float latchedC = 85.0f;          // Power-on scratchpad value
+    uint64_t convStartUs = 0;
+    bool converting = false;
+    uint16_t corruptReads = 0;       // Next N scratchpad reads return a bad CRC
+    bool present = true;
+    // Observations
+    uint32_t reads = 0;
+    uint32_t earlyReads = 0;
+    uint64_t readyUs = 0;            // When the current conversion completes
+};
+
+template <uint8_t N>
+class MockOneWireBus {
+public:
+    MockOneWireTiming timing;
+    MockDs18b20 dev[N];
+    uint8_t count = 0;
+    uint64_t nowUs = 0;
+    uint64_t blockedUs = 0;          // Total time callers spent inside bus transactions
+    uint32_t transactions = 0;
+
+    MockDs18b20& addProbe(uint8_t id, uint8_t bits = 12, float tempC = -18.0f) {
+        MockDs18b20& d = dev[count++];
+        d.rom[0] = 0x28;   // DS18B20 family code
+        for (uint8_t i = 1; i < 7; i++) d.rom[i] = (uint8_t)(id * 17 + i);
+        d.rom[7] = ds18b20::crc8(d.rom, 7);
+        d.resolution = bits;
+        d.tempC = tempC;
+        return d;
+    }
+
+    // Supply dip: the probe resets, dropping any conversion and reloading the power-on value
+    void powerCycle(uint8_t i) { dev[i].converting = false; dev[i].latchedC = 85.0f; }
+
+    uint32_t nowMs() const { return (uint32_t)(nowUs / 1000); }
+    void advanceMs(uint32_t ms) { nowUs += (uint64_t)ms * 1000; }
+
+    bool startConversion() {
+        busy(timing.resetUs + 2 * timing.byteUs);
+        bool any = false;
+        for (uint8_t i = 0; i < count; i++) {
+            if (!dev[i].present) continue;
+            dev[i].converting = true;
+            dev[i].convStartUs = nowUs;
+            dev[i].readyUs = nowUs + ds18b20::conversionMs(dev[i].resolution) * 1000ULL;
+            any = true;
+        }
+        return any;
+    }
+
+    bool readScratchpad(const uint8_t rom[ds18b20::ROM_LEN], uint8_t sp[ds18b20::SCRATCHPAD_LEN]) {
+        busy(timing.resetUs + (1 + ds18b20::ROM_LEN + 1 + ds18b20::SCRATCHPAD_LEN) * timing.byteUs);
+        MockDs18b20* d = find(rom);
+        if (!d || !d->present) { memset(sp, 0, ds18b20::SCRATCHPAD_LEN); return true; }
+        d->reads++;
+        if (d->converting) {
+            if (nowUs >= d->readyUs) { d->latchedC = d->tempC; d->converting = false; }
+            else d->earlyReads++;
+        }
+        int16_t raw = (int16_t)lroundf(d->latchedC * 16.0f);
+        sp[0] = (uint8_t)(raw & 0xFF);
+        sp[1] = (uint8_t)(raw >> 8);
+        sp[2] = 0x4B; sp[3] = 0x46;
+        sp[4] = ds18b20::configRegister(d->resolution);
+        sp[5] = 0xFF; sp[6] = 0x0C; sp[7] = 0x10;
+        sp[8] = ds18b20::crc8(sp, 8);
+        if (d->corruptReads) { d->corruptReads--; sp[8] ^= 0x5A; }
+        return true;
+    }
+
+    bool writeResolution(const uint8_t rom[ds18b20::ROM_LEN], uint8_t bits) {
+        busy(timing.resetUs + (1 + ds18b20::ROM_LEN + 1 + 3) * timing.byteUs);
+        MockDs18b20* d = find(rom);
+        if (!d || !d->present) return false;
+        d->resolution = bits;
+        return true;
+    }
+
+private:
+    void busy(uint32_t us) { nowUs += us; blockedUs += us; transactions++; }
+
+    MockDs18b20* find(const uint8_t rom[ds18b20::ROM_LEN]) {
+        for (uint8_t i = 0; i < count; i++) if (memcmp(dev[i].rom, rom, ds18b20::ROM_LEN) == 0) return &dev[i];
+        return nullptr;
+    }
+};
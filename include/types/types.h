@@ -7,6 +7,7 @@
 #include <Arduino.h>
 #endif
 #include <vector>
+#include <type_traits>
 #include "config/config.h"
 
 // System Status Enumeration
@@ -32,16 +33,32 @@ enum SystemMode {
 #define MODE_HEAT MODE_MANUAL_HEAT
 #define MODE_COOL MODE_MANUAL_COOL
 
-// Sensor Data Structure
+// Sensor Data Structure (POD: copied by value on the control path, must never touch the heap)
+#define SENSOR_ROM_LEN 8
+#define SENSOR_ROM_STR_LEN 24   // "xx:xx:xx:xx:xx:xx:xx:xx" + NUL
 struct SensorData {
-    float temperature;
-    float humidity;
-    bool valid;
-    unsigned long timestamp;
-    unsigned long lastValidReading;
-    uint8_t sensorId;
-    String address;
+    float temperature = 0.0f;
+    float humidity = 0.0f;
+    bool valid = false;
+    unsigned long timestamp = 0;
+    unsigned long lastValidReading = 0;
+    uint8_t sensorId = 0;
+    uint8_t rom[SENSOR_ROM_LEN] = {};   // Raw 1-Wire ROM code; format with formatSensorRom() when needed
 };
+static_assert(std::is_trivially_copyable<SensorData>::value, "SensorData must stay trivially copyable");
+
+// Hex-formats a ROM code into out (at least SENSOR_ROM_STR_LEN bytes). Returns out.
+inline char* formatSensorRom(const uint8_t rom[SENSOR_ROM_LEN], char* out) {
+    static const char hex[] = "0123456789abcdef";
+    char* p = out;
+    for (uint8_t i = 0; i < SENSOR_ROM_LEN; i++) {
+        *p++ = hex[rom[i] >> 4];
+        *p++ = hex[rom[i] & 0x0F];
+        if (i < SENSOR_ROM_LEN - 1) *p++ = ':';
+    }
+    *p = '\0';
+    return out;
+}
 
 // System Configuration
 struct SystemConfig {
@@ -107,13 +124,14 @@ struct Button {
 };
 
 // System Data for Display
+class SensorRegistry;
 struct SystemData {
-    SensorData sensors[4];
+    const SensorRegistry* sensors = nullptr;   // Live registry (variable probe count); see sensor_registry.h
     ControlState control;
     SystemConfig config;
     String timeString;
     String dateString;
-    uint8_t activeSensors = 0;
+    uint16_t activeSensors = 0;
     float minTemp = MIN_TEMP;
     float maxTemp = MAX_TEMP;
 };
@@ -43,7 +43,7 @@ public:
     // Storage / config (feature gated)
     static bool initSDCard();
     static bool logData(const SystemData& data); // CSV append (returns false on failure or disabled)
-    static bool logEventRecord(unsigned long ts, uint16_t code, uint32_t faultMask); // append event row
+    static bool logEventRecord(uint32_t seq, unsigned long ts, uint16_t code, uint32_t faultMask, uint8_t zone = 0); // append event row
     static bool flushLogs(); // currently no-op placeholder (for buffered backends)
     static bool readConfig(SystemConfig& config);
     static bool writeConfig(const SystemConfig& config);
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj.h"
 #include "lv_indev.h"
+#include "../misc/lv_gc.h"
 
 /*********************
  *      DEFINES
@@ -33,7 +34,7 @@ static bool event_is_bubbled(lv_event_t * e);
 /**********************
  *  STATIC VARIABLES
  **********************/
-static lv_event_t * event_head;
+static lv_event_t * event_head[LV_REFR_BAND_UNITS];   /*Per band unit: draw events are sent from each*/
 
 /**********************
  *      MACROS
@@ -67,14 +68,14 @@ lv_res_t lv_event_send(lv_obj_t * obj, lv_event_code_t event_code, void * param)
     /*Build a simple linked list from the objects used in the events
      *It's important to know if this object was deleted by a nested event
      *called from this `event_cb`.*/
-    e.prev = event_head;
-    event_head = &e;
+    e.prev = event_head[_LV_DRAW_UNIT];
+    event_head[_LV_DRAW_UNIT] = &e;
 
     /*Send the event*/
     lv_res_t res = event_send_core(&e);
 
     /*Remove this element from the list*/
-    event_head = e.prev;
+    event_head[_LV_DRAW_UNIT] = e.prev;
 
     return res;
 }
@@ -146,7 +147,7 @@ uint32_t lv_event_register_id(void)
 
 void _lv_event_mark_deleted(lv_obj_t * obj)
 {
-    lv_event_t * e = event_head;
+    lv_event_t * e = event_head[_LV_DRAW_UNIT];
 
     while(e) {
         if(e->current_target == obj || e->target == obj) e->deleted = 1;
@@ -27,6 +27,13 @@ typedef struct {
     lv_style_value_t end_value;
 } trans_t;
 
+#if LV_REFR_BAND_UNITS > 1
+typedef struct {
+    const lv_obj_t * obj;
+    lv_state_t state;
+} draw_state_t;
+#endif
+
 typedef enum {
     CACHE_ZERO = 0,
     CACHE_TRUE = 1,
@@ -59,6 +66,9 @@ static void fade_in_anim_ready(lv_anim_t * a);
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+#if LV_REFR_BAND_UNITS > 1
+    static draw_state_t draw_state[LV_REFR_BAND_UNITS]; /*Per band unit, see _lv_obj_style_set_draw_state()*/
+#endif
 
 /**********************
  *      MACROS
@@ -388,6 +398,30 @@ lv_style_value_t _lv_obj_style_apply_color_filter(const lv_obj_t * obj, uint32_t
     return v;
 }
 
+void _lv_obj_style_set_draw_state(lv_obj_t * obj, lv_state_t state)
+{
+#if LV_REFR_BAND_UNITS > 1
+    /*Other band units may be drawing the same object in its real state*/
+    draw_state[_LV_DRAW_UNIT].obj = obj;
+    draw_state[_LV_DRAW_UNIT].state = state;
+#else
+    obj->state = state;
+    obj->skip_trans = 1;
+#endif
+}
+
+void _lv_obj_style_clear_draw_state(lv_obj_t * obj, lv_state_t state_ori)
+{
+#if LV_REFR_BAND_UNITS > 1
+    LV_UNUSED(obj);
+    LV_UNUSED(state_ori);
+    draw_state[_LV_DRAW_UNIT].obj = NULL;
+#else
+    obj->state = state_ori;
+    obj->skip_trans = 0;
+#endif
+}
+
 _lv_style_state_cmp_t _lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state1, lv_state_t state2)
 {
     _lv_style_state_cmp_t res = _LV_STYLE_STATE_CMP_SAME;
@@ -603,9 +637,16 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_sty
     uint8_t group = 1 << _lv_style_get_prop_group(prop);
     int32_t weight = -1;
     lv_state_t state = obj->state;
+    bool skip_trans = obj->skip_trans;
+#if LV_REFR_BAND_UNITS > 1
+    const draw_state_t * ds = &draw_state[_LV_DRAW_UNIT];
+    if(ds->obj == obj) {
+        state = ds->state;
+        skip_trans = true;
+    }
+#endif
     lv_state_t state_inv = ~state;
     lv_style_value_t value_tmp;
-    bool skip_trans = obj->skip_trans;
     uint32_t i;
     lv_style_res_t found;
     for(i = 0; i < obj->style_cnt; i++) {
@@ -171,6 +171,22 @@ lv_style_value_t _lv_obj_style_apply_color_filter(const struct _lv_obj_t * obj,
 void _lv_obj_style_create_transition(struct _lv_obj_t * obj, lv_part_t part, lv_state_t prev_state,
                                      lv_state_t new_state, const _lv_obj_style_transition_dsc_t * tr);
 
+/**
+ * Used internally to look up the styles of an object in an other state while drawing a part in that
+ * state (table cells, matrix buttons, dropdown items). No transitions are applied.
+ * With band units only the calling unit sees the state, the object itself is not changed.
+ * @param obj       pointer to an object
+ * @param state     the state to look up the styles in
+ */
+void _lv_obj_style_set_draw_state(struct _lv_obj_t * obj, lv_state_t state);
+
+/**
+ * Used internally to end `_lv_obj_style_set_draw_state()`
+ * @param obj       pointer to an object
+ * @param state_ori the state of the object before `_lv_obj_style_set_draw_state()`
+ */
+void _lv_obj_style_clear_draw_state(struct _lv_obj_t * obj, lv_state_t state_ori);
+
 /**
  * Used internally to compare the appearance of an object in 2 states
  * @param obj
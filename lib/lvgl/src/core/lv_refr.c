@@ -26,10 +26,25 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_REFR_BAND_UNITS > 1
+    #if LV_MEM_CUSTOM == 0
+        #error "LV_REFR_BAND_UNITS > 1 needs LV_MEM_CUSTOM 1 with a thread safe malloc"
+    #endif
+    #if LV_IMG_CACHE_DEF_SIZE || LV_GRAD_CACHE_DEF_SIZE || LV_SHADOW_CACHE_SIZE
+        #error "LV_REFR_BAND_UNITS > 1: the image, gradient and shadow caches are shared by the band units. Disable them."
+    #endif
+#endif
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_REFR_BAND_UNITS > 1
+typedef struct {
+    lv_area_t buf_area;
+    lv_area_t clip_area;
+} band_job_t;
+#endif
+
 typedef struct {
     uint32_t    perf_last_time;
     uint32_t    elaps_sum;
@@ -56,11 +71,18 @@ static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
+static void refr_area_draw(lv_draw_ctx_t * draw_ctx);
+#if LV_REFR_BAND_UNITS > 1
+    static uint8_t band_units_get(lv_coord_t rows, lv_coord_t max_row);
+    static void refr_area_split(lv_draw_ctx_t * draw_ctx);
+    static void refr_area_bands(const lv_area_t * area_p, lv_coord_t y2, lv_coord_t max_row, uint8_t units);
+    static void band_units_clean_up(void);
+#endif
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
-static void draw_buf_flush(lv_disp_t * disp);
+static void draw_buf_flush(lv_disp_t * disp, lv_draw_ctx_t * draw_ctx);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
 
 #if LV_USE_PERF_MONITOR
@@ -75,6 +97,10 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
  **********************/
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
+#if LV_REFR_BAND_UNITS > 1
+    static band_job_t band_jobs[LV_REFR_BAND_UNITS - 1]; /*Areas of band units 1.. in the current round*/
+    static uint8_t band_pair;   /*Which of their two buffers the band units render into with partial buffers*/
+#endif
 
 #if LV_USE_PERF_MONITOR
     static perf_monitor_t   perf_monitor;
@@ -127,6 +153,20 @@ void lv_refr_now(lv_disp_t * disp)
     }
 }
 
+#if LV_REFR_BAND_UNITS > 1
+void lv_refr_band_unit(lv_disp_t * disp, uint8_t unit)
+{
+    LV_ASSERT(disp == disp_refr);
+    LV_ASSERT(unit > 0 && unit < LV_REFR_BAND_UNITS);
+
+    _lv_draw_unit = unit;
+    lv_draw_ctx_t * draw_ctx = disp->band_ctx[unit - 1];
+    if(draw_ctx->init_buf) draw_ctx->init_buf(draw_ctx);
+    refr_area_draw(draw_ctx);
+    if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
+}
+#endif
+
 void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 {
     const lv_area_t * clip_area_ori = draw_ctx->clip_area;
@@ -359,6 +399,10 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     _lv_draw_mask_cleanup();
 #endif
 
+#if LV_REFR_BAND_UNITS > 1
+    band_units_clean_up();
+#endif
+
 #if LV_USE_PERF_MONITOR && LV_USE_LABEL
     lv_obj_t * perf_label = perf_monitor.perf_label;
     if(perf_label == NULL) {
@@ -660,6 +704,14 @@ static void refr_area(const lv_area_t * area_p)
 
     int32_t max_row = get_max_row(disp_refr, w, h);
 
+#if LV_REFR_BAND_UNITS > 1
+    uint8_t units = band_units_get(y2 - area_p->y1 + 1, max_row);
+    if(units > 1) {
+        refr_area_bands(area_p, y2, max_row, units);
+        return;
+    }
+#endif
+
     lv_coord_t row;
     lv_coord_t row_last = 0;
     lv_area_t sub_area;
@@ -723,6 +775,22 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
 #endif
     }
 
+#if LV_REFR_BAND_UNITS > 1
+    if(disp_refr->driver->full_refresh || disp_refr->driver->direct_mode) refr_area_split(draw_ctx);
+    else refr_area_draw(draw_ctx);
+#else
+    refr_area_draw(draw_ctx);
+#endif
+
+    draw_buf_flush(disp_refr, draw_ctx);
+}
+
+/**
+ * Draw the screens and layers on the clip area of a draw context
+ * @param draw_ctx the LVGL thread's or a band unit's draw context
+ */
+static void refr_area_draw(lv_draw_ctx_t * draw_ctx)
+{
     lv_obj_t * top_act_scr = NULL;
     lv_obj_t * top_prev_scr = NULL;
 
@@ -792,9 +860,167 @@ static void refr_area_part(lv_draw_ctx_t * draw_ctx)
     /*Also refresh top and sys layer unconditionally*/
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_top(disp_refr));
     refr_obj_and_children(draw_ctx, lv_disp_get_layer_sys(disp_refr));
+}
+
+#if LV_REFR_BAND_UNITS > 1
+/**
+ * Get how many band units should render `rows` rows. Creates the draw contexts of the units.
+ * @param rows      rows of the area to refresh
+ * @param max_row   rows of a band with partial buffers, ignored in direct and full refresh mode
+ * @return          1..`band_units` of the driver: every unit gets at least `LV_REFR_BAND_MIN_ROWS` rows,
+ *                  and in partial mode at least a band
+ */
+static uint8_t band_units_get(lv_coord_t rows, lv_coord_t max_row)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    if(drv->band_start_cb == NULL || drv->band_wait_cb == NULL) return 1;
+
+    int32_t units = LV_CLAMP(1, drv->band_units, LV_REFR_BAND_UNITS);
+    units = LV_MIN(units, rows / LV_REFR_BAND_MIN_ROWS);
+
+    if(!drv->full_refresh && !drv->direct_mode) {
+        /*Each unit renders whole bands into its own buffers while the previous band is flushed*/
+        lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+        if(draw_buf->buf2 == NULL || max_row <= 0) return 1;
+        units = LV_MIN(units, (rows + max_row - 1) / max_row);
+
+        int32_t u;
+        for(u = 1; u < units; u++) {
+            if(draw_buf->band_bufs[u - 1][0] == NULL || draw_buf->band_bufs[u - 1][1] == NULL) {
+                units = u;
+                break;
+            }
+        }
+    }
+
+    int32_t u;
+    for(u = 1; u < units; u++) {
+        lv_draw_ctx_t ** ctx = &disp_refr->band_ctx[u - 1];
+        if(*ctx) continue;
+
+        *ctx = lv_mem_alloc(drv->draw_ctx_size);
+        LV_ASSERT_MALLOC(*ctx);
+        if(*ctx == NULL) {
+            units = u;
+            break;
+        }
+        drv->draw_ctx_init(drv, *ctx);
+    }
 
-    draw_buf_flush(disp_refr);
+    return units < 1 ? 1 : (uint8_t)units;
+}
+
+/**
+ * In direct and full refresh mode split the clip area into horizontal slices drawn in parallel
+ * into the same buffer. The LVGL thread draws the top slice.
+ * @param draw_ctx the LVGL thread's draw context with the whole area to draw
+ */
+static void refr_area_split(lv_draw_ctx_t * draw_ctx)
+{
+    const lv_area_t * clip_area = draw_ctx->clip_area;
+    lv_coord_t h = lv_area_get_height(clip_area);
+    uint8_t units = band_units_get(h, 0);
+    if(units == 1) {
+        refr_area_draw(draw_ctx);
+        return;
+    }
+
+    uint8_t u;
+    for(u = 1; u < units; u++) {
+        band_job_t * job = &band_jobs[u - 1];
+        job->buf_area = *draw_ctx->buf_area;
+        job->clip_area = *clip_area;
+        job->clip_area.y1 = clip_area->y1 + (int32_t)h * u / units;
+        job->clip_area.y2 = clip_area->y1 + (int32_t)h * (u + 1) / units - 1;
+
+        lv_draw_ctx_t * unit_ctx = disp_refr->band_ctx[u - 1];
+        unit_ctx->buf = draw_ctx->buf;
+        unit_ctx->buf_area = &job->buf_area;
+        unit_ctx->clip_area = &job->clip_area;
+    }
+
+    disp_refr->driver->band_start_cb(disp_refr->driver, units);
+
+    lv_area_t top_slice = *clip_area;
+    top_slice.y2 = clip_area->y1 + h / units - 1;
+    draw_ctx->clip_area = &top_slice;
+    refr_area_draw(draw_ctx);
+    draw_ctx->clip_area = clip_area;
+
+    disp_refr->driver->band_wait_cb(disp_refr->driver);
+}
+
+/**
+ * Refresh an area in rounds of `units` bands with partial buffers. The LVGL thread renders and
+ * flushes the top band of a round, then flushes the bands of the other units in order.
+ * @param area_p    the area to refresh
+ * @param y2        last row of the area on the display
+ * @param max_row   rows of a band
+ * @param units     band units to use, >= 2
+ */
+static void refr_area_bands(const lv_area_t * area_p, lv_coord_t y2, lv_coord_t max_row, uint8_t units)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    lv_disp_draw_buf_t * draw_buf = drv->draw_buf;
+    lv_draw_ctx_t * draw_ctx = drv->draw_ctx;
+
+    lv_area_t sub_area;
+    lv_coord_t row = area_p->y1;
+    while(row <= y2) {
+        lv_area_set(&sub_area, area_p->x1, row, area_p->x2, LV_MIN(row + max_row - 1, y2));
+        row = sub_area.y2 + 1;
+
+        /*A unit's buffer was flushed at the latest before the top band of the previous round*/
+        uint8_t n;
+        for(n = 1; n < units && row <= y2; n++) {
+            band_job_t * job = &band_jobs[n - 1];
+            lv_area_set(&job->buf_area, area_p->x1, row, area_p->x2, LV_MIN(row + max_row - 1, y2));
+            job->clip_area = job->buf_area;
+            row = job->buf_area.y2 + 1;
+
+            lv_draw_ctx_t * unit_ctx = disp_refr->band_ctx[n - 1];
+            unit_ctx->buf = draw_buf->band_bufs[n - 1][band_pair];
+            unit_ctx->buf_area = &job->buf_area;
+            unit_ctx->clip_area = &job->clip_area;
+        }
+        band_pair ^= 1;
+
+        if(n > 1) drv->band_start_cb(drv, n);
+
+        draw_ctx->buf_area = &sub_area;
+        draw_ctx->clip_area = &sub_area;
+        draw_ctx->buf = draw_buf->buf_act;
+        draw_buf->last_part = sub_area.y2 == y2;
+        refr_area_part(draw_ctx);
+
+        if(n > 1) {
+            drv->band_wait_cb(drv);
+
+            uint8_t u;
+            for(u = 1; u < n; u++) {
+                draw_buf->last_part = band_jobs[u - 1].buf_area.y2 == y2;
+                draw_buf_flush(disp_refr, disp_refr->band_ctx[u - 1]);
+            }
+        }
+    }
+}
+
+/**
+ * Release the draw buffers and masks the band units left. They are idle between refreshes.
+ */
+static void band_units_clean_up(void)
+{
+    uint8_t u;
+    for(u = 1; u < LV_REFR_BAND_UNITS; u++) {
+        _lv_draw_unit = u;
+        lv_mem_buf_free_all();
+#if LV_DRAW_COMPLEX
+        _lv_draw_mask_cleanup();
+#endif
+    }
+    _lv_draw_unit = 0;
 }
+#endif /*LV_REFR_BAND_UNITS > 1*/
 
 /**
  * Search the most top object which fully covers an area
@@ -1264,12 +1490,11 @@ static void draw_buf_rotate(lv_area_t * area, lv_color_t * color_p)
 /**
  * Flush the content of the draw buffer
  */
-static void draw_buf_flush(lv_disp_t * disp)
+static void draw_buf_flush(lv_disp_t * disp, lv_draw_ctx_t * draw_ctx)
 {
     lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
 
     /*Flush the rendered content to the display*/
-    lv_draw_ctx_t * draw_ctx = disp->driver->draw_ctx;
     if(draw_ctx->wait_for_finish) draw_ctx->wait_for_finish(draw_ctx);
 
     /* In partial double buffered mode wait until the other buffer is freed
@@ -1298,8 +1523,10 @@ static void draw_buf_flush(lv_disp_t * disp)
         }
     }
 
-    /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
-    if(draw_buf->buf1 && draw_buf->buf2 && (!disp->driver->direct_mode || flushing_last)) {
+    /*If there are 2 buffers swap them. With direct mode swap only on the last area.
+     *Band units flush their own buffers*/
+    if(draw_buf->buf1 && draw_buf->buf2 && (!disp->driver->direct_mode || flushing_last) &&
+       draw_ctx == disp->driver->draw_ctx) {
         if(draw_buf->buf_act == draw_buf->buf1)
             draw_buf->buf_act = draw_buf->buf2;
         else
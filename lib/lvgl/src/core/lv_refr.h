@@ -56,6 +56,16 @@ void _lv_refr_init(void);
  */
 void lv_refr_now(lv_disp_t * disp);
 
+#if LV_REFR_BAND_UNITS > 1
+/**
+ * Render the band of a band unit in the refresh in progress.
+ * Call it from the unit's own thread when the driver's `band_start_cb` asks for it.
+ * @param disp the display being refreshed
+ * @param unit the band unit, 1..`LV_REFR_BAND_UNITS - 1`
+ */
+void lv_refr_band_unit(lv_disp_t * disp, uint8_t unit);
+#endif
+
 /**
  * Redrawn on object an all its children using the passed draw context
  * @param draw  pointer to an initialized draw context
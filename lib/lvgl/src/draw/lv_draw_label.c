@@ -13,6 +13,7 @@
 #include "../core/lv_refr.h"
 #include "../misc/lv_bidi.h"
 #include "../misc/lv_assert.h"
+#include "../misc/lv_gc.h"
 
 /*********************
  *      DEFINES
@@ -88,6 +89,9 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
         return;
     }
 
+    /*The hint lives in the label: only band unit 0 may update it*/
+    if(_LV_DRAW_UNIT != 0) hint = NULL;
+
     lv_draw_label_dsc_t dsc_mod = *dsc;
 
     const lv_font_t * font = dsc->font;
@@ -116,7 +116,7 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
         LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
     }
 #else
-    cached_src = &LV_GC_ROOT(_lv_img_cache_single);
+    cached_src = &LV_GC_UNIT_ROOT(_lv_img_cache_single);
 #endif
     /*Open the image and measure the time to open*/
     uint32_t t_start  = lv_tick_get();
@@ -60,8 +60,15 @@ void lv_draw_sw_init_ctx(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
     draw_sw_ctx->base_draw.layer_adjust = lv_draw_sw_layer_adjust;
     draw_sw_ctx->base_draw.layer_blend = lv_draw_sw_layer_blend;
     draw_sw_ctx->base_draw.layer_destroy = lv_draw_sw_layer_destroy;
+#if LV_DRAW_SW_BLEND_RGB565
+    draw_sw_ctx->blend = lv_draw_sw_blend_rgb565;
+#else
     draw_sw_ctx->blend = lv_draw_sw_blend_basic;
+#endif
     draw_ctx->layer_instance_size = sizeof(lv_draw_sw_layer_ctx_t);
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+    _lv_draw_sw_glyph_cache_init();
+#endif
 }
 
 void lv_draw_sw_deinit_ctx(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
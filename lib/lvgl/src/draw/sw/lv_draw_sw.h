@@ -43,6 +43,14 @@ typedef struct {
     uint32_t has_alpha : 1;
 } lv_draw_sw_layer_ctx_t;
 
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+typedef struct {
+    uint32_t hits;      /**< Glyphs drawn from a cached mask*/
+    uint32_t misses;    /**< Glyphs unpacked from the font*/
+    uint32_t size;      /**< Bytes of cached masks in all band units*/
+} lv_draw_sw_glyph_cache_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -91,6 +99,26 @@ void lv_draw_sw_layer_blend(struct _lv_draw_ctx_t * draw_ctx, struct _lv_draw_la
 
 void lv_draw_sw_layer_destroy(lv_draw_ctx_t * draw_ctx, lv_draw_layer_ctx_t * layer_ctx);
 
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+/**
+ * Create the glyph caches of the band units if they don't exist yet. Called by `lv_draw_sw_init_ctx()`.
+ */
+void _lv_draw_sw_glyph_cache_init(void);
+
+/**
+ * Drop the cached glyph masks and resize the caches. Call it after freeing a font too.
+ * Not while a refresh is in progress.
+ * @param size  bytes per band unit, 0 to draw without cache
+ */
+void lv_draw_sw_glyph_cache_set_size(uint32_t size);
+
+/**
+ * Get the hit counters and size of the glyph caches
+ * @param stats store the result here
+ */
+void lv_draw_sw_glyph_cache_get_stats(lv_draw_sw_glyph_cache_stats_t * stats);
+#endif
+
 /***********************
  * GLOBAL VARIABLES
  ***********************/
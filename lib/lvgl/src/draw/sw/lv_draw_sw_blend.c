@@ -10,6 +10,7 @@
 #include "../../misc/lv_math.h"
 #include "../../hal/lv_hal_disp.h"
 #include "../../core/lv_refr.h"
+#include "../../misc/lv_gc.h"
 
 /*********************
  *      DEFINES
@@ -404,10 +405,13 @@ static inline void set_px_argb(uint8_t * buf, lv_color_t color, lv_opa_t opa)
 static inline void set_px_argb_blend(uint8_t * buf, lv_color_t color, lv_opa_t opa, lv_color_t (*blend_fp)(lv_color_t,
                                                                                                            lv_color_t, lv_opa_t))
 {
-    static lv_color_t last_dest_color;
-    static lv_color_t last_src_color;
-    static lv_color_t last_res_color;
-    static uint32_t last_opa = 0xffff; /*Set to an invalid value for first*/
+    /*Per band unit*/
+    static struct {
+        lv_color_t dest;
+        lv_color_t src;
+        lv_color_t res;
+        uint32_t opa_tag;   /*opa + 1; 0: nothing cached yet*/
+    } last_units[LV_REFR_BAND_UNITS];
 
     lv_color_t bg_color;
 
@@ -424,12 +428,15 @@ static inline void set_px_argb_blend(uint8_t * buf, lv_color_t color, lv_opa_t o
 #endif
 
     /*Get the result color*/
-    if(last_dest_color.full != bg_color.full || last_src_color.full != color.full || last_opa != opa) {
-        last_dest_color = bg_color;
-        last_src_color = color;
-        last_opa = opa;
-        last_res_color = blend_fp(last_src_color, last_dest_color, last_opa);
+    lv_color_t last_res_color;
+    if(last_units[_LV_DRAW_UNIT].dest.full != bg_color.full || last_units[_LV_DRAW_UNIT].src.full != color.full ||
+       last_units[_LV_DRAW_UNIT].opa_tag != (uint32_t)opa + 1) {
+        last_units[_LV_DRAW_UNIT].dest = bg_color;
+        last_units[_LV_DRAW_UNIT].src = color;
+        last_units[_LV_DRAW_UNIT].opa_tag = (uint32_t)opa + 1;
+        last_units[_LV_DRAW_UNIT].res = blend_fp(color, bg_color, opa);
     }
+    last_res_color = last_units[_LV_DRAW_UNIT].res;
 
     /*Set the result color*/
 #if LV_COLOR_DEPTH == 8
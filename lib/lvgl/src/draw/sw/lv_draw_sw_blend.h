@@ -59,6 +59,32 @@ void lv_draw_sw_blend(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_d
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_basic(struct _lv_draw_ctx_t * draw_ctx,
                                                         const lv_draw_sw_blend_dsc_t * dsc);
 
+#if LV_DRAW_SW_BLEND_RGB565
+/**
+ * Blend function with RGB565 kernels for the normal fill and image paths (vectorized where the
+ * compiler supports it). Same output as `lv_draw_sw_blend_basic()`, which handles everything else.
+ * @param draw_ctx      pointer to a draw context
+ * @param dsc           pointer to an initialized blend descriptor
+ */
+void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_blend_rgb565(struct _lv_draw_ctx_t * draw_ctx,
+                                                         const lv_draw_sw_blend_dsc_t * dsc);
+
+/**
+ * `lv_draw_sw_blend_rgb565()` with the portable C kernels only, as on targets without vectors: the
+ * unmasked fill with opacity uses its kernel, the rest the generic path. To compare against the
+ * vector kernels.
+ * @param draw_ctx      pointer to a draw context
+ * @param dsc           pointer to an initialized blend descriptor
+ */
+void lv_draw_sw_blend_rgb565_portable(struct _lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+
+/**
+ * Tell whether `lv_draw_sw_blend_rgb565()` uses vector kernels in this build.
+ * @return true: compiled with 128 bit vector support
+ */
+bool lv_draw_sw_blend_rgb565_has_simd(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
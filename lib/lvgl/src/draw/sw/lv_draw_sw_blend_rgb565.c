@@ -0,0 +1,390 @@
+/**
+ * @file lv_draw_sw_blend_rgb565.c
+ *
+ * Blend kernels for RGB565 draw buffers: opaque fill, fill with opacity, masked fill with opacity
+ * and image map in LV_BLEND_MODE_NORMAL. Every other case goes to `lv_draw_sw_blend_basic()`.
+ *
+ * The output is the same as `lv_draw_sw_blend_basic()` bit for bit, including its rounding:
+ * - `lv_color_mix()` blends with the 5 bit ratio `(mix + 4) >> 3` on the 0x07E0F81F spread pixel
+ * - the unmasked fill with opacity uses `lv_color_mix_premult()` with the opacity rounded to a
+ *   multiple of 8, except for the black pixels at the start of the area, which get the
+ *   `lv_color_mix()` result `fill_normal()` starts its result cache with
+ *
+ * Two sets of kernels: portable C (used on targets without compiler vector support, e.g. Xtensa)
+ * and GCC/Clang vector extensions, 4 pixels per step, where the compiler has 128 bit vectors
+ * (SSE2, NEON). The portable set only has the unmasked fill with opacity, the one case where a
+ * scalar loop beats `fill_normal()` (premultiplied color, no per pixel ratio). Scalar opaque fills,
+ * masked fills and image maps measure the same as the generic path or slower, so without vectors
+ * they stay there.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_draw_sw.h"
+#include "../../misc/lv_math.h"
+#include "../../hal/lv_hal_disp.h"
+#include "../../core/lv_refr.h"
+
+#if LV_DRAW_SW_BLEND_RGB565
+
+#if LV_COLOR_DEPTH != 16 || LV_COLOR_16_SWAP != 0 || LV_COLOR_MIX_ROUND_OFS != 0
+    #error "LV_DRAW_SW_BLEND_RGB565 needs LV_COLOR_DEPTH 16, LV_COLOR_16_SWAP 0 and LV_COLOR_MIX_ROUND_OFS 0"
+#endif
+
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#if defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON))
+    #define BLEND565_SIMD 1
+#else
+    #define BLEND565_SIMD 0
+#endif
+
+#define SPREAD_MASK 0x07E0F81FU
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+#if BLEND565_SIMD
+typedef uint32_t v4u32_t __attribute__((vector_size(16)));
+typedef uint16_t v4u16_t __attribute__((vector_size(8)));
+typedef uint8_t v4u8_t __attribute__((vector_size(4)));
+typedef uint16_t v8u16_t __attribute__((vector_size(16)));
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void blend_rgb565(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc, bool simd);
+
+static void fill_opa_portable(uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color,
+                              lv_opa_t opa);
+#if BLEND565_SIMD
+static void fill_simd(uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color, lv_opa_t opa,
+                      const lv_opa_t * mask, int32_t mask_stride);
+static void map_simd(uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride, const uint16_t * src,
+                     int32_t src_stride, lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride);
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_rgb565(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    blend_rgb565(draw_ctx, dsc, true);
+}
+
+void lv_draw_sw_blend_rgb565_portable(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    blend_rgb565(draw_ctx, dsc, false);
+}
+
+bool lv_draw_sw_blend_rgb565_has_simd(void)
+{
+    return BLEND565_SIMD;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void LV_ATTRIBUTE_FAST_MEM blend_rgb565(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc, bool simd)
+{
+#if !BLEND565_SIMD
+    simd = false;
+#endif
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    /*Per pixel callback, ARGB8565 screen, other blend modes, masks rounded in place: the generic path.
+     *So is a masked fill at full opacity: it only stores the color, and `fill_normal()` already skips
+     *and stores 4 pixels per mask word, so there is nothing to gain. Without vectors everything but
+     *the unmasked fill with opacity (see the file header).*/
+    const bool masked = dsc->mask_buf && dsc->mask_res != LV_DRAW_MASK_RES_FULL_COVER;
+    if(disp->driver->set_px_cb || disp->driver->screen_transp || dsc->blend_mode != LV_BLEND_MODE_NORMAL ||
+       (dsc->mask_buf && disp->driver->antialiasing == 0) ||
+       (masked && dsc->src_buf == NULL && dsc->opa >= LV_OPA_MAX) ||
+       (!simd && (dsc->src_buf || masked || dsc->opa >= LV_OPA_MAX))) {
+        lv_draw_sw_blend_basic(draw_ctx, dsc);
+        return;
+    }
+
+    const lv_opa_t * mask;
+    if(dsc->mask_buf && dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) return;
+    else if(dsc->mask_buf == NULL || dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) mask = NULL;
+    else mask = dsc->mask_buf;
+
+    lv_area_t blend_area;
+    if(!_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) return;
+
+    int32_t dest_stride = lv_area_get_width(draw_ctx->buf_area);
+    uint16_t * dest = (uint16_t *)draw_ctx->buf;
+    dest += dest_stride * (blend_area.y1 - draw_ctx->buf_area->y1) + (blend_area.x1 - draw_ctx->buf_area->x1);
+    int32_t w = lv_area_get_width(&blend_area);
+    int32_t h = lv_area_get_height(&blend_area);
+
+    int32_t mask_stride = 0;
+    if(mask) {
+        mask_stride = lv_area_get_width(dsc->mask_area);
+        mask += mask_stride * (blend_area.y1 - dsc->mask_area->y1) + (blend_area.x1 - dsc->mask_area->x1);
+    }
+
+    if(dsc->src_buf) {
+        int32_t src_stride = lv_area_get_width(dsc->blend_area);
+        const uint16_t * src = (const uint16_t *)dsc->src_buf;
+        src += src_stride * (blend_area.y1 - dsc->blend_area->y1) + (blend_area.x1 - dsc->blend_area->x1);
+#if BLEND565_SIMD
+        map_simd(dest, w, h, dest_stride, src, src_stride, dsc->opa, mask, mask_stride);
+#else
+        LV_UNUSED(src);
+        LV_UNUSED(src_stride);
+#endif
+    }
+    else {
+#if BLEND565_SIMD
+        if(simd) {
+            fill_simd(dest, w, h, dest_stride, dsc->color.full, dsc->opa, mask, mask_stride);
+            return;
+        }
+#endif
+        fill_opa_portable(dest, w, h, dest_stride, dsc->color.full, dsc->opa);
+    }
+}
+
+/*`lv_color_mix()` for RGB565: fg over bg with the 5 bit ratio (mix + 4) >> 3*/
+static inline uint16_t mix565(uint32_t fg, uint32_t bg, uint32_t mix)
+{
+    uint32_t m = (mix + 4) >> 3;
+    fg = (fg | (fg << 16)) & SPREAD_MASK;
+    bg = (bg | (bg << 16)) & SPREAD_MASK;
+    uint32_t r = ((((fg - bg) * m) >> 5) + bg) & SPREAD_MASK;
+    return (uint16_t)((r >> 16) | r);
+}
+
+/*Opacity rounded like `fill_normal()` does for `lv_color_premult()` (wraps to 0 for 252, as there)*/
+static inline lv_opa_t premult_opa(lv_opa_t opa)
+{
+    return (lv_opa_t)((((uint32_t)opa + 4) >> 3) << 3);
+}
+
+/*`lv_color_mix_premult()` for RGB565; `pre` holds R, G, B multiplied by the rounded opacity*/
+static inline uint16_t mix565_premult(const uint32_t * pre, uint32_t bg, uint32_t inv)
+{
+    uint32_t r = LV_UDIV255(pre[0] + (bg >> 11) * inv);
+    uint32_t g = LV_UDIV255(pre[1] + ((bg >> 5) & 0x3F) * inv);
+    uint32_t b = LV_UDIV255(pre[2] + (bg & 0x1F) * inv);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static void premult_init(uint16_t color, lv_opa_t opa8, uint32_t * pre)
+{
+    pre[0] = (uint32_t)(color >> 11) * opa8;
+    pre[1] = (uint32_t)((color >> 5) & 0x3F) * opa8;
+    pre[2] = (uint32_t)(color & 0x1F) * opa8;
+}
+
+/*Ratio of a masked fill pixel, as in `fill_normal()`*/
+static inline uint32_t fill_ratio(lv_opa_t m, lv_opa_t opa)
+{
+    if(opa >= LV_OPA_MAX) return m;
+    return m == LV_OPA_COVER ? opa : ((uint32_t)m * opa) >> 8;
+}
+
+/*Ratio of a masked image pixel with opacity, as in `map_normal()`*/
+static inline uint32_t map_ratio(lv_opa_t m, lv_opa_t opa)
+{
+    return m >= LV_OPA_MAX ? opa : ((uint32_t)opa * m) >> 8;
+}
+
+/*Leading black pixels of an unmasked fill with opacity (see the file header). Returns false when
+ *a non-black pixel ended the run; *x is where the row continues.*/
+static inline bool fill_leading_black(uint16_t * row, int32_t w, int32_t * x, uint16_t first)
+{
+    int32_t i = 0;
+    while(i < w && row[i] == 0) row[i++] = first;
+    *x = i;
+    return i == w;
+}
+
+/*Unmasked fill with opacity below LV_OPA_MAX*/
+static void LV_ATTRIBUTE_FAST_MEM fill_opa_portable(uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride,
+                                                    uint16_t color, lv_opa_t opa)
+{
+    int32_t x;
+    int32_t y;
+    const lv_opa_t opa8 = premult_opa(opa);
+    const uint32_t inv = 255 - opa8;
+    uint32_t pre[3];
+    premult_init(color, opa8, pre);
+    const uint16_t first = mix565(color, 0, opa);
+    bool leading = true;
+    /*Result cache as in `fill_normal()`: widgets mostly cover a single background color*/
+    uint16_t last_dest = 0;
+    uint16_t last_res = mix565_premult(pre, 0, inv);
+    for(y = 0; y < h; y++) {
+        x = 0;
+        if(leading) leading = fill_leading_black(dest, w, &x, first);
+        for(; x < w; x++) {
+            if(dest[x] != last_dest) {
+                last_dest = dest[x];
+                last_res = mix565_premult(pre, last_dest, inv);
+            }
+            dest[x] = last_res;
+        }
+        dest += dest_stride;
+    }
+}
+
+#if BLEND565_SIMD
+
+static inline v4u32_t load565(const uint16_t * p)
+{
+    v4u16_t v;
+    memcpy(&v, p, sizeof(v));
+    return __builtin_convertvector(v, v4u32_t);
+}
+
+static inline void store565(uint16_t * p, v4u32_t v)
+{
+    /*Low halves of the lanes (little endian): one shuffle instead of a saturating narrow*/
+    v8u16_t h = (v8u16_t)v;
+    v4u16_t r = __builtin_shufflevector(h, h, 0, 2, 4, 6);
+    memcpy(p, &r, sizeof(r));
+}
+
+static inline v4u32_t load_mask(const lv_opa_t * p)
+{
+    v4u8_t v;
+    memcpy(&v, p, sizeof(v));
+    return __builtin_convertvector(v, v4u32_t);
+}
+
+/*mix565() on 4 pixels; ratio 0 gives bg and 255 gives fg exactly*/
+static inline v4u32_t mix565_v(v4u32_t fg, v4u32_t bg, v4u32_t mix)
+{
+    v4u32_t m = (mix + 4) >> 3;
+    fg = (fg | (fg << 16)) & SPREAD_MASK;
+    bg = (bg | (bg << 16)) & SPREAD_MASK;
+    v4u32_t r = ((((fg - bg) * m) >> 5) + bg) & SPREAD_MASK;
+    return ((r >> 16) | r) & 0xFFFF;
+}
+
+static inline v4u32_t mix565_premult_v(const uint32_t * pre, v4u32_t bg, uint32_t inv)
+{
+    v4u32_t r = (((bg >> 11) * inv + pre[0]) * 0x8081U) >> 0x17;
+    v4u32_t g = ((((bg >> 5) & 0x3F) * inv + pre[1]) * 0x8081U) >> 0x17;
+    v4u32_t b = (((bg & 0x1F) * inv + pre[2]) * 0x8081U) >> 0x17;
+    return (r << 11) | (g << 5) | b;
+}
+
+/*Ratio of a masked pixel: the mask alone, or mask scaled by opa with `cover_at` and above meaning opa*/
+static inline v4u32_t mask_ratio_v(v4u32_t m, uint32_t opa, uint32_t cover_at)
+{
+    v4u32_t cover = (v4u32_t)(m >= cover_at);   /*All ones where true*/
+    return (cover & opa) | (~cover & ((m * opa) >> 8));
+}
+
+static void fill_simd(uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride, uint16_t color, lv_opa_t opa,
+                      const lv_opa_t * mask, int32_t mask_stride)
+{
+    int32_t x;
+    int32_t y;
+    const v4u32_t cv = {color, color, color, color};
+
+    if(mask == NULL) {
+        if(opa >= LV_OPA_MAX) {
+            lv_color_t c;
+            c.full = color;
+            for(y = 0; y < h; y++) {
+                lv_color_fill((lv_color_t *)dest, c, w);
+                dest += dest_stride;
+            }
+            return;
+        }
+        const lv_opa_t opa8 = premult_opa(opa);
+        const uint32_t inv = 255 - opa8;
+        uint32_t pre[3];
+        premult_init(color, opa8, pre);
+        const uint16_t first = mix565(color, 0, opa);
+        bool leading = true;
+        for(y = 0; y < h; y++) {
+            x = 0;
+            if(leading) leading = fill_leading_black(dest, w, &x, first);
+            for(; x + 4 <= w; x += 4) store565(dest + x, mix565_premult_v(pre, load565(dest + x), inv));
+            for(; x < w; x++) dest[x] = mix565_premult(pre, dest[x], inv);
+            dest += dest_stride;
+        }
+        return;
+    }
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            uint32_t m32;
+            memcpy(&m32, mask + x, sizeof(m32));
+            if(m32 == 0) continue;
+            v4u32_t m = mask_ratio_v(load_mask(mask + x), opa, LV_OPA_COVER);
+            store565(dest + x, mix565_v(cv, load565(dest + x), m));
+        }
+        for(; x < w; x++) {
+            if(mask[x]) dest[x] = mix565(color, dest[x], fill_ratio(mask[x], opa));
+        }
+        dest += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+static void map_simd(uint16_t * dest, int32_t w, int32_t h, int32_t dest_stride, const uint16_t * src,
+                     int32_t src_stride, lv_opa_t opa, const lv_opa_t * mask, int32_t mask_stride)
+{
+    int32_t x;
+    int32_t y;
+
+    if(mask == NULL) {
+        if(opa >= LV_OPA_MAX) {
+            for(y = 0; y < h; y++) {
+                lv_memcpy(dest, src, w * sizeof(uint16_t));
+                dest += dest_stride;
+                src += src_stride;
+            }
+            return;
+        }
+        const v4u32_t ov = {opa, opa, opa, opa};
+        for(y = 0; y < h; y++) {
+            for(x = 0; x + 4 <= w; x += 4) store565(dest + x, mix565_v(load565(src + x), load565(dest + x), ov));
+            for(; x < w; x++) dest[x] = mix565(src[x], dest[x], opa);
+            dest += dest_stride;
+            src += src_stride;
+        }
+        return;
+    }
+
+    const bool mask_only = opa > LV_OPA_MAX;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            uint32_t m32;
+            memcpy(&m32, mask + x, sizeof(m32));
+            if(m32 == 0) continue;
+            if(m32 == 0xFFFFFFFF && mask_only) {
+                memcpy(dest + x, src + x, 4 * sizeof(uint16_t));
+                continue;
+            }
+            v4u32_t m = load_mask(mask + x);
+            if(!mask_only) m = mask_ratio_v(m, opa, LV_OPA_MAX);
+            store565(dest + x, mix565_v(load565(src + x), load565(dest + x), m));
+        }
+        for(; x < w; x++) {
+            uint32_t m = mask[x];
+            if(m == 0) continue;
+            dest[x] = mix565(src[x], dest[x], mask_only ? m : map_ratio((lv_opa_t)m, opa));
+        }
+        dest += dest_stride;
+        src += src_stride;
+        mask += mask_stride;
+    }
+}
+
+#endif /*BLEND565_SIMD*/
+
+#endif /*LV_DRAW_SW_BLEND_RGB565*/
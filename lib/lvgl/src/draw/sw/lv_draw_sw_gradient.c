@@ -253,7 +253,7 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
 
     /* Step 0: Check if the cache exist (else create it) */
     static bool inited = false;
-    if(!inited) {
+    if(!inited && _LV_DRAW_UNIT == 0) {   /*Other band units find no cache until unit 0 made it*/
         lv_gradient_set_cache_size(LV_GRAD_CACHE_DEF_SIZE);
         inited = true;
     }
@@ -14,14 +14,29 @@
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
 #include "../../core/lv_refr.h"
+#include "../../misc/lv_gc.h"
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+    #include "../../misc/lv_lru.h"
+    #ifdef LV_DRAW_SW_GLYPH_CACHE_INCLUDE
+        #include LV_DRAW_SW_GLYPH_CACHE_INCLUDE
+    #endif
+#endif
 
 /*********************
  *      DEFINES
  *********************/
+/*Guess of the average mask size to size the hash tables of the glyph caches*/
+#define GLYPH_CACHE_AVG_SIZE 128
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+typedef struct {
+    const lv_font_t * font;
+    uint32_t letter;
+} glyph_cache_key_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -35,9 +50,22 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p);
 #endif /*LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX*/
 
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+static const uint8_t * glyph_cache_get(const lv_font_glyph_dsc_t * g, uint32_t letter, const uint8_t ** map_p);
+static void glyph_unpack(uint8_t * a8, const uint8_t * map_p, uint32_t px_cnt, uint32_t bpp);
+static void glyph_cache_free(void * p);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+/*One cache per band unit, used only by that unit*/
+static lv_lru_t * glyph_caches[LV_REFR_BAND_UNITS];
+static uint32_t glyph_cache_size = LV_DRAW_SW_GLYPH_CACHE_SIZE;
+static uint32_t glyph_hits[LV_REFR_BAND_UNITS];
+static uint32_t glyph_misses[LV_REFR_BAND_UNITS];
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -139,7 +167,19 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
         return;
     }
 
-    const uint8_t * map_p = lv_font_get_glyph_bitmap(g.resolved_font, letter);
+    const uint8_t * map_p = NULL;
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+    /*Draw the unpacked mask instead, as an 8 bpp glyph.
+     *Looked up before the bitmap: a hit skips decompressing glyphs of compressed fonts.*/
+    if(!g.resolved_font->subpx && g.bpp < 8) {
+        const uint8_t * a8 = glyph_cache_get(&g, letter, &map_p);
+        if(a8) {
+            map_p = a8;
+            g.bpp = 8;
+        }
+    }
+#endif
+    if(map_p == NULL) map_p = lv_font_get_glyph_bitmap(g.resolved_font, letter);
     if(map_p == NULL) {
         LV_LOG_WARN("lv_draw_letter: character's bitmap not found");
         return;
@@ -157,6 +197,45 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
     }
 }
 
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+void _lv_draw_sw_glyph_cache_init(void)
+{
+    if(glyph_cache_size == 0) return;
+
+    uint32_t u;
+    for(u = 0; u < LV_REFR_BAND_UNITS; u++) {
+        if(glyph_caches[u]) continue;
+        glyph_caches[u] = lv_lru_create(glyph_cache_size, GLYPH_CACHE_AVG_SIZE, glyph_cache_free, NULL);
+    }
+}
+
+void lv_draw_sw_glyph_cache_set_size(uint32_t size)
+{
+    uint32_t u;
+    for(u = 0; u < LV_REFR_BAND_UNITS; u++) {
+        if(glyph_caches[u]) lv_lru_del(glyph_caches[u]);
+        glyph_caches[u] = NULL;
+        glyph_hits[u] = 0;
+        glyph_misses[u] = 0;
+    }
+
+    glyph_cache_size = size;
+    _lv_draw_sw_glyph_cache_init();
+}
+
+void lv_draw_sw_glyph_cache_get_stats(lv_draw_sw_glyph_cache_stats_t * stats)
+{
+    lv_memset_00(stats, sizeof(lv_draw_sw_glyph_cache_stats_t));
+
+    uint32_t u;
+    for(u = 0; u < LV_REFR_BAND_UNITS; u++) {
+        stats->hits += glyph_hits[u];
+        stats->misses += glyph_misses[u];
+        if(glyph_caches[u]) stats->size += glyph_caches[u]->total_memory - glyph_caches[u]->free_memory;
+    }
+}
+#endif /*LV_DRAW_SW_GLYPH_CACHE_SIZE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -217,19 +296,21 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
             return; /*Invalid bpp. Can't render the letter*/
     }
 
-    static lv_opa_t opa_table[256];
-    static lv_opa_t prev_opa = LV_OPA_TRANSP;
-    static uint32_t prev_bpp = 0;
+    /*Per band unit (initially LV_OPA_TRANSP and bpp 0)*/
+    static lv_opa_t opa_table_units[LV_REFR_BAND_UNITS][256];
+    static lv_opa_t prev_opa_units[LV_REFR_BAND_UNITS];
+    static uint32_t prev_bpp_units[LV_REFR_BAND_UNITS];
     if(opa < LV_OPA_MAX) {
-        if(prev_opa != opa || prev_bpp != bpp) {
+        lv_opa_t * opa_table = opa_table_units[_LV_DRAW_UNIT];
+        if(prev_opa_units[_LV_DRAW_UNIT] != opa || prev_bpp_units[_LV_DRAW_UNIT] != bpp) {
             uint32_t i;
             for(i = 0; i < shades; i++) {
                 opa_table[i] = bpp_opa_table_p[i] == LV_OPA_COVER ? opa : ((bpp_opa_table_p[i] * opa) >> 8);
             }
         }
         bpp_opa_table_p = opa_table;
-        prev_opa = opa;
-        prev_bpp = bpp;
+        prev_opa_units[_LV_DRAW_UNIT] = opa;
+        prev_bpp_units[_LV_DRAW_UNIT] = bpp;
     }
 
     int32_t col, row;
@@ -285,30 +366,44 @@ static void LV_ATTRIBUTE_FAST_MEM draw_letter_normal(lv_draw_ctx_t * draw_ctx, c
 #if LV_DRAW_COMPLEX
         int32_t mask_p_start = mask_p;
 #endif
-        bitmask = bitmask_init >> col_bit;
-        for(col = col_start; col < col_end; col++) {
-            /*Load the pixel's opacity into the mask*/
-            letter_px = (*map_p & bitmask) >> (col_bit_max - col_bit);
-            if(letter_px) {
-                mask_buf[mask_p] = bpp_opa_table_p[letter_px];
+        if(bpp == 8) {
+            /*One byte per pixel: copy the row, through the opacity table only if it scales*/
+            int32_t row_w = col_end - col_start;
+            if(bpp_opa_table_p == _lv_bpp8_opa_table) {
+                lv_memcpy(mask_buf + mask_p, map_p, row_w);
             }
             else {
-                mask_buf[mask_p] = 0;
+                for(col = 0; col < row_w; col++) mask_buf[mask_p + col] = bpp_opa_table_p[map_p[col]];
             }
+            map_p += row_w;
+            mask_p += row_w;
+        }
+        else {
+            bitmask = bitmask_init >> col_bit;
+            for(col = col_start; col < col_end; col++) {
+                /*Load the pixel's opacity into the mask*/
+                letter_px = (*map_p & bitmask) >> (col_bit_max - col_bit);
+                if(letter_px) {
+                    mask_buf[mask_p] = bpp_opa_table_p[letter_px];
+                }
+                else {
+                    mask_buf[mask_p] = 0;
+                }
 
-            /*Go to the next column*/
-            if(col_bit < col_bit_max) {
-                col_bit += bpp;
-                bitmask = bitmask >> bpp;
-            }
-            else {
-                col_bit = 0;
-                bitmask = bitmask_init;
-                map_p++;
-            }
+                /*Go to the next column*/
+                if(col_bit < col_bit_max) {
+                    col_bit += bpp;
+                    bitmask = bitmask >> bpp;
+                }
+                else {
+                    col_bit = 0;
+                    bitmask = bitmask_init;
+                    map_p++;
+                }
 
-            /*Next mask byte*/
-            mask_p++;
+                /*Next mask byte*/
+                mask_p++;
+            }
         }
 
 #if LV_DRAW_COMPLEX
@@ -569,3 +664,83 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
     lv_mem_buf_release(color_buf);
 }
 #endif /*LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX*/
+
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+/**
+ * Get the glyph's mask unpacked to one byte per pixel from the band unit's cache.
+ * Get the bitmap, unpack and add it on a miss.
+ * @param map_p store the bitmap here if it was read on a miss
+ * @return the A8 mask or NULL if the glyph is not cached (the caller draws the bitmap as is)
+ */
+static const uint8_t * glyph_cache_get(const lv_font_glyph_dsc_t * g, uint32_t letter, const uint8_t ** map_p)
+{
+    lv_lru_t * cache = glyph_caches[_LV_DRAW_UNIT];
+    if(cache == NULL) return NULL;
+
+    glyph_cache_key_t key;
+    lv_memset_00(&key, sizeof(key));    /*Hashed as bytes: clear the padding*/
+    key.font = g->resolved_font;
+    key.letter = letter;
+
+    void * a8 = NULL;
+    lv_lru_get(cache, &key, sizeof(key), &a8);
+    if(a8) {
+        glyph_hits[_LV_DRAW_UNIT]++;
+        return a8;
+    }
+
+    glyph_misses[_LV_DRAW_UNIT]++;
+
+    /*Don't let a few large glyphs flush the whole cache*/
+    uint32_t px_cnt = (uint32_t)g->box_w * g->box_h;
+    if(px_cnt == 0 || px_cnt > glyph_cache_size / 4) return NULL;
+
+    *map_p = lv_font_get_glyph_bitmap(g->resolved_font, letter);
+    if(*map_p == NULL) return NULL;
+
+    a8 = LV_DRAW_SW_GLYPH_CACHE_ALLOC(px_cnt);
+    if(a8 == NULL) return NULL;
+
+    glyph_unpack(a8, *map_p, px_cnt, g->bpp);
+    if(lv_lru_set(cache, &key, sizeof(key), a8, px_cnt) != LV_LRU_OK) {
+        glyph_cache_free(a8);
+        return NULL;
+    }
+
+    return a8;
+}
+
+/**
+ * Unpack a glyph bitmap to one opacity byte per pixel.
+ * The rows are continuous in the bitmap, so it's unpacked as one stream of pixels.
+ */
+static void glyph_unpack(uint8_t * a8, const uint8_t * map_p, uint32_t px_cnt, uint32_t bpp)
+{
+    const uint8_t * opa_table;
+    switch(bpp) {
+        case 1:
+            opa_table = _lv_bpp1_opa_table;
+            break;
+        case 2:
+            opa_table = _lv_bpp2_opa_table;
+            break;
+        default:
+            bpp = 4;    /*bpp 3 is stored as 4, like in draw_letter_normal*/
+            opa_table = _lv_bpp4_opa_table;
+            break;
+    }
+
+    uint32_t px_per_byte = 8 / bpp;
+    uint32_t mask = (1 << bpp) - 1;
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        uint32_t shift = 8 - bpp - (i % px_per_byte) * bpp;
+        a8[i] = opa_table[(map_p[i / px_per_byte] >> shift) & mask];
+    }
+}
+
+static void glyph_cache_free(void * p)
+{
+    LV_DRAW_SW_GLYPH_CACHE_FREE(p);
+}
+#endif /*LV_DRAW_SW_GLYPH_CACHE_SIZE*/
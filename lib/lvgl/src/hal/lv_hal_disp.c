@@ -95,6 +95,9 @@ void lv_disp_drv_init(lv_disp_drv_t * driver)
     driver->screen_transp    = 0;
     driver->dpi              = LV_DPI_DEF;
     driver->color_chroma_key = LV_COLOR_CHROMA_KEY;
+#if LV_REFR_BAND_UNITS > 1
+    driver->band_units       = LV_REFR_BAND_UNITS;
+#endif
 
 #if LV_USE_GPU_RA6M3_G2D
     driver->draw_ctx_init = lv_draw_ra6m3_2d_ctx_init;
@@ -157,6 +160,17 @@ void lv_disp_draw_buf_init(lv_disp_draw_buf_t * draw_buf, void * buf1, void * bu
     draw_buf->size    = size_in_px_cnt;
 }
 
+#if LV_REFR_BAND_UNITS > 1
+void lv_disp_draw_buf_set_band_bufs(lv_disp_draw_buf_t * draw_buf, uint8_t unit, void * buf1, void * buf2)
+{
+    LV_ASSERT(unit > 0 && unit < LV_REFR_BAND_UNITS);
+    if(unit == 0 || unit >= LV_REFR_BAND_UNITS) return;
+
+    draw_buf->band_bufs[unit - 1][0] = buf1;
+    draw_buf->band_bufs[unit - 1][1] = buf2;
+}
+#endif
+
 /**
  * Register an initialized display driver.
  * Automatically set the first display as active.
@@ -292,6 +306,9 @@ void lv_disp_remove(lv_disp_t * disp)
 {
     bool was_default = false;
     if(disp == lv_disp_get_default()) was_default = true;
+#if LV_REFR_BAND_UNITS > 1
+    uint32_t i;
+#endif
 
     /*Detach the input devices*/
     lv_indev_t * indev;
@@ -320,6 +337,13 @@ void lv_disp_remove(lv_disp_t * disp)
     _lv_ll_remove(&LV_GC_ROOT(_lv_disp_ll), disp);
     _lv_ll_clear(&disp->sync_areas);
     if(disp->refr_timer) lv_timer_del(disp->refr_timer);
+#if LV_REFR_BAND_UNITS > 1
+    for(i = 0; i < LV_REFR_BAND_UNITS - 1; i++) {
+        if(disp->band_ctx[i] == NULL) continue;
+        if(disp->driver->draw_ctx_deinit) disp->driver->draw_ctx_deinit(disp->driver, disp->band_ctx[i]);
+        lv_mem_free(disp->band_ctx[i]);
+    }
+#endif
     lv_mem_free(disp);
 
     if(was_default) lv_disp_set_default(_lv_ll_get_head(&LV_GC_ROOT(_lv_disp_ll)));
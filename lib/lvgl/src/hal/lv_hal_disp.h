@@ -61,6 +61,11 @@ typedef struct _lv_disp_draw_buf_t {
     volatile int flushing_last;
     volatile uint32_t last_area         : 1; /*1: the last area is being rendered*/
     volatile uint32_t last_part         : 1; /*1: the last part of the current area is being rendered*/
+
+#if LV_REFR_BAND_UNITS > 1
+    /*Buffer pairs of band units 1.. with partial buffers, `size` pixels each. @see lv_disp_draw_buf_set_band_bufs*/
+    void * band_bufs[LV_REFR_BAND_UNITS - 1][2];
+#endif
 } lv_disp_draw_buf_t;
 
 typedef enum {
@@ -136,6 +141,18 @@ typedef struct _lv_disp_drv_t {
     /** OPTIONAL: called when start rendering */
     void (*render_start_cb)(struct _lv_disp_drv_t * disp_drv);
 
+#if LV_REFR_BAND_UNITS > 1
+    /** OPTIONAL: Make band units 1..`units - 1` call `lv_refr_band_unit(disp, unit)` on their own
+     * threads and return without waiting for them. NULL: every band is rendered by the LVGL thread*/
+    void (*band_start_cb)(struct _lv_disp_drv_t * disp_drv, uint8_t units);
+
+    /** Wait until every unit started by `band_start_cb` returned from `lv_refr_band_unit()`*/
+    void (*band_wait_cb)(struct _lv_disp_drv_t * disp_drv);
+
+    /** Band units to use, 1..`LV_REFR_BAND_UNITS`. `LV_REFR_BAND_UNITS` by default*/
+    uint8_t band_units;
+#endif
+
     /** On CHROMA_KEYED images this color will be transparent.
      * `LV_COLOR_CHROMA_KEY` by default. (lv_conf.h)*/
     lv_color_t color_chroma_key;
@@ -190,6 +207,11 @@ typedef struct _lv_disp_t {
     /** Double buffer sync areas */
     lv_ll_t sync_areas;
 
+#if LV_REFR_BAND_UNITS > 1
+    /** Draw contexts of band units 1.., created on their first band*/
+    lv_draw_ctx_t * band_ctx[LV_REFR_BAND_UNITS - 1];
+#endif
+
     /*Miscellaneous data*/
     uint32_t last_activity_time;        /**< Last time when there was activity on this display*/
 } lv_disp_t;
@@ -223,6 +245,19 @@ void lv_disp_drv_init(lv_disp_drv_t * driver);
  */
 void lv_disp_draw_buf_init(lv_disp_draw_buf_t * draw_buf, void * buf1, void * buf2, uint32_t size_in_px_cnt);
 
+#if LV_REFR_BAND_UNITS > 1
+/**
+ * Give a band unit its own buffers, so it can render a band while the previous ones are flushed.
+ * Needed only with partial buffers: in direct and full refresh mode every unit draws into `buf_act`.
+ * Bands are rendered in parallel only if `buf2` and the buffers of all used units are set.
+ * @param draw_buf pointer to an initialized `lv_disp_draw_buf_t`
+ * @param unit the band unit, 1..`LV_REFR_BAND_UNITS - 1`
+ * @param buf1 buffer of `draw_buf->size` pixels
+ * @param buf2 second buffer of the same size
+ */
+void lv_disp_draw_buf_set_band_bufs(lv_disp_draw_buf_t * draw_buf, uint8_t unit, void * buf1, void * buf2);
+#endif
+
 /**
  * Register an initialized display driver.
  * Automatically set the first display as active.
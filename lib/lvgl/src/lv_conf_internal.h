@@ -229,6 +229,26 @@
     #endif
 #endif
 
+/*Render independent horizontal bands of a refresh on up to this many threads ("band units").
+ *Unit 0 is the thread calling `lv_timer_handler()`; the others are run by the display driver
+ *through `band_start_cb`/`band_wait_cb`. 1: serial refresh.*/
+#ifndef LV_REFR_BAND_UNITS
+    #ifdef CONFIG_LV_REFR_BAND_UNITS
+        #define LV_REFR_BAND_UNITS CONFIG_LV_REFR_BAND_UNITS
+    #else
+        #define LV_REFR_BAND_UNITS 1
+    #endif
+#endif
+
+/*Areas with fewer rows per unit than this are rendered by unit 0 alone*/
+#ifndef LV_REFR_BAND_MIN_ROWS
+    #ifdef CONFIG_LV_REFR_BAND_MIN_ROWS
+        #define LV_REFR_BAND_MIN_ROWS CONFIG_LV_REFR_BAND_MIN_ROWS
+    #else
+        #define LV_REFR_BAND_MIN_ROWS 16
+    #endif
+#endif
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #ifndef LV_TICK_CUSTOM
@@ -315,6 +335,37 @@
     #endif
 #endif /*LV_DRAW_COMPLEX*/
 
+/*Blend RGB565 fills and images with dedicated kernels (vectorized where the compiler supports it).
+ *Requires LV_COLOR_DEPTH 16, LV_COLOR_16_SWAP 0 and LV_COLOR_MIX_ROUND_OFS 0.*/
+#ifndef LV_DRAW_SW_BLEND_RGB565
+    #ifdef CONFIG_LV_DRAW_SW_BLEND_RGB565
+        #define LV_DRAW_SW_BLEND_RGB565 CONFIG_LV_DRAW_SW_BLEND_RGB565
+    #else
+        #define LV_DRAW_SW_BLEND_RGB565 0
+    #endif
+#endif
+
+/*Keep the unpacked A8 masks of drawn glyphs (fonts with 1..4 bpp) in an LRU cache of this many bytes
+ *per band unit, so redrawing a label copies the masks instead of unpacking the font bitmaps.
+ *0: no cache*/
+#ifndef LV_DRAW_SW_GLYPH_CACHE_SIZE
+    #ifdef CONFIG_LV_DRAW_SW_GLYPH_CACHE_SIZE
+        #define LV_DRAW_SW_GLYPH_CACHE_SIZE CONFIG_LV_DRAW_SW_GLYPH_CACHE_SIZE
+    #else
+        #define LV_DRAW_SW_GLYPH_CACHE_SIZE 0
+    #endif
+#endif
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+    /*Allocator of the cached masks, e.g. to keep them in fast RAM.
+     *LV_DRAW_SW_GLYPH_CACHE_INCLUDE can name the header to include for it.*/
+    #ifndef LV_DRAW_SW_GLYPH_CACHE_ALLOC
+        #define LV_DRAW_SW_GLYPH_CACHE_ALLOC lv_mem_alloc
+    #endif
+    #ifndef LV_DRAW_SW_GLYPH_CACHE_FREE
+        #define LV_DRAW_SW_GLYPH_CACHE_FREE lv_mem_free
+    #endif
+#endif
+
 /**
  * "Simple layers" are used when a widget has `style_opa < 255` to buffer the widget into a layer
  * and blend it as an image with the given opacity.
@@ -957,6 +1008,15 @@
     #endif
 #endif
 
+/*Storage class of the per-thread band unit index (LV_REFR_BAND_UNITS > 1)*/
+#ifndef LV_ATTRIBUTE_THREAD_LOCAL
+    #ifdef CONFIG_LV_ATTRIBUTE_THREAD_LOCAL
+        #define LV_ATTRIBUTE_THREAD_LOCAL CONFIG_LV_ATTRIBUTE_THREAD_LOCAL
+    #else
+        #define LV_ATTRIBUTE_THREAD_LOCAL __thread
+    #endif
+#endif
+
 /*Prefix variables that are used in GPU accelerated operations, often these need to be placed in RAM sections that are DMA accessible*/
 #ifndef LV_ATTRIBUTE_DMA
     #ifdef CONFIG_LV_ATTRIBUTE_DMA
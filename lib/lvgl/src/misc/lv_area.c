@@ -10,6 +10,7 @@
 
 #include "lv_area.h"
 #include "lv_math.h"
+#include "lv_gc.h"
 
 /*********************
  *      DEFINES
@@ -544,10 +545,14 @@ void lv_point_transform(lv_point_t * p, int32_t angle, int32_t zoom, const lv_po
         return;
     }
 
-    static int32_t angle_prev = INT32_MIN;
-    static int32_t sinma;
-    static int32_t cosma;
-    if(angle_prev != angle) {
+    /*Per band unit; 0 never matches as angle 0 returned above*/
+    static int32_t angle_prev_units[LV_REFR_BAND_UNITS];
+    static int32_t sinma_units[LV_REFR_BAND_UNITS];
+    static int32_t cosma_units[LV_REFR_BAND_UNITS];
+    int32_t * angle_prev = &angle_prev_units[_LV_DRAW_UNIT];
+    int32_t sinma = sinma_units[_LV_DRAW_UNIT];
+    int32_t cosma = cosma_units[_LV_DRAW_UNIT];
+    if(*angle_prev != angle) {
         int32_t angle_limited = angle;
         if(angle_limited > 3600) angle_limited -= 3600;
         if(angle_limited < 0) angle_limited += 3600;
@@ -566,7 +571,9 @@ void lv_point_transform(lv_point_t * p, int32_t angle, int32_t zoom, const lv_po
         cosma = (c1 * (10 - angle_rem) + c2 * angle_rem) / 10;
         sinma = sinma >> (LV_TRIGO_SHIFT - _LV_TRANSFORM_TRIGO_SHIFT);
         cosma = cosma >> (LV_TRIGO_SHIFT - _LV_TRANSFORM_TRIGO_SHIFT);
-        angle_prev = angle;
+        *angle_prev = angle;
+        sinma_units[_LV_DRAW_UNIT] = sinma;
+        cosma_units[_LV_DRAW_UNIT] = cosma;
     }
     int32_t x = p->x;
     int32_t y = p->y;
@@ -28,6 +28,10 @@
     LV_ROOTS
 #endif /*LV_ENABLE_GC*/
 
+#if LV_REFR_BAND_UNITS > 1
+    LV_ATTRIBUTE_THREAD_LOCAL uint8_t _lv_draw_unit;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -40,6 +40,15 @@ extern "C" {
 #define LV_DISPATCH10(f, t, n)
 #define LV_DISPATCH11(f, t, n)          LV_DISPATCH(f, t, n)
 
+/*Roots used while drawing have one copy per band unit (LV_REFR_BAND_UNITS); use LV_GC_UNIT_ROOT()*/
+typedef lv_mem_buf_arr_t _lv_mem_buf_units_t[LV_REFR_BAND_UNITS];
+typedef _lv_img_cache_entry_t _lv_img_cache_single_units_t[LV_REFR_BAND_UNITS];
+typedef uint8_t * _lv_font_decompr_buf_units_t[LV_REFR_BAND_UNITS];
+#if LV_DRAW_COMPLEX
+typedef _lv_draw_mask_radius_circle_dsc_arr_t _lv_circle_cache_units_t[LV_REFR_BAND_UNITS];
+typedef _lv_draw_mask_saved_arr_t _lv_draw_mask_list_units_t[LV_REFR_BAND_UNITS];
+#endif
+
 #define LV_ITERATE_ROOTS(f)                                                                            \
     LV_DISPATCH(f, lv_ll_t, _lv_timer_ll) /*Linked list to store the lv_timers*/                       \
     LV_DISPATCH(f, lv_ll_t, _lv_disp_ll)  /*Linked list of display device*/                            \
@@ -51,14 +60,14 @@ extern "C" {
     LV_DISPATCH(f, lv_ll_t, _lv_obj_style_trans_ll)                                                    \
     LV_DISPATCH(f, lv_layout_dsc_t *, _lv_layout_list)                                                 \
     LV_DISPATCH_COND(f, _lv_img_cache_entry_t*, _lv_img_cache_array, LV_IMG_CACHE_DEF, 1)              \
-    LV_DISPATCH_COND(f, _lv_img_cache_entry_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0)              \
+    LV_DISPATCH_COND(f, _lv_img_cache_single_units_t, _lv_img_cache_single, LV_IMG_CACHE_DEF, 0)       \
     LV_DISPATCH(f, lv_timer_t*, _lv_timer_act)                                                         \
-    LV_DISPATCH(f, lv_mem_buf_arr_t , lv_mem_buf)                                                      \
-    LV_DISPATCH_COND(f, _lv_draw_mask_radius_circle_dsc_arr_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)  \
-    LV_DISPATCH_COND(f, _lv_draw_mask_saved_arr_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)            \
+    LV_DISPATCH(f, _lv_mem_buf_units_t , lv_mem_buf)                                                   \
+    LV_DISPATCH_COND(f, _lv_circle_cache_units_t , _lv_circle_cache, LV_DRAW_COMPLEX, 1)                \
+    LV_DISPATCH_COND(f, _lv_draw_mask_list_units_t , _lv_draw_mask_list, LV_DRAW_COMPLEX, 1)           \
     LV_DISPATCH(f, void * , _lv_theme_default_styles)                                                  \
     LV_DISPATCH(f, void * , _lv_theme_basic_styles)                                                  \
-    LV_DISPATCH_COND(f, uint8_t *, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1)                    \
+    LV_DISPATCH_COND(f, _lv_font_decompr_buf_units_t, _lv_font_decompr_buf, LV_USE_FONT_COMPRESSED, 1) \
     LV_DISPATCH(f, uint8_t * , _lv_grad_cache_mem)                                                     \
     LV_DISPATCH(f, uint8_t * , _lv_style_custom_prop_flag_lookup_table)
 
@@ -76,6 +85,16 @@ extern "C" {
 LV_ITERATE_ROOTS(LV_EXTERN_ROOT)
 #endif /*LV_ENABLE_GC*/
 
+#if LV_REFR_BAND_UNITS > 1
+extern LV_ATTRIBUTE_THREAD_LOCAL uint8_t _lv_draw_unit;   /*Band unit drawing on this thread (0: the LVGL thread)*/
+#define _LV_DRAW_UNIT _lv_draw_unit
+#else
+#define _LV_DRAW_UNIT 0
+#endif
+
+/*This thread's copy of a per band unit root*/
+#define LV_GC_UNIT_ROOT(x) LV_GC_ROOT(x)[_LV_DRAW_UNIT]
+
 /**********************
  *      TYPEDEFS
  **********************/
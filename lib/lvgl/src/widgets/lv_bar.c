@@ -13,6 +13,7 @@
 #include "../draw/lv_draw.h"
 #include "../misc/lv_anim.h"
 #include "../misc/lv_math.h"
+#include "../misc/lv_gc.h"
 
 /*********************
  *      DEFINES
@@ -67,6 +68,10 @@ const lv_obj_class_t lv_bar_class = {
     .base_class = &lv_obj_class
 };
 
+#if LV_REFR_BAND_UNITS > 1
+    static lv_area_t unit_indic_area[LV_REFR_BAND_UNITS - 1]; /*Indicator drawn last by band units 1..*/
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -201,6 +206,14 @@ lv_bar_mode_t lv_bar_get_mode(lv_obj_t * obj)
     return bar->mode;
 }
 
+lv_area_t * _lv_bar_get_indic_area(lv_obj_t * obj)
+{
+#if LV_REFR_BAND_UNITS > 1
+    if(_LV_DRAW_UNIT != 0) return &unit_indic_area[_LV_DRAW_UNIT - 1];
+#endif
+    return &((lv_bar_t *)obj)->indic_area;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -244,6 +257,7 @@ static void draw_indic(lv_event_t * e)
 {
     lv_obj_t * obj = lv_event_get_target(e);
     lv_bar_t * bar = (lv_bar_t *)obj;
+    lv_area_t * indic = _lv_bar_get_indic_area(obj);
 
     lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
 
@@ -270,23 +284,23 @@ static void draw_indic(lv_event_t * e)
     lv_coord_t bg_top = lv_obj_get_style_pad_top(obj,       LV_PART_MAIN);
     lv_coord_t bg_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
     /*Respect padding and minimum width/height too*/
-    lv_area_copy(&bar->indic_area, &bar_coords);
-    bar->indic_area.x1 += bg_left;
-    bar->indic_area.x2 -= bg_right;
-    bar->indic_area.y1 += bg_top;
-    bar->indic_area.y2 -= bg_bottom;
-
-    if(hor && lv_area_get_height(&bar->indic_area) < LV_BAR_SIZE_MIN) {
-        bar->indic_area.y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
-        bar->indic_area.y2 = bar->indic_area.y1 + LV_BAR_SIZE_MIN;
+    lv_area_copy(indic, &bar_coords);
+    indic->x1 += bg_left;
+    indic->x2 -= bg_right;
+    indic->y1 += bg_top;
+    indic->y2 -= bg_bottom;
+
+    if(hor && lv_area_get_height(indic) < LV_BAR_SIZE_MIN) {
+        indic->y1 = obj->coords.y1 + (barh / 2) - (LV_BAR_SIZE_MIN / 2);
+        indic->y2 = indic->y1 + LV_BAR_SIZE_MIN;
     }
-    else if(!hor && lv_area_get_width(&bar->indic_area) < LV_BAR_SIZE_MIN) {
-        bar->indic_area.x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
-        bar->indic_area.x2 = bar->indic_area.x1 + LV_BAR_SIZE_MIN;
+    else if(!hor && lv_area_get_width(indic) < LV_BAR_SIZE_MIN) {
+        indic->x1 = obj->coords.x1 + (barw / 2) - (LV_BAR_SIZE_MIN / 2);
+        indic->x2 = indic->x1 + LV_BAR_SIZE_MIN;
     }
 
-    lv_coord_t indicw = lv_area_get_width(&bar->indic_area);
-    lv_coord_t indich = lv_area_get_height(&bar->indic_area);
+    lv_coord_t indicw = lv_area_get_width(indic);
+    lv_coord_t indich = lv_area_get_height(indic);
 
     /*Calculate the indicator length*/
     lv_coord_t anim_length = hor ? indicw : indich;
@@ -297,13 +311,13 @@ static void draw_indic(lv_event_t * e)
     lv_coord_t (*indic_length_calc)(const lv_area_t * area);
 
     if(hor) {
-        axis1 = &bar->indic_area.x1;
-        axis2 = &bar->indic_area.x2;
+        axis1 = &indic->x1;
+        axis2 = &indic->x2;
         indic_length_calc = lv_area_get_width;
     }
     else {
-        axis1 = &bar->indic_area.y1;
-        axis2 = &bar->indic_area.y2;
+        axis1 = &indic->y1;
+        axis2 = &indic->y2;
         indic_length_calc = lv_area_get_height;
     }
 
@@ -386,14 +400,14 @@ static void draw_indic(lv_event_t * e)
     }
 
     /*Do not draw a zero length indicator but at least call the draw part events*/
-    if(!sym && indic_length_calc(&bar->indic_area) <= 1) {
+    if(!sym && indic_length_calc(indic) <= 1) {
 
         lv_obj_draw_part_dsc_t part_draw_dsc;
         lv_obj_draw_dsc_init(&part_draw_dsc, draw_ctx);
         part_draw_dsc.part = LV_PART_INDICATOR;
         part_draw_dsc.class_p = MY_CLASS;
         part_draw_dsc.type = LV_BAR_DRAW_PART_INDICATOR;
-        part_draw_dsc.draw_area = &bar->indic_area;
+        part_draw_dsc.draw_area = indic;
 
         lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
         lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
@@ -401,7 +415,7 @@ static void draw_indic(lv_event_t * e)
     }
 
     lv_area_t indic_area;
-    lv_area_copy(&indic_area, &bar->indic_area);
+    lv_area_copy(&indic_area, indic);
 
     lv_draw_rect_dsc_t draw_rect_dsc;
     lv_draw_rect_dsc_init(&draw_rect_dsc);
@@ -413,7 +427,7 @@ static void draw_indic(lv_event_t * e)
     part_draw_dsc.class_p = MY_CLASS;
     part_draw_dsc.type = LV_BAR_DRAW_PART_INDICATOR;
     part_draw_dsc.rect_dsc = &draw_rect_dsc;
-    part_draw_dsc.draw_area = &bar->indic_area;
+    part_draw_dsc.draw_area = indic;
 
     lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
 
@@ -428,8 +442,8 @@ static void draw_indic(lv_event_t * e)
     /*Draw only the shadow and outline only if the indicator is long enough.
      *The radius of the bg and the indicator can make a strange shape where
      *it'd be very difficult to draw shadow.*/
-    if((hor && lv_area_get_width(&bar->indic_area) > indic_radius * 2) ||
-       (!hor && lv_area_get_height(&bar->indic_area) > indic_radius * 2)) {
+    if((hor && lv_area_get_width(indic) > indic_radius * 2) ||
+       (!hor && lv_area_get_height(indic) > indic_radius * 2)) {
         lv_opa_t bg_opa = draw_rect_dsc.bg_opa;
         lv_opa_t bg_img_opa = draw_rect_dsc.bg_img_opa;
         lv_opa_t border_opa = draw_rect_dsc.border_opa;
@@ -437,7 +451,7 @@ static void draw_indic(lv_event_t * e)
         draw_rect_dsc.bg_img_opa = LV_OPA_TRANSP;
         draw_rect_dsc.border_opa = LV_OPA_TRANSP;
 
-        lv_draw_rect(draw_ctx, &draw_rect_dsc, &bar->indic_area);
+        lv_draw_rect(draw_ctx, &draw_rect_dsc, indic);
 
         draw_rect_dsc.bg_opa = bg_opa;
         draw_rect_dsc.bg_img_opa = bg_img_opa;
@@ -481,7 +495,7 @@ static void draw_indic(lv_event_t * e)
 #if LV_DRAW_COMPLEX
     /*Create a mask to the current indicator area to see only this part from the whole gradient.*/
     lv_draw_mask_radius_param_t mask_indic_param;
-    lv_draw_mask_radius_init(&mask_indic_param, &bar->indic_area, draw_rect_dsc.radius, false);
+    lv_draw_mask_radius_init(&mask_indic_param, indic, draw_rect_dsc.radius, false);
     int16_t mask_indic_id = lv_draw_mask_add(&mask_indic_param, NULL);
 #endif
 
@@ -493,7 +507,7 @@ static void draw_indic(lv_event_t * e)
     draw_rect_dsc.bg_opa = LV_OPA_TRANSP;
     draw_rect_dsc.bg_img_opa = LV_OPA_TRANSP;
     draw_rect_dsc.shadow_opa = LV_OPA_TRANSP;
-    lv_draw_rect(draw_ctx, &draw_rect_dsc, &bar->indic_area);
+    lv_draw_rect(draw_ctx, &draw_rect_dsc, indic);
 
 #if LV_DRAW_COMPLEX
     lv_draw_mask_free_param(&mask_indic_param);
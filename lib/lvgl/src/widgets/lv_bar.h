@@ -151,6 +151,18 @@ int32_t lv_bar_get_max_value(const lv_obj_t * obj);
  */
 lv_bar_mode_t lv_bar_get_mode(lv_obj_t * obj);
 
+/*=====================
+ * Other functions
+ *====================*/
+
+/**
+ * Get the indicator area of the bar being drawn. Derived types use it while drawing: band units
+ * other than 0 draw the same bar at the same time so only unit 0 updates `indic_area` of the bar.
+ * @param obj       pointer to bar object
+ * @return          the indicator area on this band unit
+ */
+lv_area_t * _lv_bar_get_indic_area(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
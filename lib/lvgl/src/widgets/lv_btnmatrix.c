@@ -691,7 +691,6 @@ static void draw_main(lv_event_t * e)
     if(btnm->btn_cnt == 0) return;
 
     lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
-    obj->skip_trans = 1;
 
     lv_area_t area_obj;
     lv_obj_get_coords(obj, &area_obj);
@@ -708,14 +707,12 @@ static void draw_main(lv_event_t * e)
     lv_draw_label_dsc_t draw_label_dsc_def;
 
     lv_state_t state_ori = obj->state;
-    obj->state = LV_STATE_DEFAULT;
-    obj->skip_trans = 1;
+    _lv_obj_style_set_draw_state(obj, LV_STATE_DEFAULT);
     lv_draw_rect_dsc_init(&draw_rect_dsc_def);
     lv_draw_label_dsc_init(&draw_label_dsc_def);
     lv_obj_init_draw_rect_dsc(obj, LV_PART_ITEMS, &draw_rect_dsc_def);
     lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &draw_label_dsc_def);
-    obj->skip_trans = 0;
-    obj->state = state_ori;
+    _lv_obj_style_clear_draw_state(obj, state_ori);
 
     lv_coord_t ptop = lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
     lv_coord_t pbottom = lv_obj_get_style_pad_bottom(obj, LV_PART_MAIN);
@@ -770,14 +767,12 @@ static void draw_main(lv_event_t * e)
         }
         /*In other cases get the styles directly without caching them*/
         else {
-            obj->state = btn_state;
-            obj->skip_trans = 1;
+            _lv_obj_style_set_draw_state(obj, btn_state);
             lv_draw_rect_dsc_init(&draw_rect_dsc_act);
             lv_draw_label_dsc_init(&draw_label_dsc_act);
             lv_obj_init_draw_rect_dsc(obj, LV_PART_ITEMS, &draw_rect_dsc_act);
             lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &draw_label_dsc_act);
-            obj->state = state_ori;
-            obj->skip_trans = 0;
+            _lv_obj_style_clear_draw_state(obj, state_ori);
         }
 
         bool recolor = button_is_recolor(btnm->ctrl_bits[btn_i]);
@@ -842,7 +837,6 @@ static void draw_main(lv_event_t * e)
         lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
     }
 
-    obj->skip_trans = 0;
 #if LV_USE_ARABIC_PERSIAN_CHARS
     lv_mem_buf_release(txt_ap);
 #endif
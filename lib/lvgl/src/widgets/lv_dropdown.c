@@ -935,8 +935,7 @@ static void draw_box(lv_obj_t * dropdown_obj, lv_draw_ctx_t * draw_ctx, uint16_t
     lv_state_t state_ori = list_obj->state;
 
     if(state != list_obj->state) {
-        list_obj->state = state;
-        list_obj->skip_trans = 1;
+        _lv_obj_style_set_draw_state(list_obj, state);
     }
 
     /*Draw a rectangle under the selected item*/
@@ -960,8 +959,7 @@ static void draw_box(lv_obj_t * dropdown_obj, lv_draw_ctx_t * draw_ctx, uint16_t
     lv_obj_init_draw_rect_dsc(list_obj,  LV_PART_SELECTED, &sel_rect);
     lv_draw_rect(draw_ctx, &sel_rect, &rect_area);
 
-    list_obj->state = state_ori;
-    list_obj->skip_trans = 0;
+    _lv_obj_style_clear_draw_state(list_obj, state_ori);
 }
 
 static void draw_box_label(lv_obj_t * dropdown_obj, lv_draw_ctx_t * draw_ctx, uint16_t id, lv_state_t state)
@@ -973,8 +971,7 @@ static void draw_box_label(lv_obj_t * dropdown_obj, lv_draw_ctx_t * draw_ctx, ui
     lv_state_t state_orig = list_obj->state;
 
     if(state != list_obj->state) {
-        list_obj->state = state;
-        list_obj->skip_trans = 1;
+        _lv_obj_style_set_draw_state(list_obj, state);
     }
 
     lv_draw_label_dsc_t label_dsc;
@@ -1006,8 +1003,7 @@ static void draw_box_label(lv_obj_t * dropdown_obj, lv_draw_ctx_t * draw_ctx, ui
         lv_draw_label(draw_ctx, &label_dsc, &label->coords, lv_label_get_text(label), NULL);
         draw_ctx->clip_area = clip_area_ori;
     }
-    list_obj->state = state_orig;
-    list_obj->skip_trans = 0;
+    _lv_obj_style_clear_draw_state(list_obj, state_orig);
 }
 
 static lv_res_t btn_release_handler(lv_obj_t * obj)
@@ -15,6 +15,7 @@
 #include "../draw/lv_draw.h"
 #include "../misc/lv_math.h"
 #include "../core/lv_disp.h"
+#include "../misc/lv_gc.h"
 #include "lv_img.h"
 
 /*********************
@@ -337,6 +338,7 @@ static void draw_knob(lv_event_t * e)
 
     const bool is_rtl = LV_BASE_DIR_RTL == lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
     const bool is_horizontal = is_slider_horizontal(obj);
+    const lv_area_t * indic_area = _lv_bar_get_indic_area(obj);
 
     lv_area_t knob_area;
     lv_coord_t knob_size;
@@ -346,13 +348,13 @@ static void draw_knob(lv_event_t * e)
 
     if(is_horizontal) {
         knob_size = lv_obj_get_height(obj);
-        if(is_symmetrical && slider->bar.cur_value < 0) knob_area.x1 = slider->bar.indic_area.x1;
-        else knob_area.x1 = LV_SLIDER_KNOB_COORD(is_rtl, slider->bar.indic_area);
+        if(is_symmetrical && slider->bar.cur_value < 0) knob_area.x1 = indic_area->x1;
+        else knob_area.x1 = LV_SLIDER_KNOB_COORD(is_rtl, (*indic_area));
     }
     else {
         knob_size = lv_obj_get_width(obj);
-        if(is_symmetrical && slider->bar.cur_value < 0) knob_area.y1 = slider->bar.indic_area.y2;
-        else knob_area.y1 = slider->bar.indic_area.y1;
+        if(is_symmetrical && slider->bar.cur_value < 0) knob_area.y1 = indic_area->y2;
+        else knob_area.y1 = indic_area->y1;
     }
 
     lv_draw_rect_dsc_t knob_rect_dsc;
@@ -360,8 +362,10 @@ static void draw_knob(lv_event_t * e)
     lv_obj_init_draw_rect_dsc(obj, LV_PART_KNOB, &knob_rect_dsc);
     /* Update knob area with knob style */
     position_knob(obj, &knob_area, knob_size, is_horizontal);
-    /* Update right knob area with calculated knob area */
-    lv_area_copy(&slider->right_knob_area, &knob_area);
+    /* Update right knob area with calculated knob area. Only band unit 0 stores it for hit testing */
+    lv_area_t right_knob_area;
+    lv_area_copy(&right_knob_area, &knob_area);
+    if(_LV_DRAW_UNIT == 0) lv_area_copy(&slider->right_knob_area, &knob_area);
 
     lv_obj_draw_part_dsc_t part_draw_dsc;
     lv_obj_draw_dsc_init(&part_draw_dsc, draw_ctx);
@@ -369,12 +373,12 @@ static void draw_knob(lv_event_t * e)
     part_draw_dsc.class_p = MY_CLASS;
     part_draw_dsc.type = LV_SLIDER_DRAW_PART_KNOB;
     part_draw_dsc.id = 0;
-    part_draw_dsc.draw_area = &slider->right_knob_area;
+    part_draw_dsc.draw_area = &right_knob_area;
     part_draw_dsc.rect_dsc = &knob_rect_dsc;
 
     if(lv_slider_get_mode(obj) != LV_SLIDER_MODE_RANGE) {
         lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
-        lv_draw_rect(draw_ctx, &knob_rect_dsc, &slider->right_knob_area);
+        lv_draw_rect(draw_ctx, &knob_rect_dsc, &right_knob_area);
         lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
     }
     else {
@@ -383,28 +387,30 @@ static void draw_knob(lv_event_t * e)
         lv_memcpy(&knob_rect_dsc_tmp, &knob_rect_dsc, sizeof(lv_draw_rect_dsc_t));
         /* Draw the right knob */
         lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
-        lv_draw_rect(draw_ctx, &knob_rect_dsc, &slider->right_knob_area);
+        lv_draw_rect(draw_ctx, &knob_rect_dsc, &right_knob_area);
         lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
 
         /*Calculate the second knob area*/
         if(is_horizontal) {
             /*use !is_rtl to get the other knob*/
-            knob_area.x1 = LV_SLIDER_KNOB_COORD(!is_rtl, slider->bar.indic_area);
+            knob_area.x1 = LV_SLIDER_KNOB_COORD(!is_rtl, (*indic_area));
         }
         else {
-            knob_area.y1 = slider->bar.indic_area.y2;
+            knob_area.y1 = indic_area->y2;
         }
         position_knob(obj, &knob_area, knob_size, is_horizontal);
-        lv_area_copy(&slider->left_knob_area, &knob_area);
+        lv_area_t left_knob_area;
+        lv_area_copy(&left_knob_area, &knob_area);
+        if(_LV_DRAW_UNIT == 0) lv_area_copy(&slider->left_knob_area, &knob_area);
 
         lv_memcpy(&knob_rect_dsc, &knob_rect_dsc_tmp, sizeof(lv_draw_rect_dsc_t));
         part_draw_dsc.type = LV_SLIDER_DRAW_PART_KNOB_LEFT;
-        part_draw_dsc.draw_area = &slider->left_knob_area;
+        part_draw_dsc.draw_area = &left_knob_area;
         part_draw_dsc.rect_dsc = &knob_rect_dsc;
         part_draw_dsc.id = 1;
 
         lv_event_send(obj, LV_EVENT_DRAW_PART_BEGIN, &part_draw_dsc);
-        lv_draw_rect(draw_ctx, &knob_rect_dsc, &slider->left_knob_area);
+        lv_draw_rect(draw_ctx, &knob_rect_dsc, &left_knob_area);
         lv_event_send(obj, LV_EVENT_DRAW_PART_END, &part_draw_dsc);
     }
 }
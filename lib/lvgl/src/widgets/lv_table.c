@@ -686,8 +686,7 @@ static void draw_main(lv_event_t * e)
     lv_coord_t bg_right = lv_obj_get_style_pad_right(obj, LV_PART_MAIN);
 
     lv_state_t state_ori = obj->state;
-    obj->state = LV_STATE_DEFAULT;
-    obj->skip_trans = 1;
+    _lv_obj_style_set_draw_state(obj, LV_STATE_DEFAULT);
     lv_draw_rect_dsc_t rect_dsc_def;
     lv_draw_rect_dsc_t rect_dsc_act; /*Passed to the event to modify it*/
     lv_draw_rect_dsc_init(&rect_dsc_def);
@@ -697,8 +696,7 @@ static void draw_main(lv_event_t * e)
     lv_draw_label_dsc_t label_dsc_act;  /*Passed to the event to modify it*/
     lv_draw_label_dsc_init(&label_dsc_def);
     lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &label_dsc_def);
-    obj->state = state_ori;
-    obj->skip_trans = 0;
+    _lv_obj_style_clear_draw_state(obj, state_ori);
 
     uint16_t col;
     uint16_t row;
@@ -797,14 +795,12 @@ static void draw_main(lv_event_t * e)
             }
             /*In other cases get the styles directly without caching them*/
             else {
-                obj->state = cell_state;
-                obj->skip_trans = 1;
+                _lv_obj_style_set_draw_state(obj, cell_state);
                 lv_draw_rect_dsc_init(&rect_dsc_act);
                 lv_draw_label_dsc_init(&label_dsc_act);
                 lv_obj_init_draw_rect_dsc(obj, LV_PART_ITEMS, &rect_dsc_act);
                 lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &label_dsc_act);
-                obj->state = state_ori;
-                obj->skip_trans = 0;
+                _lv_obj_style_clear_draw_state(obj, state_ori);
             }
 
             part_draw_dsc.draw_area = &cell_area_border;
@@ -0,0 +1,1362 @@
+/*******************************************************************************
+ * Size: 18 px
+ * Bpp: 4
+ * Opts: generated by generate_ui_fonts.py from lv_font_montserrat_18.c, RLE compressed
+ * Characters:  !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~°
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+0020 " " */
+
+    /* U+0021 "!" */
+    0x9f, 0x61, 0x0, 0xc7, 0xe0, 0x22, 0x0, 0xce,
+    0x60, 0x18, 0x44, 0x6, 0x9e, 0x22, 0x50, 0xba,
+    0x7d, 0x3,
+
+    /* U+0022 """ */
+    0xda, 0x9, 0xe0, 0x30, 0x1, 0x80, 0x42, 0x2,
+    0x20, 0xf, 0x87, 0x20, 0x23, 0x0,
+
+    /* U+0023 "#" */
+    0x0, 0xdc, 0xa0, 0x4, 0xf0, 0xf, 0x85, 0x80,
+    0x4, 0x20, 0x1e, 0x20, 0x20, 0x7, 0x10, 0x6,
+    0xff, 0x68, 0x77, 0xf9, 0xcf, 0xfc, 0x41, 0x54,
+    0x51, 0xaa, 0x89, 0x6a, 0x84, 0xa, 0xa3, 0x55,
+    0xc7, 0x8a, 0xa0, 0xc, 0x44, 0x0, 0x84, 0x80,
+    0x30, 0x89, 0x84, 0x63, 0x7, 0x10, 0x4, 0x77,
+    0x9, 0xfb, 0x98, 0x19, 0xd2, 0x15, 0x74, 0x13,
+    0x76, 0x71, 0xbb, 0x80, 0x91, 0xc1, 0xd1, 0x1e,
+    0x48, 0x82, 0x0, 0x98, 0x4, 0x1, 0xcc, 0x1,
+    0xe1, 0x10, 0x4, 0x46, 0x1, 0x80,
+
+    /* U+0024 "$" */
+    0x0, 0xe7, 0x20, 0xf, 0xe9, 0x60, 0xf, 0xfe,
+    0x29, 0x56, 0x8d, 0xec, 0x90, 0x0, 0xf5, 0x58,
+    0xc, 0x1b, 0x80, 0x10, 0x17, 0x61, 0x8d, 0xcf,
+    0x0, 0x29, 0x20, 0x6, 0x33, 0x0, 0xc, 0x8c,
+    0x3, 0xf4, 0x6, 0x50, 0x88, 0x3, 0x96, 0xd1,
+    0x42, 0xb5, 0xc0, 0x32, 0x5f, 0xa, 0x1c, 0x58,
+    0x7, 0x8, 0x7f, 0x22, 0x40, 0x1f, 0xb4, 0x8,
+    0x2d, 0x0, 0x3b, 0x41, 0x45, 0x6f, 0x68, 0x7f,
+    0x91, 0x4c, 0x7e, 0x5, 0x41, 0xa, 0x68, 0x0,
+    0x2f, 0x9e, 0x37, 0x8c, 0x1, 0xff, 0xc1,
+
+    /* U+0025 "%" */
+    0x1, 0xbf, 0xc3, 0x0, 0xc5, 0xe8, 0x1, 0x69,
+    0x75, 0x68, 0x6, 0xe6, 0x40, 0x1, 0x1c, 0x8b,
+    0x12, 0x80, 0x1c, 0xa4, 0x2, 0x62, 0x0, 0x98,
+    0x80, 0xa2, 0x80, 0x33, 0x90, 0x4, 0xc2, 0x1c,
+    0xc8, 0x1, 0x8c, 0x9c, 0x10, 0xdd, 0xc5, 0x20,
+    0x1e, 0xea, 0xfa, 0xb3, 0x8a, 0x1a, 0xeb, 0x20,
+    0x1, 0xef, 0x71, 0x39, 0x93, 0x4f, 0xf, 0x0,
+    0x30, 0x83, 0x14, 0x19, 0xa4, 0xa0, 0xd4, 0x3,
+    0x14, 0xd0, 0xb9, 0x0, 0x4e, 0x40, 0x1a, 0x55,
+    0x1, 0xcc, 0x2, 0x62, 0x0, 0x99, 0x6c, 0x0,
+    0x66, 0x70, 0x52, 0x40, 0x0, 0xcd, 0x88, 0x5,
+    0xf9, 0xf3, 0xa2,
+
+    /* U+0026 "&" */
+    0x0, 0x93, 0x3f, 0xa4, 0x3, 0xe3, 0xb7, 0xa9,
+    0x69, 0x0, 0xf5, 0x5, 0xab, 0xaa, 0x0, 0x78,
+    0x40, 0x40, 0xe, 0xc0, 0x1e, 0xa0, 0xa3, 0xc3,
+    0x90, 0xf, 0x14, 0xa6, 0x6, 0x10, 0x7, 0x92,
+    0x4, 0x1c, 0x80, 0x2, 0x1, 0x2d, 0xa7, 0x4a,
+    0x58, 0xf, 0x28, 0x2, 0xce, 0x81, 0xa5, 0x2d,
+    0x81, 0xc0, 0x85, 0x0, 0x26, 0x94, 0x84, 0x20,
+    0x20, 0x50, 0xc, 0xe4, 0x1, 0xce, 0x5d, 0x31,
+    0x5c, 0x6e, 0x96, 0x0, 0x8a, 0x26, 0x77, 0x37,
+    0xc4, 0x98, 0x4, 0xb9, 0xfe, 0xd9, 0x10, 0x68,
+    0x0,
+
+    /* U+0027 "'" */
+    0xda, 0x3, 0x0, 0x8, 0x80, 0x19, 0x0,
+
+    /* U+0028 "(" */
+    0x0, 0x37, 0xa0, 0x2, 0xcd, 0x1, 0xa, 0x80,
+    0x1a, 0xe, 0x0, 0x42, 0x10, 0x1, 0x30, 0x0,
+    0x80, 0xc0, 0x2, 0x1e, 0x0, 0x70, 0x10, 0xf,
+    0x9c, 0x4, 0x0, 0x21, 0xe0, 0x2, 0x3, 0x0,
+    0x89, 0x80, 0x25, 0x21, 0x0, 0x58, 0x38, 0x0,
+    0xca, 0x80, 0x2b, 0x34,
+
+    /* U+0029 ")" */
+    0x3f, 0x70, 0x1, 0xa4, 0x80, 0x5c, 0x2a, 0x0,
+    0x40, 0xf0, 0x0, 0x9a, 0x0, 0x4a, 0x22, 0x0,
+    0x70, 0x10, 0x0, 0x41, 0xc0, 0x6, 0x2, 0x1,
+    0xf1, 0x80, 0x80, 0x4, 0x1c, 0x1, 0xc0, 0x40,
+    0x5, 0x11, 0x0, 0x9a, 0x0, 0x10, 0x3c, 0x1,
+    0xc2, 0xa0, 0x69, 0x20, 0x0,
+
+    /* U+002A "*" */
+    0x0, 0xb8, 0x80, 0x6, 0xc0, 0x12, 0xb3, 0xde,
+    0x8f, 0x58, 0x26, 0x0, 0xf, 0x59, 0x3c, 0x41,
+    0x31, 0x9e, 0x30, 0x66, 0xcc, 0xcc, 0x1, 0x22,
+    0x80,
+
+    /* U+002B "+" */
+    0x0, 0x84, 0xc0, 0x3e, 0x9c, 0x0, 0xff, 0xe0,
+    0x89, 0x10, 0x40, 0x8a, 0xd, 0xd9, 0x83, 0x76,
+    0x48, 0xaa, 0x28, 0x55, 0x4a, 0x8a, 0xa2, 0x5,
+    0x58, 0x40, 0x3f, 0xf8, 0xc0,
+
+    /* U+002C "," */
+    0x1, 0x10, 0x3, 0xf8, 0x40, 0x40, 0xc2, 0x4,
+    0x83, 0x1c, 0x0, 0xba, 0x0,
+
+    /* U+002D "-" */
+    0x88, 0xce, 0xfd, 0x20,
+
+    /* U+002E "." */
+    0x5, 0x60, 0x1a, 0x92, 0x13, 0x22,
+
+    /* U+002F "/" */
+    0x0, 0xf2, 0xb8, 0x7, 0xaf, 0x40, 0x38, 0xc7,
+    0xc0, 0x3a, 0x81, 0x40, 0x39, 0xd4, 0x3, 0x90,
+    0x78, 0x3, 0xb4, 0x50, 0x3, 0x9d, 0xc0, 0x1c,
+    0x83, 0xa0, 0x1d, 0xa2, 0x80, 0x1c, 0xee, 0x0,
+    0xe4, 0x1d, 0x0, 0xee, 0x14, 0x0, 0xe5, 0x70,
+    0xe, 0x50, 0xa0, 0xe, 0xf1, 0x30, 0xe, 0x57,
+    0x0, 0xe5, 0xa, 0x0, 0xe0,
+
+    /* U+0030 "0" */
+    0x0, 0x92, 0xfb, 0x96, 0x80, 0x1c, 0xd6, 0x8a,
+    0xa4, 0xb6, 0x0, 0x8a, 0x4b, 0xae, 0xdc, 0x52,
+    0x40, 0x8, 0xe, 0x10, 0x0, 0xf0, 0x40, 0x1,
+    0x4, 0xc0, 0x31, 0x8a, 0x0, 0x5, 0x40, 0x3c,
+    0xa2, 0x2, 0x2, 0x1, 0xe1, 0x1, 0x10, 0x8,
+    0x7, 0x84, 0x4, 0x5, 0x40, 0x3c, 0xa2, 0x0,
+    0x71, 0x30, 0xc, 0x62, 0xe0, 0xb, 0xe, 0x10,
+    0x0, 0xf0, 0x58, 0x0, 0xa4, 0xba, 0xed, 0xc5,
+    0x24, 0x1, 0x35, 0xa2, 0xa9, 0x2d, 0x80, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xfb, 0x15, 0x60, 0x4, 0x55, 0x0, 0x3f,
+    0xfd, 0x0,
+
+    /* U+0032 "2" */
+    0x1, 0x8d, 0xfe, 0xc5, 0x0, 0x27, 0x38, 0x29,
+    0x1d, 0x38, 0x39, 0xe6, 0xd6, 0x68, 0x40, 0x1e,
+    0x18, 0x4, 0x48, 0x4, 0x1, 0xf3, 0x81, 0x80,
+    0x78, 0xcc, 0x82, 0x1, 0xc5, 0xa3, 0x20, 0x1c,
+    0x58, 0x3a, 0x40, 0x18, 0xb0, 0x70, 0xc0, 0x31,
+    0x60, 0xe1, 0x80, 0x62, 0xc1, 0xc3, 0x0, 0xc5,
+    0x82, 0x73, 0x55, 0x9d, 0xc2, 0x6, 0xab, 0xd8,
+
+    /* U+0033 "3" */
+    0x5f, 0xff, 0xc0, 0xca, 0xbc, 0x60, 0x60, 0x75,
+    0x5a, 0xc8, 0x74, 0x3, 0xda, 0x3a, 0x20, 0x1d,
+    0x27, 0x26, 0x1, 0xc8, 0xc2, 0x2, 0x1, 0xc2,
+    0x43, 0x3c, 0xa0, 0x19, 0x77, 0xf0, 0x68, 0x80,
+    0x3c, 0x72, 0x8, 0x1, 0xf0, 0x80, 0x1a, 0x44,
+    0x2, 0x1b, 0x4, 0xf6, 0xec, 0xbc, 0xe2, 0x72,
+    0x9b, 0x52, 0x42, 0x4a, 0x80,
+
+    /* U+0034 "4" */
+    0x0, 0xf2, 0x7d, 0x80, 0x7e, 0x1a, 0x2b, 0x0,
+    0xfd, 0xa3, 0xe0, 0x1f, 0xa4, 0xe8, 0x80, 0x3e,
+    0x56, 0x62, 0x80, 0x7c, 0x54, 0x72, 0x7, 0x8a,
+    0x1, 0xbc, 0x74, 0x0, 0xe6, 0x40, 0x15, 0x95,
+    0x8, 0x7, 0xc8, 0x80, 0xbf, 0xfa, 0xc2, 0x3f,
+    0x5d, 0x9b, 0xc8, 0x6, 0xca, 0x73, 0x3e, 0xe0,
+    0xb9, 0x80, 0xf, 0xfe, 0x60,
+
+    /* U+0035 "5" */
+    0x2, 0xff, 0xf8, 0x0, 0xc0, 0x6a, 0xbc, 0x0,
+    0x10, 0x9a, 0xae, 0x0, 0x10, 0x30, 0x7, 0xdc,
+    0x4, 0x1, 0xf1, 0x87, 0x7f, 0xb1, 0xc0, 0x2d,
+    0x55, 0x90, 0xe3, 0x0, 0xf, 0x55, 0x5f, 0xa1,
+    0xb0, 0x7, 0xd0, 0x18, 0x1, 0xfe, 0x3c, 0x20,
+    0xd, 0x1, 0x8a, 0x7b, 0xab, 0xb7, 0x22, 0x19,
+    0x98, 0xc0, 0x88, 0x28, 0xb0,
+
+    /* U+0036 "6" */
+    0x0, 0x86, 0x37, 0xfb, 0x18, 0x2, 0x4f, 0x71,
+    0x54, 0x1f, 0x0, 0xd, 0x5, 0xe5, 0x53, 0x64,
+    0x1, 0x23, 0x48, 0x1, 0xf3, 0xa, 0x0, 0x7e,
+    0x15, 0x2a, 0xef, 0xd7, 0x0, 0x8, 0x36, 0xbb,
+    0x98, 0x22, 0xc0, 0x22, 0x5d, 0x99, 0x6a, 0xa2,
+    0x88, 0x2, 0x0, 0x34, 0x86, 0x2, 0x0, 0x7e,
+    0x10, 0xf0, 0x80, 0xd, 0x21, 0x80, 0x8c, 0xbb,
+    0x32, 0xd5, 0x52, 0x0, 0x26, 0x85, 0x98, 0x33,
+    0x40,
+
+    /* U+0037 "7" */
+    0x7f, 0xff, 0xe0, 0x9, 0x15, 0x78, 0x4, 0x2,
+    0xfa, 0xad, 0xe0, 0xc0, 0x20, 0x1e, 0x90, 0x90,
+    0x6f, 0x40, 0x8, 0xcc, 0xa2, 0x1, 0xf4, 0x84,
+    0x80, 0x7c, 0x2a, 0x66, 0x0, 0xfa, 0x42, 0x40,
+    0x3f, 0x30, 0xa8, 0x7, 0xcc, 0x32, 0x1, 0xfa,
+    0xc1, 0x80, 0x3e, 0x42, 0x61, 0x0, 0xfb, 0xc2,
+    0xc0, 0x38,
+
+    /* U+0038 "8" */
+    0x0, 0x15, 0x77, 0xfb, 0x1c, 0x2, 0x3d, 0x55,
+    0x3b, 0xc, 0x58, 0x2, 0x42, 0xae, 0x27, 0x51,
+    0x6, 0x2, 0x8, 0x1, 0x8c, 0x1c, 0x3c, 0x35,
+    0x8, 0x8c, 0xe4, 0x80, 0x92, 0x77, 0xba, 0x91,
+    0xc0, 0x2, 0xc8, 0xbd, 0x4a, 0x8e, 0x8, 0x58,
+    0xfc, 0x2b, 0x54, 0x14, 0x90, 0xa0, 0x80, 0x66,
+    0x3, 0x0, 0x8, 0x7, 0x18, 0x0, 0x88, 0x88,
+    0x0, 0xd0, 0x18, 0x1c, 0x17, 0x68, 0x9d, 0x53,
+    0x70, 0x3d, 0x66, 0x3b, 0xc, 0xe0, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x36, 0x7f, 0xb1, 0x80, 0x35, 0x48, 0xb3,
+    0x84, 0xd0, 0x0, 0xd5, 0x36, 0x63, 0x21, 0x58,
+    0x10, 0x38, 0x3, 0x38, 0x58, 0x8, 0x18, 0x6,
+    0x20, 0x21, 0x70, 0x95, 0x10, 0x4f, 0x0, 0x18,
+    0xd8, 0xd7, 0x7d, 0xb3, 0x0, 0x41, 0x3a, 0xa2,
+    0x19, 0x66, 0x4, 0x1, 0x2b, 0xb8, 0xc1, 0xc0,
+    0x40, 0x3e, 0x42, 0x50, 0xf, 0x8e, 0x82, 0x0,
+    0x11, 0xd7, 0x59, 0x81, 0xa2, 0x0, 0x6a, 0xac,
+    0x2d, 0xaa, 0x0,
+
+    /* U+003A ":" */
+    0xc, 0xd0, 0x13, 0x22, 0xd, 0x49, 0x2, 0xb0,
+    0x7, 0xff, 0x9, 0x58, 0x6, 0xa4, 0x84, 0xc8,
+    0x80,
+
+    /* U+003B ";" */
+    0xc, 0xd0, 0x13, 0x22, 0xd, 0x49, 0x2, 0xb0,
+    0x7, 0xff, 0x8, 0x44, 0x0, 0xfe, 0x10, 0x10,
+    0x30, 0x81, 0x20, 0xc7, 0x0, 0x2e, 0x80,
+
+    /* U+003C "<" */
+    0x0, 0xf9, 0x48, 0x3, 0xc, 0x75, 0x30, 0x1,
+    0x2f, 0x9d, 0xd8, 0x8d, 0xb6, 0xf3, 0xf2, 0x61,
+    0x44, 0xf8, 0xc0, 0x1a, 0x4d, 0xf9, 0xc4, 0x2,
+    0x5c, 0xc3, 0xc7, 0x5a, 0x0, 0x47, 0x3d, 0x2d,
+    0x68, 0x1, 0x85, 0xb6, 0xd8,
+
+    /* U+003D "=" */
+    0xcf, 0xff, 0x92, 0xa2, 0x3e, 0x66, 0x3b, 0xfc,
+    0x40, 0x1f, 0xc2, 0x45, 0xf0, 0x6e, 0xfe, 0x48,
+    0xaa, 0xf9, 0x40,
+
+    /* U+003E ">" */
+    0x62, 0x0, 0xfa, 0xb6, 0xd0, 0x3, 0xb2, 0x5e,
+    0xf9, 0xc4, 0x2, 0x6c, 0xc3, 0xc7, 0x50, 0x80,
+    0x47, 0x3a, 0x4a, 0xa0, 0x9, 0x2f, 0x49, 0x94,
+    0x63, 0xad, 0xe7, 0xe4, 0x75, 0xd3, 0x30, 0xc0,
+    0x14, 0xf5, 0x18, 0x7,
+
+    /* U+003F "?" */
+    0x2, 0x9d, 0xfe, 0xc5, 0x0, 0x26, 0xb3, 0x4a,
+    0x75, 0x0, 0x3, 0xdb, 0x9b, 0xd0, 0x70, 0x4c,
+    0x20, 0x8, 0x8c, 0x3, 0xf0, 0x99, 0x80, 0x3c,
+    0x3a, 0x1e, 0x1, 0xc3, 0x87, 0x66, 0x1, 0xd0,
+    0x54, 0x80, 0x1e, 0x33, 0x28, 0x7, 0xd5, 0x80,
+    0x1f, 0x8c, 0xc0, 0x1f, 0xe, 0x60, 0x40, 0x3c,
+    0x26, 0x42, 0x1,
+
+    /* U+0040 "@" */
+    0x0, 0xe2, 0x9d, 0xff, 0x76, 0x38, 0x80, 0x7e,
+    0x9d, 0x5a, 0xa5, 0xd9, 0x2b, 0x98, 0x3, 0xd8,
+    0xf7, 0x8e, 0xa8, 0xb1, 0xb3, 0x30, 0x6, 0xa2,
+    0xf4, 0x3b, 0xef, 0xb2, 0xbb, 0x63, 0x30, 0x0,
+    0x8b, 0x42, 0x98, 0xaf, 0xf, 0xaa, 0x7, 0x30,
+    0x0, 0xe3, 0x40, 0xa1, 0xf9, 0x7c, 0x71, 0x0,
+    0x30, 0x28, 0x25, 0x2, 0xc, 0x8, 0x5, 0x0,
+    0x19, 0x30, 0x44, 0x40, 0x40, 0xa0, 0x1c, 0x60,
+    0x11, 0x10, 0xc1, 0xc0, 0x3f, 0xf8, 0x66, 0xe,
+    0xa, 0xa, 0x1, 0xc6, 0x1, 0x9, 0x8, 0x88,
+    0xc, 0x60, 0x40, 0x28, 0x3, 0x0, 0x3e, 0x2,
+    0x50, 0x2, 0x87, 0xe1, 0xed, 0xd4, 0x66, 0xc1,
+    0x43, 0x8d, 0x1, 0x31, 0x5e, 0x3, 0x2d, 0x19,
+    0xf4, 0x0, 0x8d, 0x42, 0x7, 0x7f, 0xeb, 0x31,
+    0xbf, 0xc3, 0x0, 0xa4, 0xbd, 0x0, 0x3f, 0xf8,
+    0x78, 0xf7, 0x8e, 0xa8, 0xd5, 0xc0, 0x1f, 0xd3,
+    0x8b, 0x54, 0xbb, 0xd, 0x80, 0x70,
+
+    /* U+0041 "A" */
+    0x0, 0xf4, 0x7d, 0x80, 0x7f, 0xe6, 0x4, 0x20,
+    0xf, 0xf3, 0xc, 0x85, 0x80, 0x7f, 0xac, 0x99,
+    0x18, 0x3, 0xf9, 0xa, 0xc3, 0xc1, 0xc0, 0x3f,
+    0x78, 0xb0, 0x21, 0x50, 0x7, 0xc4, 0x8c, 0x1,
+    0x59, 0x28, 0x7, 0xac, 0x24, 0x2, 0x61, 0x90,
+    0xe, 0x16, 0xe, 0xff, 0xc2, 0x66, 0x0, 0xcc,
+    0xe, 0xff, 0x4, 0x80, 0x69, 0x28, 0x8f, 0x91,
+    0x44, 0x0, 0xa3, 0x60, 0x1f, 0x78, 0x48, 0x2,
+    0x41, 0xc0, 0x3e, 0x41, 0x60,
+
+    /* U+0042 "B" */
+    0x1f, 0xff, 0x75, 0xa0, 0x6, 0x27, 0x7c, 0x88,
+    0xb7, 0x0, 0x9a, 0x23, 0x56, 0x84, 0x0, 0x7f,
+    0x11, 0x80, 0x7f, 0x88, 0xcc, 0x1, 0x34, 0x46,
+    0xad, 0x1f, 0x0, 0x89, 0xdf, 0x28, 0x1b, 0x80,
+    0x49, 0xff, 0xba, 0xc2, 0xcc, 0x3, 0xe1, 0x49,
+    0xa, 0x0, 0xfe, 0x60, 0x20, 0xf, 0xea, 0x3,
+    0x0, 0x34, 0x46, 0x9c, 0x71, 0x90, 0x1, 0x3b,
+    0xe6, 0x16, 0xf1,
+
+    /* U+0043 "C" */
+    0x0, 0xc9, 0x5d, 0xfd, 0x6a, 0x1, 0x86, 0xec,
+    0xa4, 0xa4, 0x95, 0x60, 0x15, 0x22, 0x37, 0x2b,
+    0x39, 0x9c, 0x0, 0xc8, 0x8b, 0x20, 0x8, 0x67,
+    0x0, 0x16, 0x14, 0x1, 0xfe, 0x23, 0x10, 0xf,
+    0xe1, 0x6, 0x0, 0xff, 0x8, 0x30, 0x7, 0xfc,
+    0x46, 0x20, 0x1f, 0xeb, 0xa, 0x0, 0xff, 0x32,
+    0x22, 0xc8, 0x2, 0x1a, 0xc1, 0x0, 0x52, 0x23,
+    0x72, 0xf3, 0x95, 0xc4, 0x0, 0x37, 0x64, 0x24,
+    0x24, 0xab, 0x0,
+
+    /* U+0044 "D" */
+    0x1f, 0xff, 0x6d, 0x20, 0x7, 0xa, 0xae, 0x15,
+    0xba, 0x0, 0xcb, 0x55, 0xb3, 0x51, 0x68, 0x3,
+    0xf8, 0xac, 0xd5, 0x0, 0x3f, 0xde, 0x1e, 0x1,
+    0xfe, 0x31, 0x50, 0xf, 0xf8, 0xc4, 0x3, 0xfe,
+    0x31, 0x0, 0xff, 0x18, 0xa8, 0x7, 0xfb, 0xc3,
+    0xc0, 0x3f, 0x15, 0x9a, 0xa0, 0x1, 0x6a, 0xb6,
+    0x6a, 0x2d, 0x0, 0x42, 0xab, 0x85, 0x6e, 0x80,
+    0x0,
+
+    /* U+0045 "E" */
+    0x1f, 0xff, 0xd8, 0x1, 0xa, 0xaf, 0xac, 0x2,
+    0x5a, 0xaf, 0x38, 0x7, 0xff, 0x35, 0xa6, 0x7c,
+    0x1, 0x89, 0x9b, 0xc0, 0x19, 0x3f, 0xfc, 0x1,
+    0xff, 0xd9, 0x5a, 0xaf, 0x80, 0x21, 0x55, 0xf8,
+    0x0,
+
+    /* U+0046 "F" */
+    0x1f, 0xff, 0xd8, 0x0, 0x15, 0x5f, 0x58, 0x1,
+    0x6a, 0xbc, 0xe0, 0x1f, 0xfd, 0x44, 0xff, 0xf0,
+    0x4, 0x2c, 0xde, 0x0, 0x96, 0x67, 0xc0, 0x1f,
+    0xfd, 0xd0,
+
+    /* U+0047 "G" */
+    0x0, 0xc9, 0x5b, 0xfd, 0x6c, 0x1, 0x86, 0xec,
+    0xa2, 0x8a, 0x93, 0x82, 0x0, 0xa4, 0x46, 0xe5,
+    0xdb, 0xe0, 0x40, 0xc, 0x88, 0xb2, 0x0, 0xcf,
+    0xa2, 0x16, 0x14, 0x1, 0xfe, 0x23, 0x10, 0xf,
+    0xe1, 0x6, 0x0, 0xf8, 0xe4, 0xc4, 0x18, 0x3,
+    0xe5, 0x66, 0x1, 0x98, 0x40, 0x3f, 0xd4, 0x14,
+    0x1, 0xfe, 0x64, 0x45, 0x90, 0x6, 0xf0, 0xd,
+    0x6a, 0x9b, 0xab, 0xcf, 0x62, 0x70, 0xa, 0xad,
+    0x4d, 0x9, 0x27, 0x48,
+
+    /* U+0048 "H" */
+    0x1f, 0xb0, 0xf, 0xf, 0xd8, 0x7, 0xff, 0x99,
+    0x6a, 0xbd, 0x60, 0x18, 0x55, 0x7e, 0x0, 0xc9,
+    0xff, 0xee, 0x0, 0xff, 0xf9, 0x0,
+
+    /* U+0049 "I" */
+    0x1f, 0xb0, 0xf, 0xfe, 0xc0,
+
+    /* U+004A "J" */
+    0x0, 0x77, 0xff, 0x38, 0x1, 0x95, 0x64, 0x0,
+    0xd1, 0x55, 0x70, 0x7, 0xff, 0xc8, 0xc0, 0x42,
+    0x9c, 0x2, 0xa0, 0x50, 0x68, 0xda, 0xd3, 0x38,
+    0x31, 0xc1, 0x4d, 0xb0, 0x0,
+
+    /* U+004B "K" */
+    0x1f, 0xb0, 0xe, 0x1d, 0xe2, 0x0, 0xf8, 0x70,
+    0xb4, 0x80, 0x3e, 0xd2, 0xb3, 0x0, 0xfa, 0xce,
+    0x90, 0x3, 0xeb, 0x48, 0x50, 0xf, 0xa9, 0x1d,
+    0xc0, 0x1f, 0x4a, 0x81, 0x80, 0x7c, 0x8c, 0x89,
+    0x40, 0x7, 0xc9, 0x74, 0x4e, 0xa0, 0x1c, 0x56,
+    0x3, 0xe1, 0x44, 0x1, 0x98, 0x2, 0x2b, 0xf,
+    0x10, 0xf, 0xc9, 0x5, 0x40, 0x1f, 0xce, 0xc9,
+    0x0,
+
+    /* U+004C "L" */
+    0x1f, 0xb0, 0xf, 0xff, 0xf8, 0x7, 0xff, 0x59,
+    0x6a, 0xbc, 0xa0, 0x1, 0x55, 0xf6, 0x80,
+
+    /* U+004D "M" */
+    0x1f, 0xa0, 0xf, 0xe7, 0xf4, 0x0, 0x29, 0x80,
+    0x7c, 0x30, 0x1, 0xde, 0x1, 0xf4, 0x0, 0x78,
+    0xd4, 0x3, 0x89, 0x84, 0x3, 0x29, 0x58, 0x7,
+    0x48, 0xb0, 0x7, 0x48, 0xc0, 0x4, 0x88, 0x8f,
+    0x0, 0xe4, 0x57, 0x20, 0x4, 0x93, 0x0, 0x7d,
+    0x1, 0x0, 0xe5, 0x20, 0x1f, 0x89, 0xd5, 0x52,
+    0xa8, 0x1, 0xfd, 0x3, 0x43, 0x0, 0x1, 0x0,
+    0xfd, 0x60, 0xe4, 0x1, 0xff, 0x2c, 0xc0, 0x7,
+    0xff, 0x5, 0x80, 0x3e,
+
+    /* U+004E "N" */
+    0x1f, 0xb0, 0xf, 0xf, 0xd8, 0x1, 0x20, 0x3,
+    0xfe, 0x75, 0x0, 0xfe, 0x20, 0xa2, 0x0, 0xfc,
+    0xd2, 0x1e, 0x1, 0xfc, 0xcc, 0x2a, 0x0, 0xfe,
+    0x93, 0x56, 0x0, 0xfe, 0xd1, 0x93, 0x0, 0xfc,
+    0x34, 0x1a, 0x60, 0x1f, 0x92, 0x7, 0xc0, 0x3f,
+    0x9d, 0x8, 0x3, 0xfd, 0x44, 0x1, 0xfe, 0x1f,
+    0x0,
+
+    /* U+004F "O" */
+    0x0, 0xc9, 0x5b, 0xfd, 0x6a, 0x1, 0xf5, 0x5a,
+    0x8a, 0x12, 0x56, 0x8, 0x6, 0xb5, 0x4d, 0xcb,
+    0xce, 0x53, 0xc0, 0x9, 0x91, 0x16, 0x40, 0x10,
+    0xd3, 0x14, 0x0, 0x28, 0x28, 0x3, 0xe9, 0x6,
+    0x0, 0x19, 0x84, 0x3, 0xf2, 0x89, 0x8, 0x30,
+    0x7, 0xf1, 0x80, 0x88, 0x18, 0x3, 0xf8, 0xc0,
+    0x40, 0xcc, 0x20, 0x1f, 0x94, 0x48, 0x28, 0x28,
+    0x3, 0xe9, 0x6, 0x0, 0x32, 0x22, 0xc8, 0x2,
+    0x1a, 0x62, 0x80, 0xa, 0xd5, 0x37, 0x2f, 0x39,
+    0x4f, 0x0, 0x3a, 0xad, 0x49, 0x9, 0x2b, 0x4,
+    0x0,
+
+    /* U+0050 "P" */
+    0x1f, 0xff, 0x63, 0x80, 0x70, 0xaa, 0xc8, 0x51,
+    0xa2, 0x1, 0x2d, 0x55, 0x7c, 0xc5, 0x0, 0x1f,
+    0xd2, 0x2c, 0x1, 0xfe, 0x20, 0xf, 0xf8, 0x80,
+    0x3f, 0xd2, 0x2c, 0x1, 0x2d, 0x55, 0x7c, 0xc5,
+    0x0, 0x10, 0xaa, 0xc8, 0x51, 0xa2, 0x1, 0x27,
+    0xfe, 0xc7, 0x0, 0xff, 0xed, 0x80,
+
+    /* U+0051 "Q" */
+    0x0, 0xc9, 0x5b, 0xfd, 0x6a, 0x1, 0xf5, 0x5a,
+    0x8a, 0x12, 0x56, 0x8, 0x6, 0xb5, 0x4d, 0xcb,
+    0xce, 0x53, 0xc0, 0x9, 0x91, 0x16, 0x40, 0x10,
+    0xd3, 0x14, 0x0, 0x28, 0x28, 0x3, 0xe9, 0x6,
+    0x0, 0x19, 0x84, 0x3, 0xf2, 0x88, 0xc0, 0xc0,
+    0x1f, 0xc6, 0x4, 0x20, 0xc0, 0x1f, 0xc6, 0x2,
+    0x4, 0x62, 0x1, 0xf9, 0x44, 0x82, 0x82, 0xc0,
+    0x3e, 0x80, 0x60, 0x3, 0x9a, 0xd0, 0x80, 0x69,
+    0x72, 0x80, 0xb, 0x4d, 0x7a, 0xea, 0xfd, 0x8b,
+    0x0, 0x30, 0xe4, 0x9a, 0xa9, 0xa, 0x74, 0x40,
+    0x3c, 0xd9, 0xd4, 0x6, 0x6, 0x94, 0xe0, 0x1f,
+    0x2e, 0x14, 0xe5, 0xa1, 0x80, 0x7e, 0x3c, 0xdb,
+    0xce, 0x40,
+
+    /* U+0052 "R" */
+    0x1f, 0xff, 0x63, 0x80, 0x70, 0xaa, 0xc8, 0x51,
+    0xa2, 0x1, 0x2d, 0x55, 0x7c, 0xc5, 0x0, 0x1f,
+    0xd2, 0x2c, 0x1, 0xfe, 0x20, 0xf, 0xf8, 0x84,
+    0x3, 0xfa, 0x45, 0xc0, 0x26, 0x99, 0xab, 0x98,
+    0xa0, 0x2, 0x26, 0x69, 0x45, 0x74, 0x40, 0x24,
+    0xff, 0xb8, 0x1c, 0x3, 0xf8, 0x64, 0xa4, 0x3,
+    0xf9, 0x91, 0x90, 0x3, 0xfa, 0x86, 0x80,
+
+    /* U+0053 "S" */
+    0x0, 0x14, 0xef, 0xfb, 0x60, 0x40, 0x7, 0xac,
+    0x2c, 0xa0, 0xfa, 0x0, 0x80, 0xbc, 0x9a, 0xdd,
+    0x78, 0x1, 0x49, 0x0, 0x31, 0x18, 0x0, 0x88,
+    0x60, 0x1f, 0xa4, 0x32, 0x98, 0x40, 0x39, 0x71,
+    0x16, 0x7b, 0x5c, 0x3, 0x1d, 0xfd, 0xb9, 0xc5,
+    0x80, 0x79, 0x23, 0x91, 0x20, 0xf, 0xda, 0x4,
+    0x16, 0xa0, 0x1d, 0x40, 0xa2, 0xd5, 0xd7, 0x35,
+    0xc6, 0xc6, 0x3b, 0x2a, 0xa6, 0x45, 0xa9, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xe8, 0x75, 0x58, 0x81, 0x15, 0x6d,
+    0x9a, 0xa9, 0x2, 0x6a, 0xa5, 0x0, 0xff, 0xff,
+    0x80, 0x7f, 0xf5, 0xc0,
+
+    /* U+0055 "U" */
+    0x3f, 0x90, 0xf, 0x2f, 0xb8, 0x7, 0xff, 0xfc,
+    0x3, 0xf0, 0x88, 0x8, 0x3, 0xc4, 0x6, 0x42,
+    0x80, 0x1e, 0xc0, 0x70, 0x60, 0xa0, 0xc, 0xe8,
+    0x82, 0x8, 0x35, 0xfb, 0xb7, 0x40, 0xc8, 0x5,
+    0x90, 0x68, 0x83, 0x7f, 0x20,
+
+    /* U+0056 "V" */
+    0xc, 0xf2, 0x0, 0xf8, 0xbe, 0x42, 0x82, 0x80,
+    0x3e, 0xb0, 0xa0, 0x61, 0x70, 0xf, 0xb, 0x19,
+    0x80, 0xc, 0xc, 0x1, 0xcc, 0x12, 0x1, 0x48,
+    0x58, 0x7, 0x48, 0xa8, 0x4, 0x2a, 0x48, 0x1,
+    0x28, 0xc8, 0x7, 0x48, 0x78, 0x5, 0x20, 0xc0,
+    0x1c, 0x64, 0x84, 0x4, 0x6a, 0x20, 0x1e, 0xb0,
+    0xa0, 0xb0, 0x90, 0xf, 0x98, 0x58, 0x58, 0xcc,
+    0x1, 0xf9, 0x87, 0x42, 0x40, 0x3f, 0xa4, 0xc,
+    0x54, 0x3, 0xf8, 0x54, 0x18, 0x3, 0x80,
+
+    /* U+0057 "W" */
+    0x4f, 0x90, 0xf, 0x67, 0x98, 0x7, 0x17, 0xc2,
+    0xb, 0x80, 0x71, 0x18, 0x58, 0x7, 0x50, 0x58,
+    0x38, 0x98, 0x6, 0x50, 0x2, 0x80, 0x72, 0x91,
+    0x86, 0x85, 0x80, 0x6b, 0x27, 0x22, 0x0, 0x44,
+    0x45, 0x0, 0x20, 0x30, 0x4, 0x46, 0xb6, 0x14,
+    0x1, 0x28, 0x58, 0x4, 0xa2, 0x60, 0x5, 0xb,
+    0x31, 0x50, 0xa, 0x84, 0xc0, 0x2f, 0xb, 0x0,
+    0x59, 0x18, 0x31, 0x10, 0x8, 0x8e, 0x1, 0x94,
+    0x14, 0x8, 0xd4, 0x1, 0x60, 0xa0, 0xa1, 0xa0,
+    0x1c, 0xa4, 0x45, 0xb, 0x0, 0x18, 0xd0, 0x58,
+    0xa0, 0x7, 0x78, 0x2d, 0x11, 0x80, 0x4e, 0x48,
+    0x6e, 0x1, 0xe5, 0x9, 0x25, 0x0, 0xd4, 0x12,
+    0x1a, 0x1, 0xf2, 0x8, 0x58, 0x6, 0x31, 0x20,
+    0x40, 0xf, 0xb4, 0x4, 0xc0, 0x39, 0xc1, 0x40,
+    0x30,
+
+    /* U+0058 "X" */
+    0x2f, 0xd0, 0xf, 0x5f, 0x99, 0x49, 0x50, 0x6,
+    0x74, 0x83, 0x6, 0x45, 0x50, 0x0, 0xa0, 0xdc,
+    0x2, 0xa1, 0xb1, 0xf, 0xe, 0x0, 0xc3, 0x63,
+    0x50, 0x54, 0x40, 0x1c, 0xac, 0x8e, 0xaa, 0x0,
+    0xfa, 0x80, 0x1e, 0x1, 0xfb, 0x80, 0x16, 0x20,
+    0x1e, 0x92, 0x9a, 0x1b, 0x0, 0xe4, 0x64, 0x65,
+    0x59, 0x80, 0x21, 0xa1, 0xa0, 0x5, 0x8c, 0x90,
+    0x2, 0x86, 0xc4, 0x0, 0x34, 0x1c, 0xc, 0x8a,
+    0xa0, 0xc, 0x8e, 0x70,
+
+    /* U+0059 "Y" */
+    0xc, 0xf2, 0x0, 0xf2, 0xfb, 0x7, 0x84, 0x80,
+    0x7a, 0xc9, 0x80, 0xd9, 0x14, 0x3, 0x40, 0xf0,
+    0x5, 0x3, 0x60, 0x11, 0x3a, 0x98, 0x4, 0x30,
+    0x30, 0x0, 0x90, 0xb0, 0xe, 0x63, 0x71, 0x44,
+    0x40, 0x80, 0x7b, 0xc2, 0xa4, 0x9c, 0x3, 0xe3,
+    0x54, 0x29, 0x0, 0xfe, 0x80, 0x34, 0x0, 0xfe,
+    0x30, 0x70, 0xf, 0xff, 0x0,
+
+    /* U+005A "Z" */
+    0x1f, 0xff, 0xf0, 0x89, 0x57, 0xe3, 0x2, 0x10,
+    0xaa, 0xf5, 0x90, 0x78, 0x7, 0xed, 0x1a, 0x20,
+    0xf, 0xa4, 0xdd, 0x40, 0x3e, 0x56, 0x48, 0x0,
+    0xf8, 0xa8, 0x68, 0x3, 0xf7, 0x86, 0x88, 0x7,
+    0xd4, 0x52, 0x60, 0x1f, 0x3a, 0xa9, 0x80, 0x3e,
+    0x48, 0x2a, 0x0, 0xf8, 0x68, 0x1a, 0xab, 0xe2,
+    0x20, 0x82, 0x2a, 0xfc, 0xc0,
+
+    /* U+005B "[" */
+    0x1f, 0xfa, 0x80, 0x7, 0x1c, 0x0, 0x67, 0x40,
+    0xf, 0xff, 0xbb, 0x3a, 0x0, 0xe, 0x38,
+
+    /* U+005C "\\" */
+    0x47, 0x0, 0xf0, 0xc1, 0x80, 0x72, 0x85, 0x80,
+    0x79, 0x58, 0x3, 0xde, 0x26, 0x1, 0xca, 0x14,
+    0x1, 0xe5, 0x70, 0xf, 0x78, 0xa0, 0x7, 0x28,
+    0x68, 0x7, 0x95, 0xc0, 0x3d, 0xc2, 0x80, 0x1c,
+    0x83, 0xa0, 0x1e, 0x77, 0x0, 0x7b, 0x45, 0x0,
+    0x39, 0x7, 0x80, 0x3c, 0xea, 0x1, 0xed, 0x5,
+    0x0, 0xe4, 0x1f,
+
+    /* U+005D "]" */
+    0xaf, 0xf8, 0x7a, 0xc, 0x0, 0x8e, 0xc0, 0x1f,
+    0xff, 0x74, 0x76, 0x0, 0x74, 0x18, 0x0,
+
+    /* U+005E "^" */
+    0x0, 0xab, 0xc8, 0x3, 0x85, 0x46, 0xc0, 0x39,
+    0x8a, 0xdc, 0x3, 0xaa, 0x8a, 0x2a, 0x1, 0x21,
+    0x30, 0x34, 0x80, 0x5c, 0x82, 0x14, 0x64, 0x2,
+    0xbc, 0x0, 0x32, 0xa0, 0x61, 0x50, 0xa, 0xd8,
+    0x0,
+
+    /* U+005F "_" */
+    0xff, 0xfe, 0xdd, 0xfe,
+
+    /* U+0060 "`" */
+    0x48, 0x40, 0x2, 0x15, 0xa0, 0x2, 0xa2, 0xd0,
+
+    /* U+0061 "a" */
+    0x1, 0x7c, 0xff, 0x6b, 0x0, 0x51, 0x0, 0x66,
+    0x1c, 0xc0, 0x2, 0x33, 0x13, 0x2e, 0x27, 0x0,
+    0x9, 0x80, 0x64, 0x2, 0x1, 0x9e, 0xff, 0x98,
+    0x4, 0x2d, 0x99, 0x79, 0x85, 0x0, 0x95, 0x21,
+    0xc, 0xc4, 0x1, 0xfc, 0xc0, 0x13, 0x24, 0xa3,
+    0x68, 0x80, 0x52, 0xe9, 0x70, 0xb0, 0x0,
+
+    /* U+0062 "b" */
+    0x5f, 0x50, 0xf, 0xff, 0x3, 0x6f, 0xf5, 0x10,
+    0x6, 0x89, 0x16, 0x55, 0x69, 0x80, 0x45, 0x59,
+    0x37, 0x60, 0xd0, 0x9, 0x54, 0x1, 0x23, 0x8a,
+    0x0, 0x30, 0x3, 0xb0, 0xc, 0x3, 0xff, 0x83,
+    0x80, 0x1d, 0x80, 0x60, 0x5, 0x50, 0x4, 0x8e,
+    0x28, 0x0, 0x3a, 0xc9, 0xbb, 0x6, 0x80, 0x51,
+    0x22, 0xca, 0xad, 0x30,
+
+    /* U+0063 "c" */
+    0x0, 0x9f, 0x7f, 0xac, 0xc0, 0x2c, 0x80, 0x64,
+    0x46, 0x20, 0x49, 0xc6, 0xcd, 0x69, 0xb8, 0x31,
+    0x38, 0x4, 0x58, 0x66, 0x5, 0x0, 0xff, 0xe2,
+    0x98, 0x20, 0x7, 0xe6, 0x37, 0x0, 0x8b, 0xc,
+    0x24, 0xe3, 0x66, 0xb4, 0xc0, 0x2c, 0x80, 0x64,
+    0x46, 0x18,
+
+    /* U+0064 "d" */
+    0x0, 0xfc, 0x3f, 0x40, 0x1f, 0xfd, 0x88, 0xdf,
+    0xe8, 0x30, 0x8, 0x75, 0xc1, 0x95, 0xfc, 0x2,
+    0xb2, 0x7d, 0x9b, 0xd3, 0x0, 0x94, 0xa0, 0x2,
+    0x28, 0x0, 0x18, 0x28, 0x7, 0x20, 0x7, 0xff,
+    0x4, 0xc1, 0x0, 0x39, 0xc0, 0x25, 0x36, 0x0,
+    0x86, 0xc0, 0x2b, 0x29, 0xb7, 0x9f, 0x30, 0x8,
+    0x75, 0xda, 0x1d, 0xd8, 0x0,
+
+    /* U+0065 "e" */
+    0x0, 0xa3, 0x7f, 0xa4, 0x40, 0x21, 0xd7, 0x67,
+    0x46, 0xf2, 0x0, 0x59, 0x65, 0xc5, 0x60, 0xc8,
+    0x1, 0x54, 0x60, 0x11, 0xb2, 0x9, 0x82, 0xff,
+    0xf3, 0x1, 0x0, 0x17, 0x33, 0xe3, 0x30, 0x39,
+    0x9f, 0xc0, 0x6, 0x29, 0x0, 0xd2, 0x20, 0x9,
+    0x26, 0xda, 0xa7, 0x33, 0x80, 0x5b, 0x0, 0xaa,
+    0x2a, 0x60,
+
+    /* U+0066 "f" */
+    0x0, 0xd, 0x77, 0x24, 0x1, 0x6a, 0xec, 0x20,
+    0x5, 0x49, 0x88, 0x0, 0x81, 0x0, 0x57, 0xc0,
+    0xdf, 0xe5, 0xe7, 0x3, 0x88, 0x3a, 0xc8, 0x33,
+    0xb8, 0x80, 0x3f, 0xfc, 0xa0,
+
+    /* U+0067 "g" */
+    0x0, 0xa3, 0x7f, 0xa4, 0x7b, 0x0, 0x75, 0xc1,
+    0x95, 0xbc, 0x2, 0xb2, 0x7d, 0x9b, 0xe3, 0x10,
+    0x2, 0x94, 0x0, 0x43, 0x20, 0x3, 0x4, 0x0,
+    0xe4, 0x0, 0xc2, 0x1, 0xf8, 0xc1, 0x40, 0x39,
+    0x0, 0x25, 0x28, 0x0, 0x86, 0x40, 0x2b, 0x27,
+    0xd9, 0xae, 0x0, 0xc3, 0xae, 0xc, 0x8d, 0x80,
+    0xe0, 0x14, 0x6f, 0xf4, 0x98, 0x10, 0x13, 0x80,
+    0x74, 0x86, 0x82, 0xc7, 0xdc, 0xd7, 0x22, 0xa0,
+    0x3d, 0xaa, 0x99, 0x4a, 0x68, 0x0,
+
+    /* U+0068 "h" */
+    0x5f, 0x50, 0xf, 0xfe, 0xe3, 0x6f, 0xf5, 0x8,
+    0x5, 0x72, 0x2a, 0x6b, 0x80, 0x10, 0xde, 0x56,
+    0xa9, 0x30, 0x1, 0x90, 0x2, 0x80, 0xf0, 0x7,
+    0x80, 0x62, 0x3, 0x0, 0x18, 0x7, 0x84, 0x3,
+    0xff, 0xb8,
+
+    /* U+0069 "i" */
+    0x6f, 0x6f, 0xf, 0x9b, 0x90, 0x40, 0x5f, 0x50,
+    0xf, 0xfe, 0x78,
+
+    /* U+006A "j" */
+    0x0, 0x93, 0xdc, 0x2, 0x30, 0xd0, 0x9, 0xee,
+    0x80, 0x32, 0x0, 0x64, 0xf7, 0x0, 0xff, 0xf9,
+    0x90, 0x12, 0x5c, 0xc8, 0x50, 0x55, 0x8f, 0x44,
+
+    /* U+006B "k" */
+    0x5f, 0x50, 0xf, 0xff, 0x18, 0xef, 0x98, 0x7,
+    0x8b, 0xb, 0xc, 0x3, 0x8b, 0xa, 0xcc, 0x3,
+    0x8b, 0x6, 0xd0, 0x3, 0xb3, 0x2, 0x24, 0x0,
+    0xf3, 0xa, 0x8d, 0x0, 0x78, 0x72, 0x8d, 0x58,
+    0x3, 0xa0, 0xc3, 0x46, 0x4c, 0x3, 0x18, 0x0,
+    0x68, 0x38, 0x3, 0xf2, 0x41, 0x50, 0x0,
+
+    /* U+006C "l" */
+    0x5f, 0x50, 0xf, 0xfe, 0xd8,
+
+    /* U+006D "m" */
+    0x5f, 0x58, 0xdf, 0xe8, 0x0, 0x46, 0xff, 0x40,
+    0x6, 0xb7, 0x73, 0x1b, 0xde, 0xbb, 0x98, 0xde,
+    0xc0, 0x21, 0xda, 0x9d, 0x24, 0x2c, 0xa9, 0xd3,
+    0x43, 0x0, 0x31, 0x0, 0x54, 0xa, 0x60, 0x15,
+    0x2, 0x80, 0x3c, 0x3, 0x10, 0x68, 0x6, 0x20,
+    0x10, 0x1, 0x80, 0x78, 0x40, 0x3f, 0xff, 0xe0,
+
+    /* U+006E "n" */
+    0x5f, 0x57, 0xdf, 0xea, 0x10, 0xa, 0xe1, 0xdc,
+    0x4b, 0x80, 0x10, 0xe5, 0x46, 0x31, 0x30, 0x1,
+    0x8c, 0x2, 0xb0, 0xf0, 0x7, 0x80, 0x62, 0x3,
+    0x0, 0x18, 0x7, 0x84, 0x3, 0xff, 0xb8,
+
+    /* U+006F "o" */
+    0x0, 0x9f, 0x7f, 0xa8, 0xc0, 0x36, 0xc0, 0x32,
+    0x2e, 0x28, 0x2, 0x4a, 0x36, 0x6b, 0x46, 0x84,
+    0x18, 0x9c, 0x2, 0x28, 0x6, 0x30, 0x50, 0xe,
+    0x40, 0xe0, 0xf, 0xf8, 0xc1, 0x40, 0x39, 0x3,
+    0xc1, 0x8a, 0x0, 0x22, 0x80, 0x70, 0x93, 0x7d,
+    0x9a, 0xd1, 0xb1, 0x0, 0x64, 0x3, 0x22, 0xe2,
+    0x0,
+
+    /* U+0070 "p" */
+    0x5f, 0x46, 0xdf, 0xea, 0x20, 0xd, 0x32, 0x77,
+    0x22, 0xe9, 0x80, 0x45, 0x75, 0x15, 0x81, 0xa0,
+    0x12, 0xa0, 0x4, 0x6e, 0x28, 0x0, 0xc0, 0xe,
+    0xc0, 0x30, 0xf, 0xfe, 0xe, 0x0, 0x76, 0x81,
+    0x80, 0x15, 0x40, 0x12, 0x30, 0xa0, 0x0, 0xab,
+    0x26, 0xec, 0x1a, 0x1, 0x44, 0x8b, 0x2a, 0xb4,
+    0xc0, 0x33, 0x6f, 0xf5, 0x10, 0x7, 0xff, 0x5c,
+
+    /* U+0071 "q" */
+    0x0, 0xa3, 0x7f, 0xa0, 0x7e, 0x80, 0x75, 0xc1,
+    0x95, 0xf4, 0x2, 0xb2, 0x8d, 0x9b, 0xd2, 0x0,
+    0x94, 0x9c, 0x2, 0x28, 0x0, 0x18, 0x28, 0x7,
+    0x20, 0x7, 0xff, 0x4, 0xc1, 0x40, 0x39, 0x0,
+    0x25, 0x28, 0x0, 0x8a, 0x0, 0x2b, 0x27, 0xd9,
+    0xad, 0x30, 0x8, 0x75, 0xc1, 0x91, 0xfc, 0x3,
+    0xa3, 0x7f, 0xa0, 0xc0, 0x3f, 0xfa, 0xe0,
+
+    /* U+0072 "r" */
+    0x5f, 0x46, 0xdb, 0x0, 0x44, 0x81, 0x0, 0xe,
+    0xb6, 0x40, 0xa, 0xa0, 0xd, 0xa0, 0x1c, 0x40,
+    0x1f, 0xfc, 0xf0,
+
+    /* U+0073 "s" */
+    0x1, 0x8d, 0xfe, 0xc7, 0x0, 0x6b, 0xb3, 0xa0,
+    0xd0, 0x19, 0x9a, 0xe2, 0xb7, 0x0, 0x40, 0x80,
+    0x30, 0x81, 0x22, 0x3e, 0xe1, 0x0, 0x2b, 0xa6,
+    0x77, 0x5e, 0x0, 0x4b, 0x39, 0xec, 0x6c, 0xa,
+    0x1, 0xb0, 0x5, 0x6b, 0xaa, 0x6a, 0x82, 0xcb,
+    0x24, 0x8c, 0xed, 0x82,
+
+    /* U+0074 "t" */
+    0x1, 0xfa, 0x0, 0xff, 0x5f, 0x2, 0xff, 0x97,
+    0x9c, 0xe, 0x20, 0xeb, 0x20, 0xce, 0xe2, 0x0,
+    0xff, 0xe8, 0x88, 0x30, 0x7, 0x21, 0xd4, 0xc8,
+    0x1, 0x48, 0x87, 0x0,
+
+    /* U+0075 "u" */
+    0x7f, 0x40, 0xc, 0x7f, 0x0, 0x1f, 0xfe, 0x37,
+    0x0, 0x8, 0x10, 0x6, 0x20, 0x2, 0x5, 0x0,
+    0x43, 0x0, 0x2, 0x53, 0xd8, 0x9f, 0x0, 0xd4,
+    0xe0, 0xef, 0x60, 0x0,
+
+    /* U+0076 "v" */
+    0xd, 0xe0, 0xf, 0x6e, 0x80, 0x16, 0x2c, 0x1,
+    0x8c, 0xa8, 0x0, 0xc1, 0x40, 0x1a, 0x41, 0x80,
+    0x26, 0x33, 0x0, 0x5, 0x58, 0x40, 0x2b, 0xa,
+    0x0, 0x30, 0x50, 0x6, 0x24, 0x60, 0x4, 0x99,
+    0x80, 0x3b, 0x81, 0x94, 0x64, 0x3, 0xca, 0x37,
+    0xc2, 0xa0, 0x1f, 0x49, 0x23, 0x0, 0x7e, 0x60,
+    0x4, 0x80, 0x60,
+
+    /* U+0077 "w" */
+    0xbe, 0x0, 0xec, 0xf1, 0x0, 0xd5, 0xc1, 0xc2,
+    0x80, 0x11, 0x18, 0x38, 0x6, 0x56, 0x5, 0xd,
+    0x0, 0xa8, 0x7, 0x40, 0x25, 0xa, 0x0, 0x2b,
+    0x80, 0x4a, 0x8c, 0x82, 0x0, 0xe2, 0x20, 0x3,
+    0x85, 0x0, 0xcb, 0xa8, 0x18, 0x5, 0x28, 0x2,
+    0x41, 0xe0, 0xa1, 0x52, 0x3b, 0x7, 0x6, 0x0,
+    0xce, 0xa2, 0xee, 0x0, 0x51, 0x95, 0x18, 0x80,
+    0x6a, 0xb, 0x1a, 0x0, 0x38, 0x41, 0xd0, 0x7,
+    0x19, 0x29, 0x18, 0x0, 0x51, 0x41, 0xc0, 0x3c,
+    0xa1, 0x40, 0x1b, 0x81, 0x4, 0x2,
+
+    /* U+0078 "x" */
+    0x3f, 0xb0, 0xd, 0x9e, 0x47, 0x8, 0xe0, 0x7,
+    0x39, 0x20, 0x74, 0x83, 0x34, 0x2b, 0x0, 0x54,
+    0x3d, 0xa5, 0x40, 0x18, 0x68, 0x87, 0x80, 0x3c,
+    0x40, 0x6, 0x0, 0xe3, 0x94, 0x3a, 0x20, 0xd,
+    0xc3, 0x5c, 0x1c, 0x1, 0x51, 0x50, 0x95, 0x1c,
+    0x83, 0x2b, 0xa0, 0x1, 0x54, 0xca,
+
+    /* U+0079 "y" */
+    0xd, 0xe0, 0xf, 0x66, 0x80, 0x2c, 0x58, 0x3,
+    0x19, 0xa8, 0x0, 0xc1, 0x40, 0x1a, 0x81, 0x80,
+    0x26, 0x33, 0x0, 0x5, 0x94, 0x40, 0x2b, 0xa,
+    0x0, 0x38, 0x48, 0x6, 0x23, 0x60, 0x5, 0x99,
+    0x80, 0x3a, 0x41, 0x8c, 0xa8, 0x3, 0xca, 0x37,
+    0x22, 0xc0, 0x1f, 0x31, 0x2b, 0x0, 0x7e, 0x90,
+    0x5, 0x0, 0x7e, 0x10, 0x42, 0x0, 0xe1, 0x0,
+    0x38, 0x78, 0x7, 0xf, 0x55, 0x21, 0x10, 0x1,
+    0xe6, 0x44, 0x2d, 0x0, 0x78,
+
+    /* U+007A "z" */
+    0x2f, 0xff, 0xa4, 0xe2, 0x38, 0x43, 0x45, 0xdf,
+    0x8, 0x9d, 0x0, 0x31, 0xc9, 0xc0, 0x6, 0x1d,
+    0x1d, 0x0, 0xea, 0x1a, 0x10, 0xd, 0x9, 0x8,
+    0x1, 0x91, 0xd1, 0xc0, 0x30, 0xd0, 0x1b, 0xbe,
+    0x55, 0x8, 0x3c, 0x46, 0xe0,
+
+    /* U+007B "{" */
+    0x0, 0x3f, 0x78, 0x1c, 0x1c, 0x2, 0x4, 0xb8,
+    0x78, 0x38, 0x7, 0xff, 0x14, 0x40, 0x42, 0x1c,
+    0x48, 0x1c, 0x50, 0x1, 0xe8, 0xa4, 0x0, 0x30,
+    0x10, 0xf, 0xfe, 0x2f, 0x83, 0x80, 0xc, 0x25,
+    0xc1, 0x1c, 0xe0,
+
+    /* U+007C "|" */
+    0x1f, 0x70, 0xf, 0xff, 0x38,
+
+    /* U+007D "}" */
+    0xaf, 0xa1, 0x0, 0x72, 0x2c, 0x0, 0x12, 0xc5,
+    0x0, 0x31, 0x98, 0x3, 0xff, 0xa0, 0xe3, 0x24,
+    0x0, 0xf0, 0x66, 0x0, 0x24, 0x39, 0x0, 0x2,
+    0x30, 0x7, 0xff, 0x24, 0xcc, 0x0, 0x4a, 0x14,
+    0x0, 0x72, 0xa4, 0x0, 0x0,
+
+    /* U+007E "~" */
+    0x0, 0xf8, 0x40, 0x77, 0xf0, 0x40, 0x1a, 0xb6,
+    0x34, 0x1e, 0x68, 0x6e, 0xe8, 0x5c, 0x7c, 0xb6,
+    0x2e, 0x40, 0x4, 0xef, 0x48, 0x0,
+
+    /* U+00B0 "°" */
+    0x1, 0xaf, 0xd5, 0x0, 0x51, 0x7f, 0x5a, 0xa,
+    0xc0, 0x1c, 0x71, 0x80, 0x78, 0x88, 0xe0, 0x37,
+    0xe1, 0xd7, 0xfd, 0x4a, 0x5, 0x9f, 0xe7, 0x0,
+
+    /* Padding */
+    0x0
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 77, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 0, .adv_w = 77, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 18, .adv_w = 113, .box_w = 5, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 32, .adv_w = 202, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 110, .adv_w = 179, .box_w = 11, .box_h = 18, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 189, .adv_w = 243, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 280, .adv_w = 198, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = -1},
+    {.bitmap_index = 361, .adv_w = 60, .box_w = 2, .box_h = 6, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 368, .adv_w = 97, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 412, .adv_w = 97, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 457, .adv_w = 115, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 7},
+    {.bitmap_index = 482, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 511, .adv_w = 65, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 524, .adv_w = 110, .box_w = 5, .box_h = 2, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 528, .adv_w = 65, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 534, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 587, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 659, .adv_w = 107, .box_w = 5, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 669, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 725, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 778, .adv_w = 193, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 831, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 884, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 949, .adv_w = 172, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 999, .adv_w = 185, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1070, .adv_w = 178, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1137, .adv_w = 65, .box_w = 4, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1154, .adv_w = 65, .box_w = 4, .box_h = 13, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 1177, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1214, .adv_w = 168, .box_w = 9, .box_h = 7, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 1233, .adv_w = 168, .box_w = 9, .box_h = 9, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 1269, .adv_w = 165, .box_w = 10, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1320, .adv_w = 298, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 1454, .adv_w = 211, .box_w = 15, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1523, .adv_w = 218, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1582, .adv_w = 208, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1649, .adv_w = 238, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1706, .adv_w = 193, .box_w = 11, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1739, .adv_w = 183, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1765, .adv_w = 222, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1833, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1855, .adv_w = 89, .box_w = 3, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1860, .adv_w = 148, .box_w = 9, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1889, .adv_w = 207, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1946, .adv_w = 171, .box_w = 10, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1961, .adv_w = 275, .box_w = 15, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2029, .adv_w = 234, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2078, .adv_w = 242, .box_w = 15, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2159, .adv_w = 208, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2205, .adv_w = 242, .box_w = 15, .box_h = 16, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 2303, .adv_w = 209, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2358, .adv_w = 179, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2422, .adv_w = 169, .box_w = 11, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2442, .adv_w = 228, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2479, .adv_w = 205, .box_w = 14, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2550, .adv_w = 324, .box_w = 20, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2663, .adv_w = 194, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2731, .adv_w = 186, .box_w = 13, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2784, .adv_w = 189, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2837, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2852, .adv_w = 101, .box_w = 8, .box_h = 18, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 2903, .adv_w = 96, .box_w = 5, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 2918, .adv_w = 168, .box_w = 9, .box_h = 8, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 2951, .adv_w = 144, .box_w = 9, .box_h = 2, .ofs_x = 0, .ofs_y = -2},
+    {.bitmap_index = 2955, .adv_w = 173, .box_w = 5, .box_h = 3, .ofs_x = 2, .ofs_y = 11},
+    {.bitmap_index = 2963, .adv_w = 172, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3010, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3062, .adv_w = 164, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3104, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3157, .adv_w = 176, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3207, .adv_w = 102, .box_w = 7, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3236, .adv_w = 199, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3306, .adv_w = 196, .box_w = 10, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3340, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3351, .adv_w = 82, .box_w = 6, .box_h = 18, .ofs_x = -2, .ofs_y = -4},
+    {.bitmap_index = 3375, .adv_w = 177, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3422, .adv_w = 80, .box_w = 3, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3427, .adv_w = 304, .box_w = 17, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3475, .adv_w = 196, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3506, .adv_w = 183, .box_w = 11, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3555, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 3611, .adv_w = 196, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 3666, .adv_w = 118, .box_w = 6, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3685, .adv_w = 144, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3729, .adv_w = 119, .box_w = 7, .box_h = 12, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3757, .adv_w = 195, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3785, .adv_w = 161, .box_w = 12, .box_h = 10, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3836, .adv_w = 259, .box_w = 17, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3914, .adv_w = 159, .box_w = 10, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3960, .adv_w = 161, .box_w = 12, .box_h = 14, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 4029, .adv_w = 150, .box_w = 9, .box_h = 10, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4066, .adv_w = 101, .box_w = 5, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4101, .adv_w = 86, .box_w = 3, .box_h = 18, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 4106, .adv_w = 101, .box_w = 6, .box_h = 18, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 4143, .adv_w = 168, .box_w = 9, .box_h = 5, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 4165, .adv_w = 121, .box_w = 7, .box_h = 7, .ofs_x = 0, .ofs_y = 6}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_1[] = {
+    0x0
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 32, .range_length = 95, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 176, .range_length = 1, .glyph_id_start = 96,
+        .unicode_list = unicode_list_1, .glyph_id_ofs_list = NULL, .list_length = 1, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 0, 13, 14, 15, 16, 17,
+    18, 19, 12, 20, 20, 0, 0, 0,
+    21, 22, 23, 24, 25, 22, 26, 27,
+    28, 29, 29, 30, 31, 32, 29, 29,
+    22, 33, 34, 35, 3, 36, 30, 37,
+    37, 38, 39, 40, 41, 42, 43, 0,
+    44, 0, 45, 46, 47, 48, 49, 50,
+    51, 45, 52, 52, 53, 48, 45, 45,
+    46, 46, 54, 55, 56, 57, 51, 58,
+    58, 59, 58, 60, 41, 0, 0, 9,
+    61
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 0, 1, 2, 0, 3, 4, 5,
+    2, 6, 7, 8, 9, 10, 9, 10,
+    11, 12, 13, 14, 15, 16, 17, 12,
+    18, 19, 20, 21, 21, 0, 0, 0,
+    22, 23, 24, 25, 23, 25, 25, 25,
+    23, 25, 25, 26, 25, 25, 25, 25,
+    23, 25, 23, 25, 3, 27, 28, 29,
+    29, 30, 31, 32, 33, 34, 35, 0,
+    36, 0, 37, 38, 39, 39, 39, 0,
+    39, 38, 40, 41, 38, 38, 42, 42,
+    39, 42, 39, 42, 43, 44, 45, 46,
+    46, 47, 46, 48, 0, 0, 35, 9,
+    49
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 3, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 13, 0, 8, -6, 0, 0,
+    0, 0, -16, -17, 2, 14, 6, 5,
+    -12, 2, 14, 1, 12, 3, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 17, 2, -2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 6, 0, -9, 0, 0, 0, 0,
+    0, -6, 5, 6, 0, 0, -3, 0,
+    -2, 3, 0, -3, 0, -3, -1, -6,
+    0, 0, 0, 0, -3, 0, 0, -4,
+    -4, 0, 0, -3, 0, -6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    -3, 0, -4, 0, -8, 0, -35, 0,
+    0, -6, 0, 6, 9, 0, 0, -6,
+    3, 3, 10, 6, -5, 6, 0, 0,
+    -16, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -11, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -8, -3, -14, 0, -12,
+    -2, 0, 0, 0, 0, 1, 11, 0,
+    -9, -2, -1, 1, 0, -5, 0, 0,
+    -2, -21, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -23, -2, 11,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -12, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10,
+    0, 3, 0, 0, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 11, 2,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -11, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2,
+    6, 3, 9, -3, 0, 0, 6, -3,
+    -10, -39, 2, 8, 6, 1, -4, 0,
+    10, 0, 9, 0, 9, 0, -27, 0,
+    -3, 9, 0, 10, -3, 6, 3, 0,
+    0, 1, -3, 0, 0, -5, 23, 0,
+    23, 0, 9, 0, 12, 4, 5, 9,
+    0, 0, 0, -11, 0, 0, 0, 0,
+    1, -2, 0, 2, -5, -4, -6, 2,
+    0, -3, 0, 0, 0, -12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -19, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, -16, 0, -18, 0, 0, 0,
+    0, -2, 0, 29, -3, -4, 3, 3,
+    -3, 0, -4, 3, 0, 0, -15, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -28, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -18, 0, 17, 0, 0, -11, 0,
+    10, 0, -20, -28, -20, -6, 9, 0,
+    0, -19, 0, 3, -7, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 9, -35, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 2, 0, 0, 0,
+    0, 0, 2, 2, -3, -6, 0, -1,
+    -1, -3, 0, 0, -2, 0, 0, 0,
+    -6, 0, -2, 0, -7, -6, 0, -7,
+    -10, -10, -5, 0, -6, 0, -6, 0,
+    0, 0, 0, -2, 0, 0, 3, 0,
+    2, -3, 0, 1, 0, 0, 0, 3,
+    -2, 0, 0, 0, -2, 3, 3, -1,
+    0, 0, 0, -5, 0, -1, 0, 0,
+    0, 0, 0, 1, 0, 4, -2, 0,
+    -3, 0, -5, 0, 0, -2, 0, 9,
+    0, 0, -3, 0, 0, 0, 0, 0,
+    -1, 1, -2, -2, 0, 0, -3, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, -1, 0, -3, -3, 0,
+    0, 0, 0, 0, 1, 0, 0, -2,
+    0, -3, -3, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -2, 0, 0,
+    0, 0, -2, -4, 0, -4, 0, -9,
+    -2, -9, 6, 0, 0, -6, 3, 6,
+    8, 0, -7, -1, -3, 0, -1, -14,
+    3, -2, 2, -15, 3, 0, 0, 1,
+    -15, 0, -15, -2, -25, -2, 0, -14,
+    0, 6, 8, 0, 4, 0, 0, 0,
+    0, 1, 0, -5, -4, 0, -9, 0,
+    0, 0, -3, 0, 0, 0, -3, 0,
+    0, 0, 0, 0, -1, -1, 0, -1,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    -3, -3, 0, -2, -3, -2, 0, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, -2, 0, -3,
+    0, -2, 0, -6, 3, 0, 0, -3,
+    1, 3, 3, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 2,
+    0, 0, -3, 0, -3, -2, -3, 0,
+    0, 0, 0, 0, 0, 0, 2, 0,
+    -2, 0, 0, 0, 0, -3, -4, 0,
+    -5, 0, 9, -2, 1, -9, 0, 0,
+    8, -14, -15, -12, -6, 3, 0, -2,
+    -19, -5, 0, -5, 0, -6, 4, -5,
+    -18, 0, -8, 0, 0, 1, -1, 2,
+    -2, 0, 3, 0, -9, -11, 0, -14,
+    -7, -6, -7, -9, -3, -8, -1, -5,
+    -8, 2, 0, 1, 0, -3, 0, 0,
+    0, 2, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, -1, 0, -1, -3, 0, -5, -6,
+    -6, -1, 0, -9, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 0, 0, 1,
+    -2, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 2, 0, 0, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, 0, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, 0, 0,
+    -5, 0, 0, 0, 0, -14, -9, 0,
+    0, 0, -4, -14, 0, 0, -3, 3,
+    0, -8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, 0, 0, -5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, -5, 0,
+    0, 0, 0, 3, 0, 2, -6, -6,
+    0, -3, -3, -3, 0, 0, 0, 0,
+    0, 0, -9, 0, -3, 0, -4, -3,
+    0, -6, -7, -9, -2, 0, -6, 0,
+    -9, 0, 0, 0, 0, 23, 0, 0,
+    1, 0, 0, -4, 0, 3, 0, -12,
+    0, 0, 0, 0, 0, -27, -5, 10,
+    9, -2, -12, 0, 3, -4, 0, -14,
+    -1, -4, 3, -20, -3, 4, 0, 4,
+    -10, -4, -11, -10, -12, 0, 0, -17,
+    0, 16, 0, 0, -1, 0, 0, 0,
+    -1, -1, -3, -8, -10, -1, -27, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, -1, -3, -4, 0, 0,
+    -6, 0, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, -6, 0, 0, 6,
+    -1, 4, 0, -6, 3, -2, -1, -7,
+    -3, 0, -4, -3, -2, 0, -4, -5,
+    0, 0, -2, -1, -2, -5, -3, 0,
+    0, -3, 0, 3, -2, 0, -6, 0,
+    0, 0, -6, 0, -5, 0, -5, -5,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, -6, 3, 0, -4, 0, -2, -3,
+    -9, -2, -2, -2, -1, -2, -3, -1,
+    0, 0, 0, 0, 0, -3, -2, -2,
+    0, 0, 0, 0, 3, -2, 0, -2,
+    0, 0, 0, -2, -3, -2, -3, -3,
+    -3, 0, 2, 12, -1, 0, -8, 0,
+    -2, 6, 0, -3, -12, -4, 4, 0,
+    0, -14, -5, 3, -5, 2, 0, -2,
+    -2, -9, 0, -4, 1, 0, 0, -5,
+    0, 0, 0, 3, 3, -6, -5, 0,
+    -5, -3, -4, -3, -3, 0, -5, 1,
+    -5, -5, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -4, 0, 0, -4,
+    0, 0, -3, -3, 0, 0, 0, 0,
+    -3, 0, 0, 0, 0, -1, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    -4, 0, -6, 0, 0, 0, -10, 0,
+    2, -6, 6, 1, -2, -14, 0, 0,
+    -6, -3, 0, -12, -7, -8, 0, 0,
+    -12, -3, -12, -11, -14, 0, -7, 0,
+    2, 19, -4, 0, -7, -3, -1, -3,
+    -5, -8, -5, -11, -12, -7, -3, 0,
+    0, -2, 0, 1, 0, 0, -20, -3,
+    9, 6, -6, -11, 0, 1, -9, 0,
+    -14, -2, -3, 6, -26, -4, 1, 0,
+    0, -19, -3, -15, -3, -21, 0, 0,
+    -20, 0, 17, 1, 0, -2, 0, 0,
+    0, 0, -1, -2, -11, -2, 0, -19,
+    0, 0, 0, 0, -9, 0, -3, 0,
+    -1, -8, -14, 0, 0, -1, -4, -9,
+    -3, 0, -2, 0, 0, 0, 0, -13,
+    -3, -10, -9, -2, -5, -7, -3, -5,
+    0, -6, -3, -10, -4, 0, -3, -5,
+    -3, -5, 0, 1, 0, -2, -10, 0,
+    6, 0, -5, 0, 0, 0, 0, 3,
+    0, 2, -6, 12, 0, -3, -3, -3,
+    0, 0, 0, 0, 0, 0, -9, 0,
+    -3, 0, -4, -3, 0, -6, -7, -9,
+    -2, 0, -6, 2, 12, 0, 0, 0,
+    0, 23, 0, 0, 1, 0, 0, -4,
+    0, 3, 0, 0, 0, 0, 0, 0,
+    0, 0, -1, 0, 0, 0, 0, 0,
+    -2, -6, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, -3, -3, 0, 0, -6,
+    -3, 0, 0, -6, 0, 5, -1, 0,
+    0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 4, 6, 2, -3, 0, -9,
+    -5, 0, 9, -10, -9, -6, -6, 12,
+    5, 3, -25, -2, 6, -3, 0, -3,
+    3, -3, -10, 0, -3, 3, -4, -2,
+    -9, -2, 0, 0, 9, 6, 0, -8,
+    0, -16, -4, 8, -4, -11, 1, -4,
+    -10, -10, -3, 12, 3, 0, -4, 0,
+    -8, 0, 2, 10, -7, -11, -12, -7,
+    9, 0, 1, -21, -2, 3, -5, -2,
+    -7, 0, -6, -11, -4, -4, -2, 0,
+    0, -7, -6, -3, 0, 9, 7, -3,
+    -16, 0, -16, -4, 0, -10, -17, -1,
+    -9, -5, -10, -8, 8, 0, 0, -4,
+    0, -6, -3, 0, -3, -5, 0, 5,
+    -10, 3, 0, 0, -15, 0, -3, -6,
+    -5, -2, -9, -7, -10, -7, 0, -9,
+    -3, -7, -5, -9, -3, 0, 0, 1,
+    14, -5, 0, -9, -3, 0, -3, -6,
+    -7, -8, -8, -11, -4, -6, 6, 0,
+    -4, 0, -14, -3, 2, 6, -9, -11,
+    -6, -10, 10, -3, 1, -27, -5, 6,
+    -6, -5, -11, 0, -9, -12, -3, -3,
+    -2, -3, -6, -9, -1, 0, 0, 9,
+    8, -2, -19, 0, -17, -7, 7, -11,
+    -20, -6, -10, -12, -14, -10, 6, 0,
+    0, 0, 0, -3, 0, 0, 3, -3,
+    6, 2, -5, 6, 0, 0, -9, -1,
+    0, -1, 0, 1, 1, -2, 0, 0,
+    0, 0, 0, 0, -3, 0, 0, 0,
+    0, 2, 9, 1, 0, -3, 0, 0,
+    0, 0, -2, -2, -3, 0, 0, 0,
+    1, 2, 0, 0, 0, 0, 2, 0,
+    -2, 0, 11, 0, 5, 1, 1, -4,
+    0, 6, 0, 0, 0, 2, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 0, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -17, 0, -3, 5, 0, 9,
+    0, 0, 29, 3, -6, -6, 3, 3,
+    -2, 1, -14, 0, 0, 14, -17, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -20, 11, 40, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -17, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -5, 0, 0, -5,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -2, 0, -8, 0,
+    0, 1, 0, 0, 3, 37, -6, -2,
+    9, 8, -8, 3, 0, 0, 3, 3,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -37, 8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -8,
+    0, 0, 0, -8, 0, 0, 0, 0,
+    -6, -1, 0, 0, 0, -6, 0, -3,
+    0, -14, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -19, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, -5, 0, -4, 0,
+    -8, 0, 0, 0, -5, 3, -3, 0,
+    0, -8, -3, -7, 0, 0, -8, 0,
+    -3, 0, -14, 0, -3, 0, 0, -23,
+    -5, -12, -3, -10, 0, 0, -19, 0,
+    -8, -1, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, -5, -2, -5, 0, 0,
+    0, 0, -6, 0, -6, 4, -3, 6,
+    0, -2, -7, -2, -5, -5, 0, -3,
+    -1, -2, 2, -8, -1, 0, 0, 0,
+    -25, -2, -4, 0, -6, 0, -2, -14,
+    -3, 0, 0, -2, -2, 0, 0, 0,
+    0, 2, 0, -2, -5, -2, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0,
+    0, -6, 0, -2, 0, 0, 0, -6,
+    3, 0, 0, 0, -8, -3, -6, 0,
+    0, -8, 0, -3, 0, -14, 0, 0,
+    0, 0, -28, 0, -6, -11, -14, 0,
+    0, -19, 0, -2, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, -4, -1,
+    -4, 1, 0, 0, 5, -4, 0, 9,
+    14, -3, -3, -9, 3, 14, 5, 6,
+    -8, 3, 12, 3, 8, 6, 8, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 18, 14, -5, -3, 0, -2,
+    23, 12, 23, 0, 0, 0, 3, 0,
+    0, 11, 0, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, -24, -3, -2, -12,
+    -14, 0, 0, -19, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, -24, -3, -2,
+    -12, -14, 0, 0, -12, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, -7, 3, 0, -3,
+    2, 5, 3, -9, 0, -1, -2, 3,
+    0, 2, 0, 0, 0, 0, -7, 0,
+    -3, -2, -6, 0, -3, -12, 0, 18,
+    -3, 0, -6, -2, 0, -2, -5, 0,
+    -3, -8, -6, -3, 0, 0, 0, -5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, -24,
+    -3, -2, -12, -14, 0, 0, -19, 0,
+    0, 0, 0, 0, 0, 14, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, 0, -9, -3, -3, 9, -3, -3,
+    -12, 1, -2, 1, -2, -8, 1, 6,
+    1, 2, 1, 2, -7, -12, -3, 0,
+    -11, -5, -8, -12, -11, 0, -5, -6,
+    -3, -4, -2, -2, -3, -2, 0, -2,
+    -1, 4, 0, 4, -2, 0, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -2, -3, -3, 0, 0,
+    -8, 0, -1, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -17, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -3, -3, 0, -4,
+    0, 0, 0, 0, -2, 0, 0, -5,
+    -3, 3, 0, -5, -5, -2, 0, -8,
+    -2, -6, -2, -3, 0, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -19, 0, 9, 0, 0, -5, 0,
+    0, 0, 0, -4, 0, -3, 0, 0,
+    -1, 0, 0, -2, 0, -7, 0, 0,
+    12, -4, -10, -9, 2, 3, 3, -1,
+    -8, 2, 4, 2, 9, 2, 10, -2,
+    -8, 0, 0, -12, 0, 0, -9, -8,
+    0, 0, -6, 0, -4, -5, 0, -4,
+    0, -4, 0, -2, 4, 0, -2, -9,
+    -3, 11, 0, 0, -3, 0, -6, 0,
+    0, 4, -7, 0, 3, -3, 2, 0,
+    0, -10, 0, -2, -1, 0, -3, 3,
+    -2, 0, 0, 0, -12, -3, -6, 0,
+    -9, 0, 0, -14, 0, 11, -3, 0,
+    -5, 0, 2, 0, -3, 0, -3, -9,
+    0, -3, 3, 0, 0, 0, 0, -2,
+    0, 0, 3, -4, 1, 0, 0, -3,
+    -2, 0, -3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -18, 0, 6, 0,
+    0, -2, 0, 0, 0, 0, 1, 0,
+    -3, -3, 0, 0, 0, 6, 0, 7,
+    0, 0, 0, 0, 0, -18, -16, 1,
+    12, 9, 5, -12, 2, 12, 0, 11,
+    0, 6, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 15, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 61,
+    .right_class_cnt     = 49,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 2,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 1,
+    .cache = &cache
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_montserrat_18 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 21,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_16,   /*Characters outside the subset*/
+};
@@ -0,0 +1,932 @@
+/*******************************************************************************
+ * Size: 20 px
+ * Bpp: 2
+ * Opts: generated by generate_ui_fonts.py from lv_font_montserrat_20.c, plain
+ * Characters:  %()+,-./0123456789:>ABCDEFGHIKLMNOPRSTUVWXYabcdefghiklmnoprstuvwxyz°
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0xe, 0x0, 0x0, 0xe0, 0x0,
+    0xe, 0x0, 0x0, 0xe0, 0xb, 0xff, 0xfd, 0x6a,
+    0xfa, 0x80, 0xe, 0x0, 0x0, 0xe0, 0x0, 0xe,
+    0x0,
+
+    /* U+002C "," */
+    0x18, 0x3e, 0x2d, 0x1c, 0x28, 0x34,
+
+    /* U+002D "-" */
+    0xaa, 0x9f, 0xfe,
+
+    /* U+002E "." */
+    0x18, 0x3e, 0x2d,
+
+    /* U+002F "/" */
+    0x0, 0x1, 0x40, 0x1, 0xd0, 0x0, 0xb0, 0x0,
+    0x38, 0x0, 0x1d, 0x0, 0xb, 0x0, 0x3, 0x80,
+    0x1, 0xd0, 0x0, 0xb0, 0x0, 0x38, 0x0, 0x1d,
+    0x0, 0xb, 0x0, 0x3, 0x80, 0x1, 0xd0, 0x0,
+    0xb0, 0x0, 0x38, 0x0, 0x1d, 0x0, 0xb, 0x0,
+    0x3, 0x80, 0x1, 0xd0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0xbf, 0x90, 0x0, 0xff, 0xfd, 0x0, 0xf8,
+    0x7, 0xc0, 0x78, 0x0, 0x78, 0x2d, 0x0, 0xf,
+    0xf, 0x0, 0x2, 0xd3, 0xc0, 0x0, 0xb4, 0xf0,
+    0x0, 0x2d, 0x3c, 0x0, 0xb, 0x4b, 0x40, 0x3,
+    0xc1, 0xe0, 0x1, 0xe0, 0x3e, 0x1, 0xf0, 0x3,
+    0xff, 0xf4, 0x0, 0x2f, 0xe4, 0x0,
+
+    /* U+0031 "1" */
+    0xff, 0xda, 0xbd, 0x2, 0xd0, 0x2d, 0x2, 0xd0,
+    0x2d, 0x2, 0xd0, 0x2d, 0x2, 0xd0, 0x2d, 0x2,
+    0xd0, 0x2d, 0x2, 0xd0, 0x2d,
+
+    /* U+0032 "2" */
+    0x6, 0xfe, 0x40, 0xff, 0xff, 0x47, 0x80, 0x2f,
+    0x0, 0x0, 0x3c, 0x0, 0x0, 0xf0, 0x0, 0x3,
+    0xc0, 0x0, 0x3d, 0x0, 0x2, 0xe0, 0x0, 0x3e,
+    0x0, 0x3, 0xe0, 0x0, 0x3d, 0x0, 0x3, 0xd0,
+    0x0, 0x3f, 0xaa, 0xa9, 0xff, 0xff, 0xe0,
+
+    /* U+0033 "3" */
+    0x7f, 0xff, 0xf1, 0xaa, 0xaf, 0xc0, 0x0, 0x3c,
+    0x0, 0x3, 0xd0, 0x0, 0x2d, 0x0, 0x2, 0xe0,
+    0x0, 0xf, 0xf8, 0x0, 0x16, 0xf8, 0x0, 0x0,
+    0xf4, 0x0, 0x2, 0xe0, 0x0, 0xb, 0x5d, 0x0,
+    0x7c, 0x7f, 0xff, 0xd0, 0x2b, 0xf9, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x1, 0xe0, 0x0, 0x0, 0x7c, 0x0, 0x0,
+    0xf, 0x40, 0x0, 0x2, 0xd0, 0x0, 0x0, 0xb8,
+    0x0, 0x0, 0x1f, 0x0, 0x0, 0x3, 0xc0, 0x74,
+    0x0, 0xb4, 0x7, 0x40, 0x2e, 0x0, 0x74, 0x7,
+    0xff, 0xff, 0xfc, 0x2a, 0xaa, 0xfe, 0x80, 0x0,
+    0x7, 0x40, 0x0, 0x0, 0x74, 0x0, 0x0, 0x7,
+    0x40,
+
+    /* U+0035 "5" */
+    0xf, 0xff, 0xf0, 0x3e, 0xaa, 0x80, 0xe0, 0x0,
+    0x7, 0x80, 0x0, 0x1d, 0x0, 0x0, 0x7e, 0xa4,
+    0x2, 0xff, 0xfd, 0x0, 0x0, 0xbd, 0x0, 0x0,
+    0xb8, 0x0, 0x1, 0xe0, 0x0, 0x7, 0x9e, 0x0,
+    0x7d, 0x7f, 0xff, 0xe0, 0x1b, 0xf9, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x6f, 0xe4, 0x2, 0xfe, 0xf8, 0xb, 0x80,
+    0x0, 0x1e, 0x0, 0x0, 0x2d, 0x0, 0x0, 0x3c,
+    0x6f, 0x90, 0x3e, 0xfa, 0xf8, 0x3f, 0x40, 0x3d,
+    0x3e, 0x0, 0x1e, 0x2d, 0x0, 0x1e, 0x1e, 0x0,
+    0x1e, 0xf, 0x40, 0x3d, 0x7, 0xfa, 0xf8, 0x0,
+    0xbf, 0x90,
+
+    /* U+0037 "7" */
+    0x7f, 0xff, 0xfc, 0x7e, 0xaa, 0xfc, 0x78, 0x0,
+    0x78, 0x78, 0x0, 0xf4, 0x10, 0x1, 0xe0, 0x0,
+    0x2, 0xd0, 0x0, 0x7, 0xc0, 0x0, 0xb, 0x40,
+    0x0, 0xf, 0x0, 0x0, 0x2e, 0x0, 0x0, 0x3c,
+    0x0, 0x0, 0x78, 0x0, 0x0, 0xf0, 0x0, 0x1,
+    0xe0, 0x0,
+
+    /* U+0038 "8" */
+    0x1, 0xbf, 0x90, 0xb, 0xea, 0xf8, 0x1e, 0x0,
+    0x3d, 0x2d, 0x0, 0x2d, 0x1e, 0x0, 0x3d, 0xb,
+    0xea, 0xf8, 0x7, 0xff, 0xf4, 0x1f, 0x40, 0x7d,
+    0x3d, 0x0, 0x1e, 0x3c, 0x0, 0xf, 0x3c, 0x0,
+    0x1f, 0x2e, 0x0, 0x3e, 0xf, 0xea, 0xf8, 0x1,
+    0xbf, 0x90,
+
+    /* U+0039 "9" */
+    0x6, 0xfe, 0x40, 0x1f, 0xeb, 0xe0, 0x3d, 0x0,
+    0xb4, 0x78, 0x0, 0x3c, 0x78, 0x0, 0x7c, 0x3d,
+    0x0, 0xbd, 0x2f, 0xeb, 0xed, 0x6, 0xfe, 0x2d,
+    0x0, 0x0, 0x3d, 0x0, 0x0, 0x3c, 0x0, 0x0,
+    0xb8, 0x4, 0x2, 0xf0, 0x1f, 0xff, 0xd0, 0x1b,
+    0xf9, 0x0,
+
+    /* U+003A ":" */
+    0x2d, 0x3e, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x18, 0x3e, 0x2d,
+
+    /* U+0041 "A" */
+    0x0, 0x3, 0xe0, 0x0, 0x0, 0x7, 0xf0, 0x0,
+    0x0, 0xf, 0xb4, 0x0, 0x0, 0x1e, 0x3c, 0x0,
+    0x0, 0x2d, 0x2d, 0x0, 0x0, 0x38, 0x1e, 0x0,
+    0x0, 0xb4, 0xb, 0x40, 0x0, 0xf0, 0x7, 0x80,
+    0x2, 0xd0, 0x3, 0xc0, 0x3, 0xff, 0xff, 0xe0,
+    0x7, 0xea, 0xaa, 0xf0, 0xf, 0x40, 0x0, 0xb8,
+    0x1e, 0x0, 0x0, 0x3c, 0x2d, 0x0, 0x0, 0x2d,
+
+    /* U+0042 "B" */
+    0xff, 0xff, 0x90, 0x3e, 0xaa, 0xfe, 0xf, 0x0,
+    0x7, 0xd3, 0xc0, 0x0, 0xb4, 0xf0, 0x0, 0x2d,
+    0x3c, 0x0, 0x2e, 0xf, 0xff, 0xff, 0x3, 0xea,
+    0xab, 0xf0, 0xf0, 0x0, 0x2e, 0x3c, 0x0, 0x3,
+    0xcf, 0x0, 0x0, 0xf3, 0xc0, 0x0, 0xbc, 0xfa,
+    0xaa, 0xfd, 0x3f, 0xff, 0xf8, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x1b, 0xf9, 0x0, 0x1f, 0xff, 0xf8, 0x7,
+    0xe0, 0x6, 0xd0, 0xf4, 0x0, 0x4, 0x2e, 0x0,
+    0x0, 0x3, 0xd0, 0x0, 0x0, 0x3c, 0x0, 0x0,
+    0x3, 0xc0, 0x0, 0x0, 0x3d, 0x0, 0x0, 0x2,
+    0xe0, 0x0, 0x0, 0xf, 0x40, 0x0, 0x40, 0x7e,
+    0x40, 0x6d, 0x1, 0xff, 0xff, 0x80, 0x1, 0xbf,
+    0x90,
+
+    /* U+0044 "D" */
+    0xff, 0xff, 0x90, 0xf, 0xea, 0xff, 0x80, 0xf0,
+    0x0, 0x7f, 0xf, 0x0, 0x0, 0xb8, 0xf0, 0x0,
+    0x3, 0xcf, 0x0, 0x0, 0x2d, 0xf0, 0x0, 0x2,
+    0xef, 0x0, 0x0, 0x1e, 0xf0, 0x0, 0x2, 0xdf,
+    0x0, 0x0, 0x3c, 0xf0, 0x0, 0xb, 0x8f, 0x0,
+    0x7, 0xf0, 0xfa, 0xaf, 0xf8, 0xf, 0xff, 0xf9,
+    0x0,
+
+    /* U+0045 "E" */
+    0xff, 0xff, 0xf3, 0xfa, 0xaa, 0x8f, 0x0, 0x0,
+    0x3c, 0x0, 0x0, 0xf0, 0x0, 0x3, 0xc0, 0x0,
+    0xf, 0xff, 0xfc, 0x3e, 0xaa, 0xa0, 0xf0, 0x0,
+    0x3, 0xc0, 0x0, 0xf, 0x0, 0x0, 0x3c, 0x0,
+    0x0, 0xfa, 0xaa, 0xa7, 0xff, 0xff, 0xd0,
+
+    /* U+0046 "F" */
+    0xff, 0xff, 0xff, 0xea, 0xaa, 0xf0, 0x0, 0xf,
+    0x0, 0x0, 0xf0, 0x0, 0xf, 0x0, 0x0, 0xfa,
+    0xaa, 0x8f, 0xff, 0xfc, 0xf0, 0x0, 0xf, 0x0,
+    0x0, 0xf0, 0x0, 0xf, 0x0, 0x0, 0xf0, 0x0,
+    0xf, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x1b, 0xf9, 0x0, 0x1f, 0xff, 0xfc, 0x7,
+    0xe0, 0x2, 0xd0, 0xf4, 0x0, 0x0, 0x2e, 0x0,
+    0x0, 0x3, 0xd0, 0x0, 0x0, 0x3c, 0x0, 0x0,
+    0x3, 0xc0, 0x0, 0x1e, 0x3d, 0x0, 0x1, 0xe2,
+    0xe0, 0x0, 0x1e, 0xf, 0x40, 0x1, 0xe0, 0x7e,
+    0x40, 0x2e, 0x1, 0xff, 0xff, 0xd0, 0x1, 0xbf,
+    0x90,
+
+    /* U+0048 "H" */
+    0xf0, 0x0, 0xf, 0x3c, 0x0, 0x3, 0xcf, 0x0,
+    0x0, 0xf3, 0xc0, 0x0, 0x3c, 0xf0, 0x0, 0xf,
+    0x3c, 0x0, 0x3, 0xcf, 0xff, 0xff, 0xf3, 0xfa,
+    0xaa, 0xbc, 0xf0, 0x0, 0xf, 0x3c, 0x0, 0x3,
+    0xcf, 0x0, 0x0, 0xf3, 0xc0, 0x0, 0x3c, 0xf0,
+    0x0, 0xf, 0x3c, 0x0, 0x3, 0xc0,
+
+    /* U+0049 "I" */
+    0xf3, 0xcf, 0x3c, 0xf3, 0xcf, 0x3c, 0xf3, 0xcf,
+    0x3c, 0xf3, 0xc0,
+
+    /* U+004B "K" */
+    0xf0, 0x0, 0x2e, 0x3c, 0x0, 0x2e, 0xf, 0x0,
+    0x2e, 0x3, 0xc0, 0x2e, 0x0, 0xf0, 0x2e, 0x0,
+    0x3c, 0x2e, 0x0, 0xf, 0x2f, 0x40, 0x3, 0xef,
+    0xf0, 0x0, 0xff, 0x2e, 0x0, 0x3f, 0x2, 0xe0,
+    0xf, 0x0, 0x3d, 0x3, 0xc0, 0x3, 0xd0, 0xf0,
+    0x0, 0x7c, 0x3c, 0x0, 0x7, 0xc0,
+
+    /* U+004C "L" */
+    0xf0, 0x0, 0xf, 0x0, 0x0, 0xf0, 0x0, 0xf,
+    0x0, 0x0, 0xf0, 0x0, 0xf, 0x0, 0x0, 0xf0,
+    0x0, 0xf, 0x0, 0x0, 0xf0, 0x0, 0xf, 0x0,
+    0x0, 0xf0, 0x0, 0xf, 0x0, 0x0, 0xfa, 0xaa,
+    0xaf, 0xff, 0xfe,
+
+    /* U+004D "M" */
+    0xf0, 0x0, 0x0, 0x3f, 0xe0, 0x0, 0x2, 0xff,
+    0xd0, 0x0, 0xf, 0xff, 0x80, 0x0, 0xbf, 0xfb,
+    0x40, 0x7, 0xbf, 0xcf, 0x0, 0x3c, 0xff, 0x1e,
+    0x1, 0xd3, 0xfc, 0x2d, 0xf, 0xf, 0xf0, 0x78,
+    0xb4, 0x3f, 0xc0, 0xbb, 0x80, 0xff, 0x0, 0xfc,
+    0x3, 0xfc, 0x1, 0xd0, 0xf, 0xf0, 0x1, 0x0,
+    0x3f, 0xc0, 0x0, 0x0, 0xf0,
+
+    /* U+004E "N" */
+    0xf0, 0x0, 0xf, 0x3f, 0x0, 0x3, 0xcf, 0xe0,
+    0x0, 0xf3, 0xfe, 0x0, 0x3c, 0xf7, 0xd0, 0xf,
+    0x3c, 0x7d, 0x3, 0xcf, 0xb, 0xc0, 0xf3, 0xc0,
+    0xb8, 0x3c, 0xf0, 0xf, 0x8f, 0x3c, 0x0, 0xf7,
+    0xcf, 0x0, 0x1f, 0xf3, 0xc0, 0x2, 0xfc, 0xf0,
+    0x0, 0x2f, 0x3c, 0x0, 0x3, 0xc0,
+
+    /* U+004F "O" */
+    0x0, 0x1b, 0xf9, 0x0, 0x1, 0xff, 0xff, 0xd0,
+    0x7, 0xe0, 0x6, 0xf0, 0xf, 0x40, 0x0, 0xbc,
+    0x2e, 0x0, 0x0, 0x3d, 0x3d, 0x0, 0x0, 0x1e,
+    0x3c, 0x0, 0x0, 0x1e, 0x3c, 0x0, 0x0, 0x1e,
+    0x3d, 0x0, 0x0, 0x1e, 0x2e, 0x0, 0x0, 0x3d,
+    0xf, 0x40, 0x0, 0xbc, 0x7, 0xe0, 0x6, 0xf0,
+    0x1, 0xff, 0xff, 0xd0, 0x0, 0x1b, 0xf9, 0x0,
+
+    /* U+0050 "P" */
+    0xff, 0xfe, 0x40, 0xfe, 0xbf, 0xf0, 0xf0, 0x0,
+    0xb8, 0xf0, 0x0, 0x3d, 0xf0, 0x0, 0x2d, 0xf0,
+    0x0, 0x2d, 0xf0, 0x0, 0x3c, 0xf0, 0x1, 0xf8,
+    0xff, 0xff, 0xe0, 0xfa, 0xaa, 0x40, 0xf0, 0x0,
+    0x0, 0xf0, 0x0, 0x0, 0xf0, 0x0, 0x0, 0xf0,
+    0x0, 0x0,
+
+    /* U+0052 "R" */
+    0xff, 0xfe, 0x40, 0xfe, 0xbf, 0xf0, 0xf0, 0x0,
+    0xb8, 0xf0, 0x0, 0x3d, 0xf0, 0x0, 0x2d, 0xf0,
+    0x0, 0x2d, 0xf0, 0x0, 0x3c, 0xf0, 0x1, 0xf8,
+    0xff, 0xff, 0xe0, 0xfa, 0xaf, 0x80, 0xf0, 0x3,
+    0xc0, 0xf0, 0x1, 0xf0, 0xf0, 0x0, 0xb8, 0xf0,
+    0x0, 0x3d,
+
+    /* U+0053 "S" */
+    0x1, 0xbf, 0x90, 0xb, 0xfb, 0xfc, 0x2e, 0x0,
+    0x14, 0x2d, 0x0, 0x0, 0x2d, 0x0, 0x0, 0x1f,
+    0x40, 0x0, 0x7, 0xfe, 0x40, 0x0, 0x6f, 0xf4,
+    0x0, 0x1, 0xbc, 0x0, 0x0, 0x2d, 0x0, 0x0,
+    0x1e, 0x39, 0x0, 0x7d, 0x2f, 0xeb, 0xf8, 0x6,
+    0xff, 0x90,
+
+    /* U+0054 "T" */
+    0xff, 0xff, 0xfe, 0xaa, 0xfe, 0xaa, 0x0, 0x3c,
+    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3c, 0x0, 0x0,
+    0x3c, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x3c, 0x0,
+    0x0, 0x3c, 0x0, 0x0, 0x3c, 0x0, 0x0, 0x3c,
+    0x0, 0x0, 0x3c, 0x0, 0x0, 0x3c, 0x0, 0x0,
+    0x3c, 0x0,
+
+    /* U+0055 "U" */
+    0x3c, 0x0, 0x3, 0xcf, 0x0, 0x0, 0xf3, 0xc0,
+    0x0, 0x3c, 0xf0, 0x0, 0xf, 0x3c, 0x0, 0x3,
+    0xcf, 0x0, 0x0, 0xf3, 0xc0, 0x0, 0x3c, 0xf0,
+    0x0, 0xe, 0x3c, 0x0, 0x3, 0x8f, 0x40, 0x1,
+    0xe2, 0xe0, 0x0, 0xb4, 0x3e, 0x0, 0xbc, 0x7,
+    0xff, 0xfd, 0x0, 0x2f, 0xf8, 0x0,
+
+    /* U+0056 "V" */
+    0x2d, 0x0, 0x0, 0x3c, 0x1e, 0x0, 0x0, 0x78,
+    0xf, 0x40, 0x0, 0xf0, 0x7, 0x80, 0x1, 0xe0,
+    0x3, 0xc0, 0x2, 0xd0, 0x2, 0xe0, 0x3, 0xc0,
+    0x0, 0xf0, 0xb, 0x40, 0x0, 0xb4, 0xf, 0x0,
+    0x0, 0x7c, 0x1e, 0x0, 0x0, 0x3d, 0x3c, 0x0,
+    0x0, 0x1e, 0x78, 0x0, 0x0, 0xf, 0xf4, 0x0,
+    0x0, 0xb, 0xe0, 0x0, 0x0, 0x3, 0xd0, 0x0,
+
+    /* U+0057 "W" */
+    0x7c, 0x0, 0xb, 0x40, 0x0, 0xe3, 0xd0, 0x0,
+    0xf8, 0x0, 0x2d, 0x2e, 0x0, 0x1f, 0xc0, 0x3,
+    0xc1, 0xf0, 0x2, 0xed, 0x0, 0x78, 0xf, 0x40,
+    0x38, 0xe0, 0xb, 0x40, 0xb8, 0x7, 0x4b, 0x0,
+    0xf0, 0x7, 0xc0, 0xf0, 0x74, 0x1e, 0x0, 0x3d,
+    0xe, 0x3, 0x82, 0xd0, 0x2, 0xe2, 0xd0, 0x2c,
+    0x3c, 0x0, 0x1f, 0x3c, 0x1, 0xd7, 0x80, 0x0,
+    0xf7, 0x80, 0xe, 0xb4, 0x0, 0xb, 0xf4, 0x0,
+    0xbf, 0x0, 0x0, 0x7f, 0x0, 0x7, 0xe0, 0x0,
+    0x3, 0xe0, 0x0, 0x3d, 0x0,
+
+    /* U+0058 "X" */
+    0x3d, 0x0, 0xb, 0x41, 0xf0, 0x1, 0xe0, 0xb,
+    0x80, 0x3c, 0x0, 0x3d, 0xf, 0x40, 0x1, 0xf2,
+    0xe0, 0x0, 0x7, 0xf8, 0x0, 0x0, 0x2f, 0x0,
+    0x0, 0x3, 0xf4, 0x0, 0x0, 0xbb, 0xd0, 0x0,
+    0x1e, 0x1f, 0x0, 0x7, 0xc0, 0xb8, 0x0, 0xf4,
+    0x3, 0xd0, 0x2e, 0x0, 0x1f, 0x7, 0xc0, 0x0,
+    0x78,
+
+    /* U+0059 "Y" */
+    0x2d, 0x0, 0x1, 0xe0, 0x3c, 0x0, 0xf, 0x0,
+    0xb8, 0x0, 0x74, 0x0, 0xf4, 0x3, 0xc0, 0x1,
+    0xe0, 0x2d, 0x0, 0x2, 0xd1, 0xe0, 0x0, 0x3,
+    0xcf, 0x0, 0x0, 0xb, 0xf4, 0x0, 0x0, 0xf,
+    0xc0, 0x0, 0x0, 0x2d, 0x0, 0x0, 0x0, 0xb4,
+    0x0, 0x0, 0x2, 0xd0, 0x0, 0x0, 0xb, 0x40,
+    0x0, 0x0, 0x2d, 0x0, 0x0,
+
+    /* U+0061 "a" */
+    0x1b, 0xf9, 0x7, 0xfb, 0xf4, 0x20, 0x7, 0xc0,
+    0x0, 0x3c, 0x0, 0x2, 0xd2, 0xff, 0xfd, 0xb9,
+    0x56, 0xdf, 0x0, 0x2d, 0xf0, 0x7, 0xdb, 0xd6,
+    0xfd, 0x1b, 0xe6, 0xd0,
+
+    /* U+0062 "b" */
+    0x78, 0x0, 0x0, 0x78, 0x0, 0x0, 0x78, 0x0,
+    0x0, 0x78, 0x0, 0x0, 0x78, 0xbf, 0x80, 0x7f,
+    0xfb, 0xf4, 0x7f, 0x40, 0xbc, 0x7d, 0x0, 0x2d,
+    0x7c, 0x0, 0x1e, 0x78, 0x0, 0xe, 0x7c, 0x0,
+    0x1e, 0x7d, 0x0, 0x2d, 0x7f, 0x40, 0xbc, 0x7b,
+    0xfb, 0xf4, 0x78, 0xbf, 0x80,
+
+    /* U+0063 "c" */
+    0x1, 0xbf, 0x80, 0x1f, 0xef, 0xc1, 0xf4, 0x7,
+    0x4b, 0x40, 0x0, 0x3c, 0x0, 0x0, 0xe0, 0x0,
+    0x3, 0xc0, 0x0, 0xb, 0x40, 0x0, 0x1f, 0x40,
+    0x74, 0x1f, 0xef, 0xc0, 0x1b, 0xf8, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0xf, 0x0, 0x0, 0xf, 0x0, 0x0,
+    0xf, 0x0, 0x0, 0xf, 0x1, 0xbe, 0x4f, 0xb,
+    0xfb, 0xef, 0x1f, 0x40, 0x7f, 0x2d, 0x0, 0x2f,
+    0x3c, 0x0, 0x1f, 0x38, 0x0, 0xf, 0x3c, 0x0,
+    0x1f, 0x2d, 0x0, 0x2f, 0x1f, 0x0, 0x7f, 0xb,
+    0xeb, 0xef, 0x1, 0xbf, 0x4f,
+
+    /* U+0065 "e" */
+    0x1, 0xbe, 0x40, 0xb, 0xeb, 0xe0, 0x1f, 0x0,
+    0xb8, 0x2d, 0x0, 0x3c, 0x3c, 0x0, 0x2d, 0x3f,
+    0xff, 0xfd, 0x3d, 0x55, 0x54, 0x2d, 0x0, 0x0,
+    0x1f, 0x40, 0x20, 0x7, 0xfb, 0xf4, 0x1, 0xbf,
+    0x90,
+
+    /* U+0066 "f" */
+    0x1, 0xfd, 0x7, 0xe9, 0xb, 0x0, 0xf, 0x0,
+    0xbf, 0xfc, 0x6f, 0xa8, 0xf, 0x0, 0xf, 0x0,
+    0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0,
+    0xf, 0x0, 0xf, 0x0, 0xf, 0x0,
+
+    /* U+0067 "g" */
+    0x1, 0xbf, 0x4f, 0xb, 0xfb, 0xef, 0x1f, 0x40,
+    0x7f, 0x2d, 0x0, 0x1f, 0x3c, 0x0, 0xf, 0x38,
+    0x0, 0xf, 0x3c, 0x0, 0xf, 0x2d, 0x0, 0x1f,
+    0x1f, 0x40, 0x7f, 0xb, 0xfb, 0xef, 0x1, 0xbf,
+    0x4f, 0x0, 0x0, 0x1e, 0x9, 0x0, 0x3d, 0x1f,
+    0xeb, 0xf8, 0x2, 0xbf, 0x90,
+
+    /* U+0068 "h" */
+    0x78, 0x0, 0x1, 0xe0, 0x0, 0x7, 0x80, 0x0,
+    0x1e, 0x0, 0x0, 0x78, 0xbf, 0x81, 0xff, 0xff,
+    0xc7, 0xf0, 0xf, 0x5f, 0x0, 0x1e, 0x7c, 0x0,
+    0x3d, 0xe0, 0x0, 0xf7, 0x80, 0x3, 0xde, 0x0,
+    0xf, 0x78, 0x0, 0x3d, 0xe0, 0x0, 0xf7, 0x80,
+    0x3, 0xc0,
+
+    /* U+0069 "i" */
+    0x78, 0x7c, 0x24, 0x0, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+
+    /* U+006B "k" */
+    0x78, 0x0, 0x0, 0x78, 0x0, 0x0, 0x78, 0x0,
+    0x0, 0x78, 0x0, 0x0, 0x78, 0x0, 0xf4, 0x78,
+    0x3, 0xd0, 0x78, 0x1f, 0x40, 0x78, 0x7d, 0x0,
+    0x79, 0xf8, 0x0, 0x7f, 0xfc, 0x0, 0x7f, 0x6f,
+    0x0, 0x7d, 0xb, 0x80, 0x78, 0x3, 0xd0, 0x78,
+    0x1, 0xf0, 0x78, 0x0, 0x7c,
+
+    /* U+006C "l" */
+    0x79, 0xe7, 0x9e, 0x79, 0xe7, 0x9e, 0x79, 0xe7,
+    0x9e, 0x79, 0xe7, 0x80,
+
+    /* U+006D "m" */
+    0x79, 0xbf, 0x41, 0xbe, 0x41, 0xff, 0xaf, 0xaf,
+    0xaf, 0x47, 0xe0, 0x1f, 0xe0, 0x1f, 0x1f, 0x0,
+    0x2f, 0x0, 0x2d, 0x7c, 0x0, 0x78, 0x0, 0xb5,
+    0xe0, 0x1, 0xe0, 0x2, 0xd7, 0x80, 0x7, 0x80,
+    0xb, 0x5e, 0x0, 0x1e, 0x0, 0x2d, 0x78, 0x0,
+    0x78, 0x0, 0xb5, 0xe0, 0x1, 0xe0, 0x2, 0xd7,
+    0x80, 0x7, 0x80, 0xb, 0x40,
+
+    /* U+006E "n" */
+    0x78, 0xbf, 0x81, 0xff, 0xaf, 0xc7, 0xe0, 0xb,
+    0x5f, 0x0, 0x1e, 0x7c, 0x0, 0x3d, 0xe0, 0x0,
+    0xf7, 0x80, 0x3, 0xde, 0x0, 0xf, 0x78, 0x0,
+    0x3d, 0xe0, 0x0, 0xf7, 0x80, 0x3, 0xc0,
+
+    /* U+006F "o" */
+    0x1, 0xbf, 0x80, 0x7, 0xfb, 0xf4, 0x1f, 0x40,
+    0x7c, 0x2d, 0x0, 0x2d, 0x3c, 0x0, 0x1e, 0x38,
+    0x0, 0xf, 0x3c, 0x0, 0x1e, 0x2d, 0x0, 0x2d,
+    0x1f, 0x40, 0x7c, 0x7, 0xfb, 0xf4, 0x1, 0xbf,
+    0x80,
+
+    /* U+0070 "p" */
+    0x78, 0xbf, 0x80, 0x7b, 0xeb, 0xf4, 0x7f, 0x0,
+    0x7c, 0x7d, 0x0, 0x2d, 0x7c, 0x0, 0x1e, 0x78,
+    0x0, 0xe, 0x7c, 0x0, 0x1e, 0x7d, 0x0, 0x2d,
+    0x7f, 0x40, 0xbc, 0x7f, 0xfb, 0xf4, 0x78, 0xbf,
+    0x80, 0x78, 0x0, 0x0, 0x78, 0x0, 0x0, 0x78,
+    0x0, 0x0, 0x78, 0x0, 0x0,
+
+    /* U+0072 "r" */
+    0x78, 0xb9, 0xef, 0xd7, 0xf4, 0x1f, 0x40, 0x7c,
+    0x1, 0xe0, 0x7, 0x80, 0x1e, 0x0, 0x78, 0x1,
+    0xe0, 0x7, 0x80, 0x0,
+
+    /* U+0073 "s" */
+    0x6, 0xfe, 0x42, 0xfa, 0xfc, 0x3c, 0x0, 0x43,
+    0xc0, 0x0, 0x3e, 0x50, 0x0, 0xbf, 0xe4, 0x0,
+    0x5b, 0xc0, 0x0, 0x2d, 0x24, 0x2, 0xd7, 0xfa,
+    0xf8, 0x1b, 0xf9, 0x0,
+
+    /* U+0074 "t" */
+    0x6, 0x0, 0xf, 0x0, 0xf, 0x0, 0xbf, 0xfc,
+    0x6f, 0xa8, 0xf, 0x0, 0xf, 0x0, 0xf, 0x0,
+    0xf, 0x0, 0xf, 0x0, 0xf, 0x0, 0xb, 0x40,
+    0x7, 0xed, 0x1, 0xfd,
+
+    /* U+0075 "u" */
+    0x78, 0x0, 0x79, 0xe0, 0x1, 0xe7, 0x80, 0x7,
+    0x9e, 0x0, 0x1e, 0x78, 0x0, 0x79, 0xe0, 0x1,
+    0xe7, 0x80, 0x7, 0x8f, 0x0, 0x2e, 0x3d, 0x1,
+    0xf8, 0x7f, 0xbe, 0xe0, 0x6f, 0xd3, 0x80,
+
+    /* U+0076 "v" */
+    0x3c, 0x0, 0xf, 0x7, 0x80, 0x7, 0x80, 0xf0,
+    0x2, 0xc0, 0x2d, 0x0, 0xe0, 0x3, 0x80, 0xb4,
+    0x0, 0xb4, 0x3c, 0x0, 0x1e, 0x1d, 0x0, 0x3,
+    0xcf, 0x0, 0x0, 0x7b, 0x80, 0x0, 0xf, 0xd0,
+    0x0, 0x2, 0xe0, 0x0,
+
+    /* U+0077 "w" */
+    0xb0, 0x0, 0xf0, 0x0, 0xe7, 0x40, 0x1f, 0x40,
+    0x1d, 0x3c, 0x2, 0xf8, 0x2, 0xc2, 0xc0, 0x3a,
+    0xc0, 0x38, 0x1e, 0x7, 0x5d, 0x7, 0x40, 0xf0,
+    0xb0, 0xe0, 0xf0, 0xb, 0x4e, 0xb, 0x1e, 0x0,
+    0x7a, 0xd0, 0x7a, 0xc0, 0x3, 0xfc, 0x3, 0xf8,
+    0x0, 0x1f, 0x40, 0x1f, 0x40, 0x0, 0xf0, 0x0,
+    0xf0, 0x0,
+
+    /* U+0078 "x" */
+    0x3c, 0x0, 0xf4, 0x78, 0xb, 0x40, 0xb4, 0x78,
+    0x0, 0xf7, 0xc0, 0x1, 0xfd, 0x0, 0x2, 0xe0,
+    0x0, 0x1f, 0xd0, 0x0, 0xf3, 0xc0, 0xf, 0x47,
+    0xc0, 0xb8, 0xb, 0x87, 0x80, 0xb, 0x40,
+
+    /* U+0079 "y" */
+    0x3c, 0x0, 0xf, 0x7, 0x80, 0x7, 0x80, 0xf0,
+    0x2, 0xc0, 0x2d, 0x0, 0xe0, 0x3, 0xc0, 0xb4,
+    0x0, 0xb4, 0x3c, 0x0, 0x1e, 0x1d, 0x0, 0x3,
+    0xcf, 0x0, 0x0, 0x7b, 0x80, 0x0, 0xf, 0xc0,
+    0x0, 0x2, 0xe0, 0x0, 0x0, 0xb4, 0x0, 0x10,
+    0x78, 0x0, 0xf, 0xbd, 0x0, 0x2, 0xf9, 0x0,
+    0x0,
+
+    /* U+007A "z" */
+    0x3f, 0xff, 0xe2, 0xaa, 0xbd, 0x0, 0xb, 0x80,
+    0x1, 0xe0, 0x0, 0x7c, 0x0, 0xf, 0x40, 0x2,
+    0xd0, 0x0, 0x78, 0x0, 0x1f, 0x0, 0x3, 0xea,
+    0xa9, 0x7f, 0xff, 0xe0,
+
+    /* U+0020 " " */
+
+    /* U+0025 "%" */
+    0xb, 0xe0, 0x0, 0xe0, 0xb, 0x5e, 0x0, 0xb0,
+    0x3, 0x41, 0xc0, 0x74, 0x1, 0xc0, 0x34, 0x38,
+    0x0, 0x34, 0x1c, 0x2c, 0x0, 0xa, 0xa, 0x1d,
+    0x0, 0x0, 0xbe, 0xe, 0x2f, 0x40, 0x0, 0xb,
+    0x2d, 0x74, 0x0, 0x7, 0x4d, 0x7, 0x0, 0x3,
+    0x47, 0x1, 0xc0, 0x2, 0x81, 0xc0, 0x70, 0x1,
+    0xc0, 0x30, 0x1c, 0x0, 0xd0, 0xa, 0x1d, 0x0,
+    0xa0, 0x0, 0xbe, 0x0,
+
+    /* U+0028 "(" */
+    0x3, 0xc0, 0x74, 0xf, 0x1, 0xe0, 0x2d, 0x2,
+    0xc0, 0x3c, 0x3, 0xc0, 0x3c, 0x3, 0x80, 0x3c,
+    0x3, 0xc0, 0x3c, 0x2, 0xc0, 0x2d, 0x1, 0xe0,
+    0xf, 0x0, 0x74, 0x3, 0xc0,
+
+    /* U+0029 ")" */
+    0x38, 0xb, 0x41, 0xe0, 0x3c, 0xb, 0x41, 0xd0,
+    0x78, 0xe, 0x3, 0x80, 0xf0, 0x38, 0xe, 0x7,
+    0x81, 0xd0, 0xb4, 0x3c, 0x1e, 0xb, 0x43, 0x80,
+
+    /* U+003E ">" */
+    0x50, 0x0, 0xb, 0xd0, 0x0, 0x1f, 0xe4, 0x0,
+    0x1b, 0xe4, 0x0, 0x7, 0xd0, 0x1, 0xbd, 0x6,
+    0xfd, 0x7, 0xf9, 0x0, 0xb4, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+00B0 "°" */
+    0x7, 0xe0, 0x1d, 0x68, 0x34, 0xd, 0x30, 0x9,
+    0x34, 0xd, 0x28, 0x2c, 0xb, 0xe0, 0x0, 0x0
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 186, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 25, .adv_w = 73, .box_w = 4, .box_h = 6, .ofs_x = 0, .ofs_y = -3},
+    {.bitmap_index = 31, .adv_w = 123, .box_w = 6, .box_h = 2, .ofs_x = 1, .ofs_y = 5},
+    {.bitmap_index = 34, .adv_w = 73, .box_w = 4, .box_h = 3, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 37, .adv_w = 113, .box_w = 9, .box_h = 20, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 82, .adv_w = 213, .box_w = 13, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 128, .adv_w = 118, .box_w = 6, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 149, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 188, .adv_w = 183, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 227, .adv_w = 214, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 276, .adv_w = 184, .box_w = 11, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 315, .adv_w = 197, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 357, .adv_w = 191, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 399, .adv_w = 206, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 441, .adv_w = 197, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 483, .adv_w = 73, .box_w = 4, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 494, .adv_w = 234, .box_w = 16, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 550, .adv_w = 242, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 596, .adv_w = 231, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 645, .adv_w = 264, .box_w = 14, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 694, .adv_w = 214, .box_w = 11, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 733, .adv_w = 203, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 768, .adv_w = 247, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 817, .adv_w = 260, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 863, .adv_w = 99, .box_w = 3, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 874, .adv_w = 230, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 920, .adv_w = 190, .box_w = 10, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 955, .adv_w = 306, .box_w = 15, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1008, .adv_w = 260, .box_w = 13, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1054, .adv_w = 269, .box_w = 16, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1110, .adv_w = 231, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1152, .adv_w = 233, .box_w = 12, .box_h = 14, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1194, .adv_w = 199, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1236, .adv_w = 188, .box_w = 12, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1278, .adv_w = 253, .box_w = 13, .box_h = 14, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1324, .adv_w = 228, .box_w = 16, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1380, .adv_w = 360, .box_w = 22, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1457, .adv_w = 215, .box_w = 14, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1506, .adv_w = 207, .box_w = 15, .box_h = 14, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1559, .adv_w = 191, .box_w = 10, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1587, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1632, .adv_w = 183, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1663, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1708, .adv_w = 196, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1741, .adv_w = 113, .box_w = 8, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1771, .adv_w = 221, .box_w = 12, .box_h = 15, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 1816, .adv_w = 218, .box_w = 11, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1858, .adv_w = 89, .box_w = 4, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1873, .adv_w = 197, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1918, .adv_w = 89, .box_w = 3, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1930, .adv_w = 338, .box_w = 19, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1983, .adv_w = 218, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2014, .adv_w = 203, .box_w = 12, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2047, .adv_w = 218, .box_w = 12, .box_h = 15, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2092, .adv_w = 131, .box_w = 7, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2112, .adv_w = 160, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2140, .adv_w = 132, .box_w = 8, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2168, .adv_w = 217, .box_w = 11, .box_h = 11, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2199, .adv_w = 179, .box_w = 13, .box_h = 11, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2235, .adv_w = 288, .box_w = 18, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2285, .adv_w = 177, .box_w = 11, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2316, .adv_w = 179, .box_w = 13, .box_h = 15, .ofs_x = -1, .ofs_y = -4},
+    {.bitmap_index = 2365, .adv_w = 167, .box_w = 10, .box_h = 11, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2393, .adv_w = 86, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2393, .adv_w = 270, .box_w = 17, .box_h = 14, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2453, .adv_w = 108, .box_w = 6, .box_h = 19, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 2482, .adv_w = 108, .box_w = 5, .box_h = 19, .ofs_x = 0, .ofs_y = -4},
+    {.bitmap_index = 2506, .adv_w = 186, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 2},
+    {.bitmap_index = 2531, .adv_w = 134, .box_w = 8, .box_h = 8, .ofs_x = 0, .ofs_y = 7}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_7[] = {
+    0x0, 0x5, 0x8, 0x9, 0x1e, 0x90
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 43, .range_length = 16, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 65, .range_length = 9, .glyph_id_start = 17,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 75, .range_length = 6, .glyph_id_start = 26,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 82, .range_length = 8, .glyph_id_start = 32,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 97, .range_length = 9, .glyph_id_start = 40,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 107, .range_length = 6, .glyph_id_start = 49,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 114, .range_length = 9, .glyph_id_start = 55,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 32, .range_length = 145, .glyph_id_start = 64,
+        .unicode_list = unicode_list_7, .glyph_id_ofs_list = NULL, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 5, 6, 5, 6, 7, 8, 0,
+    9, 10, 11, 12, 13, 14, 15, 8,
+    16, 18, 19, 20, 17, 21, 22, 23,
+    24, 24, 26, 27, 24, 24, 17, 28,
+    29, 1, 30, 25, 31, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 34,
+    41, 42, 37, 34, 34, 35, 35, 43,
+    44, 45, 40, 46, 46, 47, 46, 48,
+    0, 2, 3, 4, 0, 49
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 5, 6, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 8, 14, 15, 16,
+    17, 19, 20, 18, 20, 20, 20, 18,
+    20, 20, 20, 20, 20, 20, 18, 20,
+    20, 1, 21, 22, 23, 23, 24, 25,
+    26, 27, 28, 28, 28, 0, 28, 27,
+    29, 27, 27, 30, 30, 28, 30, 30,
+    31, 32, 33, 34, 34, 35, 34, 36,
+    0, 2, 3, 4, 0, 37
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 0, 0, 0, 5, 6, 0, 0,
+    -3, 0, -2, 3, 0, -3, 0, -3,
+    -2, 0, 0, 0, -3, 0, 0, -4,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, -3, 0, -5, 0, -39, 0,
+    -6, 6, 10, 0, 0, -6, 3, 3,
+    11, 6, -5, 6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -9, 0, 0, 0, 0, 0, 0,
+    11, 0, 3, 0, 0, -6, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -12, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -12, 0, 0,
+    1, -2, 0, 2, -6, -4, -6, 2,
+    0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -20, 0, 0, -2, 0, 32,
+    -4, -4, 3, 3, -3, 0, -4, 3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -20, 0, 0,
+    0, 11, -22, -31, -22, -6, 10, 0,
+    0, -21, 0, 4, -7, 0, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 15, 0, 0, 0, 0, 2,
+    -4, -6, 0, -1, -1, -3, 0, 0,
+    -2, 0, 0, 0, 0, -3, 0, -6,
+    0, -8, -11, -11, 0, 0, 0, 0,
+    0, 0, 3, 0, 2, -3, 0, 1,
+    0, 3, 0, 0, -2, 3, 3, -1,
+    0, 0, 0, -6, 0, -1, 0, 0,
+    0, 0, 1, 0, -2, 0, -4, 0,
+    -5, 0, 0, -3, 0, 0, 0, 0,
+    -1, 1, -2, -2, 0, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, -2, -2,
+    0, -3, -4, 0, 0, 0, 0, 1,
+    0, -2, 0, -3, -3, -3, 0, 0,
+    0, 0, 0, 0, 0, 0, -2, -4,
+    0, -5, -2, -10, 0, 0, 3, 6,
+    9, 0, -8, -1, -4, 0, -1, -15,
+    3, -2, 2, 3, 0, 0, -17, 0,
+    -17, -3, -28, 9, 0, 4, 0, 0,
+    0, 1, 0, -6, -4, 0, -10, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    -2, -2, 0, -2, -4, 0, 0, 0,
+    0, 0, 0, -3, 0, -2, -4, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, -3, 0, -4, 0, -6, 0, 0,
+    2, 3, 3, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 2, 0,
+    -3, 0, -3, -2, -4, 0, 0, 3,
+    0, 0, 0, 0, 0, -4, -5, 0,
+    -6, -2, 1, 0, 0, -16, -17, -13,
+    -6, 3, 0, -3, -21, -6, 0, -6,
+    0, -6, -6, -20, 0, 0, 0, 2,
+    -1, 3, -12, 0, -16, -8, -8, -10,
+    -4, -9, -1, -6, -9, 2, 0, -3,
+    0, 0, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, -3, 0, -5, -7, -7, 0,
+    0, 0, 0, 0, 0, 0, 0, 1,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 15, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 2, -6, -6, 0,
+    -3, -3, -4, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, -3, 0, -7, -8,
+    -10, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, -4, 0, 3, 0, 0, 0,
+    0, -6, 11, 10, -3, -13, 0, 3,
+    -5, 0, -16, -2, -4, 3, -3, 4,
+    0, -11, -5, -12, -11, -13, 0, 0,
+    -2, 0, 0, -2, -2, -3, -9, -11,
+    -1, -30, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    -2, -3, -5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, -1, 4, 0, -7, 3,
+    -2, -1, -8, -3, 0, -4, -3, -2,
+    -5, -5, 0, -3, -1, -2, -5, -4,
+    -2, 0, -7, 0, 0, -6, 0, -5,
+    0, -5, -5, 3, 0, 0, 0, 0,
+    -6, 3, 0, -4, 0, -2, -4, -10,
+    -2, -2, -2, -1, -2, -1, 0, 0,
+    0, 0, -3, -3, -3, -2, 0, -2,
+    0, 0, -2, -4, -2, -3, -4, -3,
+    0, -1, 0, 0, -2, 0, -3, -13,
+    -4, 5, 0, 0, -15, -5, 3, -5,
+    2, 0, -3, -10, 0, 2, 0, 0,
+    -5, 0, -6, 0, -5, -3, -3, -3,
+    0, -5, 2, -6, -5, 10, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, -4, 0, 0, -3,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, -5, 0, 0,
+    0, -11, 0, 2, -7, 6, 1, -2,
+    -15, 0, 0, -7, -3, 0, -8, -9,
+    0, -14, -3, -13, -12, -15, -4, 0,
+    -7, -3, -3, -5, -9, -6, -12, -13,
+    -7, -3, -2, 0, 0, 0, -3, 10,
+    7, -7, -12, 0, 1, -10, 0, -16,
+    -2, -3, 6, -4, 1, 0, -21, -4,
+    -17, -3, -23, 1, 0, -2, 0, 0,
+    0, -2, -2, -12, -2, 0, -21, 0,
+    0, 0, -3, -1, -9, -15, 0, 0,
+    -2, -5, -10, -3, 0, -2, 0, 0,
+    0, -14, -3, -10, -3, -5, -8, -3,
+    -5, 0, -4, -6, -6, 0, 2, 0,
+    -2, -11, 0, 6, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, -2, -6,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, -6, -3, -2, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    5, -3, 0, -5, 0, -11, -10, -6,
+    -6, 13, 6, 3, -28, -2, 6, -3,
+    0, -3, -3, -11, 0, 3, -4, -3,
+    -10, -3, -9, 0, -18, -4, -4, -12,
+    1, -4, -11, -11, -3, 13, -5, 0,
+    0, 3, -7, -12, -13, -8, 10, 0,
+    1, -23, -3, 3, -5, -2, -7, -7,
+    -12, -5, -3, 0, 0, -7, -7, -18,
+    0, -18, -4, -11, -19, -1, -10, -5,
+    -11, -9, 9, -4, 0, -3, 0, -6,
+    0, 5, -11, 3, 0, 0, -17, 0,
+    -3, -7, -5, -2, -8, -11, -7, -10,
+    -3, -7, -6, -10, -5, 0, -10, -3,
+    -3, -6, -7, -9, -9, -12, -4, -6,
+    -5, 0, -4, 2, -10, -12, -6, -11,
+    11, -3, 2, -30, -6, 6, -7, -5,
+    -12, -10, -13, -4, -3, -3, -7, -10,
+    -1, -21, 0, -19, -7, -12, -22, -6,
+    -11, -13, -16, -11, 6, 0, -9, 0,
+    0, 0, 0, 0, 0, -7, -2, 0,
+    0, 0, -7, 0, -4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, -3, 0,
+    0, -6, 0, -9, 0, 0, 3, -4,
+    0, 0, -9, -3, -7, 0, 0, -9,
+    0, -3, 0, 0, -4, 0, -26, -6,
+    -13, -4, -12, -2, 0, 0, 0, 0,
+    0, 0, 0, -5, -6, -3, -5, 0,
+    0, 0, -7, -4, 6, 0, -2, -7,
+    -2, -5, -6, 0, -4, -2, -2, 2,
+    -1, 0, 0, -28, -3, -4, 0, -7,
+    0, -2, -3, 0, 0, 0, 2, 0,
+    -2, -5, -2, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, -2, 0, 0, 3, 0, 0,
+    0, -9, -3, -6, 0, 0, -9, 0,
+    -3, 0, 0, 0, 0, -31, 0, -6,
+    -12, -16, -5, 0, 0, 0, 0, 0,
+    0, 0, -3, -5, -2, -5, 0, 5,
+    0, 10, -3, -3, -10, 4, 16, 5,
+    7, -9, 4, 13, 4, 9, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    0, -3, 26, 26, 0, 0, 0, 3,
+    0, 0, 12, -5, 0, 0, 0, 0,
+    0, 0, 0, -2, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -27,
+    -4, -3, -13, -16, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -27, -4, -3, -13,
+    -16, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -7, 3, 0, -3, 3, 6, 3,
+    -10, 0, -1, -3, 3, 0, 0, 0,
+    0, -8, 0, -3, -2, -6, -3, 0,
+    -7, -2, -2, -5, 0, -3, -9, -6,
+    -4, 0, -5, 0, -4, -3, -3, -3,
+    -13, 1, -2, 1, -2, -9, 1, 7,
+    1, 3, 1, -8, -13, -4, -12, -6,
+    -9, -13, -12, -3, -2, -4, -2, -2,
+    -1, 5, 0, 5, -2, 0, 10, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    -3, -3, 0, 0, -9, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, -3, 0, -4, 0, 0, 0, 0,
+    -3, 3, 0, -5, -6, -2, 0, -9,
+    -2, -7, -2, -4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -6,
+    0, 0, 0, -4, 0, -3, 0, 0,
+    -2, -2, 0, 0, 0, -4, -11, -10,
+    2, 4, 4, -1, -9, 2, 5, 2,
+    10, 2, -2, -9, 0, -13, 0, 0,
+    -10, -9, -5, 0, -5, 0, 0, -2,
+    5, 0, -3, -10, -3, 12, -3, 0,
+    0, 0, -7, 0, 3, -3, 3, 0,
+    0, -11, 0, -2, -1, 0, -3, -3,
+    0, 0, -13, -4, -7, 0, -10, -3,
+    0, -6, 0, 0, -3, 0, -3, -10,
+    0, -3, 3, 0, 0, 0, 0, -4,
+    1, 0, 0, -4, -2, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    0, 0, 1, 0, -3, -3, 0, 0,
+    0, 7, 0, 0, 0, -20, -18, 1,
+    14, 10, 5, -13, 2, 13, 0, 12,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 49,
+    .right_class_cnt     = 37,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 8,
+    .bpp = 2,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_montserrat_20 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 22,          /*The maximum line height required by the font*/
+    .base_line = 4,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -1,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_16,   /*Characters outside the subset*/
+};
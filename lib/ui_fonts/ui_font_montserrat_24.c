@@ -0,0 +1,1497 @@
+/*******************************************************************************
+ * Size: 24 px
+ * Bpp: 4
+ * Opts: generated by generate_ui_fonts.py from lv_font_montserrat_24.c, plain
+ * Characters:  %()+,-./0123456789:>ABCDEFGHIKLMNOPRSTUVWXYabcdefghiklmnoprstuvwxyz°
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+002B "+" */
+    0x0, 0x0, 0xa, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x6f, 0xff,
+    0xff, 0xff, 0xff, 0xf5, 0x5e, 0xee, 0xef, 0xfe,
+    0xee, 0xe5, 0x0, 0x0, 0xf, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf0,
+    0x0, 0x0,
+
+    /* U+002C "," */
+    0x3b, 0x80, 0xcf, 0xf3, 0xaf, 0xf3, 0xf, 0xe0,
+    0x1f, 0x90, 0x5f, 0x40, 0x9e, 0x0,
+
+    /* U+002D "-" */
+    0x0, 0x0, 0x0, 0xa, 0xff, 0xff, 0xfd, 0xaf,
+    0xff, 0xff, 0xd0,
+
+    /* U+002E "." */
+    0x4, 0x10, 0x9f, 0xf1, 0xdf, 0xf4, 0x6f, 0xb0,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0,
+    0x0, 0x4f, 0xd0, 0x0, 0x0, 0x0, 0x9, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x20, 0x0, 0x0,
+    0x0, 0x4f, 0xc0, 0x0, 0x0, 0x0, 0xa, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x5f, 0xc0, 0x0, 0x0, 0x0, 0xa, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x5f, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xf6,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x6f, 0xb0, 0x0, 0x0, 0x0, 0xb, 0xf5,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xa0, 0x0, 0x0, 0x0, 0xc, 0xf5,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0xd, 0xf4,
+    0x0, 0x0, 0x0, 0x2, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0x90, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x1, 0x8d, 0xff, 0xd8, 0x10, 0x0, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x1, 0xff,
+    0xe7, 0x33, 0x7e, 0xff, 0x10, 0xb, 0xfe, 0x20,
+    0x0, 0x2, 0xef, 0xb0, 0x2f, 0xf5, 0x0, 0x0,
+    0x0, 0x5f, 0xf2, 0x7f, 0xe0, 0x0, 0x0, 0x0,
+    0xe, 0xf7, 0xaf, 0xb0, 0x0, 0x0, 0x0, 0xb,
+    0xfa, 0xcf, 0x90, 0x0, 0x0, 0x0, 0x9, 0xfc,
+    0xdf, 0x80, 0x0, 0x0, 0x0, 0x8, 0xfd, 0xcf,
+    0x90, 0x0, 0x0, 0x0, 0x9, 0xfc, 0xaf, 0xb0,
+    0x0, 0x0, 0x0, 0xb, 0xfa, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0xe, 0xf7, 0x2f, 0xf5, 0x0, 0x0,
+    0x0, 0x5f, 0xf2, 0xb, 0xfe, 0x10, 0x0, 0x2,
+    0xef, 0xb0, 0x1, 0xff, 0xe7, 0x33, 0x7e, 0xff,
+    0x10, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xe2, 0x0,
+    0x0, 0x1, 0x7c, 0xee, 0xc7, 0x10, 0x0,
+
+    /* U+0031 "1" */
+    0xdf, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf5, 0x11,
+    0x11, 0xff, 0x50, 0x0, 0xf, 0xf5, 0x0, 0x0,
+    0xff, 0x50, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xff,
+    0x50, 0x0, 0xf, 0xf5, 0x0, 0x0, 0xff, 0x50,
+    0x0, 0xf, 0xf5, 0x0, 0x0, 0xff, 0x50, 0x0,
+    0xf, 0xf5, 0x0, 0x0, 0xff, 0x50, 0x0, 0xf,
+    0xf5, 0x0, 0x0, 0xff, 0x50, 0x0, 0xf, 0xf5,
+    0x0, 0x0, 0xff, 0x50,
+
+    /* U+0032 "2" */
+    0x0, 0x17, 0xce, 0xfe, 0xc6, 0x0, 0x0, 0x7f,
+    0xff, 0xff, 0xff, 0xfc, 0x10, 0x6f, 0xfc, 0x63,
+    0x35, 0xbf, 0xfa, 0x0, 0x97, 0x0, 0x0, 0x0,
+    0xaf, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xc0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xd1,
+    0x0, 0x0, 0x0, 0x2, 0xef, 0xd1, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xc1, 0x0, 0x0, 0x0, 0x3,
+    0xef, 0xc0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xc2, 0x11, 0x11,
+    0x11, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+
+    /* U+0033 "3" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xe0, 0x1, 0x11, 0x11,
+    0x11, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xfe, 0x20, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xfc, 0x71, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x15, 0xef,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x81, 0xa1, 0x0, 0x0,
+    0x0, 0x4f, 0xf5, 0x9f, 0xfa, 0x53, 0x34, 0x9f,
+    0xfd, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x20,
+    0x0, 0x49, 0xdf, 0xfe, 0xb6, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xe1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xfd, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0x60, 0x0, 0x9d, 0x70, 0x0,
+    0x0, 0x1e, 0xfa, 0x0, 0x0, 0xbf, 0x90, 0x0,
+    0x0, 0xbf, 0xd0, 0x0, 0x0, 0xbf, 0x90, 0x0,
+    0x7, 0xff, 0x41, 0x11, 0x11, 0xbf, 0x91, 0x11,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x90, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xff, 0xf0, 0x0, 0xbf, 0x81,
+    0x11, 0x11, 0x11, 0x0, 0xd, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x31, 0x10, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0xff, 0xfe, 0xa3, 0x0, 0x5, 0xff, 0xff, 0xff,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x26, 0xdf,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xd0, 0x93, 0x0, 0x0,
+    0x0, 0x1e, 0xfa, 0x5f, 0xfb, 0x63, 0x24, 0x7e,
+    0xff, 0x31, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x50,
+    0x0, 0x28, 0xce, 0xfe, 0xc8, 0x10, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xb5, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0x10, 0x0, 0xcf,
+    0xf9, 0x42, 0x23, 0x76, 0x0, 0x8, 0xfe, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xa0, 0x5b, 0xef, 0xd9, 0x30,
+    0x0, 0xbf, 0x9a, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0xdf, 0xff, 0xc4, 0x1, 0x4c, 0xff, 0x40, 0xcf,
+    0xfc, 0x0, 0x0, 0x0, 0xcf, 0xc0, 0xbf, 0xf5,
+    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x8f, 0xf2, 0x0,
+    0x0, 0x0, 0x3f, 0xf1, 0x4f, 0xf4, 0x0, 0x0,
+    0x0, 0x4f, 0xf0, 0xd, 0xfc, 0x0, 0x0, 0x0,
+    0xbf, 0xb0, 0x4, 0xff, 0xc3, 0x0, 0x3b, 0xff,
+    0x30, 0x0, 0x5f, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x1, 0x8d, 0xff, 0xd9, 0x20, 0x0,
+
+    /* U+0037 "7" */
+    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x4f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x4f, 0xf2,
+    0x11, 0x11, 0x11, 0x8f, 0xf1, 0x4f, 0xf0, 0x0,
+    0x0, 0x0, 0xef, 0x90, 0x4f, 0xf0, 0x0, 0x0,
+    0x5, 0xff, 0x20, 0x2, 0x20, 0x0, 0x0, 0xc,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x6, 0xbe, 0xff, 0xd9, 0x20, 0x0, 0x2,
+    0xdf, 0xff, 0xff, 0xff, 0xf7, 0x0, 0xd, 0xff,
+    0x71, 0x0, 0x4b, 0xff, 0x40, 0x3f, 0xf5, 0x0,
+    0x0, 0x0, 0xcf, 0xa0, 0x4f, 0xf1, 0x0, 0x0,
+    0x0, 0x9f, 0xc0, 0x2f, 0xf5, 0x0, 0x0, 0x0,
+    0xdf, 0x90, 0xa, 0xff, 0x72, 0x1, 0x4c, 0xff,
+    0x20, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xd3, 0x0,
+    0x4, 0xdf, 0xff, 0xef, 0xff, 0xf8, 0x0, 0x2f,
+    0xfc, 0x40, 0x0, 0x18, 0xff, 0x90, 0xaf, 0xd0,
+    0x0, 0x0, 0x0, 0x6f, 0xf2, 0xdf, 0x80, 0x0,
+    0x0, 0x0, 0xf, 0xf5, 0xdf, 0x80, 0x0, 0x0,
+    0x0, 0x1f, 0xf5, 0xaf, 0xe1, 0x0, 0x0, 0x0,
+    0x8f, 0xf2, 0x3f, 0xfd, 0x51, 0x0, 0x3a, 0xff,
+    0xa0, 0x5, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x0,
+    0x0, 0x17, 0xce, 0xff, 0xd9, 0x40, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x4, 0xae, 0xfe, 0xc7, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xe2, 0x0, 0x8, 0xff,
+    0x82, 0x0, 0x4c, 0xfe, 0x10, 0x1f, 0xf6, 0x0,
+    0x0, 0x0, 0xcf, 0xa0, 0x3f, 0xf0, 0x0, 0x0,
+    0x0, 0x6f, 0xf1, 0x4f, 0xf0, 0x0, 0x0, 0x0,
+    0x6f, 0xf5, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0xcf,
+    0xf8, 0xa, 0xff, 0x82, 0x0, 0x4c, 0xff, 0xf9,
+    0x0, 0xcf, 0xff, 0xff, 0xff, 0x9c, 0xfa, 0x0,
+    0x6, 0xbe, 0xfe, 0xa4, 0xd, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x50, 0x0, 0xa7, 0x31, 0x25, 0xcf, 0xf9,
+    0x0, 0x3, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x7b, 0xdf, 0xec, 0x82, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x5f, 0xb0, 0xdf, 0xf4, 0x9f, 0xf1, 0x4, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x10, 0x9f, 0xf1, 0xdf, 0xf4,
+    0x6f, 0xb0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0x5d, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xe0, 0x6f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xf7, 0x0, 0xef, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x8, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0,
+    0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf3,
+    0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0xa,
+    0xfc, 0x0, 0x0, 0x4, 0xff, 0x30, 0x0, 0x0,
+    0x2, 0xff, 0x50, 0x0, 0x0, 0xd, 0xfa, 0x0,
+    0x0, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x90, 0x0, 0x7, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x10, 0x0, 0xef, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf7, 0x0, 0x5f,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0,
+    0xc, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x50,
+
+    /* U+0042 "B" */
+    0x7f, 0xff, 0xff, 0xff, 0xfe, 0xb6, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x7f,
+    0xe0, 0x0, 0x0, 0x2, 0x9f, 0xfa, 0x7, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf0, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x7, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xd0, 0x7f, 0xe0, 0x0,
+    0x0, 0x2, 0x9f, 0xf5, 0x7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf6, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xd4, 0x7, 0xfe, 0x0, 0x0, 0x0,
+    0x14, 0xcf, 0xf3, 0x7f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xa7, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xfd, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xe7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xfc, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x3b, 0xff,
+    0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xd9, 0x30, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xda, 0x50, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x30,
+    0x0, 0x5f, 0xff, 0xb6, 0x43, 0x59, 0xff, 0xf2,
+    0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x1c, 0x80,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x1c, 0x80,
+    0x0, 0x5f, 0xff, 0xb5, 0x33, 0x49, 0xff, 0xf2,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x5, 0xae, 0xff, 0xda, 0x50, 0x0,
+
+    /* U+0044 "D" */
+    0x7f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
+    0x0, 0x7f, 0xe1, 0x11, 0x12, 0x36, 0xbf, 0xff,
+    0x40, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4e,
+    0xfe, 0x20, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfb, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf2, 0x7f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0x77, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xf9, 0x7f, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xa7, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xf9, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0x77, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf2, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfb, 0x7, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x3e, 0xfe, 0x20, 0x7f,
+    0xe1, 0x11, 0x11, 0x35, 0xbf, 0xff, 0x40, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x7f, 0xff, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
+    0x0,
+
+    /* U+0045 "E" */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x7f, 0xe1, 0x11,
+    0x11, 0x11, 0x11, 0x7, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x50, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x7, 0xfe, 0x11, 0x11, 0x11, 0x11,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xe1, 0x11, 0x11, 0x11,
+    0x11, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0,
+
+    /* U+0046 "F" */
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf6, 0x7f, 0xe1, 0x11,
+    0x11, 0x11, 0x11, 0x7, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xf5, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x50, 0x7f, 0xe1, 0x11, 0x11, 0x11, 0x10, 0x7,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0x50,
+    0x0, 0x5f, 0xff, 0xb6, 0x43, 0x48, 0xef, 0xf5,
+    0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0x9, 0xb0,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x90, 0x0, 0x0, 0x0, 0x0, 0x7, 0x94,
+    0xcf, 0xa0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0x5f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0xd, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0x3, 0xff, 0xd3, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0x0, 0x5f, 0xff, 0xb6, 0x32, 0x47, 0xdf, 0xf7,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x80,
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x71, 0x0,
+
+    /* U+0048 "H" */
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x7f,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf7, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0xfe, 0x11, 0x11, 0x11,
+    0x11, 0x17, 0xff, 0x7f, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf7, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf0,
+
+    /* U+0049 "I" */
+    0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7,
+    0xfe, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f,
+    0xe7, 0xfe, 0x7f, 0xe7, 0xfe, 0x7f, 0xe7, 0xfe,
+    0x7f, 0xe0,
+
+    /* U+004B "K" */
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x6, 0xff, 0x50,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x6f, 0xf6, 0x0,
+    0x7f, 0xe0, 0x0, 0x0, 0x5, 0xff, 0x60, 0x0,
+    0x7f, 0xe0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0,
+    0x7f, 0xe0, 0x0, 0x4, 0xff, 0x80, 0x0, 0x0,
+    0x7f, 0xe0, 0x0, 0x4f, 0xf9, 0x0, 0x0, 0x0,
+    0x7f, 0xe0, 0x3, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x7f, 0xe0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xe3, 0xef, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0xfd, 0xdf, 0xf2, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xd1, 0x2f, 0xfd, 0x10, 0x0, 0x0,
+    0x7f, 0xfe, 0x10, 0x4, 0xff, 0xb0, 0x0, 0x0,
+    0x7f, 0xf2, 0x0, 0x0, 0x6f, 0xf8, 0x0, 0x0,
+    0x7f, 0xe0, 0x0, 0x0, 0x8, 0xff, 0x50, 0x0,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0xbf, 0xf3, 0x0,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x10,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xc0,
+
+    /* U+004C "L" */
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xe1, 0x11, 0x11, 0x11,
+    0x11, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+
+    /* U+004D "M" */
+    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x67, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf6, 0x7f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x67, 0xff, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xf6, 0x7f, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x67,
+    0xfd, 0xbf, 0xb0, 0x0, 0x0, 0x0, 0xcf, 0x8e,
+    0xf6, 0x7f, 0xd2, 0xff, 0x40, 0x0, 0x0, 0x5f,
+    0xe0, 0xef, 0x67, 0xfd, 0x8, 0xfd, 0x0, 0x0,
+    0xe, 0xf6, 0xe, 0xf6, 0x7f, 0xd0, 0xe, 0xf7,
+    0x0, 0x8, 0xfc, 0x0, 0xef, 0x67, 0xfd, 0x0,
+    0x5f, 0xf1, 0x1, 0xff, 0x30, 0xe, 0xf6, 0x7f,
+    0xd0, 0x0, 0xbf, 0xa0, 0xaf, 0x90, 0x0, 0xef,
+    0x67, 0xfd, 0x0, 0x2, 0xff, 0x7f, 0xe1, 0x0,
+    0xe, 0xf6, 0x7f, 0xd0, 0x0, 0x8, 0xff, 0xf6,
+    0x0, 0x0, 0xef, 0x67, 0xfd, 0x0, 0x0, 0xe,
+    0xfd, 0x0, 0x0, 0xe, 0xf6, 0x7f, 0xd0, 0x0,
+    0x0, 0x5f, 0x40, 0x0, 0x0, 0xef, 0x67, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xf6,
+    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x60,
+
+    /* U+004E "N" */
+    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf7,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x7f,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x7f, 0xf7, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x7, 0xff, 0x7f, 0xfd,
+    0xfe, 0x20, 0x0, 0x0, 0x7f, 0xf7, 0xfe, 0x3f,
+    0xfd, 0x0, 0x0, 0x7, 0xff, 0x7f, 0xe0, 0x5f,
+    0xfa, 0x0, 0x0, 0x7f, 0xf7, 0xfe, 0x0, 0x8f,
+    0xf7, 0x0, 0x7, 0xff, 0x7f, 0xe0, 0x0, 0xbf,
+    0xf4, 0x0, 0x7f, 0xf7, 0xfe, 0x0, 0x1, 0xef,
+    0xe1, 0x7, 0xff, 0x7f, 0xe0, 0x0, 0x3, 0xff,
+    0xc0, 0x7f, 0xf7, 0xfe, 0x0, 0x0, 0x6, 0xff,
+    0xa7, 0xff, 0x7f, 0xe0, 0x0, 0x0, 0x9, 0xff,
+    0xdf, 0xf7, 0xfe, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xff, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0xf7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x2d, 0xff, 0xff, 0xff, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xb6, 0x33,
+    0x5a, 0xff, 0xf7, 0x0, 0x0, 0x3f, 0xfd, 0x30,
+    0x0, 0x0, 0x1, 0xcf, 0xf5, 0x0, 0xd, 0xfe,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1, 0x4,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x70, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xfc, 0xc, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xf0, 0xdf, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xc, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf0, 0x9f,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xfc,
+    0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x70, 0xd, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf1, 0x0, 0x3f, 0xfd, 0x30, 0x0,
+    0x0, 0x1, 0xcf, 0xf5, 0x0, 0x0, 0x5f, 0xff,
+    0xb5, 0x33, 0x59, 0xff, 0xf8, 0x0, 0x0, 0x0,
+    0x3d, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0, 0x0,
+
+    /* U+0050 "P" */
+    0x7f, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x7f,
+    0xe1, 0x11, 0x12, 0x49, 0xff, 0xe1, 0x7, 0xfe,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x9, 0xfe, 0x7, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x7, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xe0, 0x7f, 0xe0, 0x0, 0x0,
+    0x0, 0x3f, 0xf9, 0x7, 0xfe, 0x11, 0x11, 0x24,
+    0x8f, 0xfe, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x20, 0x7, 0xff, 0xff, 0xff, 0xfe, 0xb6,
+    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0052 "R" */
+    0x7f, 0xff, 0xff, 0xff, 0xeb, 0x60, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0, 0x7f,
+    0xe1, 0x11, 0x12, 0x49, 0xff, 0xe1, 0x7, 0xfe,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0x90, 0x7f, 0xe0,
+    0x0, 0x0, 0x0, 0x9, 0xfe, 0x7, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf0, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x7, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xe0, 0x7f, 0xe0, 0x0, 0x0,
+    0x0, 0x3f, 0xf8, 0x7, 0xfe, 0x11, 0x11, 0x13,
+    0x8f, 0xfe, 0x10, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x20, 0x7, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x0, 0x0, 0x7f, 0xe0, 0x0, 0x0, 0x7f, 0xf2,
+    0x0, 0x7, 0xfe, 0x0, 0x0, 0x0, 0xcf, 0xd0,
+    0x0, 0x7f, 0xe0, 0x0, 0x0, 0x1, 0xef, 0x90,
+    0x7, 0xfe, 0x0, 0x0, 0x0, 0x5, 0xff, 0x40,
+    0x7f, 0xe0, 0x0, 0x0, 0x0, 0x9, 0xfe, 0x10,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x6b, 0xef, 0xfd, 0xa5, 0x0, 0x0,
+    0x2e, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x0, 0xef,
+    0xe7, 0x21, 0x14, 0x8e, 0xc0, 0x6, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x20, 0x9, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xc3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xd9, 0x51, 0x0, 0x0,
+    0x0, 0x4, 0xbf, 0xff, 0xff, 0xc5, 0x0, 0x0,
+    0x0, 0x1, 0x59, 0xdf, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xaf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xfe, 0x5, 0x80, 0x0, 0x0, 0x0,
+    0xc, 0xfb, 0xd, 0xfe, 0x84, 0x21, 0x25, 0xcf,
+    0xf4, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x0, 0x4, 0x9d, 0xef, 0xec, 0x82, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x11,
+    0x13, 0xff, 0x51, 0x11, 0x11, 0x0, 0x0, 0x2,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0,
+
+    /* U+0055 "U" */
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x9a,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xaf,
+    0xc0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0x9a, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xf9, 0xaf, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0x9a, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xf9, 0xaf, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0x9a, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xf9, 0xaf, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0x99, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xf9, 0x9f, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x87, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xf6, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x20, 0xdf, 0xe1, 0x0, 0x0, 0x1, 0xef,
+    0xc0, 0x3, 0xff, 0xe7, 0x32, 0x38, 0xef, 0xf3,
+    0x0, 0x4, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x1, 0x7c, 0xef, 0xec, 0x71, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0xd, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xfe, 0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0x70, 0x0, 0xef, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf1, 0x0, 0x8, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0xc, 0xf9, 0x0, 0x0, 0x1f,
+    0xf8, 0x0, 0x0, 0x0, 0x4, 0xff, 0x20, 0x0,
+    0x0, 0xaf, 0xe0, 0x0, 0x0, 0x0, 0xbf, 0xb0,
+    0x0, 0x0, 0x3, 0xff, 0x50, 0x0, 0x0, 0x2f,
+    0xf4, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x0,
+    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3,
+    0x0, 0x0, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xa0, 0x0, 0x7f, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x10, 0xd, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xf8, 0x5, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0, 0xcf,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0057 "W" */
+    0x1f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xe0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0x10, 0xbf, 0xb0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x8f, 0xc0, 0x6, 0xff, 0x10, 0x0, 0x0,
+    0x5, 0xff, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xf6,
+    0x0, 0x1f, 0xf6, 0x0, 0x0, 0x0, 0xbf, 0xef,
+    0xe0, 0x0, 0x0, 0x3, 0xff, 0x10, 0x0, 0xbf,
+    0xb0, 0x0, 0x0, 0x1f, 0xf4, 0xff, 0x30, 0x0,
+    0x0, 0x8f, 0xc0, 0x0, 0x6, 0xff, 0x10, 0x0,
+    0x6, 0xfd, 0xc, 0xf8, 0x0, 0x0, 0xd, 0xf6,
+    0x0, 0x0, 0x1f, 0xf5, 0x0, 0x0, 0xbf, 0x70,
+    0x6f, 0xe0, 0x0, 0x3, 0xff, 0x10, 0x0, 0x0,
+    0xcf, 0xb0, 0x0, 0x1f, 0xf2, 0x1, 0xff, 0x30,
+    0x0, 0x8f, 0xc0, 0x0, 0x0, 0x6, 0xff, 0x0,
+    0x6, 0xfd, 0x0, 0xc, 0xf8, 0x0, 0xd, 0xf7,
+    0x0, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0xbf, 0x70,
+    0x0, 0x6f, 0xe0, 0x3, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0xcf, 0xb0, 0x1f, 0xf2, 0x0, 0x1, 0xff,
+    0x30, 0x8f, 0xc0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0x6, 0xfc, 0x0, 0x0, 0xb, 0xf8, 0xd, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf5, 0xcf, 0x70,
+    0x0, 0x0, 0x6f, 0xe3, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xcf, 0xf2, 0x0, 0x0, 0x1,
+    0xff, 0xbf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfc, 0x0, 0x0, 0x0, 0xb, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xf1, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xc0, 0x0, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0xe, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xe1,
+    0x3, 0xff, 0x80, 0x0, 0x0, 0x4, 0xff, 0x50,
+    0x0, 0x8f, 0xf3, 0x0, 0x0, 0x1e, 0xf9, 0x0,
+    0x0, 0xc, 0xfe, 0x10, 0x0, 0xbf, 0xd0, 0x0,
+    0x0, 0x2, 0xff, 0xa0, 0x6, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x5f, 0xf6, 0x2f, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xdf, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xff, 0x60, 0x0, 0x0,
+    0x0, 0x0, 0x1e, 0xfa, 0x9f, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xe1, 0xd, 0xfd, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0x40, 0x2, 0xff, 0x90, 0x0,
+    0x0, 0x2f, 0xf8, 0x0, 0x0, 0x6f, 0xf4, 0x0,
+    0x0, 0xdf, 0xd0, 0x0, 0x0, 0xb, 0xfe, 0x10,
+    0x9, 0xff, 0x20, 0x0, 0x0, 0x1, 0xef, 0xb0,
+    0x5f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7,
+
+    /* U+0059 "Y" */
+    0xc, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0x50, 0x3f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xb0, 0x0, 0x9f, 0xe0, 0x0, 0x0, 0x0, 0x4f,
+    0xf2, 0x0, 0x1, 0xef, 0x90, 0x0, 0x0, 0xd,
+    0xf8, 0x0, 0x0, 0x6, 0xff, 0x20, 0x0, 0x7,
+    0xfe, 0x0, 0x0, 0x0, 0xc, 0xfc, 0x0, 0x1,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x3f, 0xf5, 0x0,
+    0xaf, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xe0,
+    0x4f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0x9d, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0061 "a" */
+    0x0, 0x6b, 0xef, 0xfd, 0x81, 0x0, 0x2e, 0xff,
+    0xff, 0xff, 0xfe, 0x10, 0xe, 0xb5, 0x10, 0x27,
+    0xff, 0xb0, 0x1, 0x0, 0x0, 0x0, 0x6f, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0x0, 0x37,
+    0xaa, 0xaa, 0xaf, 0xf4, 0xa, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x6f, 0xf6, 0x10, 0x0, 0xf, 0xf4,
+    0xbf, 0x90, 0x0, 0x0, 0xf, 0xf4, 0xcf, 0x80,
+    0x0, 0x0, 0x5f, 0xf4, 0x8f, 0xe2, 0x0, 0x4,
+    0xff, 0xf4, 0x1d, 0xff, 0xcb, 0xdf, 0xdf, 0xf4,
+    0x1, 0x8d, 0xff, 0xd8, 0xe, 0xf4,
+
+    /* U+0062 "b" */
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0x70, 0x7c, 0xfe, 0xc7,
+    0x10, 0x0, 0xdf, 0x9d, 0xff, 0xff, 0xff, 0xe3,
+    0x0, 0xdf, 0xff, 0xa3, 0x12, 0x6e, 0xfe, 0x20,
+    0xdf, 0xf8, 0x0, 0x0, 0x1, 0xef, 0xa0, 0xdf,
+    0xe0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0xdf, 0x90,
+    0x0, 0x0, 0x0, 0x1f, 0xf3, 0xdf, 0x70, 0x0,
+    0x0, 0x0, 0xf, 0xf5, 0xdf, 0x90, 0x0, 0x0,
+    0x0, 0x1f, 0xf3, 0xdf, 0xe0, 0x0, 0x0, 0x0,
+    0x6f, 0xf1, 0xdf, 0xf8, 0x0, 0x0, 0x2, 0xef,
+    0xa0, 0xdf, 0xff, 0xa3, 0x12, 0x6e, 0xff, 0x20,
+    0xdf, 0x8d, 0xff, 0xff, 0xff, 0xe3, 0x0, 0xdf,
+    0x60, 0x7d, 0xfe, 0xc7, 0x10, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x3, 0xad, 0xfe, 0xc6, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xc1, 0x9, 0xff, 0x93, 0x12,
+    0x7f, 0xfa, 0x4f, 0xf6, 0x0, 0x0, 0x3, 0x91,
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
+    0x0, 0x0, 0x2, 0x91, 0x9, 0xff, 0x93, 0x12,
+    0x7f, 0xfa, 0x0, 0x9f, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x3, 0xad, 0xfe, 0xc6, 0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf3, 0x0, 0x5, 0xbe, 0xfe, 0x92,
+    0x2f, 0xf3, 0x1, 0xbf, 0xff, 0xff, 0xff, 0x7f,
+    0xf3, 0xb, 0xff, 0x93, 0x12, 0x7f, 0xff, 0xf3,
+    0x5f, 0xf6, 0x0, 0x0, 0x3, 0xff, 0xf3, 0xbf,
+    0xc0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0xdf, 0x70,
+    0x0, 0x0, 0x0, 0x3f, 0xf3, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x1f, 0xf3, 0xdf, 0x70, 0x0, 0x0,
+    0x0, 0x3f, 0xf3, 0xbf, 0xb0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x5f, 0xf5, 0x0, 0x0, 0x2, 0xff,
+    0xf3, 0xb, 0xff, 0x71, 0x0, 0x5e, 0xff, 0xf3,
+    0x1, 0xbf, 0xff, 0xef, 0xff, 0x7f, 0xf3, 0x0,
+    0x5, 0xbe, 0xfe, 0xa3, 0xf, 0xf3,
+
+    /* U+0065 "e" */
+    0x0, 0x5, 0xbe, 0xfd, 0xa3, 0x0, 0x0, 0xa,
+    0xff, 0xff, 0xff, 0xf8, 0x0, 0xa, 0xfe, 0x61,
+    0x2, 0x8f, 0xf7, 0x4, 0xff, 0x20, 0x0, 0x0,
+    0x5f, 0xf1, 0xaf, 0x90, 0x0, 0x0, 0x0, 0xcf,
+    0x6d, 0xfc, 0xbb, 0xbb, 0xbb, 0xbd, 0xf9, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0x60, 0x0, 0x0, 0x6,
+    0x0, 0xa, 0xff, 0xa3, 0x11, 0x4b, 0xf8, 0x0,
+    0x9, 0xff, 0xff, 0xff, 0xff, 0x40, 0x0, 0x3,
+    0xad, 0xff, 0xd8, 0x10, 0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x8d, 0xfe, 0xa1, 0x0, 0xb, 0xff,
+    0xff, 0xf0, 0x0, 0x4f, 0xf5, 0x0, 0x30, 0x0,
+    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
+    0x0, 0xaf, 0xff, 0xff, 0xff, 0x70, 0x9e, 0xff,
+    0xfe, 0xee, 0x60, 0x0, 0x7f, 0xd0, 0x0, 0x0,
+    0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
+    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0,
+    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0,
+    0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f,
+    0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
+    0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
+    0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x5, 0xbe, 0xfe, 0xa3, 0xd, 0xf5, 0x0,
+    0xbf, 0xff, 0xff, 0xff, 0x8d, 0xf5, 0xb, 0xff,
+    0x93, 0x12, 0x6e, 0xff, 0xf5, 0x4f, 0xf6, 0x0,
+    0x0, 0x1, 0xef, 0xf5, 0xbf, 0xc0, 0x0, 0x0,
+    0x0, 0x5f, 0xf5, 0xdf, 0x70, 0x0, 0x0, 0x0,
+    0xf, 0xf5, 0xff, 0x50, 0x0, 0x0, 0x0, 0xe,
+    0xf5, 0xdf, 0x70, 0x0, 0x0, 0x0, 0xf, 0xf5,
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x5f, 0xf5, 0x4f,
+    0xf6, 0x0, 0x0, 0x1, 0xef, 0xf5, 0xa, 0xff,
+    0xa3, 0x12, 0x6e, 0xff, 0xf5, 0x0, 0xbf, 0xff,
+    0xff, 0xff, 0x8f, 0xf5, 0x0, 0x5, 0xbe, 0xfe,
+    0xa3, 0xf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf1, 0x3, 0x10, 0x0, 0x0, 0x0, 0xaf,
+    0xd0, 0xd, 0xf9, 0x52, 0x11, 0x4b, 0xff, 0x50,
+    0xa, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0,
+    0x28, 0xce, 0xff, 0xd9, 0x30, 0x0,
+
+    /* U+0068 "h" */
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xf7, 0x18, 0xdf, 0xfc, 0x70, 0x0, 0xdf,
+    0xae, 0xff, 0xff, 0xff, 0xc0, 0xd, 0xff, 0xf8,
+    0x31, 0x4a, 0xff, 0x90, 0xdf, 0xf5, 0x0, 0x0,
+    0xa, 0xff, 0xd, 0xfc, 0x0, 0x0, 0x0, 0x3f,
+    0xf2, 0xdf, 0x80, 0x0, 0x0, 0x1, 0xff, 0x3d,
+    0xf7, 0x0, 0x0, 0x0, 0xf, 0xf4, 0xdf, 0x70,
+    0x0, 0x0, 0x0, 0xff, 0x4d, 0xf7, 0x0, 0x0,
+    0x0, 0xf, 0xf4, 0xdf, 0x70, 0x0, 0x0, 0x0,
+    0xff, 0x4d, 0xf7, 0x0, 0x0, 0x0, 0xf, 0xf4,
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0xff, 0x4d, 0xf7,
+    0x0, 0x0, 0x0, 0xf, 0xf4,
+
+    /* U+0069 "i" */
+    0xb, 0xf6, 0x2f, 0xfd, 0xb, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7,
+    0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7,
+    0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7, 0xd, 0xf7,
+    0xd, 0xf7, 0xd, 0xf7,
+
+    /* U+006B "k" */
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xf7, 0x0, 0x0, 0x3, 0xef, 0xa0, 0xdf,
+    0x70, 0x0, 0x3, 0xff, 0xb0, 0xd, 0xf7, 0x0,
+    0x4, 0xff, 0xb0, 0x0, 0xdf, 0x70, 0x5, 0xff,
+    0xb0, 0x0, 0xd, 0xf7, 0x6, 0xff, 0xb0, 0x0,
+    0x0, 0xdf, 0x77, 0xff, 0xf1, 0x0, 0x0, 0xd,
+    0xfe, 0xff, 0xff, 0xb0, 0x0, 0x0, 0xdf, 0xff,
+    0x87, 0xff, 0x70, 0x0, 0xd, 0xff, 0x70, 0xa,
+    0xff, 0x40, 0x0, 0xdf, 0x90, 0x0, 0xd, 0xfe,
+    0x10, 0xd, 0xf7, 0x0, 0x0, 0x2e, 0xfc, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0x4f, 0xf9, 0xd, 0xf7,
+    0x0, 0x0, 0x0, 0x7f, 0xf5,
+
+    /* U+006C "l" */
+    0xdf, 0x7d, 0xf7, 0xdf, 0x7d, 0xf7, 0xdf, 0x7d,
+    0xf7, 0xdf, 0x7d, 0xf7, 0xdf, 0x7d, 0xf7, 0xdf,
+    0x7d, 0xf7, 0xdf, 0x7d, 0xf7, 0xdf, 0x7d, 0xf7,
+    0xdf, 0x7d, 0xf7,
+
+    /* U+006D "m" */
+    0xdf, 0x61, 0x9d, 0xfe, 0xb5, 0x0, 0x7, 0xcf,
+    0xfd, 0x80, 0x0, 0xdf, 0xaf, 0xff, 0xff, 0xff,
+    0x92, 0xef, 0xff, 0xff, 0xfd, 0x10, 0xdf, 0xfe,
+    0x60, 0x3, 0xcf, 0xff, 0xfa, 0x20, 0x17, 0xff,
+    0xa0, 0xdf, 0xf3, 0x0, 0x0, 0xe, 0xff, 0xa0,
+    0x0, 0x0, 0x8f, 0xf0, 0xdf, 0xc0, 0x0, 0x0,
+    0x9, 0xff, 0x20, 0x0, 0x0, 0x2f, 0xf3, 0xdf,
+    0x80, 0x0, 0x0, 0x7, 0xff, 0x0, 0x0, 0x0,
+    0xf, 0xf4, 0xdf, 0x70, 0x0, 0x0, 0x6, 0xfe,
+    0x0, 0x0, 0x0, 0xf, 0xf4, 0xdf, 0x70, 0x0,
+    0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xf4,
+    0xdf, 0x70, 0x0, 0x0, 0x6, 0xfe, 0x0, 0x0,
+    0x0, 0xf, 0xf4, 0xdf, 0x70, 0x0, 0x0, 0x6,
+    0xfe, 0x0, 0x0, 0x0, 0xf, 0xf4, 0xdf, 0x70,
+    0x0, 0x0, 0x6, 0xfe, 0x0, 0x0, 0x0, 0xf,
+    0xf4, 0xdf, 0x70, 0x0, 0x0, 0x6, 0xfe, 0x0,
+    0x0, 0x0, 0xf, 0xf4, 0xdf, 0x70, 0x0, 0x0,
+    0x6, 0xfe, 0x0, 0x0, 0x0, 0xf, 0xf4,
+
+    /* U+006E "n" */
+    0xdf, 0x61, 0x8d, 0xff, 0xc7, 0x0, 0xd, 0xf9,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0xdf, 0xff, 0x61,
+    0x2, 0x8f, 0xf9, 0xd, 0xff, 0x40, 0x0, 0x0,
+    0x9f, 0xf0, 0xdf, 0xc0, 0x0, 0x0, 0x3, 0xff,
+    0x2d, 0xf8, 0x0, 0x0, 0x0, 0x1f, 0xf3, 0xdf,
+    0x70, 0x0, 0x0, 0x0, 0xff, 0x4d, 0xf7, 0x0,
+    0x0, 0x0, 0xf, 0xf4, 0xdf, 0x70, 0x0, 0x0,
+    0x0, 0xff, 0x4d, 0xf7, 0x0, 0x0, 0x0, 0xf,
+    0xf4, 0xdf, 0x70, 0x0, 0x0, 0x0, 0xff, 0x4d,
+    0xf7, 0x0, 0x0, 0x0, 0xf, 0xf4, 0xdf, 0x70,
+    0x0, 0x0, 0x0, 0xff, 0x40,
+
+    /* U+006F "o" */
+    0x0, 0x4, 0xad, 0xfe, 0xb5, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xff, 0xc1, 0x0, 0xa, 0xff,
+    0x93, 0x12, 0x7f, 0xfd, 0x0, 0x4f, 0xf6, 0x0,
+    0x0, 0x3, 0xff, 0x80, 0xaf, 0xc0, 0x0, 0x0,
+    0x0, 0x8f, 0xe0, 0xdf, 0x70, 0x0, 0x0, 0x0,
+    0x3f, 0xf1, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1f,
+    0xf3, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x3f, 0xf1,
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0x8f, 0xe0, 0x4f,
+    0xf6, 0x0, 0x0, 0x3, 0xff, 0x80, 0xa, 0xff,
+    0x93, 0x12, 0x7f, 0xfd, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xc1, 0x0, 0x0, 0x4, 0xad, 0xfe,
+    0xb5, 0x0, 0x0,
+
+    /* U+0070 "p" */
+    0xdf, 0x61, 0x8d, 0xfe, 0xc7, 0x10, 0x0, 0xdf,
+    0x8e, 0xff, 0xff, 0xff, 0xe3, 0x0, 0xdf, 0xff,
+    0x92, 0x0, 0x5d, 0xfe, 0x20, 0xdf, 0xf7, 0x0,
+    0x0, 0x1, 0xef, 0xa0, 0xdf, 0xd0, 0x0, 0x0,
+    0x0, 0x5f, 0xf1, 0xdf, 0x90, 0x0, 0x0, 0x0,
+    0x1f, 0xf3, 0xdf, 0x70, 0x0, 0x0, 0x0, 0xf,
+    0xf5, 0xdf, 0x90, 0x0, 0x0, 0x0, 0x1f, 0xf3,
+    0xdf, 0xe0, 0x0, 0x0, 0x0, 0x6f, 0xf1, 0xdf,
+    0xf8, 0x0, 0x0, 0x2, 0xef, 0xa0, 0xdf, 0xff,
+    0xa3, 0x12, 0x6e, 0xff, 0x20, 0xdf, 0x9d, 0xff,
+    0xff, 0xff, 0xe3, 0x0, 0xdf, 0x70, 0x7c, 0xfe,
+    0xc7, 0x10, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0072 "r" */
+    0xdf, 0x61, 0x8d, 0xf0, 0xdf, 0x7e, 0xff, 0xf0,
+    0xdf, 0xff, 0xb5, 0x40, 0xdf, 0xf7, 0x0, 0x0,
+    0xdf, 0xd0, 0x0, 0x0, 0xdf, 0x90, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0, 0xdf, 0x70, 0x0, 0x0,
+    0xdf, 0x70, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x18, 0xcf, 0xfe, 0xb7, 0x10, 0x2, 0xef,
+    0xff, 0xff, 0xff, 0xb0, 0xb, 0xfe, 0x41, 0x2,
+    0x6c, 0x30, 0xf, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xd9, 0x52, 0x0, 0x0, 0x0, 0x8f, 0xff, 0xff,
+    0xe9, 0x10, 0x0, 0x0, 0x47, 0xad, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf3, 0x1, 0x0,
+    0x0, 0x0, 0xf, 0xf4, 0xe, 0xc6, 0x20, 0x3,
+    0xaf, 0xf1, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x60,
+    0x1, 0x7b, 0xef, 0xfd, 0x92, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
+    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0x70, 0x9e, 0xff, 0xfe, 0xee,
+    0x60, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f,
+    0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0,
+    0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xd0,
+    0x0, 0x0, 0x0, 0x7f, 0xd0, 0x0, 0x0, 0x0,
+    0x7f, 0xd0, 0x0, 0x0, 0x0, 0x7f, 0xe0, 0x0,
+    0x0, 0x0, 0x4f, 0xf7, 0x1, 0x50, 0x0, 0xc,
+    0xff, 0xff, 0xf1, 0x0, 0x0, 0x9e, 0xfd, 0x81,
+
+    /* U+0075 "u" */
+    0xff, 0x60, 0x0, 0x0, 0x4, 0xff, 0xf, 0xf6,
+    0x0, 0x0, 0x0, 0x4f, 0xf0, 0xff, 0x60, 0x0,
+    0x0, 0x4, 0xff, 0xf, 0xf6, 0x0, 0x0, 0x0,
+    0x4f, 0xf0, 0xff, 0x60, 0x0, 0x0, 0x4, 0xff,
+    0xf, 0xf6, 0x0, 0x0, 0x0, 0x4f, 0xf0, 0xff,
+    0x60, 0x0, 0x0, 0x4, 0xff, 0xe, 0xf6, 0x0,
+    0x0, 0x0, 0x5f, 0xf0, 0xdf, 0x80, 0x0, 0x0,
+    0x8, 0xff, 0xa, 0xfe, 0x0, 0x0, 0x1, 0xef,
+    0xf0, 0x3f, 0xfb, 0x20, 0x4, 0xdf, 0xff, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0x9f, 0xf0, 0x0, 0x4b,
+    0xef, 0xea, 0x32, 0xff, 0x0,
+
+    /* U+0076 "v" */
+    0xd, 0xf9, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30,
+    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
+    0xef, 0x60, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x8,
+    0xfd, 0x0, 0x0, 0x5, 0xfe, 0x0, 0x0, 0x2f,
+    0xf3, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0xbf,
+    0xa0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x4, 0xff,
+    0x10, 0x9, 0xfa, 0x0, 0x0, 0x0, 0xd, 0xf7,
+    0x1, 0xff, 0x30, 0x0, 0x0, 0x0, 0x6f, 0xe0,
+    0x7f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff, 0x5d,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0,
+    0x0, 0x0,
+
+    /* U+0077 "w" */
+    0xaf, 0x80, 0x0, 0x0, 0x5, 0xff, 0x0, 0x0,
+    0x0, 0xc, 0xf4, 0x5f, 0xd0, 0x0, 0x0, 0xb,
+    0xff, 0x50, 0x0, 0x0, 0x2f, 0xe0, 0xe, 0xf3,
+    0x0, 0x0, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x8f,
+    0x80, 0x9, 0xf9, 0x0, 0x0, 0x7f, 0xbf, 0xf1,
+    0x0, 0x0, 0xef, 0x20, 0x3, 0xfe, 0x0, 0x0,
+    0xcf, 0x4b, 0xf7, 0x0, 0x4, 0xfc, 0x0, 0x0,
+    0xdf, 0x40, 0x2, 0xfe, 0x5, 0xfc, 0x0, 0xa,
+    0xf6, 0x0, 0x0, 0x7f, 0xa0, 0x8, 0xf8, 0x0,
+    0xef, 0x20, 0xf, 0xf1, 0x0, 0x0, 0x2f, 0xf0,
+    0xe, 0xf2, 0x0, 0x9f, 0x80, 0x5f, 0xb0, 0x0,
+    0x0, 0xc, 0xf5, 0x4f, 0xc0, 0x0, 0x3f, 0xe0,
+    0xbf, 0x50, 0x0, 0x0, 0x6, 0xfb, 0xaf, 0x60,
+    0x0, 0xd, 0xf5, 0xfe, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xff, 0x0, 0x0, 0x7, 0xff, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xfa, 0x0, 0x0, 0x1,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf4,
+    0x0, 0x0, 0x0, 0xbf, 0xd0, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0x1e, 0xf8, 0x0, 0x0, 0x4, 0xff, 0x40, 0x4f,
+    0xf4, 0x0, 0x1, 0xef, 0x80, 0x0, 0x8f, 0xe1,
+    0x0, 0xbf, 0xb0, 0x0, 0x0, 0xcf, 0xb0, 0x7f,
+    0xe1, 0x0, 0x0, 0x1, 0xef, 0xaf, 0xf4, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x10, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xfb, 0x0, 0x0, 0x0, 0x4, 0xff, 0x5e,
+    0xf7, 0x0, 0x0, 0x1, 0xef, 0x80, 0x4f, 0xf3,
+    0x0, 0x0, 0xcf, 0xc0, 0x0, 0x8f, 0xe1, 0x0,
+    0x8f, 0xe1, 0x0, 0x0, 0xcf, 0xb0, 0x4f, 0xf4,
+    0x0, 0x0, 0x2, 0xff, 0x80,
+
+    /* U+0079 "y" */
+    0xd, 0xf9, 0x0, 0x0, 0x0, 0x1, 0xff, 0x30,
+    0x6f, 0xf0, 0x0, 0x0, 0x0, 0x7f, 0xc0, 0x0,
+    0xef, 0x60, 0x0, 0x0, 0xd, 0xf5, 0x0, 0x8,
+    0xfd, 0x0, 0x0, 0x4, 0xfe, 0x0, 0x0, 0x2f,
+    0xf4, 0x0, 0x0, 0xbf, 0x80, 0x0, 0x0, 0xbf,
+    0xb0, 0x0, 0x2f, 0xf1, 0x0, 0x0, 0x4, 0xff,
+    0x10, 0x8, 0xfa, 0x0, 0x0, 0x0, 0xd, 0xf8,
+    0x0, 0xef, 0x30, 0x0, 0x0, 0x0, 0x6f, 0xe0,
+    0x6f, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xef, 0x6c,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x8, 0xfe, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0xa4, 0x2, 0xcf, 0xb0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
+    0x8d, 0xfe, 0x91, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0xe, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xd, 0xee,
+    0xee, 0xee, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x1,
+    0xef, 0xa0, 0x0, 0x0, 0x0, 0xc, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0x40, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xb0, 0x0, 0x0,
+    0x0, 0xb, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x7f,
+    0xf2, 0x0, 0x0, 0x0, 0x4, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0xe, 0xff, 0xee, 0xee, 0xee, 0xe8,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xf9,
+
+    /* U+0020 " " */
+
+    /* U+0025 "%" */
+    0x0, 0x3c, 0xfe, 0x90, 0x0, 0x0, 0x0, 0x6f,
+    0x70, 0x0, 0x3, 0xfd, 0x78, 0xfb, 0x0, 0x0,
+    0x2, 0xfc, 0x0, 0x0, 0xb, 0xe1, 0x0, 0x6f,
+    0x40, 0x0, 0xc, 0xf2, 0x0, 0x0, 0xf, 0x90,
+    0x0, 0xf, 0x90, 0x0, 0x7f, 0x60, 0x0, 0x0,
+    0x1f, 0x70, 0x0, 0xe, 0xa0, 0x2, 0xfb, 0x0,
+    0x0, 0x0, 0xf, 0x80, 0x0, 0xf, 0x90, 0xc,
+    0xf1, 0x0, 0x0, 0x0, 0xd, 0xd0, 0x0, 0x3f,
+    0x60, 0x7f, 0x60, 0x0, 0x0, 0x0, 0x5, 0xf9,
+    0x24, 0xde, 0x2, 0xfb, 0x0, 0x1, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0xd3, 0xc, 0xe1, 0x8, 0xff,
+    0xe7, 0x0, 0x0, 0x1, 0x43, 0x0, 0x7f, 0x50,
+    0x9f, 0x85, 0xaf, 0x70, 0x0, 0x0, 0x0, 0x2,
+    0xfa, 0x2, 0xf8, 0x0, 0xb, 0xf0, 0x0, 0x0,
+    0x0, 0xd, 0xe1, 0x5, 0xf3, 0x0, 0x5, 0xf4,
+    0x0, 0x0, 0x0, 0x8f, 0x50, 0x6, 0xf1, 0x0,
+    0x3, 0xf5, 0x0, 0x0, 0x3, 0xfa, 0x0, 0x5,
+    0xf3, 0x0, 0x5, 0xf3, 0x0, 0x0, 0xd, 0xe1,
+    0x0, 0x1, 0xf8, 0x0, 0xa, 0xe0, 0x0, 0x0,
+    0x8f, 0x40, 0x0, 0x0, 0x8f, 0x84, 0x9f, 0x60,
+    0x0, 0x3, 0xfa, 0x0, 0x0, 0x0, 0x7, 0xdf,
+    0xd6, 0x0,
+
+    /* U+0028 "(" */
+    0x0, 0x2f, 0xf1, 0x0, 0x9f, 0x90, 0x1, 0xff,
+    0x20, 0x6, 0xfc, 0x0, 0xc, 0xf7, 0x0, 0xf,
+    0xf3, 0x0, 0x3f, 0xf0, 0x0, 0x6f, 0xd0, 0x0,
+    0x8f, 0xb0, 0x0, 0x9f, 0xa0, 0x0, 0xaf, 0x90,
+    0x0, 0xbf, 0x80, 0x0, 0xaf, 0x90, 0x0, 0x9f,
+    0xa0, 0x0, 0x8f, 0xb0, 0x0, 0x6f, 0xd0, 0x0,
+    0x3f, 0xf0, 0x0, 0xf, 0xf3, 0x0, 0xc, 0xf7,
+    0x0, 0x6, 0xfc, 0x0, 0x1, 0xff, 0x20, 0x0,
+    0x9f, 0x90, 0x0, 0x2f, 0xf1,
+
+    /* U+0029 ")" */
+    0xf, 0xf3, 0x0, 0x8, 0xfb, 0x0, 0x1, 0xff,
+    0x30, 0x0, 0xbf, 0x80, 0x0, 0x6f, 0xd0, 0x0,
+    0x1f, 0xf2, 0x0, 0xe, 0xf5, 0x0, 0xb, 0xf8,
+    0x0, 0x9, 0xfa, 0x0, 0x8, 0xfb, 0x0, 0x7,
+    0xfc, 0x0, 0x6, 0xfd, 0x0, 0x7, 0xfc, 0x0,
+    0x8, 0xfb, 0x0, 0x9, 0xfa, 0x0, 0xb, 0xf8,
+    0x0, 0xe, 0xf5, 0x0, 0x1f, 0xf2, 0x0, 0x6f,
+    0xd0, 0x0, 0xbf, 0x80, 0x1, 0xff, 0x30, 0x8,
+    0xfb, 0x0, 0xf, 0xf3, 0x0,
+
+    /* U+003E ">" */
+    0x47, 0x10, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfa,
+    0x40, 0x0, 0x0, 0x0, 0x18, 0xef, 0xfe, 0x71,
+    0x0, 0x0, 0x0, 0x4, 0xbf, 0xff, 0xb4, 0x0,
+    0x0, 0x0, 0x1, 0x7d, 0xff, 0xe3, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x1, 0x7d,
+    0xff, 0xe3, 0x0, 0x4, 0xaf, 0xff, 0xb4, 0x0,
+    0x18, 0xef, 0xfe, 0x71, 0x0, 0x0, 0x6f, 0xfb,
+    0x40, 0x0, 0x0, 0x0, 0x47, 0x10, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+00B0 "°" */
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xbf, 0xfb, 0x20,
+    0x1e, 0xc5, 0x5c, 0xe2, 0x9d, 0x0, 0x0, 0xda,
+    0xd8, 0x0, 0x0, 0x7e, 0xd7, 0x0, 0x0, 0x7e,
+    0xac, 0x0, 0x0, 0xcb, 0x3f, 0xa2, 0x2a, 0xf3,
+    0x4, 0xef, 0xfe, 0x40, 0x0, 0x2, 0x20, 0x0
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 223, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 66, .adv_w = 87, .box_w = 4, .box_h = 7, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 80, .adv_w = 147, .box_w = 7, .box_h = 3, .ofs_x = 1, .ofs_y = 6},
+    {.bitmap_index = 91, .adv_w = 87, .box_w = 4, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 99, .adv_w = 135, .box_w = 11, .box_h = 23, .ofs_x = -1, .ofs_y = -2},
+    {.bitmap_index = 226, .adv_w = 256, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 345, .adv_w = 142, .box_w = 7, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 405, .adv_w = 220, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 516, .adv_w = 220, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 627, .adv_w = 257, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 763, .adv_w = 220, .box_w = 13, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 874, .adv_w = 237, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 993, .adv_w = 230, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1112, .adv_w = 247, .box_w = 14, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1231, .adv_w = 237, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1350, .adv_w = 87, .box_w = 4, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1376, .adv_w = 281, .box_w = 19, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 1538, .adv_w = 291, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1666, .adv_w = 278, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1802, .adv_w = 317, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 1947, .adv_w = 257, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2058, .adv_w = 244, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2169, .adv_w = 296, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2305, .adv_w = 312, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2433, .adv_w = 119, .box_w = 3, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2459, .adv_w = 276, .box_w = 16, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2595, .adv_w = 228, .box_w = 13, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2706, .adv_w = 367, .box_w = 19, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2868, .adv_w = 312, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2996, .adv_w = 323, .box_w = 19, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3158, .adv_w = 277, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3286, .adv_w = 279, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3414, .adv_w = 238, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3533, .adv_w = 225, .box_w = 14, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3652, .adv_w = 304, .box_w = 15, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3780, .adv_w = 273, .box_w = 19, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 3942, .adv_w = 432, .box_w = 27, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4172, .adv_w = 258, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 4308, .adv_w = 248, .box_w = 17, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 4453, .adv_w = 230, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4531, .adv_w = 262, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4657, .adv_w = 219, .box_w = 12, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4735, .adv_w = 262, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4861, .adv_w = 235, .box_w = 13, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4946, .adv_w = 136, .box_w = 10, .box_h = 18, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5036, .adv_w = 265, .box_w = 14, .box_h = 18, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 5162, .adv_w = 262, .box_w = 13, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5279, .adv_w = 107, .box_w = 4, .box_h = 18, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5315, .adv_w = 237, .box_w = 13, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5432, .adv_w = 107, .box_w = 3, .box_h = 18, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5459, .adv_w = 406, .box_w = 22, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5602, .adv_w = 262, .box_w = 13, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5687, .adv_w = 244, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5778, .adv_w = 262, .box_w = 14, .box_h = 18, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 5904, .adv_w = 157, .box_w = 8, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5956, .adv_w = 192, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6034, .adv_w = 159, .box_w = 10, .box_h = 16, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6114, .adv_w = 260, .box_w = 13, .box_h = 13, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6199, .adv_w = 215, .box_w = 15, .box_h = 13, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6297, .adv_w = 345, .box_w = 22, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6440, .adv_w = 212, .box_w = 13, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6525, .adv_w = 215, .box_w = 15, .box_h = 18, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 6660, .adv_w = 200, .box_w = 12, .box_h = 13, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6738, .adv_w = 103, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6738, .adv_w = 324, .box_w = 20, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6908, .adv_w = 129, .box_w = 6, .box_h = 23, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 6977, .adv_w = 130, .box_w = 6, .box_h = 23, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 7046, .adv_w = 223, .box_w = 12, .box_h = 11, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 7112, .adv_w = 161, .box_w = 8, .box_h = 10, .ofs_x = 1, .ofs_y = 9}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_7[] = {
+    0x0, 0x5, 0x8, 0x9, 0x1e, 0x90
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 43, .range_length = 16, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 65, .range_length = 9, .glyph_id_start = 17,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 75, .range_length = 6, .glyph_id_start = 26,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 82, .range_length = 8, .glyph_id_start = 32,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 97, .range_length = 9, .glyph_id_start = 40,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 107, .range_length = 6, .glyph_id_start = 49,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 114, .range_length = 9, .glyph_id_start = 55,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 32, .range_length = 145, .glyph_id_start = 64,
+        .unicode_list = unicode_list_7, .glyph_id_ofs_list = NULL, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 5, 6, 5, 6, 7, 8, 0,
+    9, 10, 11, 12, 13, 14, 15, 8,
+    16, 18, 19, 20, 17, 21, 22, 23,
+    24, 24, 26, 27, 24, 24, 17, 28,
+    29, 1, 30, 25, 31, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 34,
+    41, 42, 37, 34, 34, 35, 35, 43,
+    44, 45, 40, 46, 46, 47, 46, 48,
+    0, 2, 3, 4, 0, 49
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 5, 6, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 8, 14, 15, 16,
+    17, 19, 20, 18, 20, 20, 20, 18,
+    20, 20, 20, 20, 20, 20, 18, 20,
+    20, 1, 21, 22, 23, 23, 24, 25,
+    26, 27, 28, 28, 28, 0, 28, 27,
+    29, 27, 27, 30, 30, 28, 30, 30,
+    31, 32, 33, 34, 34, 35, 34, 36,
+    0, 2, 3, 4, 0, 37
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 0, 0, 0, 7, 8, 0, 0,
+    -4, 0, -3, 4, 0, -4, 0, -4,
+    -2, 0, 0, 0, -4, 0, 0, -5,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, -4, 0, -6, 0, -46, 0,
+    -8, 8, 12, 0, 0, -8, 4, 4,
+    13, 8, -7, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -10, 0, 0, 0, 0, 0, 0,
+    13, 0, 4, 0, 0, -8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -14, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -14, 0, 0,
+    1, -3, 0, 3, -7, -5, -8, 3,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -24, 0, 0, -3, 0, 38,
+    -5, -5, 4, 4, -3, 0, -5, 4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -24, 0, 0,
+    0, 13, -26, -37, -26, -8, 12, 0,
+    0, -26, 0, 5, -9, 0, -6, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 18, 0, 0, 0, 0, 3,
+    -5, -8, 0, -1, -1, -4, 0, 0,
+    -3, 0, 0, 0, 0, -3, 0, -8,
+    0, -10, -13, -13, 0, 0, 0, 0,
+    0, 0, 4, 0, 3, -4, 0, 1,
+    0, 4, 0, 0, -3, 4, 4, -1,
+    0, 0, 0, -7, 0, -1, 0, 0,
+    0, 0, 1, 0, -3, 0, -5, 0,
+    -7, 0, 0, -4, 0, 0, 0, 0,
+    -1, 1, -3, -3, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, -2, -2,
+    0, -4, -5, 0, 0, 0, 0, 1,
+    0, -3, 0, -4, -4, -4, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, -5,
+    0, -6, -3, -12, 0, 0, 4, 8,
+    10, 0, -10, -1, -5, 0, -1, -18,
+    4, -3, 3, 4, 0, 0, -20, 0,
+    -20, -3, -33, 11, 0, 5, 0, 0,
+    0, 1, 0, -7, -5, 0, -12, 0,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    -2, -2, 0, -2, -5, 0, 0, 0,
+    0, 0, 0, -4, 0, -3, -5, -3,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, -3, 0, -5, 0, -8, 0, 0,
+    2, 4, 4, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 3, 0,
+    -4, 0, -4, -3, -5, 0, 0, 3,
+    0, 0, 0, 0, 0, -4, -6, 0,
+    -7, -3, 1, 0, 0, -19, -20, -16,
+    -8, 4, 0, -3, -25, -7, 0, -7,
+    0, -8, -7, -25, 0, 0, 0, 2,
+    -1, 3, -15, 0, -19, -9, -9, -12,
+    -5, -10, -1, -7, -10, 2, 0, -4,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, -4, 0, -7, -8, -8, 0,
+    0, 0, 0, 0, 0, 0, 0, 2,
+    -2, 0, 0, 0, 0, 0, 0, 0,
+    0, 18, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 3, -8, -8, 0,
+    -4, -4, -5, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, -4, 0, -8, -10,
+    -12, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, -5, 0, 4, 0, 0, 0,
+    0, -7, 13, 12, -3, -16, 0, 4,
+    -6, 0, -19, -2, -5, 4, -4, 5,
+    0, -13, -6, -14, -13, -16, 0, 0,
+    -2, 0, 0, -2, -2, -4, -10, -13,
+    -1, -36, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, 0,
+    -2, -4, -6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, -1, 5, 0, -8, 4,
+    -3, -1, -10, -4, 0, -5, -4, -3,
+    -6, -7, 0, -3, -1, -3, -7, -5,
+    -3, 0, -8, 0, 0, -8, 0, -7,
+    0, -7, -7, 4, 0, 0, 0, 0,
+    -8, 4, 0, -5, 0, -3, -5, -12,
+    -3, -3, -3, -1, -3, -1, 0, 0,
+    0, 0, -4, -3, -3, -3, 0, -3,
+    0, 0, -3, -5, -3, -3, -5, -3,
+    0, -1, 0, 0, -3, 0, -4, -16,
+    -5, 6, 0, 0, -18, -7, 4, -7,
+    3, 0, -3, -12, 0, 2, 0, 0,
+    -7, 0, -7, 0, -7, -4, -4, -4,
+    0, -7, 2, -7, -7, 12, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -3, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -6, 0, -5, 0, 0, -4,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, -6, 0, 0,
+    0, -13, 0, 3, -8, 8, 1, -3,
+    -18, 0, 0, -8, -4, 0, -10, -11,
+    0, -17, -4, -15, -15, -18, -5, 0,
+    -9, -4, -4, -7, -10, -7, -14, -16,
+    -9, -4, -3, 0, 0, 0, -3, 12,
+    8, -8, -14, 0, 1, -12, 0, -19,
+    -3, -4, 8, -5, 1, 0, -25, -5,
+    -20, -4, -28, 1, 0, -3, 0, 0,
+    0, -2, -3, -15, -3, 0, -25, 0,
+    0, 0, -3, -1, -11, -18, 0, 0,
+    -2, -6, -12, -4, 0, -3, 0, 0,
+    0, -17, -4, -12, -3, -7, -10, -4,
+    -6, 0, -5, -7, -7, 0, 2, 0,
+    -3, -13, 0, 8, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, -3, -8,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, -8, -4, -2, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    6, -3, 0, -6, 0, -13, -12, -8,
+    -8, 15, 7, 4, -33, -3, 8, -4,
+    0, -4, -4, -13, 0, 4, -5, -3,
+    -12, -3, -11, 0, -21, -5, -5, -15,
+    1, -5, -13, -13, -4, 15, -6, 0,
+    0, 3, -9, -14, -15, -10, 12, 0,
+    1, -28, -3, 4, -7, -3, -9, -8,
+    -14, -6, -3, 0, 0, -9, -8, -21,
+    0, -21, -5, -13, -22, -1, -12, -7,
+    -13, -11, 10, -5, 0, -3, 0, -7,
+    0, 7, -13, 4, 0, 0, -20, 0,
+    -4, -8, -7, -3, -10, -13, -9, -12,
+    -4, -9, -7, -12, -7, 0, -12, -4,
+    -4, -8, -9, -10, -11, -15, -5, -8,
+    -6, 0, -5, 2, -12, -14, -8, -13,
+    13, -4, 2, -36, -7, 8, -8, -7,
+    -14, -12, -16, -5, -3, -4, -8, -12,
+    -1, -25, 0, -23, -9, -15, -26, -8,
+    -13, -16, -19, -13, 8, 0, -11, 0,
+    0, 0, 0, 0, 0, -8, -2, 0,
+    0, 0, -8, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, -4, 0,
+    0, -7, 0, -10, 0, 0, 4, -5,
+    0, 0, -10, -4, -9, 0, 0, -10,
+    0, -4, 0, 0, -4, 0, -31, -7,
+    -15, -4, -14, -2, 0, 0, 0, 0,
+    0, 0, 0, -6, -7, -3, -7, 0,
+    0, 0, -8, -4, 8, 0, -3, -9,
+    -3, -7, -7, 0, -5, -2, -3, 3,
+    -1, 0, 0, -34, -3, -5, 0, -8,
+    0, -3, -3, 0, 0, 0, 3, 0,
+    -3, -7, -3, 7, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 4, 0, 0,
+    0, -10, -4, -8, 0, 0, -11, 0,
+    -4, 0, 0, 0, 0, -37, 0, -8,
+    -14, -19, -6, 0, 0, 0, 0, 0,
+    0, 0, -4, -6, -2, -6, 0, 7,
+    0, 12, -4, -4, -12, 5, 19, 7,
+    8, -10, 5, 16, 5, 11, 8, 0,
+    0, 0, 0, 0, 0, 0, 0, -4,
+    0, -3, 31, 31, 0, 0, 0, 4,
+    0, 0, 14, -6, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -32,
+    -5, -3, -16, -19, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -6, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -32, -5, -3, -16,
+    -19, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -9, 4, 0, -4, 3, 7, 4,
+    -12, 0, -1, -3, 4, 0, 0, 0,
+    0, -10, 0, -3, -3, -8, -4, 0,
+    -8, -3, -3, -7, 0, -4, -11, -8,
+    -5, 0, -6, 0, -5, -3, -3, -4,
+    -15, 1, -2, 1, -3, -10, 1, 8,
+    1, 3, 1, -9, -15, -5, -15, -7,
+    -10, -16, -15, -3, -3, -5, -3, -3,
+    -1, 6, 0, 6, -3, 0, 12, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    -4, -4, 0, 0, -10, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, -4, 0, -5, 0, 0, 0, 0,
+    -4, 4, 0, -7, -7, -3, 0, -11,
+    -3, -8, -3, -5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -7,
+    0, 0, 0, -5, 0, -4, 0, 0,
+    -2, -3, 0, 0, 0, -5, -13, -12,
+    3, 4, 4, -1, -11, 3, 6, 3,
+    12, 3, -3, -10, 0, -15, 0, 0,
+    -12, -10, -7, 0, -6, 0, 0, -3,
+    6, 0, -3, -12, -4, 14, -3, 0,
+    0, 0, -9, 0, 4, -4, 3, 0,
+    0, -13, 0, -3, -1, 0, -4, -3,
+    0, 0, -16, -5, -8, 0, -12, -4,
+    0, -7, 0, 0, -4, 0, -4, -12,
+    0, -4, 4, 0, 0, 0, 0, -5,
+    1, 0, 0, -5, -3, 0, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, 0,
+    0, 0, 1, 0, -4, -4, 0, 0,
+    0, 9, 0, 0, 0, -24, -22, 1,
+    17, 12, 7, -15, 3, 16, 0, 14,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 49,
+    .right_class_cnt     = 37,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 8,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_montserrat_24 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 27,          /*The maximum line height required by the font*/
+    .base_line = 5,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_16,   /*Characters outside the subset*/
+};
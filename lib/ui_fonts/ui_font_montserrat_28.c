@@ -0,0 +1,1821 @@
+/*******************************************************************************
+ * Size: 28 px
+ * Bpp: 4
+ * Opts: generated by generate_ui_fonts.py from lv_font_montserrat_28.c, plain
+ * Characters:  %()+,-./0123456789:>ABCDEFGHIKLMNOPRSTUVWXYabcdefghiklmnoprstuvwxyz°
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0x44, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0x50, 0x0, 0x0, 0x3, 0x33, 0x33, 0xff, 0x73,
+    0x33, 0x31, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf6, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6,
+    0x0, 0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0x50, 0x0, 0x0,
+
+    /* U+002C "," */
+    0x1a, 0xb4, 0x8, 0xff, 0xe0, 0x9f, 0xff, 0x2,
+    0xdf, 0xc0, 0xa, 0xf6, 0x0, 0xef, 0x10, 0x2f,
+    0xc0, 0x6, 0xf6, 0x0,
+
+    /* U+002D "-" */
+    0x25, 0x55, 0x55, 0x55, 0x6, 0xff, 0xff, 0xff,
+    0xf2, 0x6f, 0xff, 0xff, 0xff, 0x20,
+
+    /* U+002E "." */
+    0x1a, 0xc4, 0x9, 0xff, 0xe0, 0xaf, 0xff, 0x2,
+    0xde, 0x60,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0x5, 0x86, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0x70, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x20, 0x0, 0x0, 0x0, 0xa,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0xf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x6, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0xb, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xa0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x50, 0x0, 0x0, 0x0, 0x7,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0xd, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0x90, 0x0, 0x0, 0x0, 0x3, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xd0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x7, 0xcf, 0xfe, 0xb5, 0x0, 0x0,
+    0x0, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x4f, 0xff, 0xd9, 0x8a, 0xff, 0xfd,
+    0x10, 0x0, 0x1e, 0xff, 0x70, 0x0, 0x1, 0xbf,
+    0xfa, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0xdf, 0xf3, 0x0, 0xef, 0xe0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0x90, 0x3f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xfe, 0x7, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf1, 0x9f, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x3a, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf4, 0xaf, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x49, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x13, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0xe,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
+    0x8f, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xff, 0x30,
+    0x1, 0xef, 0xf7, 0x0, 0x0, 0x1b, 0xff, 0xa0,
+    0x0, 0x4, 0xff, 0xfd, 0x98, 0xaf, 0xff, 0xd1,
+    0x0, 0x0, 0x4, 0xef, 0xff, 0xff, 0xff, 0xc1,
+    0x0, 0x0, 0x0, 0x0, 0x7c, 0xff, 0xeb, 0x50,
+    0x0, 0x0,
+
+    /* U+0031 "1" */
+    0xcf, 0xff, 0xff, 0xf6, 0xcf, 0xff, 0xff, 0xf6,
+    0x57, 0x77, 0xaf, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+    0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0, 0x5f, 0xf6,
+
+    /* U+0032 "2" */
+    0x0, 0x3, 0x8c, 0xef, 0xfc, 0x82, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
+    0x2e, 0xff, 0xfb, 0x98, 0xae, 0xff, 0xf5, 0x0,
+    0x2d, 0xf9, 0x10, 0x0, 0x0, 0x8f, 0xfe, 0x0,
+    0x1, 0x60, 0x0, 0x0, 0x0, 0xc, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xfa, 0x77, 0x77, 0x77, 0x77, 0x70,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+
+    /* U+0033 "3" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x6,
+    0x77, 0x77, 0x77, 0x77, 0xdf, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf9, 0x61, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x3, 0x88, 0xad,
+    0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xa0, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf8,
+    0x3f, 0xc4, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x2a,
+    0xff, 0xfe, 0xa8, 0x89, 0xdf, 0xff, 0x70, 0x9,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x1,
+    0x6a, 0xdf, 0xfe, 0xc7, 0x20, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xa0, 0x0, 0xa, 0xb7, 0x0,
+    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x0, 0xf, 0xfa,
+    0x0, 0x0, 0x1, 0xef, 0xf2, 0x0, 0x0, 0xf,
+    0xfa, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0,
+    0xf, 0xfa, 0x0, 0x0, 0x8f, 0xfd, 0x66, 0x66,
+    0x66, 0x6f, 0xfc, 0x66, 0x62, 0xef, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xfa, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x4f, 0xf9, 0x77, 0x77, 0x77, 0x77, 0x0,
+    0x0, 0x6f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xff, 0xff, 0xec, 0x94, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
+    0x0, 0x77, 0x77, 0x77, 0x9c, 0xff, 0xfe, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2c, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0,
+    0x3, 0x10, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
+    0xd, 0xe6, 0x0, 0x0, 0x0, 0x2c, 0xff, 0x70,
+    0x5f, 0xff, 0xfb, 0x98, 0x9b, 0xff, 0xfd, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xb1, 0x0,
+    0x0, 0x4, 0x9c, 0xef, 0xed, 0x94, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x2, 0x8c, 0xef, 0xfd, 0xa4, 0x0,
+    0x0, 0x1, 0xaf, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0x1d, 0xff, 0xfb, 0x86, 0x89, 0xed, 0x0,
+    0x0, 0xcf, 0xfb, 0x20, 0x0, 0x0, 0x2, 0x0,
+    0x6, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xf3, 0x5, 0xae, 0xfe, 0xd8, 0x20, 0x0,
+    0xaf, 0xf3, 0xbf, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0xaf, 0xfd, 0xff, 0x95, 0x46, 0xaf, 0xff, 0x60,
+    0x9f, 0xff, 0xd1, 0x0, 0x0, 0x4, 0xff, 0xe0,
+    0x7f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf5,
+    0x4f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf7,
+    0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf6,
+    0xa, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf4,
+    0x2, 0xff, 0xd1, 0x0, 0x0, 0x4, 0xff, 0xd0,
+    0x0, 0x7f, 0xff, 0x95, 0x45, 0xaf, 0xff, 0x40,
+    0x0, 0x6, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x17, 0xce, 0xfe, 0xc7, 0x10, 0x0,
+
+    /* U+0037 "7" */
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
+    0x2f, 0xfb, 0x77, 0x77, 0x77, 0x77, 0xcf, 0xf5,
+    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xff, 0xe0,
+    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x6, 0xff, 0x70,
+    0x2f, 0xf8, 0x0, 0x0, 0x0, 0xd, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x5a, 0xdf, 0xfd, 0xa6, 0x0, 0x0,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
+    0x2, 0xef, 0xfd, 0x75, 0x57, 0xdf, 0xff, 0x20,
+    0xa, 0xff, 0x80, 0x0, 0x0, 0x8, 0xff, 0xa0,
+    0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0,
+    0xf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf0,
+    0xf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf0,
+    0xa, 0xff, 0x50, 0x0, 0x0, 0x5, 0xff, 0xa0,
+    0x1, 0xef, 0xfa, 0x42, 0x25, 0xaf, 0xfe, 0x10,
+    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xc2, 0x0,
+    0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x0,
+    0xb, 0xff, 0xc5, 0x20, 0x2, 0x6d, 0xff, 0xb0,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf5,
+    0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
+    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfa,
+    0x4f, 0xfd, 0x20, 0x0, 0x0, 0x2, 0xdf, 0xf5,
+    0xa, 0xff, 0xfa, 0x64, 0x56, 0xaf, 0xff, 0xb0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x0, 0x2, 0x7c, 0xef, 0xfe, 0xc7, 0x20, 0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x5b, 0xef, 0xed, 0x93, 0x0, 0x0,
+    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0,
+    0x1, 0xdf, 0xfc, 0x64, 0x58, 0xdf, 0xfa, 0x0,
+    0x9, 0xff, 0x80, 0x0, 0x0, 0xa, 0xff, 0x60,
+    0xf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0,
+    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x2f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9,
+    0xf, 0xfd, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfc,
+    0xa, 0xff, 0x80, 0x0, 0x0, 0xa, 0xff, 0xfd,
+    0x2, 0xff, 0xfd, 0x75, 0x58, 0xdf, 0xee, 0xfe,
+    0x0, 0x3e, 0xff, 0xff, 0xff, 0xfe, 0x3e, 0xfe,
+    0x0, 0x0, 0x7c, 0xef, 0xeb, 0x60, 0xf, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xa0,
+    0x0, 0x11, 0x0, 0x0, 0x0, 0x8f, 0xfe, 0x10,
+    0x0, 0x8f, 0xa8, 0x67, 0xae, 0xff, 0xf3, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x0, 0x39, 0xcf, 0xff, 0xd9, 0x40, 0x0, 0x0,
+
+    /* U+003A ":" */
+    0x2d, 0xe6, 0xa, 0xff, 0xf0, 0x9f, 0xfe, 0x1,
+    0xac, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xac, 0x40, 0x9f, 0xfe,
+    0xa, 0xff, 0xf0, 0x2d, 0xe6, 0x0,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xe9, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x81, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0x10, 0xaf, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
+    0x3f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0xc, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xd0, 0x0, 0x6, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x60,
+    0x0, 0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xfe, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x33, 0x33, 0x33, 0x3c, 0xff, 0x30, 0x0, 0x0,
+    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x1f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf8, 0x0,
+    0x0, 0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xfe, 0x0, 0x0, 0xef, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x60, 0x5, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xd0, 0xc, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf4,
+
+    /* U+0042 "B" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xd2, 0x0, 0x1f, 0xfc, 0x44, 0x44, 0x44, 0x69,
+    0xff, 0xfd, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x1c, 0xff, 0x60, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xa0, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x40,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x14, 0xbf, 0xfb,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xa0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe7, 0x0, 0x1f, 0xfc, 0x44, 0x44, 0x44,
+    0x45, 0x8e, 0xff, 0xa0, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xf4, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf7, 0x1f, 0xfc, 0x44, 0x44, 0x44, 0x45, 0x8e,
+    0xff, 0xe1, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x20, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xda, 0x50, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x38, 0xce, 0xfe, 0xda, 0x50,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xe5, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda,
+    0x89, 0xbf, 0xff, 0xf8, 0x0, 0x5, 0xff, 0xfb,
+    0x30, 0x0, 0x0, 0x6, 0xef, 0xb0, 0x1, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x2, 0x80, 0x0,
+    0xaf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x29, 0x0,
+    0x0, 0x5f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6e,
+    0xfb, 0x0, 0x0, 0x5f, 0xff, 0xfd, 0xa8, 0x8a,
+    0xff, 0xff, 0x80, 0x0, 0x0, 0x2c, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3,
+    0x8c, 0xef, 0xed, 0xa5, 0x0, 0x0,
+
+    /* U+0044 "D" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xd4, 0x0, 0x0, 0x1f, 0xfd, 0x77, 0x77,
+    0x77, 0x9c, 0xff, 0xff, 0x80, 0x0, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x29, 0xff, 0xf8, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0x40, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xc0, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf3, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf7,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfa, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xfc, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfc, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xf7, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf3, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xc0, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x40,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x19, 0xff,
+    0xf8, 0x0, 0x1f, 0xfd, 0x77, 0x77, 0x77, 0x9c,
+    0xff, 0xff, 0x80, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xd4, 0x0, 0x0, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xec, 0x94, 0x0, 0x0, 0x0,
+
+    /* U+0045 "E" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
+    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x50,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x0,
+    0x1f, 0xfd, 0x66, 0x66, 0x66, 0x66, 0x63, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x71,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+
+    /* U+0046 "F" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f,
+    0xfd, 0x77, 0x77, 0x77, 0x77, 0x77, 0x51, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xd6, 0x66, 0x66,
+    0x66, 0x66, 0x30, 0x1f, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf9, 0x1, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x90, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x61,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0xff, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda,
+    0x88, 0xae, 0xff, 0xfb, 0x0, 0x4, 0xff, 0xfc,
+    0x30, 0x0, 0x0, 0x4, 0xdf, 0xd1, 0x1, 0xff,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x81, 0x0,
+    0x9f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x10, 0xaf,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x38, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x31, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf3, 0x9, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x1f,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3,
+    0x0, 0x4f, 0xff, 0xc3, 0x0, 0x0, 0x0, 0x3c,
+    0xff, 0x30, 0x0, 0x5f, 0xff, 0xfd, 0xa8, 0x89,
+    0xdf, 0xff, 0xe1, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x3,
+    0x8c, 0xef, 0xfd, 0xa6, 0x10, 0x0,
+
+    /* U+0048 "H" */
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfc, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfc, 0x1f, 0xfd, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x7f, 0xfc, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xfc,
+
+    /* U+0049 "I" */
+    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
+    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
+    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
+    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
+    0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb,
+
+    /* U+004B "K" */
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
+    0xe2, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xf3, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xf4, 0x0, 0x1, 0xff, 0xb0, 0x0,
+    0x0, 0x1, 0xdf, 0xf5, 0x0, 0x0, 0x1f, 0xfb,
+    0x0, 0x0, 0x1, 0xdf, 0xf6, 0x0, 0x0, 0x1,
+    0xff, 0xb0, 0x0, 0x0, 0xcf, 0xf7, 0x0, 0x0,
+    0x0, 0x1f, 0xfb, 0x0, 0x0, 0xcf, 0xf8, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0xbf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0xbf,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
+    0xaf, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xfb, 0x9f, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xff, 0xfe, 0x8f, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xfe, 0x20, 0x8f, 0xfe,
+    0x10, 0x0, 0x0, 0x1, 0xff, 0xfe, 0x20, 0x0,
+    0xbf, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xfe, 0x20,
+    0x0, 0x0, 0xcf, 0xfa, 0x0, 0x0, 0x1, 0xff,
+    0xb0, 0x0, 0x0, 0x1, 0xef, 0xf7, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf4,
+    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xe2, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xd0, 0x1, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xb0,
+
+    /* U+004C "L" */
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xd7, 0x77, 0x77, 0x77, 0x77, 0x72, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+
+    /* U+004D "M" */
+    0x1f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xc, 0xfc, 0x1f, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0x1f, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xfc, 0x1f, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xfc, 0x1f, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xfc, 0x1f,
+    0xfe, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xff, 0xfc, 0x1f, 0xfa, 0xcf, 0xe1, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0x7e, 0xfc, 0x1f, 0xfa, 0x3f,
+    0xf9, 0x0, 0x0, 0x0, 0xd, 0xfd, 0xe, 0xfc,
+    0x1f, 0xfa, 0x9, 0xff, 0x20, 0x0, 0x0, 0x6f,
+    0xf4, 0xe, 0xfc, 0x1f, 0xfa, 0x1, 0xff, 0xb0,
+    0x0, 0x0, 0xef, 0xb0, 0xe, 0xfc, 0x1f, 0xfa,
+    0x0, 0x7f, 0xf5, 0x0, 0x8, 0xff, 0x20, 0xe,
+    0xfc, 0x1f, 0xfa, 0x0, 0xd, 0xfe, 0x0, 0x2f,
+    0xf8, 0x0, 0xe, 0xfc, 0x1f, 0xfa, 0x0, 0x4,
+    0xff, 0x70, 0xbf, 0xe0, 0x0, 0xe, 0xfc, 0x1f,
+    0xfa, 0x0, 0x0, 0xaf, 0xf6, 0xff, 0x60, 0x0,
+    0xe, 0xfc, 0x1f, 0xfa, 0x0, 0x0, 0x2f, 0xff,
+    0xfc, 0x0, 0x0, 0xe, 0xfc, 0x1f, 0xfa, 0x0,
+    0x0, 0x8, 0xff, 0xf3, 0x0, 0x0, 0xe, 0xfc,
+    0x1f, 0xfa, 0x0, 0x0, 0x0, 0xef, 0xa0, 0x0,
+    0x0, 0xe, 0xfc, 0x1f, 0xfa, 0x0, 0x0, 0x0,
+    0x49, 0x10, 0x0, 0x0, 0xe, 0xfc, 0x1f, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xfc, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xe, 0xfc,
+
+    /* U+004E "N" */
+    0x1f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xfc, 0x1f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xfc, 0x1f, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xfc, 0x1f, 0xff, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0xf, 0xfc, 0x1f, 0xff, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfc, 0xdf,
+    0xf9, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x1f, 0xfb,
+    0x2f, 0xff, 0x50, 0x0, 0x0, 0xf, 0xfc, 0x1f,
+    0xfb, 0x5, 0xff, 0xf2, 0x0, 0x0, 0xf, 0xfc,
+    0x1f, 0xfb, 0x0, 0x9f, 0xfd, 0x10, 0x0, 0xf,
+    0xfc, 0x1f, 0xfb, 0x0, 0xc, 0xff, 0xb0, 0x0,
+    0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x1, 0xef, 0xf8,
+    0x0, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x3f,
+    0xff, 0x40, 0xf, 0xfc, 0x1f, 0xfb, 0x0, 0x0,
+    0x6, 0xff, 0xf2, 0xf, 0xfc, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0xaf, 0xfd, 0xf, 0xfc, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xaf, 0xfc, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff, 0xfc,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xfc, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xd, 0xfc,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xda, 0x89, 0xbf, 0xff, 0xfb, 0x10,
+    0x0, 0x0, 0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0xc0, 0x0, 0x1, 0xef, 0xf8, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0, 0x9,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x20, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x90, 0x5f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0,
+    0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xf0, 0xaf, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf2, 0xaf, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf2, 0x8f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf0, 0x5f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xd0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x90, 0x9, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0x20, 0x1, 0xef, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xf9, 0x0,
+    0x0, 0x4f, 0xff, 0xb3, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xc0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xda,
+    0x89, 0xbf, 0xff, 0xfc, 0x10, 0x0, 0x0, 0x0,
+    0x2b, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xda,
+    0x60, 0x0, 0x0, 0x0,
+
+    /* U+0050 "P" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
+    0x1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+    0x0, 0x1f, 0xfd, 0x77, 0x77, 0x78, 0xaf, 0xff,
+    0xf3, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xd0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0x51, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xf9, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xb1, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xfb, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0x91, 0xff, 0xb0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf5, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xfd, 0x1, 0xff, 0xd7,
+    0x77, 0x77, 0x7a, 0xff, 0xff, 0x30, 0x1f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfd, 0x30, 0x1, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0xa5, 0x0, 0x0, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0052 "R" */
+    0x1f, 0xff, 0xff, 0xff, 0xff, 0xda, 0x50, 0x0,
+    0x0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x30, 0x0, 0x1f, 0xfd, 0x77, 0x77, 0x78, 0xaf,
+    0xff, 0xf3, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xfd, 0x0, 0x1f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0x50, 0x1f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0x90, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0x90, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x50, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfe, 0x0, 0x1f, 0xfd, 0x66, 0x66, 0x67,
+    0x9e, 0xff, 0xf3, 0x0, 0x1f, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x30, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x1f, 0xfb,
+    0x0, 0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x1f,
+    0xfb, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0,
+    0x1f, 0xfb, 0x0, 0x0, 0x0, 0x6, 0xff, 0xa0,
+    0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf5, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x1e, 0xfe, 0x10, 0x1f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xb0,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x6b, 0xdf, 0xfe, 0xc8, 0x30, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x20,
+    0x4, 0xff, 0xfc, 0x86, 0x67, 0xbf, 0xff, 0x10,
+    0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x69, 0x0,
+    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xff, 0xa6, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x5e, 0xff, 0xff, 0xfd, 0x94, 0x0, 0x0,
+    0x0, 0x0, 0x6b, 0xff, 0xff, 0xff, 0xd3, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0x8c, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2b, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf3,
+    0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf1,
+    0x5f, 0xb4, 0x0, 0x0, 0x0, 0x6, 0xff, 0xb0,
+    0xaf, 0xff, 0xe9, 0x76, 0x68, 0xdf, 0xff, 0x30,
+    0x7, 0xef, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0,
+    0x0, 0x5, 0x9d, 0xef, 0xed, 0xa5, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf5, 0x67, 0x77, 0x77, 0x8f, 0xfc, 0x77, 0x77,
+    0x77, 0x20, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0x90, 0x0,
+    0x0, 0x0,
+
+    /* U+0055 "U" */
+    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x3f,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xf5,
+    0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xf5, 0x3f, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xf5, 0x2f, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf4, 0xf, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0xc, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0xef, 0xe0, 0x7,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x90,
+    0x0, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x20, 0x0, 0x4f, 0xff, 0xea, 0x88, 0xae, 0xff,
+    0xf5, 0x0, 0x0, 0x3, 0xef, 0xff, 0xff, 0xff,
+    0xfe, 0x40, 0x0, 0x0, 0x0, 0x6, 0xae, 0xff,
+    0xeb, 0x60, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0xd, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xc0, 0x6f, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0xef, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0,
+    0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0x70, 0x0, 0x1f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf1, 0x0, 0x0, 0xaf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xf9, 0x0, 0x0,
+    0x3, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x20, 0x0, 0x0, 0xc, 0xff, 0x30, 0x0, 0x0,
+    0x1, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x5f, 0xfa,
+    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xf1, 0x0, 0x0, 0xe, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x6,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
+    0x0, 0x0, 0xdf, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf5, 0x0, 0x4f, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xc0, 0xa, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0x32, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xfa, 0x8f, 0xf4, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xf9, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0057 "W" */
+    0xe, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0x70,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf2, 0x4,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xfc, 0x0, 0xe,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xf5,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0x70, 0x0, 0xaf,
+    0xf3, 0x0, 0x0, 0x0, 0xe, 0xfb, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x0, 0x4, 0xff,
+    0x90, 0x0, 0x0, 0x4, 0xff, 0x4b, 0xff, 0x0,
+    0x0, 0x0, 0xd, 0xfd, 0x0, 0x0, 0xf, 0xfe,
+    0x0, 0x0, 0x0, 0x9f, 0xf0, 0x6f, 0xf5, 0x0,
+    0x0, 0x2, 0xff, 0x70, 0x0, 0x0, 0xaf, 0xf3,
+    0x0, 0x0, 0xe, 0xfa, 0x1, 0xff, 0xa0, 0x0,
+    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x5, 0xff, 0x80,
+    0x0, 0x4, 0xff, 0x40, 0xb, 0xff, 0x0, 0x0,
+    0xd, 0xfd, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x0,
+    0x0, 0xaf, 0xe0, 0x0, 0x6f, 0xf4, 0x0, 0x2,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0xaf, 0xf3, 0x0,
+    0xf, 0xfa, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x8f,
+    0xf3, 0x0, 0x0, 0x0, 0x5, 0xff, 0x80, 0x4,
+    0xff, 0x40, 0x0, 0xb, 0xff, 0x0, 0xd, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xfd, 0x0, 0xaf,
+    0xe0, 0x0, 0x0, 0x5f, 0xf4, 0x2, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0xf, 0xf9,
+    0x0, 0x0, 0x0, 0xff, 0x90, 0x7f, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x85, 0xff, 0x40,
+    0x0, 0x0, 0xb, 0xfe, 0xd, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xfd, 0xaf, 0xe0, 0x0,
+    0x0, 0x0, 0x5f, 0xf7, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xff, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0xb, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xf3, 0x0, 0x0, 0x0,
+
+    /* U+0058 "X" */
+    0xc, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xf9, 0x0, 0x2f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x2f, 0xfd, 0x0, 0x0, 0x6f, 0xfc, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x30, 0x0, 0x0, 0xbf, 0xf7,
+    0x0, 0x0, 0x8, 0xff, 0x70, 0x0, 0x0, 0x1,
+    0xef, 0xf3, 0x0, 0x4, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xd0, 0x1, 0xef, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xa0, 0xaf, 0xf5,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xd2, 0xff,
+    0xf2, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf2,
+    0x6, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf7, 0x0, 0xa, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x6f, 0xfb, 0x0, 0x0, 0x1e, 0xff, 0x40, 0x0,
+    0x0, 0x2f, 0xfe, 0x10, 0x0, 0x0, 0x3f, 0xfe,
+    0x10, 0x0, 0xd, 0xff, 0x50, 0x0, 0x0, 0x0,
+    0x8f, 0xfa, 0x0, 0x9, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf6, 0x4, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf2,
+
+    /* U+0059 "Y" */
+    0xc, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xe0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x50, 0x0, 0x9f, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xfb, 0x0, 0x0, 0x1e,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2, 0x0,
+    0x0, 0x6, 0xff, 0x90, 0x0, 0x0, 0x3, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0,
+    0xd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb,
+    0x0, 0x0, 0x6f, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x50, 0x1, 0xef, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xe0, 0x9, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8, 0x3f,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xdf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xf7, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0061 "a" */
+    0x0, 0x17, 0xbe, 0xff, 0xda, 0x40, 0x0, 0x8,
+    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0xd, 0xfe,
+    0xa6, 0x56, 0xaf, 0xff, 0x60, 0x3, 0x70, 0x0,
+    0x0, 0x2, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xf4, 0x0, 0x28, 0xce, 0xef, 0xff, 0xff,
+    0xf4, 0x6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x2f, 0xfe, 0x51, 0x0, 0x0, 0x6f, 0xf5, 0x7f,
+    0xf4, 0x0, 0x0, 0x0, 0x6f, 0xf5, 0x9f, 0xf1,
+    0x0, 0x0, 0x0, 0x8f, 0xf5, 0x7f, 0xf5, 0x0,
+    0x0, 0x2, 0xff, 0xf5, 0x2f, 0xfe, 0x50, 0x1,
+    0x6e, 0xff, 0xf5, 0x5, 0xff, 0xff, 0xff, 0xff,
+    0x9f, 0xf5, 0x0, 0x29, 0xef, 0xfd, 0x92, 0x3f,
+    0xf5,
+
+    /* U+0062 "b" */
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x5, 0xbe, 0xfd, 0xb5, 0x0, 0x0,
+    0x7f, 0xf5, 0xcf, 0xff, 0xff, 0xff, 0xd2, 0x0,
+    0x7f, 0xfe, 0xff, 0xa7, 0x68, 0xef, 0xff, 0x20,
+    0x7f, 0xff, 0xd2, 0x0, 0x0, 0x9, 0xff, 0xd0,
+    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xaf, 0xf5,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
+    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe,
+    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x7f, 0xff, 0xd2, 0x0, 0x0, 0x9, 0xff, 0xd0,
+    0x7f, 0xfd, 0xff, 0xa7, 0x68, 0xef, 0xff, 0x20,
+    0x7f, 0xf3, 0xcf, 0xff, 0xff, 0xff, 0xd2, 0x0,
+    0x7f, 0xf2, 0x5, 0xbe, 0xfe, 0xb5, 0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0, 0x0,
+    0x1, 0xbf, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x1,
+    0xdf, 0xfe, 0x96, 0x69, 0xff, 0xf8, 0x0, 0xbf,
+    0xfa, 0x0, 0x0, 0x1, 0xcf, 0x80, 0x3f, 0xfc,
+    0x0, 0x0, 0x0, 0x1, 0x20, 0x8, 0xff, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xfc, 0x0, 0x0, 0x0,
+    0x1, 0x20, 0x0, 0xbf, 0xfa, 0x0, 0x0, 0x1,
+    0xcf, 0x80, 0x1, 0xdf, 0xfe, 0x96, 0x69, 0xff,
+    0xf8, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x39, 0xdf, 0xfd, 0x93, 0x0,
+    0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0x0, 0x0, 0x5a, 0xdf, 0xec, 0x60, 0x2f, 0xf8,
+    0x0, 0x2c, 0xff, 0xff, 0xff, 0xfd, 0x4f, 0xf8,
+    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xef, 0xf8,
+    0xc, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0xf8,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf8,
+    0x9f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf8,
+    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0x9f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf8,
+    0x3f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf8,
+    0xc, 0xff, 0x80, 0x0, 0x0, 0xb, 0xff, 0xf8,
+    0x1, 0xef, 0xfc, 0x63, 0x47, 0xef, 0xef, 0xf8,
+    0x0, 0x2c, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8,
+    0x0, 0x0, 0x5b, 0xdf, 0xec, 0x70, 0xf, 0xf8,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x4b, 0xdf, 0xec, 0x61, 0x0, 0x0,
+    0x1, 0xcf, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x1,
+    0xef, 0xfb, 0x64, 0x59, 0xff, 0xf4, 0x0, 0xbf,
+    0xf4, 0x0, 0x0, 0x2, 0xdf, 0xe1, 0x3f, 0xf6,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0x69, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xfb, 0xbf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfe, 0xbf, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0xbf, 0xfb, 0x10, 0x0, 0x0,
+    0x5e, 0x30, 0x1, 0xdf, 0xff, 0x96, 0x68, 0xcf,
+    0xfc, 0x0, 0x1, 0xbf, 0xff, 0xff, 0xff, 0xfd,
+    0x20, 0x0, 0x0, 0x39, 0xde, 0xfe, 0xa5, 0x0,
+    0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x18, 0xdf, 0xeb, 0x40, 0x0, 0x1d,
+    0xff, 0xff, 0xf9, 0x0, 0x9, 0xff, 0xa4, 0x49,
+    0x30, 0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0xf,
+    0xf9, 0x0, 0x0, 0x0, 0x1, 0xff, 0x90, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0x9, 0xff,
+    0xff, 0xff, 0xff, 0xe0, 0x23, 0x4f, 0xfb, 0x33,
+    0x33, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x1f, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1f, 0xfa,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x1f,
+    0xfa, 0x0, 0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x0, 0x5b, 0xdf, 0xec, 0x71, 0xc, 0xfc,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0x4c, 0xfc,
+    0x3, 0xff, 0xfd, 0x86, 0x68, 0xef, 0xfe, 0xfc,
+    0xd, 0xff, 0x80, 0x0, 0x0, 0x8, 0xff, 0xfc,
+    0x5f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfc,
+    0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
+    0xcf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc,
+    0xaf, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc,
+    0x5f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
+    0xd, 0xff, 0x90, 0x0, 0x0, 0x9, 0xff, 0xfc,
+    0x2, 0xff, 0xfe, 0x96, 0x69, 0xef, 0xff, 0xfc,
+    0x0, 0x3d, 0xff, 0xff, 0xff, 0xfe, 0x4f, 0xfb,
+    0x0, 0x0, 0x5b, 0xdf, 0xec, 0x71, 0xf, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
+    0x3, 0xe6, 0x0, 0x0, 0x0, 0x5, 0xff, 0xe0,
+    0xc, 0xff, 0xea, 0x76, 0x68, 0xcf, 0xff, 0x50,
+    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0,
+    0x0, 0x3, 0x8b, 0xef, 0xfe, 0xb7, 0x10, 0x0,
+
+    /* U+0068 "h" */
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x6,
+    0xbe, 0xfe, 0xb5, 0x0, 0x7, 0xff, 0x5d, 0xff,
+    0xff, 0xff, 0xfb, 0x0, 0x7f, 0xff, 0xfe, 0x97,
+    0x7a, 0xff, 0xf9, 0x7, 0xff, 0xfb, 0x0, 0x0,
+    0x3, 0xff, 0xf2, 0x7f, 0xfe, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x67, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x3f, 0xf8, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0x97, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f,
+    0xfa, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xa7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xfa,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa7,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x7f,
+    0xf3, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa7, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x7f, 0xf3,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
+
+    /* U+0069 "i" */
+    0x5e, 0xd3, 0xdf, 0xfa, 0xbf, 0xf7, 0x6, 0x50,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xf3, 0x7f, 0xf3,
+    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
+    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
+    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
+    0x7f, 0xf3,
+
+    /* U+006B "k" */
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x4f, 0xfe, 0x20,
+    0x7f, 0xf3, 0x0, 0x0, 0x5, 0xff, 0xe2, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x6f, 0xfe, 0x20, 0x0,
+    0x7f, 0xf3, 0x0, 0x7, 0xff, 0xe2, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x8f, 0xfe, 0x20, 0x0, 0x0,
+    0x7f, 0xf3, 0x9, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x7f, 0xf4, 0xaf, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x7f, 0xfe, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0,
+    0x7f, 0xff, 0xfc, 0x5f, 0xff, 0x20, 0x0, 0x0,
+    0x7f, 0xff, 0xb0, 0x8, 0xff, 0xd0, 0x0, 0x0,
+    0x7f, 0xfa, 0x0, 0x0, 0xbf, 0xfa, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0xd, 0xff, 0x70, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x10,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x8, 0xff, 0xc0,
+
+    /* U+006C "l" */
+    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
+    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
+    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
+    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
+    0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3, 0x7f, 0xf3,
+    0x7f, 0xf3,
+
+    /* U+006D "m" */
+    0x7f, 0xf2, 0x18, 0xce, 0xfd, 0x93, 0x0, 0x2,
+    0x8d, 0xff, 0xd9, 0x20, 0x0, 0x7f, 0xf5, 0xef,
+    0xff, 0xff, 0xff, 0x70, 0x7f, 0xff, 0xff, 0xff,
+    0xf6, 0x0, 0x7f, 0xff, 0xfc, 0x64, 0x5a, 0xff,
+    0xfa, 0xff, 0xc6, 0x45, 0xaf, 0xff, 0x30, 0x7f,
+    0xff, 0x80, 0x0, 0x0, 0x6f, 0xff, 0xf8, 0x0,
+    0x0, 0x7, 0xff, 0xb0, 0x7f, 0xfd, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xc0, 0x0, 0x0, 0x0, 0xdf,
+    0xf0, 0x7f, 0xf7, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x9f, 0xf1, 0x7f, 0xf4,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x8f, 0xf2, 0x7f, 0xf3, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf3,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xf3, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x8f, 0xf3, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f,
+    0xf3, 0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xf3, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x8f,
+    0xf3, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x8f, 0xf3, 0x7f, 0xf3,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x8f, 0xf3,
+
+    /* U+006E "n" */
+    0x7f, 0xf2, 0x7, 0xce, 0xfe, 0xb5, 0x0, 0x7,
+    0xff, 0x5e, 0xff, 0xff, 0xff, 0xfb, 0x0, 0x7f,
+    0xff, 0xfd, 0x75, 0x58, 0xef, 0xf9, 0x7, 0xff,
+    0xf9, 0x0, 0x0, 0x2, 0xef, 0xf2, 0x7f, 0xfd,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0x67, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x2f, 0xf8, 0x7f, 0xf4, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0x97, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x1f, 0xfa, 0x7f, 0xf3, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xa7, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x1f, 0xfa, 0x7f, 0xf3, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xa7, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x1f, 0xfa, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xa7, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f,
+    0xfa, 0x7f, 0xf3, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xa0,
+
+    /* U+006F "o" */
+    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x82, 0x0, 0x0,
+    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x1, 0xef, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
+    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
+    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xf5,
+    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
+    0xcf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xf9,
+    0xbf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xf7,
+    0x8f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf5,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x1, 0xef, 0xe0,
+    0xb, 0xff, 0xa0, 0x0, 0x0, 0x1c, 0xff, 0x70,
+    0x1, 0xdf, 0xfe, 0x96, 0x6a, 0xff, 0xfb, 0x0,
+    0x0, 0x1b, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x4a, 0xdf, 0xed, 0x92, 0x0, 0x0,
+
+    /* U+0070 "p" */
+    0x7f, 0xf2, 0x6, 0xbe, 0xfd, 0xb5, 0x0, 0x0,
+    0x7f, 0xf4, 0xdf, 0xff, 0xff, 0xff, 0xd2, 0x0,
+    0x7f, 0xfe, 0xfe, 0x84, 0x46, 0xcf, 0xff, 0x20,
+    0x7f, 0xff, 0xc1, 0x0, 0x0, 0x7, 0xff, 0xd0,
+    0x7f, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x9f, 0xf5,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfa,
+    0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0xd, 0xfe,
+    0x7f, 0xf5, 0x0, 0x0, 0x0, 0x0, 0xe, 0xfc,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfa,
+    0x7f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x7f, 0xff, 0xd2, 0x0, 0x0, 0x9, 0xff, 0xd0,
+    0x7f, 0xfe, 0xff, 0xa7, 0x68, 0xef, 0xff, 0x20,
+    0x7f, 0xf4, 0xcf, 0xff, 0xff, 0xff, 0xd2, 0x0,
+    0x7f, 0xf3, 0x5, 0xbe, 0xfe, 0xb5, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0072 "r" */
+    0x7f, 0xf2, 0x6, 0xce, 0x87, 0xff, 0x3d, 0xff,
+    0xf8, 0x7f, 0xfd, 0xff, 0xc9, 0x57, 0xff, 0xfd,
+    0x20, 0x0, 0x7f, 0xff, 0x10, 0x0, 0x7, 0xff,
+    0x80, 0x0, 0x0, 0x7f, 0xf5, 0x0, 0x0, 0x7,
+    0xff, 0x30, 0x0, 0x0, 0x7f, 0xf3, 0x0, 0x0,
+    0x7, 0xff, 0x30, 0x0, 0x0, 0x7f, 0xf3, 0x0,
+    0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x7f, 0xf3,
+    0x0, 0x0, 0x7, 0xff, 0x30, 0x0, 0x0, 0x7f,
+    0xf3, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x2, 0x9d, 0xff, 0xec, 0x83, 0x0, 0x0,
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x5, 0xff,
+    0xe8, 0x65, 0x69, 0xef, 0x20, 0xb, 0xff, 0x20,
+    0x0, 0x0, 0x3, 0x0, 0xd, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xfe, 0xb8, 0x51, 0x0,
+    0x0, 0x0, 0x4d, 0xff, 0xff, 0xff, 0xd5, 0x0,
+    0x0, 0x0, 0x36, 0x9c, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8f, 0xf2, 0x5, 0x70, 0x0,
+    0x0, 0x0, 0xbf, 0xf1, 0xe, 0xff, 0xa7, 0x55,
+    0x7c, 0xff, 0xb0, 0x1c, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x10, 0x0, 0x38, 0xce, 0xff, 0xda, 0x50,
+    0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x8, 0x85, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x9f, 0xff,
+    0xff, 0xff, 0xfe, 0x9, 0xff, 0xff, 0xff, 0xff,
+    0xe0, 0x23, 0x4f, 0xfb, 0x33, 0x33, 0x0, 0x1,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xa0, 0x0, 0x0, 0x0,
+    0x1f, 0xfa, 0x0, 0x0, 0x0, 0x1, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x1f, 0xfa, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xa0, 0x0, 0x0, 0x0, 0xf, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xb5, 0x5a, 0x40, 0x0, 0x2e,
+    0xff, 0xff, 0xfb, 0x0, 0x0, 0x19, 0xef, 0xea,
+    0x30,
+
+    /* U+0075 "u" */
+    0x9f, 0xf1, 0x0, 0x0, 0x0, 0x5, 0xff, 0x69,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x9f,
+    0xf1, 0x0, 0x0, 0x0, 0x5, 0xff, 0x69, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x69, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0x69, 0xff, 0x10, 0x0,
+    0x0, 0x0, 0x5f, 0xf6, 0x9f, 0xf1, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0x68, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x8f, 0xf6, 0x5f, 0xf7, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x61, 0xff, 0xe2, 0x0, 0x0, 0xa,
+    0xff, 0xf6, 0x8, 0xff, 0xe8, 0x44, 0x6d, 0xff,
+    0xff, 0x60, 0xa, 0xff, 0xff, 0xff, 0xfe, 0x5f,
+    0xf6, 0x0, 0x4, 0xae, 0xfe, 0xc7, 0x2, 0xff,
+    0x60,
+
+    /* U+0076 "v" */
+    0xd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x70, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xf1, 0x0, 0xef, 0xc0, 0x0, 0x0, 0x0, 0x1f,
+    0xf9, 0x0, 0x8, 0xff, 0x30, 0x0, 0x0, 0x7,
+    0xff, 0x20, 0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0,
+    0xef, 0xb0, 0x0, 0x0, 0xaf, 0xf1, 0x0, 0x0,
+    0x5f, 0xf4, 0x0, 0x0, 0x3, 0xff, 0x80, 0x0,
+    0xc, 0xfd, 0x0, 0x0, 0x0, 0xd, 0xfe, 0x0,
+    0x3, 0xff, 0x60, 0x0, 0x0, 0x0, 0x6f, 0xf5,
+    0x0, 0xaf, 0xf0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xc0, 0x1f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x37, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xfa, 0xef, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+0077 "w" */
+    0xaf, 0xe0, 0x0, 0x0, 0x0, 0xa, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xd4, 0xff, 0x40, 0x0,
+    0x0, 0x1, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xe,
+    0xf7, 0xe, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xff,
+    0xb0, 0x0, 0x0, 0x5, 0xff, 0x10, 0x8f, 0xf0,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0x10, 0x0, 0x0,
+    0xbf, 0xb0, 0x2, 0xff, 0x50, 0x0, 0x2, 0xff,
+    0x5f, 0xf6, 0x0, 0x0, 0x1f, 0xf5, 0x0, 0xc,
+    0xfb, 0x0, 0x0, 0x8f, 0xd0, 0xbf, 0xc0, 0x0,
+    0x6, 0xfe, 0x0, 0x0, 0x7f, 0xf1, 0x0, 0xe,
+    0xf7, 0x5, 0xff, 0x20, 0x0, 0xcf, 0x90, 0x0,
+    0x1, 0xff, 0x60, 0x4, 0xff, 0x10, 0xe, 0xf8,
+    0x0, 0x2f, 0xf3, 0x0, 0x0, 0xb, 0xfc, 0x0,
+    0xaf, 0xb0, 0x0, 0x9f, 0xe0, 0x8, 0xfd, 0x0,
+    0x0, 0x0, 0x5f, 0xf2, 0x1f, 0xf5, 0x0, 0x3,
+    0xff, 0x40, 0xef, 0x70, 0x0, 0x0, 0x0, 0xef,
+    0x86, 0xff, 0x0, 0x0, 0xc, 0xf9, 0x4f, 0xf1,
+    0x0, 0x0, 0x0, 0x9, 0xfd, 0xcf, 0x90, 0x0,
+    0x0, 0x6f, 0xfa, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0xf3, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xfd, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x70, 0x0, 0x0, 0x0, 0x4f,
+    0xfa, 0x0, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0x1e, 0xfe, 0x10, 0x0, 0x0, 0x9, 0xff, 0x50,
+    0x3, 0xff, 0xc0, 0x0, 0x0, 0x5f, 0xf9, 0x0,
+    0x0, 0x6f, 0xf8, 0x0, 0x2, 0xef, 0xc0, 0x0,
+    0x0, 0xa, 0xff, 0x50, 0xc, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0xdf, 0xe2, 0x9f, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfe, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xf5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0xfe, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfa, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xc0, 0x5f, 0xf9, 0x0, 0x0,
+    0x0, 0x1d, 0xfe, 0x10, 0x9, 0xff, 0x50, 0x0,
+    0x0, 0xbf, 0xf4, 0x0, 0x0, 0xdf, 0xf2, 0x0,
+    0x7, 0xff, 0x80, 0x0, 0x0, 0x2f, 0xfd, 0x0,
+    0x3f, 0xfc, 0x0, 0x0, 0x0, 0x5, 0xff, 0xa0,
+
+    /* U+0079 "y" */
+    0xd, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0x70, 0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x9f,
+    0xf0, 0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x1f,
+    0xf8, 0x0, 0x7, 0xff, 0x50, 0x0, 0x0, 0x8,
+    0xff, 0x10, 0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0,
+    0xef, 0xa0, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0,
+    0x6f, 0xf3, 0x0, 0x0, 0x2, 0xff, 0xa0, 0x0,
+    0xd, 0xfc, 0x0, 0x0, 0x0, 0xa, 0xff, 0x10,
+    0x4, 0xff, 0x40, 0x0, 0x0, 0x0, 0x3f, 0xf8,
+    0x0, 0xbf, 0xd0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xf0, 0x2f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x79, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xfe, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x9f, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0xeb, 0x65, 0xaf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x6c, 0xff, 0xd7, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+007A "z" */
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5b, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0x23, 0x33, 0x33,
+    0x33, 0x8f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x1d, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0x50, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xb0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xe1,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfe,
+    0x33, 0x33, 0x33, 0x33, 0x1d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf8, 0xef, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x80,
+
+    /* U+0020 " " */
+
+    /* U+0025 "%" */
+    0x0, 0x7d, 0xfe, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0x30, 0x0, 0xa, 0xfd, 0x9c, 0xfc, 0x0,
+    0x0, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x4f, 0xb0,
+    0x0, 0x8f, 0x70, 0x0, 0x0, 0x4f, 0xd0, 0x0,
+    0x0, 0xbf, 0x30, 0x0, 0xf, 0xd0, 0x0, 0x0,
+    0xdf, 0x30, 0x0, 0x0, 0xef, 0x0, 0x0, 0xc,
+    0xf1, 0x0, 0x9, 0xf9, 0x0, 0x0, 0x0, 0xfe,
+    0x0, 0x0, 0xa, 0xf1, 0x0, 0x4f, 0xd0, 0x0,
+    0x0, 0x0, 0xef, 0x0, 0x0, 0xc, 0xf1, 0x0,
+    0xef, 0x30, 0x0, 0x0, 0x0, 0xbf, 0x30, 0x0,
+    0xf, 0xd0, 0x9, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xb0, 0x0, 0x8f, 0x70, 0x4f, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xfd, 0x9c, 0xfc, 0x0,
+    0xef, 0x30, 0x5, 0x88, 0x50, 0x0, 0x0, 0x7d,
+    0xfe, 0x80, 0x9, 0xf8, 0x1, 0xcf, 0xff, 0xfc,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0xb,
+    0xf9, 0x11, 0x8f, 0xb0, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0x30, 0x2f, 0xc0, 0x0, 0xc, 0xf3, 0x0,
+    0x0, 0x0, 0x9, 0xf8, 0x0, 0x6f, 0x60, 0x0,
+    0x6, 0xf7, 0x0, 0x0, 0x0, 0x4f, 0xd0, 0x0,
+    0x8f, 0x40, 0x0, 0x4, 0xf8, 0x0, 0x0, 0x1,
+    0xef, 0x30, 0x0, 0x7f, 0x50, 0x0, 0x5, 0xf8,
+    0x0, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x4f, 0x80,
+    0x0, 0x8, 0xf5, 0x0, 0x0, 0x4f, 0xd0, 0x0,
+    0x0, 0xe, 0xe1, 0x0, 0x1e, 0xe0, 0x0, 0x1,
+    0xef, 0x30, 0x0, 0x0, 0x4, 0xfe, 0x87, 0xef,
+    0x40, 0x0, 0xa, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x3b, 0xff, 0xb3, 0x0,
+
+    /* U+0028 "(" */
+    0x0, 0x4, 0xff, 0x40, 0x0, 0xcf, 0xc0, 0x0,
+    0x4f, 0xf5, 0x0, 0xb, 0xfe, 0x0, 0x0, 0xff,
+    0x90, 0x0, 0x5f, 0xf4, 0x0, 0x9, 0xff, 0x0,
+    0x0, 0xcf, 0xd0, 0x0, 0xf, 0xfa, 0x0, 0x2,
+    0xff, 0x70, 0x0, 0x3f, 0xf6, 0x0, 0x4, 0xff,
+    0x60, 0x0, 0x5f, 0xf5, 0x0, 0x5, 0xff, 0x50,
+    0x0, 0x4f, 0xf6, 0x0, 0x3, 0xff, 0x60, 0x0,
+    0x2f, 0xf7, 0x0, 0x0, 0xff, 0xa0, 0x0, 0xc,
+    0xfd, 0x0, 0x0, 0x9f, 0xf0, 0x0, 0x5, 0xff,
+    0x40, 0x0, 0xf, 0xf9, 0x0, 0x0, 0xaf, 0xe0,
+    0x0, 0x4, 0xff, 0x50, 0x0, 0xc, 0xfc, 0x0,
+    0x0, 0x4f, 0xf4,
+
+    /* U+0029 ")" */
+    0xd, 0xfb, 0x0, 0x0, 0x6f, 0xf3, 0x0, 0x0,
+    0xdf, 0xb0, 0x0, 0x7, 0xff, 0x20, 0x0, 0x2f,
+    0xf7, 0x0, 0x0, 0xdf, 0xc0, 0x0, 0x8, 0xff,
+    0x0, 0x0, 0x6f, 0xf3, 0x0, 0x3, 0xff, 0x60,
+    0x0, 0xf, 0xf9, 0x0, 0x0, 0xff, 0xa0, 0x0,
+    0xe, 0xfb, 0x0, 0x0, 0xdf, 0xc0, 0x0, 0xd,
+    0xfc, 0x0, 0x0, 0xef, 0xb0, 0x0, 0xf, 0xfa,
+    0x0, 0x0, 0xff, 0x90, 0x0, 0x3f, 0xf6, 0x0,
+    0x6, 0xff, 0x30, 0x0, 0x8f, 0xf0, 0x0, 0xd,
+    0xfc, 0x0, 0x2, 0xff, 0x70, 0x0, 0x7f, 0xf2,
+    0x0, 0xd, 0xfb, 0x0, 0x6, 0xff, 0x30, 0x0,
+    0xdf, 0xb0, 0x0,
+
+    /* U+003E ">" */
+    0x1b, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xfe, 0x82, 0x0, 0x0, 0x0, 0x0, 0x9, 0xef,
+    0xff, 0xc5, 0x0, 0x0, 0x0, 0x0, 0x5, 0xbf,
+    0xff, 0xe9, 0x20, 0x0, 0x0, 0x0, 0x2, 0x8e,
+    0xff, 0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x4a,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x4, 0xbf,
+    0xf6, 0x0, 0x0, 0x0, 0x28, 0xef, 0xff, 0xc3,
+    0x0, 0x0, 0x5c, 0xff, 0xfe, 0x82, 0x0, 0x3,
+    0x9f, 0xff, 0xfb, 0x50, 0x0, 0x0, 0x1f, 0xff,
+    0xe8, 0x20, 0x0, 0x0, 0x0, 0x2f, 0xb5, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+00B0 "°" */
+    0x0, 0x0, 0x10, 0x0, 0x0, 0x0, 0x7e, 0xff,
+    0xc4, 0x0, 0xa, 0xfa, 0x67, 0xdf, 0x50, 0x4f,
+    0x80, 0x0, 0xc, 0xf0, 0x9f, 0x0, 0x0, 0x4,
+    0xf5, 0xbd, 0x0, 0x0, 0x2, 0xf6, 0x9f, 0x10,
+    0x0, 0x5, 0xf4, 0x3f, 0xa0, 0x0, 0x1e, 0xe0,
+    0x8, 0xfd, 0x9a, 0xff, 0x40, 0x0, 0x5c, 0xfe,
+    0xa2, 0x0
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 4},
+    {.bitmap_index = 91, .adv_w = 102, .box_w = 5, .box_h = 8, .ofs_x = 1, .ofs_y = -4},
+    {.bitmap_index = 111, .adv_w = 172, .box_w = 9, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 125, .adv_w = 102, .box_w = 5, .box_h = 4, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 135, .adv_w = 158, .box_w = 12, .box_h = 27, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 297, .adv_w = 299, .box_w = 17, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 467, .adv_w = 166, .box_w = 8, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 547, .adv_w = 257, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 707, .adv_w = 256, .box_w = 15, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 857, .adv_w = 300, .box_w = 18, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1037, .adv_w = 257, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1197, .adv_w = 276, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1357, .adv_w = 268, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1517, .adv_w = 289, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1677, .adv_w = 276, .box_w = 16, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1837, .adv_w = 102, .box_w = 5, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1875, .adv_w = 328, .box_w = 22, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2095, .adv_w = 339, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2275, .adv_w = 324, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2465, .adv_w = 370, .box_w = 20, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2665, .adv_w = 300, .box_w = 16, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2825, .adv_w = 284, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 2975, .adv_w = 346, .box_w = 19, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3165, .adv_w = 364, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3345, .adv_w = 139, .box_w = 4, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3385, .adv_w = 322, .box_w = 19, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3575, .adv_w = 266, .box_w = 15, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3725, .adv_w = 428, .box_w = 22, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 3945, .adv_w = 364, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4125, .adv_w = 376, .box_w = 22, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4345, .adv_w = 323, .box_w = 17, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4515, .adv_w = 326, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 4695, .adv_w = 278, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4855, .adv_w = 263, .box_w = 17, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5025, .adv_w = 354, .box_w = 18, .box_h = 20, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 5205, .adv_w = 319, .box_w = 21, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 5415, .adv_w = 504, .box_w = 31, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5725, .adv_w = 302, .box_w = 19, .box_h = 20, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5915, .adv_w = 290, .box_w = 20, .box_h = 20, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6115, .adv_w = 268, .box_w = 14, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6220, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6388, .adv_w = 256, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6501, .adv_w = 306, .box_w = 16, .box_h = 21, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6669, .adv_w = 274, .box_w = 15, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 6782, .adv_w = 158, .box_w = 11, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6898, .adv_w = 309, .box_w = 16, .box_h = 20, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 7058, .adv_w = 305, .box_w = 15, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7216, .adv_w = 125, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7258, .adv_w = 276, .box_w = 16, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7426, .adv_w = 125, .box_w = 4, .box_h = 21, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7468, .adv_w = 474, .box_w = 26, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7663, .adv_w = 305, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7776, .adv_w = 284, .box_w = 16, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7896, .adv_w = 306, .box_w = 16, .box_h = 20, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 8056, .adv_w = 184, .box_w = 9, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8124, .adv_w = 224, .box_w = 14, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8229, .adv_w = 185, .box_w = 11, .box_h = 19, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8334, .adv_w = 303, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 8447, .adv_w = 250, .box_w = 17, .box_h = 15, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 8575, .adv_w = 403, .box_w = 25, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8763, .adv_w = 247, .box_w = 16, .box_h = 15, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8883, .adv_w = 250, .box_w = 17, .box_h = 20, .ofs_x = -1, .ofs_y = -5},
+    {.bitmap_index = 9053, .adv_w = 233, .box_w = 13, .box_h = 15, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9151, .adv_w = 121, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 9151, .adv_w = 378, .box_w = 22, .box_h = 20, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9371, .adv_w = 151, .box_w = 7, .box_h = 26, .ofs_x = 2, .ofs_y = -5},
+    {.bitmap_index = 9462, .adv_w = 151, .box_w = 7, .box_h = 26, .ofs_x = 0, .ofs_y = -5},
+    {.bitmap_index = 9553, .adv_w = 261, .box_w = 14, .box_h = 13, .ofs_x = 1, .ofs_y = 3},
+    {.bitmap_index = 9644, .adv_w = 188, .box_w = 10, .box_h = 10, .ofs_x = 1, .ofs_y = 11}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_7[] = {
+    0x0, 0x5, 0x8, 0x9, 0x1e, 0x90
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 43, .range_length = 16, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 65, .range_length = 9, .glyph_id_start = 17,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 75, .range_length = 6, .glyph_id_start = 26,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 82, .range_length = 8, .glyph_id_start = 32,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 97, .range_length = 9, .glyph_id_start = 40,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 107, .range_length = 6, .glyph_id_start = 49,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 114, .range_length = 9, .glyph_id_start = 55,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 32, .range_length = 145, .glyph_id_start = 64,
+        .unicode_list = unicode_list_7, .glyph_id_ofs_list = NULL, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 5, 6, 5, 6, 7, 8, 0,
+    9, 10, 11, 12, 13, 14, 15, 8,
+    16, 18, 19, 20, 17, 21, 22, 23,
+    24, 24, 26, 27, 24, 24, 17, 28,
+    29, 1, 30, 25, 31, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 34,
+    41, 42, 37, 34, 34, 35, 35, 43,
+    44, 45, 40, 46, 46, 47, 46, 48,
+    0, 2, 3, 4, 0, 49
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 5, 6, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 8, 14, 15, 16,
+    17, 19, 20, 18, 20, 20, 20, 18,
+    20, 20, 20, 20, 20, 20, 18, 20,
+    20, 1, 21, 22, 23, 23, 24, 25,
+    26, 27, 28, 28, 28, 0, 28, 27,
+    29, 27, 27, 30, 30, 28, 30, 30,
+    31, 32, 33, 34, 34, 35, 34, 36,
+    0, 2, 3, 4, 0, 37
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 0, 0, 0, 8, 9, 0, 0,
+    -4, 0, -3, 4, 0, -4, 0, -4,
+    -2, 0, 0, 0, -4, 0, 0, -6,
+    -7, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, -4, 0, -7, 0, -54, 0,
+    -9, 9, 13, 0, 0, -9, 4, 4,
+    15, 9, -8, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -12, 0, 0, 0, 0, 0, 0,
+    15, 0, 4, 0, 0, -9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -17, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -17, 0, 0,
+    1, -3, 0, 3, -8, -6, -9, 3,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -28, 0, 0, -3, 0, 44,
+    -5, -6, 4, 4, -4, 0, -6, 4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -28, 0, 0,
+    0, 15, -30, -43, -30, -9, 13, 0,
+    0, -30, 0, 5, -10, 0, -7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 21, 0, 0, 0, 0, 3,
+    -5, -9, 0, -1, -1, -4, 0, 0,
+    -3, 0, 0, 0, 0, -4, 0, -9,
+    0, -11, -15, -15, 0, 0, 0, 0,
+    0, 0, 4, 0, 3, -4, 0, 1,
+    0, 4, 0, 0, -3, 4, 4, -1,
+    0, 0, 0, -9, 0, -1, 0, 0,
+    0, 0, 1, 0, -3, 0, -5, 0,
+    -8, 0, 0, -4, 0, 0, 0, 0,
+    -1, 1, -3, -3, 0, 0, -4, 0,
+    0, 0, 0, 0, 0, 0, -2, -2,
+    0, -4, -5, 0, 0, 0, 0, 1,
+    0, -3, 0, -4, -4, -4, 0, 0,
+    0, 0, 0, 0, 0, 0, -3, -6,
+    0, -7, -3, -13, 0, 0, 4, 9,
+    12, 0, -11, -1, -5, 0, -1, -21,
+    4, -3, 3, 4, 0, 0, -23, 0,
+    -24, -4, -39, 13, 0, 6, 0, 0,
+    0, 1, 0, -8, -6, 0, -13, 0,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    -2, -2, 0, -2, -6, 0, 0, 0,
+    0, 0, 0, -4, 0, -3, -5, -4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, -4, 0, -5, 0, -9, 0, 0,
+    2, 4, 4, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 3, 0,
+    -4, 0, -4, -3, -5, 0, 0, 4,
+    0, 0, 0, 0, 0, -5, -7, 0,
+    -9, -3, 1, 0, 0, -22, -23, -19,
+    -9, 4, 0, -4, -29, -8, 0, -8,
+    0, -9, -8, -29, 0, 0, 0, 2,
+    -1, 4, -17, 0, -22, -11, -11, -13,
+    -5, -12, -1, -9, -12, 3, 0, -4,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -2, 0, -4, 0, -8, -10, -10, 0,
+    0, 0, 0, 0, 0, 0, 0, 2,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 22, 0, 0, 0, 0, 0, 0,
+    3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 3, -9, -9, 0,
+    -4, -4, -5, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, -4, 0, -10, -11,
+    -13, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, -6, 0, 4, 0, 0, 0,
+    0, -8, 15, 13, -4, -19, 0, 4,
+    -7, 0, -22, -2, -6, 4, -4, 6,
+    0, -16, -7, -17, -15, -19, 0, 0,
+    -2, 0, 0, -2, -2, -4, -12, -15,
+    -1, -42, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, 0,
+    -2, -4, -7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -1,
+    0, 0, 0, -1, 6, 0, -10, 4,
+    -3, -1, -12, -4, 0, -6, -4, -3,
+    -7, -8, 0, -4, -1, -3, -8, -5,
+    -3, 0, -10, 0, 0, -9, 0, -8,
+    0, -8, -8, 4, 0, 0, 0, 0,
+    -9, 4, 0, -6, 0, -3, -5, -14,
+    -3, -3, -3, -1, -3, -1, 0, 0,
+    0, 0, -4, -4, -4, -3, 0, -3,
+    0, 0, -3, -5, -3, -4, -5, -4,
+    0, -1, 0, 0, -3, 0, -4, -19,
+    -6, 7, 0, 0, -21, -8, 4, -8,
+    3, 0, -4, -14, 0, 2, 0, 0,
+    -8, 0, -9, 0, -8, -4, -4, -4,
+    0, -8, 2, -9, -8, 13, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -3, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, -4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -7, 0, -6, 0, 0, -4,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, -7, 0, 0,
+    0, -15, 0, 3, -10, 9, 1, -3,
+    -21, 0, 0, -10, -4, 0, -11, -13,
+    0, -19, -4, -18, -17, -22, -6, 0,
+    -10, -4, -4, -8, -12, -8, -17, -18,
+    -10, -4, -3, 0, 0, 0, -4, 13,
+    10, -10, -17, 0, 1, -14, 0, -22,
+    -3, -4, 9, -6, 1, 0, -29, -5,
+    -23, -4, -33, 1, 0, -3, 0, 0,
+    0, -2, -3, -17, -3, 0, -29, 0,
+    0, 0, -4, -1, -13, -21, 0, 0,
+    -2, -7, -13, -4, 0, -3, 0, 0,
+    0, -20, -4, -14, -4, -8, -11, -4,
+    -7, 0, -5, -9, -9, 0, 2, 0,
+    -3, -15, 0, 9, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, -3, -9,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, -9, -4, -2, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0,
+    7, -4, 0, -7, 0, -15, -14, -9,
+    -9, 18, 8, 4, -39, -3, 9, -4,
+    0, -4, -4, -16, 0, 4, -6, -4,
+    -13, -4, -13, 0, -25, -6, -6, -17,
+    1, -6, -15, -15, -4, 18, -7, 0,
+    0, 4, -10, -17, -18, -11, 13, 0,
+    1, -33, -4, 4, -8, -3, -10, -10,
+    -17, -7, -4, 0, 0, -10, -9, -25,
+    0, -25, -6, -16, -26, -1, -14, -8,
+    -15, -13, 12, -6, 0, -4, 0, -8,
+    0, 8, -15, 4, 0, 0, -24, 0,
+    -4, -10, -8, -3, -11, -15, -10, -13,
+    -4, -10, -9, -13, -8, 0, -13, -4,
+    -4, -9, -10, -12, -13, -17, -6, -9,
+    -7, 0, -5, 3, -14, -17, -9, -15,
+    15, -4, 2, -42, -8, 9, -10, -8,
+    -17, -13, -19, -5, -4, -4, -9, -13,
+    -1, -29, 0, -27, -10, -17, -30, -9,
+    -16, -19, -22, -15, 9, 0, -13, 0,
+    0, 0, 0, 0, 0, -10, -2, 0,
+    0, 0, -10, 0, -5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, -4, 0,
+    0, -9, 0, -12, 0, 0, 4, -5,
+    0, 0, -12, -4, -10, 0, 0, -12,
+    0, -4, 0, 0, -5, 0, -36, -9,
+    -18, -5, -16, -2, 0, 0, 0, 0,
+    0, 0, 0, -7, -8, -4, -8, 0,
+    0, 0, -10, -5, 9, 0, -3, -10,
+    -3, -8, -9, 0, -5, -2, -3, 3,
+    -1, 0, 0, -39, -4, -6, 0, -10,
+    0, -3, -4, 0, 0, 0, 3, 0,
+    -3, -8, -3, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 0, 0, 0, 0,
+    0, 0, -3, 0, 0, 4, 0, 0,
+    0, -12, -4, -9, 0, 0, -13, 0,
+    -4, 0, 0, 0, 0, -43, 0, -9,
+    -17, -22, -7, 0, 0, 0, 0, 0,
+    0, 0, -4, -7, -2, -7, 0, 8,
+    0, 14, -4, -4, -13, 5, 22, 8,
+    10, -12, 5, 19, 5, 13, 10, 0,
+    0, 0, 0, 0, 0, 0, 0, -4,
+    0, -4, 36, 36, 0, 0, 0, 4,
+    0, 0, 17, -7, 0, 0, 0, 0,
+    0, 0, 0, -3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -38,
+    -5, -4, -18, -22, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -7, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -38, -5, -4, -18,
+    -22, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -10, 4, 0, -4, 4, 8, 4,
+    -13, 0, -1, -4, 4, 0, 0, 0,
+    0, -11, 0, -4, -3, -9, -4, 0,
+    -10, -3, -3, -8, 0, -4, -13, -9,
+    -5, 0, -7, 0, -5, -4, -4, -4,
+    -18, 1, -3, 1, -3, -12, 1, 10,
+    1, 4, 1, -11, -18, -5, -17, -9,
+    -12, -19, -17, -4, -3, -5, -3, -3,
+    -1, 7, 0, 7, -3, 0, 14, 0,
+    0, 0, 0, 0, 0, 0, 0, -3,
+    -4, -4, 0, 0, -12, 0, -2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, -4, 0, -6, 0, 0, 0, 0,
+    -4, 4, 0, -8, -9, -3, 0, -13,
+    -3, -10, -3, -5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -8,
+    0, 0, 0, -6, 0, -4, 0, 0,
+    -2, -3, 0, 0, 0, -6, -15, -14,
+    3, 5, 5, -1, -13, 3, 7, 3,
+    13, 3, -3, -12, 0, -18, 0, 0,
+    -13, -12, -8, 0, -7, 0, 0, -3,
+    7, 0, -4, -13, -4, 17, -4, 0,
+    0, 0, -10, 0, 4, -4, 4, 0,
+    0, -15, 0, -3, -1, 0, -4, -4,
+    0, 0, -18, -5, -10, 0, -13, -4,
+    0, -8, 0, 0, -4, 0, -4, -13,
+    0, -4, 4, 0, 0, 0, 0, -6,
+    1, 0, 0, -5, -3, 0, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, 0,
+    0, 0, 1, 0, -4, -4, 0, 0,
+    0, 10, 0, 0, 0, -28, -26, 1,
+    19, 13, 8, -18, 3, 19, 0, 17,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 49,
+    .right_class_cnt     = 37,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 8,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_montserrat_28 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 30,          /*The maximum line height required by the font*/
+    .base_line = 5,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 1,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_16,   /*Characters outside the subset*/
+};
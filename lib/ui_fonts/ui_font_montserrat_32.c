@@ -0,0 +1,2140 @@
+/*******************************************************************************
+ * Size: 32 px
+ * Bpp: 4
+ * Opts: generated by generate_ui_fonts.py from lv_font_montserrat_32.c, plain
+ * Characters:  %()+,-./0123456789:>ABCDEFGHIKLMNOPRSTUVWXYabcdefghiklmnoprstuvwxyz°
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
+    /* U+002B "+" */
+    0x0, 0x0, 0x0, 0xee, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xfa, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xf7, 0x78, 0x88, 0x88, 0xff,
+    0xd8, 0x88, 0x88, 0x30, 0x0, 0x0, 0xf, 0xfa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xfa, 0x0, 0x0,
+    0x0,
+
+    /* U+002C "," */
+    0x7, 0xca, 0x14, 0xff, 0xf9, 0x6f, 0xff, 0xb2,
+    0xef, 0xf8, 0x4, 0xff, 0x30, 0x6f, 0xe0, 0xa,
+    0xf9, 0x0, 0xef, 0x30, 0x2f, 0xe0, 0x0,
+
+    /* U+002D "-" */
+    0x1a, 0xaa, 0xaa, 0xaa, 0xa4, 0x2f, 0xff, 0xff,
+    0xff, 0xf7, 0x2f, 0xff, 0xff, 0xff, 0xf7,
+
+    /* U+002E "." */
+    0x1, 0x42, 0x1, 0xef, 0xf4, 0x7f, 0xff, 0xb6,
+    0xff, 0xf9, 0xa, 0xfc, 0x10,
+
+    /* U+002F "/" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0xf, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0030 "0" */
+    0x0, 0x0, 0x0, 0x6b, 0xef, 0xfc, 0x82, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff, 0xff,
+    0xf9, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfd,
+    0xef, 0xff, 0xfc, 0x0, 0x0, 0x5, 0xff, 0xfc,
+    0x40, 0x0, 0x29, 0xff, 0xfa, 0x0, 0x0, 0xef,
+    0xfb, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0,
+    0x7f, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xc0, 0xd, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0x21, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf6, 0x4f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x96, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x7f,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
+    0xc7, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfc, 0x6f, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xb4, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xf9, 0x1f, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0x60, 0xdf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf2,
+    0x7, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xfc, 0x0, 0xe, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0x40, 0x0, 0x5f, 0xff, 0xc4, 0x0,
+    0x2, 0x9f, 0xff, 0xa0, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xde, 0xff, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xbe, 0xff, 0xd8, 0x20, 0x0,
+    0x0,
+
+    /* U+0031 "1" */
+    0xcf, 0xff, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff,
+    0xf7, 0x9c, 0xcc, 0xce, 0xff, 0x70, 0x0, 0x0,
+    0xbf, 0xf7, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0,
+    0x0, 0xbf, 0xf7, 0x0, 0x0, 0xb, 0xff, 0x70,
+    0x0, 0x0, 0xbf, 0xf7, 0x0, 0x0, 0xb, 0xff,
+    0x70, 0x0, 0x0, 0xbf, 0xf7, 0x0, 0x0, 0xb,
+    0xff, 0x70, 0x0, 0x0, 0xbf, 0xf7, 0x0, 0x0,
+    0xb, 0xff, 0x70, 0x0, 0x0, 0xbf, 0xf7, 0x0,
+    0x0, 0xb, 0xff, 0x70, 0x0, 0x0, 0xbf, 0xf7,
+    0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0, 0xbf,
+    0xf7, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0, 0x0,
+    0xbf, 0xf7, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0,
+    0x0, 0xbf, 0xf7,
+
+    /* U+0032 "2" */
+    0x0, 0x0, 0x49, 0xce, 0xff, 0xda, 0x50, 0x0,
+    0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xfd,
+    0x20, 0x0, 0x9, 0xff, 0xff, 0xfe, 0xde, 0xff,
+    0xff, 0xe2, 0x0, 0x4f, 0xff, 0xb4, 0x0, 0x0,
+    0x18, 0xff, 0xfb, 0x0, 0x4, 0xe6, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xcf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1d, 0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xdf, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xef, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6, 0xff, 0xff, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xcc, 0xc3, 0xd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xf4, 0xd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf4,
+
+    /* U+0033 "3" */
+    0xd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf0, 0x9, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xff,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0xfd, 0xa5, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0,
+    0x6, 0x99, 0xad, 0xff, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xbf, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xb0, 0xb8, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xf7, 0x5f, 0xfe, 0x83, 0x0, 0x0, 0x16, 0xef,
+    0xfe, 0x7, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff,
+    0xff, 0x30, 0x4, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xfc, 0x30, 0x0, 0x0, 0x27, 0xbd, 0xef, 0xed,
+    0x94, 0x0, 0x0,
+
+    /* U+0034 "4" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xc, 0xff, 0xa0, 0x0, 0x3, 0xdd, 0x90, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xd0, 0x0, 0x0, 0x3f,
+    0xfc, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf2, 0x0,
+    0x0, 0x3, 0xff, 0xc0, 0x0, 0x0, 0x3, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x3f, 0xfc, 0x0, 0x0,
+    0x1, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xc0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0,
+    0x9b, 0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xdf, 0xff,
+    0xbb, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xc0, 0x0, 0x0,
+
+    /* U+0035 "5" */
+    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x0, 0x0, 0xe, 0xff, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0x0, 0x0, 0xf, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xfd, 0xcc, 0xba, 0x96, 0x20, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xfc,
+    0x40, 0x0, 0x0, 0xcf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0x49, 0xff, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2e, 0xff, 0xc0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf0, 0x6, 0xd3, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0xc0, 0x1e, 0xff, 0xb5, 0x10, 0x0, 0x4,
+    0xcf, 0xff, 0x40, 0x2e, 0xff, 0xff, 0xfe, 0xdd,
+    0xff, 0xff, 0xf8, 0x0, 0x1, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x59,
+    0xde, 0xff, 0xdb, 0x61, 0x0, 0x0,
+
+    /* U+0036 "6" */
+    0x0, 0x0, 0x0, 0x27, 0xbe, 0xff, 0xec, 0x94,
+    0x0, 0x0, 0x0, 0x1a, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x70, 0x0, 0x3, 0xef, 0xff, 0xfe, 0xcb,
+    0xcf, 0xff, 0x10, 0x0, 0x2e, 0xff, 0xf8, 0x10,
+    0x0, 0x0, 0x36, 0x0, 0x0, 0xcf, 0xfd, 0x20,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x0, 0x2, 0x68, 0x87, 0x40, 0x0,
+    0x0, 0x5f, 0xfc, 0x4, 0xdf, 0xff, 0xff, 0xff,
+    0x80, 0x0, 0x6f, 0xfb, 0x7f, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0x10, 0x7f, 0xff, 0xff, 0xd6, 0x10,
+    0x3, 0x9f, 0xff, 0xc0, 0x6f, 0xff, 0xfa, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf4, 0x5f, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0x2f, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfc, 0xe,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xfd,
+    0x9, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xfb, 0x2, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf6, 0x0, 0x8f, 0xff, 0x60, 0x0, 0x0,
+    0x2c, 0xff, 0xe0, 0x0, 0xa, 0xff, 0xfe, 0xb9,
+    0x9c, 0xff, 0xff, 0x20, 0x0, 0x0, 0x7f, 0xff,
+    0xff, 0xff, 0xff, 0xc2, 0x0, 0x0, 0x0, 0x1,
+    0x7b, 0xef, 0xfd, 0xa4, 0x0, 0x0,
+
+    /* U+0037 "7" */
+    0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0xf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfd, 0xf, 0xff, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xff, 0xfb, 0xf, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf3, 0xf, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xc0, 0xf, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x50, 0xb, 0xbb,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0038 "8" */
+    0x0, 0x0, 0x16, 0xbd, 0xff, 0xed, 0x94, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x30, 0x0, 0x0, 0x9f, 0xff, 0xfc, 0xa9,
+    0xbd, 0xff, 0xff, 0x40, 0x0, 0x4f, 0xff, 0x91,
+    0x0, 0x0, 0x4, 0xdf, 0xfe, 0x0, 0x9, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf4, 0x0,
+    0xcf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0x60, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xdf, 0xf4, 0x0, 0x6f, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x6f, 0xfe, 0x0, 0x0, 0xcf, 0xfe, 0x83,
+    0x10, 0x14, 0xaf, 0xff, 0x50, 0x0, 0x0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0, 0x0,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x0,
+    0x0, 0x1c, 0xff, 0xfc, 0x97, 0x67, 0xaf, 0xff,
+    0xf7, 0x0, 0xb, 0xff, 0xe4, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xf5, 0x3, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xd0, 0x7f, 0xfb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x19, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf2,
+    0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x14, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xd0, 0xc, 0xff, 0xf6, 0x0, 0x0,
+    0x0, 0x2b, 0xff, 0xf6, 0x0, 0x1d, 0xff, 0xff,
+    0xb9, 0x9a, 0xdf, 0xff, 0xf8, 0x0, 0x0, 0x1a,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x0, 0x0,
+    0x0, 0x2, 0x7b, 0xdf, 0xfe, 0xd9, 0x50, 0x0,
+    0x0,
+
+    /* U+0039 "9" */
+    0x0, 0x0, 0x16, 0xbd, 0xff, 0xda, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x6e, 0xff, 0xff, 0xff, 0xff,
+    0xe4, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xfb, 0x99,
+    0xbf, 0xff, 0xf6, 0x0, 0x0, 0x4f, 0xff, 0x90,
+    0x0, 0x0, 0x8, 0xff, 0xf3, 0x0, 0xb, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x7, 0xff, 0xd0, 0x0,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0x40, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xfa, 0x0, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0xd0, 0xc, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0x0, 0x5f, 0xff,
+    0x90, 0x0, 0x0, 0x8, 0xff, 0xff, 0xf1, 0x0,
+    0xaf, 0xff, 0xfb, 0x99, 0xbf, 0xff, 0xaf, 0xff,
+    0x20, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0xff, 0xf2, 0x0, 0x0, 0x28, 0xce, 0xfe, 0xc8,
+    0x20, 0x1f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8f, 0xfb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf7, 0x0, 0x0, 0x9, 0x30, 0x0, 0x0,
+    0x3b, 0xff, 0xfb, 0x0, 0x0, 0x5, 0xff, 0xec,
+    0xbc, 0xef, 0xff, 0xfc, 0x10, 0x0, 0x0, 0xbf,
+    0xff, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x5a, 0xdf, 0xff, 0xda, 0x60, 0x0, 0x0,
+    0x0,
+
+    /* U+003A ":" */
+    0x9, 0xfc, 0x16, 0xff, 0xf9, 0x7f, 0xff, 0xb1,
+    0xef, 0xf4, 0x1, 0x42, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x42,
+    0x1, 0xef, 0xf4, 0x7f, 0xff, 0xb6, 0xff, 0xf9,
+    0xa, 0xfc, 0x10,
+
+    /* U+0041 "A" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8f, 0xfb, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff,
+    0x1b, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xa0, 0x4f, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf3, 0x0, 0xdf, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfc, 0x0, 0x6, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0xff, 0x40, 0x0, 0xe, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x0,
+    0x7f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf6, 0x0, 0x0, 0x1, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x80, 0x0, 0x0, 0x0, 0x2f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0x0, 0x0,
+    0x0, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0,
+    0x0, 0x7, 0xff, 0xd8, 0x88, 0x88, 0x88, 0x88,
+    0x88, 0xaf, 0xfe, 0x0, 0x0, 0x0, 0xef, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf5,
+    0x0, 0x0, 0x6f, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7, 0xff, 0xd0, 0x0, 0xd, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x40, 0x5, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfc, 0x0, 0xcf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf3,
+
+    /* U+0042 "B" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x60,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xfe, 0x50, 0x0, 0xaf, 0xfd, 0x99, 0x99,
+    0x99, 0x9a, 0xdf, 0xff, 0xf6, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xdf, 0xff, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x40, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x60, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xd, 0xff, 0x50, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x10,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x3, 0xdf,
+    0xf9, 0x0, 0xaf, 0xfd, 0x99, 0x99, 0x99, 0x9a,
+    0xdf, 0xff, 0xb0, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x14, 0xaf,
+    0xff, 0x80, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6, 0xff, 0xf2, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xf9, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf6, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3d, 0xff, 0xf1, 0xaf, 0xfd,
+    0x99, 0x99, 0x99, 0x99, 0xad, 0xff, 0xff, 0x60,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xe5, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xed, 0xa5, 0x0, 0x0,
+
+    /* U+0043 "C" */
+    0x0, 0x0, 0x0, 0x1, 0x6b, 0xdf, 0xfe, 0xd9,
+    0x50, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xe7, 0x0, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0x7f, 0xff, 0xfa, 0x40, 0x0, 0x0, 0x5b,
+    0xff, 0xfa, 0x0, 0x5f, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0xeb, 0x0, 0x1e, 0xff, 0xd1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x8,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xe0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xef, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x20, 0x0, 0x5, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0x0, 0x0, 0x4f, 0xb0, 0x0, 0x7, 0xff,
+    0xff, 0xa4, 0x0, 0x0, 0x5, 0xbf, 0xff, 0xa0,
+    0x0, 0x5, 0xff, 0xff, 0xff, 0xed, 0xef, 0xff,
+    0xff, 0xc1, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0xbd, 0xff, 0xed, 0x95, 0x0, 0x0,
+
+    /* U+0044 "D" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x40,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0xaf, 0xfe,
+    0xcc, 0xcc, 0xcc, 0xde, 0xff, 0xff, 0xfc, 0x10,
+    0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x16,
+    0xdf, 0xff, 0xd1, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0x70, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xe0, 0xaf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf5,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf9, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfd, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xfd, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf5, 0xaf, 0xf9, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xff, 0x70, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0xfc, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x16, 0xdf, 0xff, 0xd1,
+    0x0, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xce, 0xff,
+    0xff, 0xfc, 0x10, 0x0, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfd, 0x60, 0x0, 0x0, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xfe, 0xc8, 0x40, 0x0,
+    0x0, 0x0,
+
+    /* U+0045 "E" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x2a, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xdb, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xb8, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xc0, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xec, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xc7, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xf9,
+
+    /* U+0046 "F" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf2, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0x2a, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0xbb,
+    0xbb, 0xbb, 0xbb, 0xbb, 0x90, 0xa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xa, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0047 "G" */
+    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xfe, 0xda,
+    0x61, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9f, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0xfe, 0xde, 0xff, 0xff, 0xfe,
+    0x30, 0x0, 0x7, 0xff, 0xff, 0xb4, 0x0, 0x0,
+    0x4, 0x9f, 0xff, 0xd0, 0x0, 0x5f, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xcd, 0x10, 0x1,
+    0xef, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x8, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0x10, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2, 0xff, 0xf0, 0x5f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x2f,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xff, 0xf0, 0xe, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2, 0xff, 0xf0, 0x8, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0,
+    0x1, 0xef, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf0, 0x0, 0x4f, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x0, 0x6,
+    0xff, 0xff, 0xb4, 0x0, 0x0, 0x3, 0x8f, 0xff,
+    0xf0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfe, 0xde,
+    0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x1, 0xaf,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x6a, 0xdf, 0xfe, 0xda, 0x61,
+    0x0, 0x0,
+
+    /* U+0048 "H" */
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc,
+    0xcc, 0xcc, 0xef, 0xfa, 0xaf, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xaf, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa,
+
+    /* U+0049 "I" */
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9, 0xaf, 0xf9,
+    0xaf, 0xf9, 0xaf, 0xf9,
+
+    /* U+004B "K" */
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xd1, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xfd, 0x10, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0xd1, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xfd, 0x10, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0xb, 0xff, 0xe2,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0xbf,
+    0xfe, 0x20, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0xb, 0xff, 0xe2, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0xaf, 0xfe, 0x30, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0xa, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0xaf, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0xa, 0xff,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0xaf, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x10, 0x0,
+    0x0, 0x0, 0xaf, 0xff, 0xff, 0x50, 0x3f, 0xff,
+    0xc0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf5, 0x0,
+    0x5, 0xff, 0xfa, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0x60, 0x0, 0x0, 0x7f, 0xff, 0x80, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x9, 0xff, 0xf5,
+    0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0x30, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0xe1, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xdf, 0xfd, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2e,
+    0xff, 0xb0, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf8,
+
+    /* U+004C "L" */
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xc8,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+
+    /* U+004D "M" */
+    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xb, 0xff, 0x2a, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf2, 0xaf, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xff, 0x2a, 0xff, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f,
+    0xff, 0xf2, 0xaf, 0xff, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0x2a, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0xf2, 0xaf, 0xfb, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xce, 0xff, 0x2a,
+    0xff, 0x7b, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf2, 0xef, 0xf2, 0xaf, 0xf7, 0x1f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x8f, 0xf8, 0xe, 0xff,
+    0x2a, 0xff, 0x70, 0x7f, 0xfb, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0x0, 0xef, 0xf2, 0xaf, 0xf7, 0x0,
+    0xdf, 0xf5, 0x0, 0x0, 0xb, 0xff, 0x50, 0xe,
+    0xff, 0x2a, 0xff, 0x70, 0x3, 0xff, 0xe0, 0x0,
+    0x4, 0xff, 0xb0, 0x0, 0xef, 0xf3, 0xaf, 0xf7,
+    0x0, 0xa, 0xff, 0x80, 0x0, 0xdf, 0xf2, 0x0,
+    0xe, 0xff, 0x3a, 0xff, 0x70, 0x0, 0x1e, 0xff,
+    0x20, 0x8f, 0xf8, 0x0, 0x0, 0xef, 0xf3, 0xaf,
+    0xf7, 0x0, 0x0, 0x6f, 0xfb, 0x2f, 0xfe, 0x0,
+    0x0, 0xe, 0xff, 0x3a, 0xff, 0x70, 0x0, 0x0,
+    0xcf, 0xfd, 0xff, 0x50, 0x0, 0x0, 0xef, 0xf3,
+    0xaf, 0xf7, 0x0, 0x0, 0x3, 0xff, 0xff, 0xb0,
+    0x0, 0x0, 0xe, 0xff, 0x3a, 0xff, 0x70, 0x0,
+    0x0, 0x9, 0xff, 0xf2, 0x0, 0x0, 0x0, 0xef,
+    0xf3, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x1e, 0xf7,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x3a, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x25, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf3, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x3a, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xf3,
+
+    /* U+004E "N" */
+    0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xff,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xfe, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0xbf, 0xff,
+    0x50, 0x0, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0xd, 0xff, 0xf2, 0x0, 0x0, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x2, 0xef, 0xfd, 0x10, 0x0, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x4f, 0xff, 0xb0,
+    0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x6,
+    0xff, 0xf9, 0x0, 0x0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x9f, 0xff, 0x60, 0x0, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0xc, 0xff, 0xf3, 0x0,
+    0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x1, 0xef,
+    0xfe, 0x10, 0x9f, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0xd0, 0x9f, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xfa, 0x9f, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0xef, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xff, 0xfa, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xff, 0xfa, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2e, 0xff, 0xfa,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xfa, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xfa,
+
+    /* U+004F "O" */
+    0x0, 0x0, 0x0, 0x1, 0x6a, 0xdf, 0xff, 0xda,
+    0x61, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x19,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xfe, 0xde,
+    0xff, 0xff, 0xfe, 0x40, 0x0, 0x0, 0x0, 0x6f,
+    0xff, 0xfa, 0x40, 0x0, 0x0, 0x4b, 0xff, 0xff,
+    0x50, 0x0, 0x0, 0x4f, 0xff, 0xe4, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xef, 0xff, 0x30, 0x0, 0xe,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
+    0xef, 0xfd, 0x0, 0x8, 0xff, 0xf2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf6, 0x0,
+    0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0xc0, 0x2f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff,
+    0x5, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xf3, 0x7f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0x47, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xef, 0xf4, 0x5f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xf, 0xff, 0x32, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf0, 0xe,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xfc, 0x0, 0x8f, 0xff, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0x60,
+    0x0, 0xef, 0xfd, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2e, 0xff, 0xd0, 0x0, 0x4, 0xff, 0xfe,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xf3,
+    0x0, 0x0, 0x6, 0xff, 0xff, 0xa4, 0x0, 0x0,
+    0x4, 0xbf, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xff, 0xed, 0xef, 0xff, 0xff, 0xe4,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x16, 0xad, 0xff, 0xfd, 0xa6, 0x10,
+    0x0, 0x0, 0x0,
+
+    /* U+0050 "P" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc,
+    0xdf, 0xff, 0xff, 0x70, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x5, 0xdf, 0xff, 0x40, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf2, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x5a, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf6, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x5a, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf2, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
+    0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x5, 0xdf,
+    0xff, 0x40, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc, 0xdf,
+    0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfe, 0x40, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xec, 0x94, 0x0, 0x0, 0xa, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0052 "R" */
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xec, 0x94, 0x0,
+    0x0, 0xa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfd, 0x40, 0x0, 0xaf, 0xfe, 0xcc, 0xcc, 0xcc,
+    0xdf, 0xff, 0xff, 0x70, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x5, 0xdf, 0xff, 0x40, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf2, 0xaf, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x5a, 0xff, 0x90, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xcf, 0xf6, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x5a, 0xff, 0x90,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf2, 0xaf,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xfd,
+    0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0x5, 0xdf,
+    0xff, 0x40, 0xaf, 0xfd, 0xbb, 0xbb, 0xbb, 0xcf,
+    0xff, 0xff, 0x70, 0xa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfd, 0x40, 0x0, 0xaf, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0xa, 0xff,
+    0x90, 0x0, 0x0, 0x2, 0xff, 0xf5, 0x0, 0x0,
+    0xaf, 0xf9, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe1,
+    0x0, 0xa, 0xff, 0x90, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xb0, 0x0, 0xaf, 0xf9, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x60, 0xa, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x5f, 0xff, 0x20, 0xaf, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0xa,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x1, 0xef,
+    0xf7,
+
+    /* U+0053 "S" */
+    0x0, 0x0, 0x16, 0xbd, 0xef, 0xed, 0xa6, 0x10,
+    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x20, 0x0, 0xbf, 0xff, 0xfd, 0xbb, 0xce,
+    0xff, 0xff, 0x60, 0x7, 0xff, 0xf9, 0x10, 0x0,
+    0x0, 0x27, 0xde, 0x0, 0xd, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0x0, 0xf, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0xf9, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xcf, 0xff, 0xfc, 0x84, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0xfc,
+    0x72, 0x0, 0x0, 0x0, 0x0, 0x17, 0xcf, 0xff,
+    0xff, 0xff, 0xb2, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x48, 0xcf, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0x7f, 0xff, 0xe0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf7, 0xc, 0x70, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf4, 0x5f, 0xfe, 0x83, 0x0, 0x0, 0x0,
+    0x5e, 0xff, 0xd0, 0x4e, 0xff, 0xff, 0xfd, 0xbb,
+    0xcf, 0xff, 0xfe, 0x20, 0x1, 0x9f, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x1, 0x59,
+    0xce, 0xff, 0xec, 0x83, 0x0, 0x0,
+
+    /* U+0054 "T" */
+    0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xfa, 0xac, 0xcc, 0xcc, 0xcc, 0xff,
+    0xfc, 0xcc, 0xcc, 0xcc, 0x80, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xff, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0055 "U" */
+    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0xdf, 0xf6,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x7f, 0xfd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xb0,
+    0x2f, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0x70, 0xb, 0xff, 0xe2, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xff, 0x10, 0x2, 0xff, 0xff, 0x71,
+    0x0, 0x0, 0x5d, 0xff, 0xf6, 0x0, 0x0, 0x5f,
+    0xff, 0xff, 0xed, 0xef, 0xff, 0xff, 0x90, 0x0,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xe6,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0x9d, 0xef, 0xfd,
+    0xa6, 0x0, 0x0, 0x0,
+
+    /* U+0056 "V" */
+    0xc, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x9f, 0xf9, 0x5, 0xff, 0xf1, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf2,
+    0x0, 0xef, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0xb0, 0x0, 0x7f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x30,
+    0x0, 0x1f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xfc, 0x0, 0x0, 0x9, 0xff, 0xd0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf5, 0x0,
+    0x0, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xe0, 0x0, 0x0, 0x0, 0xaf, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x10, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0xaf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xf1, 0x0, 0x0, 0x2,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xf8, 0x0, 0x0, 0x8, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xff, 0x0, 0x0, 0xf,
+    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0xe,
+    0xff, 0x70, 0x0, 0x7f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0, 0xef,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf5, 0x5, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfc, 0xc, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xff, 0x7f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0057 "W" */
+    0xcf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfd, 0x7, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x80, 0x1f, 0xff, 0x20, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf2, 0x0, 0xcf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xfd, 0x0, 0x7, 0xff,
+    0xd0, 0x0, 0x0, 0x0, 0x0, 0xef, 0xfe, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x9, 0xff, 0x70, 0x0,
+    0x1f, 0xff, 0x20, 0x0, 0x0, 0x0, 0x4f, 0xfa,
+    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0xef, 0xf2,
+    0x0, 0x0, 0xcf, 0xf8, 0x0, 0x0, 0x0, 0x9,
+    0xff, 0x53, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x4f,
+    0xfc, 0x0, 0x0, 0x6, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0xff, 0xf0, 0xe, 0xff, 0x30, 0x0, 0x0,
+    0x9, 0xff, 0x70, 0x0, 0x0, 0x1f, 0xff, 0x30,
+    0x0, 0x0, 0x5f, 0xfa, 0x0, 0x8f, 0xf8, 0x0,
+    0x0, 0x0, 0xef, 0xf1, 0x0, 0x0, 0x0, 0xbf,
+    0xf8, 0x0, 0x0, 0xa, 0xff, 0x40, 0x3, 0xff,
+    0xd0, 0x0, 0x0, 0x4f, 0xfc, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xd0, 0x0, 0x0, 0xff, 0xe0, 0x0,
+    0xd, 0xff, 0x30, 0x0, 0xa, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x30, 0x0, 0x6f, 0xf9,
+    0x0, 0x0, 0x7f, 0xf9, 0x0, 0x0, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0xb,
+    0xff, 0x30, 0x0, 0x2, 0xff, 0xe0, 0x0, 0x5f,
+    0xfc, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xe0,
+    0x1, 0xff, 0xe0, 0x0, 0x0, 0xc, 0xff, 0x40,
+    0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x30, 0x6f, 0xf8, 0x0, 0x0, 0x0, 0x7f,
+    0xf9, 0x0, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbf, 0xf9, 0xc, 0xff, 0x30, 0x0, 0x0,
+    0x1, 0xff, 0xe0, 0x5f, 0xfb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xe2, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x4b, 0xff, 0x60, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xbf, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x6f, 0xfb, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff,
+    0xff, 0x20, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff,
+    0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xf, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xff, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xfa, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+0058 "X" */
+    0xb, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4f, 0xff, 0x30, 0x1, 0xef, 0xfa, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xef, 0xf6, 0x0, 0x0, 0x3f,
+    0xff, 0x60, 0x0, 0x0, 0x0, 0xc, 0xff, 0xa0,
+    0x0, 0x0, 0x7, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x8f, 0xfe, 0x10, 0x0, 0x0, 0x0, 0xbf, 0xfd,
+    0x0, 0x0, 0x4, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xa0, 0x0, 0x1e, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf6, 0x0,
+    0xbf, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8f, 0xff, 0x27, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xc, 0xff, 0xdf, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xff, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x5d, 0xff, 0xc0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf9, 0x2,
+    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0xc0, 0x0, 0x6f, 0xff, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0x20, 0x0, 0xa, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0xdf, 0xfc, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0xa0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x80,
+    0x0, 0x0, 0xbf, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xf4, 0x0, 0x7, 0xff, 0xf3, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xfe, 0x10, 0x3f,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1d,
+    0xff, 0xb0,
+
+    /* U+0059 "Y" */
+    0xc, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf8, 0x3, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x4, 0xff, 0xd0, 0x0, 0x9f,
+    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x40, 0x0, 0xe, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x8f, 0xfa, 0x0, 0x0, 0x5, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf1, 0x0, 0x0,
+    0x0, 0xbf, 0xfb, 0x0, 0x0, 0x0, 0xc, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0x2f, 0xff, 0x50, 0x0,
+    0x0, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xe0, 0x0, 0x1, 0xef, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xf8, 0x0, 0x9, 0xff,
+    0x90, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
+    0x20, 0x3f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xc0, 0xdf, 0xf5, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xfc, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xb, 0xff, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x3, 0xff, 0xf0, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0061 "a" */
+    0x0, 0x2, 0x8b, 0xef, 0xfe, 0xb6, 0x0, 0x0,
+    0x2, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0xb, 0xff, 0xfe, 0xba, 0xbd, 0xff, 0xff, 0x20,
+    0x2, 0xfa, 0x30, 0x0, 0x0, 0x3e, 0xff, 0xb0,
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x0, 0x5, 0xad, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0x1, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
+    0xb, 0xff, 0xe8, 0x43, 0x33, 0x33, 0xcf, 0xf5,
+    0x2f, 0xff, 0x20, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x5f, 0xfb, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xf5,
+    0x5f, 0xfc, 0x0, 0x0, 0x0, 0x3, 0xff, 0xf5,
+    0x2f, 0xff, 0x30, 0x0, 0x0, 0x2d, 0xff, 0xf5,
+    0xa, 0xff, 0xe8, 0x43, 0x49, 0xff, 0xff, 0xf5,
+    0x0, 0xbf, 0xff, 0xff, 0xff, 0xfa, 0x9f, 0xf5,
+    0x0, 0x5, 0xbe, 0xff, 0xda, 0x40, 0x9f, 0xf5,
+
+    /* U+0062 "b" */
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x4, 0x9d, 0xff,
+    0xda, 0x40, 0x0, 0x0, 0x1f, 0xff, 0xa, 0xff,
+    0xff, 0xff, 0xff, 0xc1, 0x0, 0x1, 0xff, 0xfc,
+    0xff, 0xfc, 0xbc, 0xff, 0xff, 0xe3, 0x0, 0x1f,
+    0xff, 0xff, 0x91, 0x0, 0x0, 0x6f, 0xff, 0xd1,
+    0x1, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x90, 0x1f, 0xff, 0xb0, 0x0, 0x0, 0x0,
+    0x0, 0x6f, 0xff, 0x1, 0xff, 0xf4, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xef, 0xf4, 0x1f, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0x61, 0xff,
+    0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
+    0x1f, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0xb,
+    0xff, 0x61, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xef, 0xf4, 0x1f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x6f, 0xff, 0x1, 0xff, 0xff, 0x60,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0x90, 0x1f, 0xff,
+    0xff, 0x91, 0x0, 0x0, 0x6f, 0xff, 0xd1, 0x1,
+    0xff, 0xec, 0xff, 0xfc, 0xbc, 0xff, 0xff, 0xf3,
+    0x0, 0x1f, 0xfd, 0x1b, 0xff, 0xff, 0xff, 0xff,
+    0xc2, 0x0, 0x1, 0xff, 0xd0, 0x4, 0xad, 0xff,
+    0xda, 0x40, 0x0, 0x0,
+
+    /* U+0063 "c" */
+    0x0, 0x0, 0x4, 0x9d, 0xff, 0xdb, 0x61, 0x0,
+    0x0, 0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xe5,
+    0x0, 0x0, 0x3f, 0xff, 0xfe, 0xcb, 0xdf, 0xff,
+    0xf6, 0x0, 0x1e, 0xff, 0xe5, 0x0, 0x0, 0x2a,
+    0xff, 0xe0, 0xb, 0xff, 0xd1, 0x0, 0x0, 0x0,
+    0x9, 0xa1, 0x2, 0xff, 0xf3, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x9, 0xff, 0x90, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0x90, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb, 0xff,
+    0xd1, 0x0, 0x0, 0x0, 0x9, 0xa1, 0x0, 0x1e,
+    0xff, 0xe5, 0x0, 0x0, 0x2a, 0xff, 0xe0, 0x0,
+    0x3f, 0xff, 0xfe, 0xcb, 0xdf, 0xff, 0xf5, 0x0,
+    0x0, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0,
+    0x0, 0x0, 0x4, 0x9d, 0xff, 0xeb, 0x61, 0x0,
+    0x0,
+
+    /* U+0064 "d" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe, 0x0,
+    0x0, 0x5, 0xbe, 0xff, 0xd9, 0x20, 0x2f, 0xfe,
+    0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xf8, 0x2f,
+    0xfe, 0x0, 0x5f, 0xff, 0xfe, 0xcb, 0xdf, 0xff,
+    0xcf, 0xfe, 0x2, 0xff, 0xfe, 0x50, 0x0, 0x2,
+    0xbf, 0xff, 0xfe, 0xc, 0xff, 0xd1, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0xfe, 0x2f, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xdf, 0xfe, 0x7f, 0xfc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x7f, 0xfe, 0x9f, 0xf9,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe, 0xaf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfe,
+    0x9f, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
+    0xfe, 0x7f, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfe, 0x2f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xfe, 0xc, 0xff, 0xc0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0xfe, 0x2, 0xff, 0xfc, 0x20,
+    0x0, 0x0, 0x8f, 0xff, 0xfe, 0x0, 0x5f, 0xff,
+    0xfb, 0x98, 0xaf, 0xff, 0xcf, 0xfe, 0x0, 0x3,
+    0xdf, 0xff, 0xff, 0xff, 0xfa, 0x1f, 0xfe, 0x0,
+    0x0, 0x6, 0xbe, 0xff, 0xd9, 0x30, 0xf, 0xfe,
+
+    /* U+0065 "e" */
+    0x0, 0x0, 0x5, 0xbe, 0xff, 0xd9, 0x40, 0x0,
+    0x0, 0x0, 0x3, 0xdf, 0xff, 0xff, 0xff, 0xfb,
+    0x10, 0x0, 0x0, 0x5f, 0xff, 0xfb, 0x9a, 0xcf,
+    0xff, 0xe1, 0x0, 0x2, 0xff, 0xf9, 0x10, 0x0,
+    0x2, 0xcf, 0xfc, 0x0, 0xb, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x60, 0x2f, 0xfd, 0x0,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xc0, 0x7f, 0xf8,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xf0, 0x9f,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2,
+    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xf3, 0x9f, 0xf9, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x30, 0x6f, 0xfb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x2f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x1, 0x80, 0x0, 0x2, 0xef, 0xfe,
+    0x50, 0x0, 0x0, 0x5d, 0xf8, 0x0, 0x0, 0x4f,
+    0xff, 0xff, 0xcb, 0xce, 0xff, 0xfc, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x0,
+    0x0, 0x0, 0x4, 0x9d, 0xff, 0xec, 0x83, 0x0,
+    0x0,
+
+    /* U+0066 "f" */
+    0x0, 0x0, 0x1, 0x9d, 0xff, 0xd7, 0x0, 0x0,
+    0x3, 0xef, 0xff, 0xff, 0xf3, 0x0, 0x0, 0xef,
+    0xfe, 0x99, 0xdd, 0x0, 0x0, 0x5f, 0xfe, 0x10,
+    0x0, 0x10, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf6, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x60, 0x0, 0x0, 0x8, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x40, 0x8f, 0xff, 0xff, 0xff,
+    0xff, 0xf4, 0x4, 0x88, 0xdf, 0xfb, 0x88, 0x88,
+    0x20, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf,
+    0xf7, 0x0, 0x0, 0x0,
+
+    /* U+0067 "g" */
+    0x0, 0x0, 0x5, 0xad, 0xff, 0xd9, 0x40, 0xc,
+    0xff, 0x20, 0x0, 0x4e, 0xff, 0xff, 0xff, 0xff,
+    0xb1, 0xcf, 0xf2, 0x0, 0x7f, 0xff, 0xfe, 0xbb,
+    0xcf, 0xff, 0xdd, 0xff, 0x20, 0x4f, 0xff, 0xc3,
+    0x0, 0x0, 0x7, 0xff, 0xff, 0xf2, 0xd, 0xff,
+    0xb0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0x24,
+    0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xf2, 0x8f, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x2a, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xef, 0xf2, 0xaf, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xf, 0xff, 0x28, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf2, 0x4f,
+    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
+    0x20, 0xdf, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x4f,
+    0xff, 0xf2, 0x4, 0xff, 0xfd, 0x40, 0x0, 0x1,
+    0x7f, 0xff, 0xff, 0x20, 0x6, 0xff, 0xff, 0xec,
+    0xbc, 0xff, 0xfd, 0xff, 0xf2, 0x0, 0x4, 0xef,
+    0xff, 0xff, 0xff, 0xfb, 0x1f, 0xff, 0x20, 0x0,
+    0x0, 0x6b, 0xef, 0xfd, 0x94, 0x0, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x7, 0xff, 0xc0, 0x0, 0x64, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xef, 0xf7, 0x0, 0x2f, 0xfb, 0x50,
+    0x0, 0x0, 0x5, 0xef, 0xfe, 0x0, 0x7, 0xff,
+    0xff, 0xfd, 0xbb, 0xcf, 0xff, 0xff, 0x40, 0x0,
+    0x5, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x30,
+    0x0, 0x0, 0x0, 0x38, 0xbd, 0xff, 0xed, 0xa5,
+    0x0, 0x0, 0x0,
+
+    /* U+0068 "h" */
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x4a, 0xdf, 0xfd, 0xa3, 0x0, 0x0,
+    0x1f, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x90,
+    0x0, 0x1f, 0xff, 0xdf, 0xff, 0xcc, 0xdf, 0xff,
+    0xf9, 0x0, 0x1f, 0xff, 0xff, 0x60, 0x0, 0x2,
+    0xcf, 0xff, 0x30, 0x1f, 0xff, 0xf3, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0x90, 0x1f, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x6, 0xff, 0xd0, 0x1f, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+
+    /* U+0069 "i" */
+    0x1b, 0xfb, 0x8, 0xff, 0xf6, 0x8f, 0xff, 0x61,
+    0xbe, 0xa0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x1, 0xff,
+    0xf0, 0x1f, 0xff, 0x1, 0xff, 0xf0, 0x1f, 0xff,
+    0x1, 0xff, 0xf0, 0x1f, 0xff, 0x1, 0xff, 0xf0,
+    0x1f, 0xff, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x1,
+    0xff, 0xf0, 0x1f, 0xff, 0x1, 0xff, 0xf0, 0x1f,
+    0xff, 0x1, 0xff, 0xf0,
+
+    /* U+006B "k" */
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x60,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf6,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x7f, 0xff,
+    0x60, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x9, 0xff,
+    0xf6, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0xaf,
+    0xff, 0x60, 0x0, 0x0, 0x1f, 0xff, 0x0, 0xb,
+    0xff, 0xf5, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x1,
+    0xcf, 0xff, 0x50, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x1d, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0xef, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0xff, 0xe6, 0xff, 0xfb, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0xfd, 0x20, 0x6f, 0xff, 0x80,
+    0x0, 0x0, 0x1f, 0xff, 0xc1, 0x0, 0x9, 0xff,
+    0xf5, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0xbf, 0xff, 0x20, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x1e, 0xff, 0xd0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x3, 0xff, 0xfa, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0x70, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xf4,
+
+    /* U+006C "l" */
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+    0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff,
+
+    /* U+006D "m" */
+    0x1f, 0xfd, 0x0, 0x6b, 0xef, 0xec, 0x71, 0x0,
+    0x0, 0x49, 0xde, 0xfe, 0xa4, 0x0, 0x0, 0x1f,
+    0xfd, 0x3d, 0xff, 0xff, 0xff, 0xff, 0x50, 0x1b,
+    0xff, 0xff, 0xff, 0xff, 0xb0, 0x0, 0x1f, 0xfe,
+    0xef, 0xfc, 0xa9, 0xcf, 0xff, 0xf5, 0xdf, 0xff,
+    0xb9, 0xae, 0xff, 0xfb, 0x0, 0x1f, 0xff, 0xfd,
+    0x30, 0x0, 0x3, 0xef, 0xff, 0xff, 0x80, 0x0,
+    0x0, 0x8f, 0xff, 0x50, 0x1f, 0xff, 0xe1, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xf9, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xb0, 0x1f, 0xff, 0x70, 0x0, 0x0,
+    0x0, 0xd, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x4,
+    0xff, 0xe0, 0x1f, 0xff, 0x20, 0x0, 0x0, 0x0,
+    0xa, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x80,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xf1, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xf1, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xf1, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xf1, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xf1, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xf1, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8,
+    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0xff, 0xf1,
+
+    /* U+006E "n" */
+    0x1f, 0xfd, 0x0, 0x5a, 0xdf, 0xfd, 0xa3, 0x0,
+    0x0, 0x1f, 0xfd, 0x2d, 0xff, 0xff, 0xff, 0xff,
+    0x90, 0x0, 0x1f, 0xfe, 0xef, 0xfd, 0xa9, 0xbf,
+    0xff, 0xf9, 0x0, 0x1f, 0xff, 0xfe, 0x40, 0x0,
+    0x0, 0xaf, 0xff, 0x30, 0x1f, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0xc, 0xff, 0x90, 0x1f, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x5, 0xff, 0xd0, 0x1f, 0xff,
+    0x20, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x1, 0xff,
+    0xf0,
+
+    /* U+006F "o" */
+    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff, 0xfe,
+    0x50, 0x0, 0x0, 0x4f, 0xff, 0xfe, 0xcb, 0xdf,
+    0xff, 0xf8, 0x0, 0x2, 0xef, 0xfe, 0x50, 0x0,
+    0x2, 0xbf, 0xff, 0x50, 0xb, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x2f, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf7, 0x6f, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfb, 0x9f,
+    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f,
+    0xff, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3f, 0xfe, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xfb, 0x2f, 0xff, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0xdf, 0xf7, 0xb, 0xff, 0xd1, 0x0,
+    0x0, 0x0, 0x9, 0xff, 0xf1, 0x1, 0xef, 0xfe,
+    0x40, 0x0, 0x2, 0xbf, 0xff, 0x50, 0x0, 0x4f,
+    0xff, 0xfe, 0xbb, 0xdf, 0xff, 0xf8, 0x0, 0x0,
+    0x2, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0x50, 0x0,
+    0x0, 0x0, 0x4, 0xad, 0xff, 0xeb, 0x60, 0x0,
+    0x0,
+
+    /* U+0070 "p" */
+    0x1f, 0xfd, 0x0, 0x4a, 0xdf, 0xfd, 0xa4, 0x0,
+    0x0, 0x1, 0xff, 0xd1, 0xcf, 0xff, 0xff, 0xff,
+    0xfc, 0x10, 0x0, 0x1f, 0xfe, 0xdf, 0xfe, 0xa8,
+    0x9d, 0xff, 0xfe, 0x30, 0x1, 0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x4, 0xef, 0xfd, 0x10, 0x1f, 0xff,
+    0xf5, 0x0, 0x0, 0x0, 0x1, 0xef, 0xf9, 0x1,
+    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xf0, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x0, 0x0,
+    0xe, 0xff, 0x41, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbf, 0xf6, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x71, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xcf, 0xf6, 0x1f,
+    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
+    0x41, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x0, 0x6,
+    0xff, 0xf0, 0x1f, 0xff, 0xf7, 0x0, 0x0, 0x0,
+    0x2, 0xff, 0xf9, 0x1, 0xff, 0xff, 0xf9, 0x10,
+    0x0, 0x6, 0xff, 0xfd, 0x10, 0x1f, 0xff, 0xbf,
+    0xff, 0xcb, 0xcf, 0xff, 0xff, 0x30, 0x1, 0xff,
+    0xf0, 0xaf, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x0,
+    0x1f, 0xff, 0x0, 0x39, 0xdf, 0xfd, 0xa4, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+0072 "r" */
+    0x1f, 0xfd, 0x0, 0x5a, 0xdf, 0x1, 0xff, 0xd1,
+    0xbf, 0xff, 0xf0, 0x1f, 0xfd, 0xcf, 0xff, 0xfe,
+    0x1, 0xff, 0xff, 0xf9, 0x30, 0x0, 0x1f, 0xff,
+    0xf5, 0x0, 0x0, 0x1, 0xff, 0xfa, 0x0, 0x0,
+    0x0, 0x1f, 0xff, 0x40, 0x0, 0x0, 0x1, 0xff,
+    0xf1, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0, 0x0,
+    0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f,
+    0xff, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0x0, 0x0, 0x0, 0x1,
+    0xff, 0xf0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0x0,
+    0x0, 0x0, 0x1, 0xff, 0xf0, 0x0, 0x0, 0x0,
+    0x1f, 0xff, 0x0, 0x0, 0x0, 0x0,
+
+    /* U+0073 "s" */
+    0x0, 0x0, 0x4a, 0xdf, 0xfe, 0xd9, 0x50, 0x0,
+    0x0, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
+    0x0, 0xdf, 0xff, 0xdb, 0xaa, 0xdf, 0xff, 0x10,
+    0x6, 0xff, 0xe3, 0x0, 0x0, 0x1, 0x87, 0x0,
+    0xa, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x9, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x6, 0xff, 0xf7, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xff, 0xfd, 0xa7, 0x40, 0x0, 0x0,
+    0x0, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x0,
+    0x0, 0x0, 0x15, 0x9c, 0xff, 0xff, 0xff, 0x30,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x6e, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf0,
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x1, 0xff, 0xf0,
+    0x6, 0xf9, 0x30, 0x0, 0x0, 0xa, 0xff, 0xd0,
+    0xe, 0xff, 0xff, 0xca, 0xac, 0xff, 0xff, 0x50,
+    0x7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0,
+    0x0, 0x5, 0x9c, 0xef, 0xfe, 0xb7, 0x10, 0x0,
+
+    /* U+0074 "t" */
+    0x0, 0x5, 0x88, 0x30, 0x0, 0x0, 0x0, 0x0,
+    0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0,
+    0x0, 0x0, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xf4,
+    0x8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0x48,
+    0x8d, 0xff, 0xb8, 0x88, 0x82, 0x0, 0x0, 0xaf,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70,
+    0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0,
+    0x0, 0x0, 0xa, 0xff, 0x70, 0x0, 0x0, 0x0,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0x70, 0x0,
+    0x0, 0x0, 0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0,
+    0x0, 0x9, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x6f, 0xfe, 0x10, 0x0, 0x20, 0x0, 0x1, 0xff,
+    0xff, 0xaa, 0xdd, 0x0, 0x0, 0x5, 0xff, 0xff,
+    0xff, 0xf4, 0x0, 0x0, 0x3, 0xae, 0xff, 0xc6,
+    0x0,
+
+    /* U+0075 "u" */
+    0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5, 0xff,
+    0xb4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x5f,
+    0xfb, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xb4, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
+    0x5f, 0xfb, 0x4f, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xff, 0xb4, 0xff, 0xd0, 0x0, 0x0, 0x0,
+    0x0, 0x5f, 0xfb, 0x4f, 0xfd, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xb4, 0xff, 0xd0, 0x0, 0x0,
+    0x0, 0x0, 0x5f, 0xfb, 0x4f, 0xfd, 0x0, 0x0,
+    0x0, 0x0, 0x5, 0xff, 0xb3, 0xff, 0xd0, 0x0,
+    0x0, 0x0, 0x0, 0x6f, 0xfb, 0x3f, 0xfe, 0x0,
+    0x0, 0x0, 0x0, 0x8, 0xff, 0xb1, 0xff, 0xf1,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb, 0xd, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xb0, 0x7f,
+    0xff, 0x60, 0x0, 0x0, 0x6f, 0xff, 0xfb, 0x0,
+    0xcf, 0xff, 0xd9, 0x9a, 0xef, 0xfd, 0xff, 0xb0,
+    0x1, 0xbf, 0xff, 0xff, 0xff, 0xfa, 0x3f, 0xfb,
+    0x0, 0x0, 0x4a, 0xef, 0xfd, 0x93, 0x3, 0xff,
+    0xb0,
+
+    /* U+0076 "v" */
+    0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xb0, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf4, 0x0, 0xef, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfd, 0x0, 0x8, 0xff, 0xa0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x60, 0x0, 0x1f,
+    0xff, 0x10, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
+    0x0, 0xaf, 0xf7, 0x0, 0x0, 0x0, 0x8f, 0xf8,
+    0x0, 0x0, 0x3, 0xff, 0xe0, 0x0, 0x0, 0xe,
+    0xff, 0x10, 0x0, 0x0, 0xc, 0xff, 0x50, 0x0,
+    0x5, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x5f, 0xfc,
+    0x0, 0x0, 0xcf, 0xf3, 0x0, 0x0, 0x0, 0x0,
+    0xef, 0xf3, 0x0, 0x3f, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x7, 0xff, 0x90, 0xa, 0xff, 0x50, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0x12, 0xff, 0xe0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x9f, 0xf7, 0x8f,
+    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff,
+    0xef, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xb, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xfb, 0x0, 0x0,
+    0x0, 0x0,
+
+    /* U+0077 "w" */
+    0xaf, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xfe,
+    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0x64, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xf0, 0xe, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x1f, 0xfa, 0x0, 0x8f, 0xf6, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0xff, 0x10, 0x0, 0x0, 0x7,
+    0xff, 0x40, 0x2, 0xff, 0xb0, 0x0, 0x0, 0x8,
+    0xff, 0xbf, 0xf6, 0x0, 0x0, 0x0, 0xdf, 0xe0,
+    0x0, 0xc, 0xff, 0x10, 0x0, 0x0, 0xef, 0xd1,
+    0xff, 0xc0, 0x0, 0x0, 0x3f, 0xf8, 0x0, 0x0,
+    0x6f, 0xf7, 0x0, 0x0, 0x4f, 0xf7, 0xb, 0xff,
+    0x20, 0x0, 0x9, 0xff, 0x20, 0x0, 0x1, 0xff,
+    0xd0, 0x0, 0xa, 0xff, 0x10, 0x4f, 0xf8, 0x0,
+    0x0, 0xef, 0xc0, 0x0, 0x0, 0xa, 0xff, 0x30,
+    0x1, 0xff, 0xb0, 0x0, 0xef, 0xe0, 0x0, 0x5f,
+    0xf6, 0x0, 0x0, 0x0, 0x4f, 0xf9, 0x0, 0x7f,
+    0xf5, 0x0, 0x8, 0xff, 0x40, 0xb, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0xef, 0xe0, 0xd, 0xfe, 0x0,
+    0x0, 0x2f, 0xf9, 0x1, 0xff, 0xa0, 0x0, 0x0,
+    0x0, 0x8, 0xff, 0x43, 0xff, 0x80, 0x0, 0x0,
+    0xcf, 0xf0, 0x7f, 0xf4, 0x0, 0x0, 0x0, 0x0,
+    0x2f, 0xfa, 0x9f, 0xf2, 0x0, 0x0, 0x6, 0xff,
+    0x5d, 0xfe, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcf,
+    0xfe, 0xfc, 0x0, 0x0, 0x0, 0x1f, 0xfd, 0xff,
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff, 0xff,
+    0x60, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xf2, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xf0, 0x0,
+    0x0, 0x0, 0x4, 0xff, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0xe, 0xff, 0x60, 0x0, 0x0, 0x0,
+
+    /* U+0078 "x" */
+    0xd, 0xff, 0x90, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x70, 0x2, 0xff, 0xf5, 0x0, 0x0, 0x0, 0xaf,
+    0xfb, 0x0, 0x0, 0x5f, 0xff, 0x20, 0x0, 0x6,
+    0xff, 0xd1, 0x0, 0x0, 0x8, 0xff, 0xd0, 0x0,
+    0x2f, 0xff, 0x30, 0x0, 0x0, 0x0, 0xcf, 0xf9,
+    0x0, 0xdf, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1e,
+    0xff, 0x6a, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xff, 0xf2, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x1f, 0xff, 0xb0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcf, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xdf, 0xff,
+    0x30, 0x0, 0x0, 0x0, 0x0, 0x5f, 0xfe, 0x16,
+    0xff, 0xd1, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf4,
+    0x0, 0xaf, 0xfb, 0x0, 0x0, 0x0, 0xd, 0xff,
+    0x80, 0x0, 0xd, 0xff, 0x70, 0x0, 0x0, 0x9f,
+    0xfc, 0x0, 0x0, 0x2, 0xff, 0xf4, 0x0, 0x6,
+    0xff, 0xe1, 0x0, 0x0, 0x0, 0x6f, 0xfe, 0x20,
+    0x3f, 0xff, 0x40, 0x0, 0x0, 0x0, 0xa, 0xff,
+    0xc0,
+
+    /* U+0079 "y" */
+    0xd, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0, 0x5,
+    0xff, 0xb0, 0x6f, 0xfc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcf, 0xf3, 0x0, 0xef, 0xf3, 0x0, 0x0,
+    0x0, 0x0, 0x3f, 0xfc, 0x0, 0x7, 0xff, 0xb0,
+    0x0, 0x0, 0x0, 0xa, 0xff, 0x50, 0x0, 0x1f,
+    0xff, 0x20, 0x0, 0x0, 0x1, 0xff, 0xe0, 0x0,
+    0x0, 0x9f, 0xf9, 0x0, 0x0, 0x0, 0x8f, 0xf7,
+    0x0, 0x0, 0x2, 0xff, 0xf1, 0x0, 0x0, 0xe,
+    0xff, 0x0, 0x0, 0x0, 0xb, 0xff, 0x70, 0x0,
+    0x6, 0xff, 0x90, 0x0, 0x0, 0x0, 0x3f, 0xfe,
+    0x0, 0x0, 0xdf, 0xf2, 0x0, 0x0, 0x0, 0x0,
+    0xcf, 0xf5, 0x0, 0x4f, 0xfa, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0xff, 0xc0, 0xb, 0xff, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0xe, 0xff, 0x32, 0xff, 0xc0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xfa, 0x9f,
+    0xf5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x1f, 0xff, 0xe0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbf, 0xf8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xe, 0xff, 0x10,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xa0, 0x0, 0x0, 0x0, 0x0, 0x73, 0x0, 0x4,
+    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xfc,
+    0xab, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x7,
+    0xff, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x4, 0xae, 0xfe, 0xb5, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0,
+
+    /* U+007A "z" */
+    0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x48,
+    0x88, 0x88, 0x88, 0x88, 0xff, 0xfc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x7f, 0xfe, 0x10, 0x0, 0x0,
+    0x0, 0x0, 0x4f, 0xff, 0x30, 0x0, 0x0, 0x0,
+    0x0, 0x2f, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
+    0xd, 0xff, 0x90, 0x0, 0x0, 0x0, 0x0, 0xa,
+    0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff,
+    0xe1, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xf3,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdf, 0xf9, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbf, 0xfc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x7f, 0xfe, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x4f, 0xff, 0xb8, 0x88, 0x88, 0x88, 0x88,
+    0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70,
+
+    /* U+0020 " " */
+
+    /* U+0025 "%" */
+    0x0, 0x2a, 0xef, 0xd8, 0x10, 0x0, 0x0, 0x0,
+    0x0, 0x7f, 0xe1, 0x0, 0x0, 0x3f, 0xff, 0xdf,
+    0xfd, 0x10, 0x0, 0x0, 0x0, 0x2f, 0xf5, 0x0,
+    0x0, 0xe, 0xf8, 0x0, 0xa, 0xfb, 0x0, 0x0,
+    0x0, 0xc, 0xfa, 0x0, 0x0, 0x6, 0xfd, 0x0,
+    0x0, 0x1f, 0xf3, 0x0, 0x0, 0x8, 0xfe, 0x0,
+    0x0, 0x0, 0xaf, 0x70, 0x0, 0x0, 0xaf, 0x70,
+    0x0, 0x3, 0xff, 0x40, 0x0, 0x0, 0xc, 0xf5,
+    0x0, 0x0, 0x8, 0xf8, 0x0, 0x0, 0xdf, 0x80,
+    0x0, 0x0, 0x0, 0xcf, 0x50, 0x0, 0x0, 0x8f,
+    0x80, 0x0, 0x9f, 0xd0, 0x0, 0x0, 0x0, 0xa,
+    0xf7, 0x0, 0x0, 0xb, 0xf6, 0x0, 0x4f, 0xf2,
+    0x0, 0x0, 0x0, 0x0, 0x5f, 0xe0, 0x0, 0x1,
+    0xff, 0x20, 0x1e, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdf, 0xb2, 0x3, 0xcf, 0xa0, 0xb, 0xfc,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef, 0xff,
+    0xff, 0xc0, 0x6, 0xff, 0x20, 0x19, 0xdf, 0xe9,
+    0x20, 0x0, 0x0, 0x7b, 0xcb, 0x60, 0x2, 0xff,
+    0x60, 0x1e, 0xff, 0xdf, 0xfe, 0x30, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcf, 0xa0, 0xc, 0xfb, 0x10,
+    0x9, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
+    0xe1, 0x3, 0xff, 0x10, 0x0, 0xe, 0xf6, 0x0,
+    0x0, 0x0, 0x0, 0x3f, 0xf4, 0x0, 0x7f, 0xa0,
+    0x0, 0x0, 0x7f, 0xa0, 0x0, 0x0, 0x0, 0xd,
+    0xf9, 0x0, 0x9, 0xf8, 0x0, 0x0, 0x5, 0xfc,
+    0x0, 0x0, 0x0, 0x9, 0xfd, 0x0, 0x0, 0x9f,
+    0x70, 0x0, 0x0, 0x5f, 0xc0, 0x0, 0x0, 0x4,
+    0xff, 0x30, 0x0, 0x7, 0xf9, 0x0, 0x0, 0x7,
+    0xfa, 0x0, 0x0, 0x1, 0xef, 0x80, 0x0, 0x0,
+    0x3f, 0xe0, 0x0, 0x0, 0xcf, 0x60, 0x0, 0x0,
+    0xaf, 0xc0, 0x0, 0x0, 0x0, 0xcf, 0x80, 0x0,
+    0x6f, 0xe0, 0x0, 0x0, 0x5f, 0xf2, 0x0, 0x0,
+    0x0, 0x2, 0xef, 0xda, 0xcf, 0xf3, 0x0, 0x0,
+    0x1e, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x1, 0x9e,
+    0xfe, 0xa2, 0x0,
+
+    /* U+0028 "(" */
+    0x0, 0x6, 0xff, 0x80, 0x0, 0xef, 0xe0, 0x0,
+    0x7f, 0xf8, 0x0, 0xe, 0xff, 0x10, 0x3, 0xff,
+    0xb0, 0x0, 0x8f, 0xf6, 0x0, 0xe, 0xff, 0x10,
+    0x1, 0xff, 0xd0, 0x0, 0x4f, 0xfa, 0x0, 0x7,
+    0xff, 0x80, 0x0, 0xaf, 0xf5, 0x0, 0xc, 0xff,
+    0x30, 0x0, 0xcf, 0xf2, 0x0, 0xd, 0xff, 0x20,
+    0x0, 0xef, 0xf1, 0x0, 0xe, 0xff, 0x10, 0x0,
+    0xdf, 0xf2, 0x0, 0xc, 0xff, 0x20, 0x0, 0xcf,
+    0xf3, 0x0, 0xa, 0xff, 0x50, 0x0, 0x7f, 0xf8,
+    0x0, 0x4, 0xff, 0xa0, 0x0, 0x1f, 0xfd, 0x0,
+    0x0, 0xdf, 0xf1, 0x0, 0x8, 0xff, 0x60, 0x0,
+    0x3f, 0xfb, 0x0, 0x0, 0xdf, 0xf1, 0x0, 0x6,
+    0xff, 0x80, 0x0, 0xe, 0xfe, 0x0, 0x0, 0x6f,
+    0xf8,
+
+    /* U+0029 ")" */
+    0xbf, 0xf3, 0x0, 0x4, 0xff, 0xb0, 0x0, 0xc,
+    0xff, 0x30, 0x0, 0x5f, 0xfb, 0x0, 0x0, 0xff,
+    0xf0, 0x0, 0xa, 0xff, 0x50, 0x0, 0x5f, 0xfb,
+    0x0, 0x1, 0xff, 0xe0, 0x0, 0xe, 0xff, 0x10,
+    0x0, 0xbf, 0xf4, 0x0, 0x8, 0xff, 0x70, 0x0,
+    0x6f, 0xf9, 0x0, 0x6, 0xff, 0xa0, 0x0, 0x5f,
+    0xfb, 0x0, 0x4, 0xff, 0xb0, 0x0, 0x4f, 0xfc,
+    0x0, 0x5, 0xff, 0xb0, 0x0, 0x6f, 0xfa, 0x0,
+    0x6, 0xff, 0x90, 0x0, 0x8f, 0xf7, 0x0, 0xb,
+    0xff, 0x40, 0x0, 0xef, 0xf1, 0x0, 0x1f, 0xfe,
+    0x0, 0x5, 0xff, 0xb0, 0x0, 0xaf, 0xf5, 0x0,
+    0xf, 0xff, 0x0, 0x4, 0xff, 0xb0, 0x0, 0xcf,
+    0xf3, 0x0, 0x3f, 0xfb, 0x0, 0xb, 0xff, 0x30,
+    0x0,
+
+    /* U+003E ">" */
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc,
+    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
+    0xfc, 0x60, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff,
+    0xff, 0xf9, 0x30, 0x0, 0x0, 0x0, 0x1, 0x6d,
+    0xff, 0xff, 0xd6, 0x10, 0x0, 0x0, 0x0, 0x3,
+    0x9e, 0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xbf, 0xff, 0xfd, 0x40, 0x0, 0x0, 0x0,
+    0x0, 0x17, 0xef, 0xf7, 0x0, 0x0, 0x0, 0x0,
+    0x5, 0xbf, 0xff, 0x70, 0x0, 0x0, 0x3, 0x9e,
+    0xff, 0xff, 0xa2, 0x0, 0x1, 0x6d, 0xff, 0xff,
+    0xc6, 0x10, 0x0, 0x4a, 0xff, 0xff, 0xf9, 0x30,
+    0x0, 0x0, 0xcf, 0xff, 0xfc, 0x60, 0x0, 0x0,
+    0x0, 0xd, 0xfe, 0x82, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x95, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0,
+
+    /* U+00B0 "°" */
+    0x0, 0x18, 0xdf, 0xea, 0x30, 0x0, 0x2e, 0xfe,
+    0xbd, 0xff, 0x60, 0xd, 0xf7, 0x0, 0x3, 0xef,
+    0x34, 0xfa, 0x0, 0x0, 0x4, 0xfb, 0x7f, 0x50,
+    0x0, 0x0, 0xf, 0xe7, 0xf5, 0x0, 0x0, 0x0,
+    0xfe, 0x4f, 0xa0, 0x0, 0x0, 0x4f, 0xb0, 0xdf,
+    0x70, 0x0, 0x3e, 0xf3, 0x2, 0xef, 0xec, 0xdf,
+    0xf7, 0x0, 0x1, 0x8d, 0xfe, 0xa3, 0x0
+};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
+    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
+    {.bitmap_index = 0, .adv_w = 298, .box_w = 15, .box_h = 14, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 105, .adv_w = 116, .box_w = 5, .box_h = 9, .ofs_x = 1, .ofs_y = -5},
+    {.bitmap_index = 128, .adv_w = 196, .box_w = 10, .box_h = 3, .ofs_x = 1, .ofs_y = 7},
+    {.bitmap_index = 143, .adv_w = 116, .box_w = 5, .box_h = 5, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 156, .adv_w = 180, .box_w = 14, .box_h = 30, .ofs_x = -1, .ofs_y = -3},
+    {.bitmap_index = 366, .adv_w = 342, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 575, .adv_w = 189, .box_w = 9, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 674, .adv_w = 294, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 872, .adv_w = 293, .box_w = 17, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1059, .adv_w = 343, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1290, .adv_w = 294, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1488, .adv_w = 316, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 1686, .adv_w = 306, .box_w = 18, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1884, .adv_w = 330, .box_w = 19, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2093, .adv_w = 316, .box_w = 19, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2302, .adv_w = 116, .box_w = 5, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 2345, .adv_w = 375, .box_w = 25, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 2620, .adv_w = 388, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 2840, .adv_w = 370, .box_w = 21, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3071, .adv_w = 423, .box_w = 22, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3313, .adv_w = 343, .box_w = 17, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3500, .adv_w = 325, .box_w = 17, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 3687, .adv_w = 395, .box_w = 22, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 3929, .adv_w = 416, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4149, .adv_w = 159, .box_w = 4, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4193, .adv_w = 368, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4413, .adv_w = 304, .box_w = 16, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4589, .adv_w = 489, .box_w = 25, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 4864, .adv_w = 416, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5084, .adv_w = 430, .box_w = 25, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5359, .adv_w = 370, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5568, .adv_w = 372, .box_w = 19, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 5777, .adv_w = 318, .box_w = 18, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 5975, .adv_w = 301, .box_w = 19, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 6184, .adv_w = 405, .box_w = 20, .box_h = 22, .ofs_x = 3, .ofs_y = 0},
+    {.bitmap_index = 6404, .adv_w = 365, .box_w = 24, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 6668, .adv_w = 577, .box_w = 35, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7053, .adv_w = 345, .box_w = 22, .box_h = 22, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 7295, .adv_w = 331, .box_w = 22, .box_h = 22, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 7537, .adv_w = 306, .box_w = 16, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7673, .adv_w = 349, .box_w = 19, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 7901, .adv_w = 292, .box_w = 17, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8046, .adv_w = 349, .box_w = 18, .box_h = 24, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8262, .adv_w = 313, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8415, .adv_w = 181, .box_w = 13, .box_h = 24, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 8571, .adv_w = 353, .box_w = 19, .box_h = 23, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 8790, .adv_w = 349, .box_w = 18, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9006, .adv_w = 143, .box_w = 5, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9066, .adv_w = 315, .box_w = 18, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9282, .adv_w = 143, .box_w = 4, .box_h = 24, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9330, .adv_w = 541, .box_w = 30, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9585, .adv_w = 349, .box_w = 18, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 9738, .adv_w = 325, .box_w = 18, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9891, .adv_w = 349, .box_w = 19, .box_h = 23, .ofs_x = 2, .ofs_y = -6},
+    {.bitmap_index = 10110, .adv_w = 210, .box_w = 11, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10204, .adv_w = 257, .box_w = 16, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10340, .adv_w = 212, .box_w = 13, .box_h = 21, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 10477, .adv_w = 347, .box_w = 17, .box_h = 17, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 10622, .adv_w = 286, .box_w = 19, .box_h = 17, .ofs_x = -1, .ofs_y = 0},
+    {.bitmap_index = 10784, .adv_w = 460, .box_w = 29, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11031, .adv_w = 283, .box_w = 18, .box_h = 17, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11184, .adv_w = 286, .box_w = 19, .box_h = 23, .ofs_x = -1, .ofs_y = -6},
+    {.bitmap_index = 11403, .adv_w = 267, .box_w = 15, .box_h = 17, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11531, .adv_w = 138, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 11531, .adv_w = 432, .box_w = 25, .box_h = 22, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 11806, .adv_w = 173, .box_w = 7, .box_h = 30, .ofs_x = 3, .ofs_y = -6},
+    {.bitmap_index = 11911, .adv_w = 173, .box_w = 7, .box_h = 30, .ofs_x = 1, .ofs_y = -6},
+    {.bitmap_index = 12016, .adv_w = 298, .box_w = 15, .box_h = 15, .ofs_x = 2, .ofs_y = 4},
+    {.bitmap_index = 12129, .adv_w = 215, .box_w = 11, .box_h = 10, .ofs_x = 1, .ofs_y = 12}
+};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+static const uint16_t unicode_list_7[] = {
+    0x0, 0x5, 0x8, 0x9, 0x1e, 0x90
+};
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] = {
+    {
+        .range_start = 43, .range_length = 16, .glyph_id_start = 1,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 65, .range_length = 9, .glyph_id_start = 17,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 75, .range_length = 6, .glyph_id_start = 26,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 82, .range_length = 8, .glyph_id_start = 32,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 97, .range_length = 9, .glyph_id_start = 40,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 107, .range_length = 6, .glyph_id_start = 49,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 114, .range_length = 9, .glyph_id_start = 55,
+        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, .type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY
+    },
+    {
+        .range_start = 32, .range_length = 145, .glyph_id_start = 64,
+        .unicode_list = unicode_list_7, .glyph_id_ofs_list = NULL, .list_length = 6, .type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY
+    }
+};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+
+/*Map glyph_ids to kern left classes*/
+static const uint8_t kern_left_class_mapping[] = {
+    0, 5, 6, 5, 6, 7, 8, 0,
+    9, 10, 11, 12, 13, 14, 15, 8,
+    16, 18, 19, 20, 17, 21, 22, 23,
+    24, 24, 26, 27, 24, 24, 17, 28,
+    29, 1, 30, 25, 31, 31, 32, 33,
+    34, 35, 36, 37, 38, 39, 40, 34,
+    41, 42, 37, 34, 34, 35, 35, 43,
+    44, 45, 40, 46, 46, 47, 46, 48,
+    0, 2, 3, 4, 0, 49
+};
+
+/*Map glyph_ids to kern right classes*/
+static const uint8_t kern_right_class_mapping[] = {
+    0, 5, 6, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 8, 14, 15, 16,
+    17, 19, 20, 18, 20, 20, 20, 18,
+    20, 20, 20, 20, 20, 20, 18, 20,
+    20, 1, 21, 22, 23, 23, 24, 25,
+    26, 27, 28, 28, 28, 0, 28, 27,
+    29, 27, 27, 30, 30, 28, 30, 30,
+    31, 32, 33, 34, 34, 35, 34, 36,
+    0, 2, 3, 4, 0, 37
+};
+
+/*Kern values between classes*/
+static const int8_t kern_class_values[] = {
+    0, 0, 0, 0, 9, 10, 0, 0,
+    -5, 0, -4, 5, 0, -5, 0, -5,
+    -3, 0, 0, 0, -5, 0, 0, -7,
+    -8, 0, 0, 0, 0, 0, 0, 0,
+    0, -5, -5, 0, -8, 0, -62, 0,
+    -10, 10, 15, 1, 0, -10, 5, 5,
+    17, 10, -9, 10, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -14, 0, 0, 0, 0, 0, 0,
+    17, 0, 5, 0, 0, -10, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, -19, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -19, 0, 0,
+    2, -4, 0, 4, -9, -7, -10, 4,
+    0, -5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -32, 0, 0, -4, 0, 51,
+    -6, -7, 5, 5, -5, 0, -7, 5,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -32, 0, 0,
+    0, 17, -35, -50, -35, -10, 15, 0,
+    0, -34, 0, 6, -12, 0, -8, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 24, 0, 0, 0, 0, 4,
+    -6, -10, 0, -2, -2, -5, 0, 0,
+    -4, 0, 0, 0, 0, -4, 0, -10,
+    0, -13, -17, -17, 0, 0, 0, 0,
+    0, 0, 5, 0, 4, -5, 0, 2,
+    0, 5, 0, 0, -4, 5, 5, -2,
+    0, 0, 0, -10, 0, -2, 0, 0,
+    0, 0, 2, 0, -4, 0, -6, 0,
+    -9, 0, 0, -5, 0, 0, 0, 0,
+    -2, 2, -4, -4, 0, 0, -5, 0,
+    0, 0, 0, 0, 0, 0, -3, -3,
+    0, -5, -6, 0, 0, 0, 0, 2,
+    0, -4, 0, -5, -5, -5, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, -7,
+    0, -8, -4, -15, 0, 0, 5, 10,
+    14, 0, -13, -2, -6, 0, -2, -24,
+    5, -4, 4, 5, 0, 0, -27, 0,
+    -27, -4, -45, 14, 0, 7, 0, 0,
+    0, 1, 0, -9, -7, 0, -15, 0,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    -3, -3, 0, -3, -7, 0, 0, 0,
+    0, 0, 0, -5, 0, -4, -6, -4,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -4, -4, 0, -6, 0, -10, 0, 0,
+    3, 5, 5, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 4, 0,
+    -5, 0, -5, -4, -6, 0, 0, 4,
+    0, 0, 0, 0, 0, -6, -8, 0,
+    -10, -4, 2, 0, 0, -26, -27, -22,
+    -10, 5, 0, -4, -33, -9, 0, -9,
+    0, -10, -9, -33, 0, 0, 0, 3,
+    -2, 4, -19, 0, -26, -12, -12, -15,
+    -6, -14, -1, -10, -14, 3, 0, -5,
+    0, 0, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -3, 0, -5, 0, -9, -11, -11, 0,
+    0, 0, 0, 0, 0, 0, 0, 2,
+    -3, 0, 0, 0, 0, 0, 0, 0,
+    0, 25, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 6, 4, -10, -10, 0,
+    -5, -5, -6, 0, 0, 0, 0, 0,
+    0, 0, -5, 0, -5, 0, -11, -13,
+    -15, 0, 0, 0, 0, 0, 0, 3,
+    0, 0, -7, 0, 5, 0, 0, 0,
+    0, -9, 17, 15, -4, -22, 0, 5,
+    -8, 0, -26, -3, -7, 5, -5, 7,
+    0, -18, -8, -19, -17, -22, 0, 0,
+    -3, 0, 0, -3, -3, -5, -14, -17,
+    -1, -48, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -5, 0,
+    -3, -5, -8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -2,
+    0, 0, 0, -2, 7, 0, -11, 5,
+    -4, -2, -13, -5, 0, -7, -5, -4,
+    -8, -9, 0, -4, -2, -4, -9, -6,
+    -4, 0, -11, 0, 0, -10, 0, -9,
+    0, -9, -9, 5, 0, 0, 0, 0,
+    -10, 5, 0, -7, 0, -4, -6, -16,
+    -4, -4, -4, -2, -4, -2, 0, 0,
+    0, 0, -5, -4, -4, -4, 0, -4,
+    0, 0, -4, -6, -4, -5, -6, -5,
+    0, -2, 0, 0, -4, 0, -5, -22,
+    -7, 8, 1, 0, -24, -9, 5, -9,
+    4, 0, -4, -16, 0, 3, 0, 0,
+    -9, 0, -10, 0, -9, -5, -5, -5,
+    0, -9, 3, -10, -9, 15, 0, 0,
+    0, 0, 0, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -4, -5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -8, 0, -7, 0, 0, -5,
+    -5, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, -8, 0, 0,
+    0, -17, 0, 4, -11, 10, 1, -4,
+    -24, 0, 0, -11, -5, 0, -13, -14,
+    0, -22, -5, -20, -19, -25, -7, 0,
+    -12, -5, -5, -9, -14, -9, -19, -21,
+    -12, -5, -4, 0, 0, 0, -5, 15,
+    11, -11, -19, 0, 2, -16, 0, -26,
+    -4, -5, 10, -7, 2, 0, -33, -6,
+    -27, -5, -37, 2, 0, -4, 0, 0,
+    0, -3, -4, -19, -4, 0, -33, 0,
+    0, 0, -5, -2, -14, -24, 0, 0,
+    -3, -8, -15, -5, 0, -4, 0, 0,
+    0, -23, -5, -16, -4, -9, -13, -5,
+    -8, 0, -6, -10, -10, 0, 3, 0,
+    -4, -17, 0, 10, 0, 0, 0, 0,
+    -1, 0, 0, 0, 0, 0, -4, -10,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, 0, 0, -10, -5, -3, 0, 0,
+    0, 0, 0, 3, 0, 0, 0, 0,
+    8, -5, 0, -8, 0, -17, -16, -10,
+    -10, 20, 9, 5, -45, -4, 10, -5,
+    0, -5, -5, -18, 0, 5, -7, -4,
+    -15, -4, -14, 0, -28, -7, -7, -19,
+    2, -7, -17, -17, -5, 20, -8, 0,
+    0, 4, -12, -19, -20, -13, 15, 0,
+    2, -37, -4, 5, -9, -4, -12, -11,
+    -19, -8, -4, 0, 0, -12, -11, -28,
+    0, -28, -7, -18, -30, -2, -16, -9,
+    -17, -14, 14, -7, 0, -5, 0, -9,
+    0, 9, -17, 5, 0, 0, -27, 0,
+    -5, -11, -9, -4, -13, -17, -12, -15,
+    -5, -12, -10, -15, -9, 0, -15, -5,
+    -5, -10, -12, -14, -14, -19, -7, -10,
+    -8, 0, -6, 3, -16, -19, -10, -17,
+    17, -5, 3, -48, -9, 10, -11, -9,
+    -19, -15, -22, -6, -4, -5, -11, -15,
+    -2, -33, 0, -31, -12, -19, -35, -10,
+    -18, -22, -26, -17, 10, 0, -14, 0,
+    0, 0, 0, 0, 0, -11, -3, 0,
+    0, 0, -11, 0, -6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    2, 0, 0, 0, 0, 0, -5, 0,
+    0, -10, 0, -14, 0, 0, 5, -6,
+    0, 0, -14, -5, -12, 0, 0, -14,
+    0, -5, 0, 0, -6, 0, -41, -10,
+    -20, -6, -18, -3, 0, 0, 0, 0,
+    0, 0, 0, -8, -9, -4, -9, 0,
+    0, 0, -11, -6, 10, 0, -4, -12,
+    -4, -9, -10, 0, -6, -3, -4, 4,
+    -2, 0, 0, -45, -4, -7, 0, -11,
+    0, -4, -4, 0, 0, 0, 4, 0,
+    -4, -9, -4, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0,
+    0, 0, -4, 0, 0, 5, 0, 0,
+    0, -14, -5, -10, 0, 0, -14, 0,
+    -5, 0, 0, 0, 0, -50, 0, -10,
+    -19, -26, -8, 0, 0, 0, 0, 0,
+    0, 0, -5, -8, -3, -8, 0, 9,
+    0, 16, -5, -5, -15, 6, 25, 9,
+    11, -14, 6, 22, 6, 15, 11, 0,
+    0, 0, 0, 0, 0, 0, 0, -5,
+    0, -4, 41, 41, 0, 0, 0, 5,
+    0, 0, 19, -8, 0, 0, 0, 0,
+    0, 0, 0, -4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -43,
+    -6, -4, -21, -25, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -8, 0, 0, 0, 0, 0, 0, 0,
+    -4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, -43, -6, -4, -21,
+    -25, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, -12, 5, 0, -5, 4, 9, 5,
+    -15, 0, -1, -4, 5, 0, 0, 0,
+    0, -13, 0, -5, -4, -10, -5, 0,
+    -11, -4, -4, -9, 0, -5, -14, -10,
+    -6, 0, -8, 0, -6, -5, -5, -5,
+    -20, 2, -3, 2, -4, -14, 1, 11,
+    1, 4, 2, -12, -20, -6, -19, -10,
+    -14, -22, -20, -4, -4, -6, -4, -4,
+    -2, 8, 0, 8, -4, 0, 16, 0,
+    0, 0, 0, 0, 0, 0, 0, -4,
+    -5, -5, 0, 0, -14, 0, -3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -5, -5, 0, -7, 0, 0, 0, 0,
+    -5, 5, 0, -9, -10, -4, 0, -15,
+    -4, -11, -4, -6, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, -9,
+    0, 0, 0, -7, 0, -5, 0, 0,
+    -3, -4, 0, 0, 0, -7, -17, -16,
+    4, 6, 6, -1, -14, 4, 8, 4,
+    15, 4, -4, -14, 0, -20, 0, 0,
+    -15, -14, -9, 0, -8, 0, 0, -4,
+    8, 0, -4, -15, -5, 19, -5, 0,
+    0, 0, -12, 0, 5, -5, 4, 1,
+    0, -17, 0, -4, -2, 0, -5, -4,
+    0, 0, -21, -6, -11, 0, -15, -5,
+    0, -9, 0, 0, -5, 0, -5, -15,
+    0, -5, 5, 0, 0, 0, 0, -7,
+    2, 0, 0, -6, -4, 0, -6, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, -4, 0,
+    0, 0, 1, 0, -5, -5, 0, 0,
+    0, 12, 0, 0, 0, -32, -29, 2,
+    22, 15, 9, -20, 4, 22, 0, 19,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0
+};
+
+
+/*Collect the kern class' data in one place*/
+static const lv_font_fmt_txt_kern_classes_t kern_classes = {
+    .class_pair_values   = kern_class_values,
+    .left_class_mapping  = kern_left_class_mapping,
+    .right_class_mapping = kern_right_class_mapping,
+    .left_class_cnt      = 49,
+    .right_class_cnt     = 37,
+};
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = &kern_classes,
+    .kern_scale = 16,
+    .cmap_num = 8,
+    .bpp = 4,
+    .kern_classes = 1,
+    .bitmap_format = 0,
+    .cache = &cache
+};
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+const lv_font_t ui_font_montserrat_32 = {
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = 35,          /*The maximum line height required by the font*/
+    .base_line = 6,             /*Baseline measured from the bottom of the line*/
+    .subpx = LV_FONT_SUBPX_NONE,
+    .underline_position = -2,
+    .underline_thickness = 2,
+    .dsc = &font_dsc,          /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+    .fallback = &lv_font_montserrat_16,   /*Characters outside the subset*/
+};
@@ -0,0 +1,48 @@
+// Auto-generated by generate_ui_fonts.py. Do not edit.
+// Subsets of lib/lvgl/src/font/lv_font_montserrat_<size>.c with the characters the UI shows;
+// others are drawn with the fallback font. Flash bytes are estimates for the 32 bit target.
+#pragma once
+
+#include <lvgl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 48 px, 4 bpp: 15 of 157 glyphs, 5514 of 96709 bytes
+LV_FONT_DECLARE(ui_font_montserrat_48)
+#define UI_FONT_MONTSERRAT_48_BYTES      5514
+#define UI_FONT_MONTSERRAT_48_FULL_BYTES 96709
+
+// 32 px, 4 bpp: 69 of 157 glyphs, 14933 of 45893 bytes
+LV_FONT_DECLARE(ui_font_montserrat_32)
+#define UI_FONT_MONTSERRAT_32_BYTES      14933
+#define UI_FONT_MONTSERRAT_32_FULL_BYTES 45893
+
+// 28 px, 4 bpp: 69 of 157 glyphs, 12443 of 37281 bytes
+LV_FONT_DECLARE(ui_font_montserrat_28)
+#define UI_FONT_MONTSERRAT_28_BYTES      12443
+#define UI_FONT_MONTSERRAT_28_FULL_BYTES 37281
+
+// 24 px, 4 bpp: 69 of 157 glyphs, 9901 of 28681 bytes
+LV_FONT_DECLARE(ui_font_montserrat_24)
+#define UI_FONT_MONTSERRAT_24_BYTES      9901
+#define UI_FONT_MONTSERRAT_24_FULL_BYTES 28681
+
+// 20 px, 2 bpp: 69 of 157 glyphs, 5296 of 21783 bytes
+LV_FONT_DECLARE(ui_font_montserrat_20)
+#define UI_FONT_MONTSERRAT_20_BYTES      5296
+#define UI_FONT_MONTSERRAT_20_FULL_BYTES 21783
+
+// 18 px, 4 bpp, compressed: 96 of 157 glyphs, 8255 of 19010 bytes
+LV_FONT_DECLARE(ui_font_montserrat_18)
+#define UI_FONT_MONTSERRAT_18_BYTES      8255
+#define UI_FONT_MONTSERRAT_18_FULL_BYTES 19010
+
+#if !LV_USE_FONT_COMPRESSED
+#error "Compressed UI fonts need LV_USE_FONT_COMPRESSED 1 in lv_conf.h"
+#endif
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
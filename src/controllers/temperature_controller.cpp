@@ -1,4 +1,5 @@
 #include "controllers/temperature_controller.h"
+#include "config/feature_flags.h"
 
 // Global controller instance
 TemperatureController controller;
@@ -42,33 +43,38 @@ TemperatureController::TemperatureController() {
     _lastCompressorChange = 0;
     _lastCoolingRequest = 0;
     _lastHeatingRequest = 0;
-    _overTempSince = 0;
-    _underTempSince = 0;
-    _sensorMissingSince = 0;
-    _rangeFaultSince = 0;
-    _defrostOverrunSince = 0;
-    _eventHead = 0;
-    _eventCount = 0;
+    _coolingHeldUntil = 0;
+    memset(_faultTimers, 0, sizeof(_faultTimers));
+    _statePub.publish(_state);
+    _configPub.publish(_config);
 }
 
 bool TemperatureController::init() {
     DEBUG_PRINTLN("Initializing Temperature Controller...");
+
+    if (!_events.begin(CONTROLLER_EVENT_RING_CAPACITY)) {
+        DEBUG_PRINTLN("WARNING: no memory for the controller event ring, events will be dropped");
+    }
     
-    // Configure control pins
-    pinMode(RELAY_HEAT_PIN, OUTPUT);
-    pinMode(RELAY_COOL_PIN, OUTPUT);
-    pinMode(FAN_PWM_PIN, OUTPUT);
-    pinMode(BUZZER_PIN, OUTPUT);
-    
-    // Configure PWM for fan control
-    ledcSetup(1, 25000, 8); // Channel 1, 25kHz, 8-bit resolution
-    ledcAttachPin(FAN_PWM_PIN, 1);
-    
-    // Initialize outputs to safe state
-    digitalWrite(RELAY_HEAT_PIN, LOW);
-    digitalWrite(RELAY_COOL_PIN, LOW);
-    ledcWrite(1, 0);
-    digitalWrite(BUZZER_PIN, LOW);
+    // Configure control pins (only those this controller owns, see setPinOutputs)
+    if (_relayPins) {
+        pinMode(RELAY_HEAT_PIN, OUTPUT);
+        pinMode(RELAY_COOL_PIN, OUTPUT);
+        pinMode(FAN_PWM_PIN, OUTPUT);
+
+        // Configure PWM for fan control
+        ledcSetup(1, 25000, 8); // Channel 1, 25kHz, 8-bit resolution
+        ledcAttachPin(FAN_PWM_PIN, 1);
+
+        // Initialize outputs to safe state
+        digitalWrite(RELAY_HEAT_PIN, LOW);
+        digitalWrite(RELAY_COOL_PIN, LOW);
+        ledcWrite(1, 0);
+    }
+    if (_buzzerPin) {
+        pinMode(BUZZER_PIN, OUTPUT);
+        digitalWrite(BUZZER_PIN, LOW);
+    }
     
     // Reset PID controller
     _pidLastError = 0;
@@ -76,6 +82,7 @@ bool TemperatureController::init() {
     
     _state.status = STATUS_IDLE;
     _state.lastDefrost = millis();
+    _statePub.publish(_state);
     
     DEBUG_PRINTLN("Temperature Controller initialized successfully");
     return true;
@@ -85,9 +92,14 @@ void TemperatureController::updateWithMultipleSensors(const SensorData sensors[]
     if (millis() - _lastControlUpdate < TEMP_UPDATE_INTERVAL) {
         return;
     }
-    
-    // Evaluate faults (non-blocking)
-    evaluateFaults(sensors, count);
+    runControlCycle(sensors, count);
+}
+
+void TemperatureController::runControlCycle(const SensorData sensors[], uint8_t count) {
+    applySilenceRequest();
+    // Reduce the probes once (average, extremes, valid count); faults and control share the result
+    const FaultInputs in = gatherFaultInputs(sensors, count);
+    evaluateFaults(in);
     // Alarm escalation derived from fault bits (over/under temperature)
     unsigned long nowAlarm = millis();
     bool overUnder = faultActive(FaultBit(FAULT_OVER_TEMPERATURE_BIT)) || faultActive(FaultBit(FAULT_UNDER_TEMPERATURE_BIT));
@@ -114,8 +126,7 @@ void TemperatureController::updateWithMultipleSensors(const SensorData sensors[]
         _state.alarmSilenced = false; // re-arm audible/visual pulse
     }
     
-    // Calculate average temperature from all valid sensors
-    float avgTemp = calculateAverageTemp(sensors, count);
+    float avgTemp = in.avgTemp;
     _state.averageTemp = avgTemp;
     _state.currentTemp = avgTemp;
     
@@ -143,15 +154,47 @@ void TemperatureController::updateWithMultipleSensors(const SensorData sensors[]
         case MODE_OFF:
         default:
             activateHeating(false);
-            activateCooling(false);
-            activateFan(0);
-            _state.status = STATUS_IDLE;
+            gateShortCycle(false);   // A running compressor still finishes its min on time
+            activateFan(_state.coolingActive ? _config.fanSpeed : 0);
+            _state.status = _state.coolingActive ? STATUS_COOLING : STATUS_IDLE;
             break;
     }
     
     updateOutputs();
-    clearResolvedFaults();
     _lastControlUpdate = millis();
+    _state.lastUpdate = _lastControlUpdate;
+    _statePub.publish(_state);
+}
+
+uint32_t TemperatureController::msUntilNextDeadline(uint32_t maxWaitMs) const {
+    if (_silenceRequested.load()) return 0;   // Operator input waits for the control task to apply it
+    unsigned long now = millis();
+    uint32_t wait = maxWaitMs;
+    auto consider = [&](unsigned long at) {
+        long remaining = (long)(at - now);
+        if (remaining <= 0) wait = 0;
+        else if ((unsigned long)remaining < wait) wait = (uint32_t)remaining;
+    };
+    // Compressor protection windows
+    if (_state.coolingActive) {
+        if (now - _lastCompressorChange < MIN_COMPRESSOR_ON_TIME_MS) consider(_lastCompressorChange + MIN_COMPRESSOR_ON_TIME_MS);
+    } else if (_coolingHeldUntil) {
+        consider(_coolingHeldUntil); // cooling request waiting on min off time
+    }
+    // Defrost end / overrun, or next scheduled start
+    if (_state.defrostActive) {
+        consider(_defrostStartTime + _config.defrostDuration);
+        consider(_defrostStartTime + _config.defrostDuration + DEFROST_TIMEOUT_GRACE_MS + 1);
+    } else if (_config.mode != MODE_OFF) {
+        consider(_state.lastDefrost + _config.defrostInterval);
+    }
+    // Fault set/clear debounce windows still counting
+    consider(now + faultRulesNextDeadline(FAULT_RULES, FAULT_RULE_COUNT, _faultTimers, _state.faultMask, now, wait));
+    // Alarm escalation, silence expiry and buzzer pattern
+    if (!_state.alarmActive && _state.alarmSince) consider(_state.alarmSince + ALARM_TRIGGER_GRACE_MS);
+    if (_state.alarmSilenced) consider(_state.alarmSilenceUntil + 1);
+    if (_config.buzzerEnabled && _state.alarmActive && !_state.alarmSilenced) consider(now - (now % 1000) + 1000);
+    return wait;
 }
 
 void TemperatureController::update(const SensorData& sensor) {
@@ -164,44 +207,45 @@ void TemperatureController::updateAutoMode(float avgTemp) {
     float hysteresis = _config.tempHysteresis;
     if (fabs(error) < hysteresis) {
         activateHeating(false);
-        activateCooling(false);
-        activateFan(0);
-        _state.status = STATUS_IDLE;
+        gateShortCycle(false);
+        activateFan(_state.coolingActive ? _config.fanSpeed : 0); // fan follows compressor held by min on time
+        _state.status = _state.coolingActive ? STATUS_COOLING : STATUS_IDLE;
         return;
     }
     if (error > 0) { // Need heating
         activateHeating(true);
-        activateCooling(false);
+        gateShortCycle(false);
         uint8_t fanSpeed = constrain((uint8_t)abs(calculatePID(error)), 30, 100);
         activateFan(fanSpeed);
         _state.status = STATUS_HEATING;
     } else { // Need cooling
         activateHeating(false);
-        activateCooling(true);
+        gateShortCycle(true); // min off time may hold the compressor back
         uint8_t fanSpeed = constrain((uint8_t)abs(calculatePID(error)), 30, 100);
         activateFan(fanSpeed);
-        _state.status = STATUS_COOLING;
+        _state.status = _state.coolingActive ? STATUS_COOLING : STATUS_IDLE;
     }
 }
 
 void TemperatureController::updateManualMode() {
     if (_config.mode == MODE_MANUAL_HEAT) {
         activateHeating(true);
-        activateCooling(false);
+        gateShortCycle(false);
         activateFan(_config.fanSpeed);
         _state.status = STATUS_HEATING;
     } else if (_config.mode == MODE_MANUAL_COOL) {
         activateHeating(false);
-        activateCooling(true);
+        gateShortCycle(true);
         activateFan(_config.fanSpeed);
-        _state.status = STATUS_COOLING;
+        _state.status = _state.coolingActive ? STATUS_COOLING : STATUS_IDLE;
     }
 }
 
 void TemperatureController::updateDefrostMode() {
-    // During defrost: heater on, compressor off, fan on high
-    activateHeating(true);
-    activateCooling(false);
+    // During defrost: heater on, compressor off, fan on high.
+    // The heater waits for a compressor still inside its min on time.
+    gateShortCycle(false);
+    activateHeating(!_state.coolingActive);
     activateFan(100);
     _state.status = STATUS_DEFROST;
     
@@ -221,7 +265,15 @@ void TemperatureController::activateHeating(bool enable) {
 
 void TemperatureController::activateCooling(bool enable) {
     if (_state.coolingActive != enable) {
+        unsigned long now = millis();
+        // Only gateShortCycle() switches the compressor, so this flags a protection window that was
+        // bypassed; a regular switch clears it
+        const bool shortCycle = enable ? _lastCompressorChange && now - _lastCompressorChange < MIN_COMPRESSOR_OFF_TIME_MS
+                                       : now - _lastCompressorChange < MIN_COMPRESSOR_ON_TIME_MS;
+        if (shortCycle && !faultActive(FaultBit(FAULT_COMPRESSOR_SHORT_CYCLE_BIT))) logEvent(0xF000 | FAULT_COMPRESSOR_SHORT_CYCLE_BIT);
+        updateFault(FaultBit(FAULT_COMPRESSOR_SHORT_CYCLE_BIT), shortCycle);
         _state.coolingActive = enable;
+        _lastCompressorChange = now; // every path (auto, manual, defrost) starts a protection window
         DEBUG_PRINT("Cooling: ");
         DEBUG_PRINTLN(enable ? "ON" : "OFF");
     }
@@ -237,25 +289,29 @@ void TemperatureController::activateFan(uint8_t speed) {
 }
 
 void TemperatureController::updateOutputs() {
-    digitalWrite(RELAY_HEAT_PIN, _state.heatingActive ? HIGH : LOW);
-    digitalWrite(RELAY_COOL_PIN, _state.coolingActive ? HIGH : LOW);
-    ledcWrite(1, map(_state.fanPWM, 0, 100, 0, 255));
+#ifndef ENABLE_RELAYS
+    // Direct GPIO drive; with ENABLE_RELAYS the control task maps state onto the PCF8574 expander
+    if (_relayPins) {
+        digitalWrite(RELAY_HEAT_PIN, _state.heatingActive ? HIGH : LOW);
+        digitalWrite(RELAY_COOL_PIN, _state.coolingActive ? HIGH : LOW);
+        ledcWrite(1, map(_state.fanPWM, 0, 100, 0, 255));
+    }
+#endif
     // Buzzer: active only during alarmActive and not silenced
-    if (_config.buzzerEnabled) {
-        if (_state.alarmActive && !_state.alarmSilenced) {
-            // Simple periodic beep pattern (250ms ON each second)
-            if ((millis() / 1000) % 2 == 0) {
-                digitalWrite(BUZZER_PIN, HIGH);
-            } else {
-                digitalWrite(BUZZER_PIN, LOW);
-            }
-        } else {
-            digitalWrite(BUZZER_PIN, LOW);
-        }
-    }
+    if (_buzzerPin && _config.buzzerEnabled) digitalWrite(BUZZER_PIN, buzzerOn() ? HIGH : LOW);
+}
+
+bool TemperatureController::buzzerOn() const {
+    if (!_config.buzzerEnabled || !_state.alarmActive || _state.alarmSilenced) return false;
+    return (millis() / 1000) % 2 == 0; // Simple periodic beep pattern (on every other second)
 }
 
 void TemperatureController::silenceAlarm() {
+    _silenceRequested.store(true);
+}
+
+void TemperatureController::applySilenceRequest() {
+    if (!_silenceRequested.exchange(false)) return;
     if (_state.alarmActive && !_state.alarmSilenced) {
         _state.alarmSilenced = true;
         _state.alarmSilenceUntil = millis() + ALARM_SILENCE_DURATION_MS;
@@ -264,36 +320,7 @@ void TemperatureController::silenceAlarm() {
 }
 
 void TemperatureController::logEvent(uint16_t code) {
-    _eventLog[_eventHead] = { millis(), _state.faultMask, code };
-    _eventHead = (_eventHead + 1) % EVENT_LOG_SIZE;
-    if (_eventCount < EVENT_LOG_SIZE) _eventCount++;
-}
-
-void TemperatureController::safetyCheck(const SensorData sensors[], uint8_t count) {
-    // Check for sensor failures
-    bool hasValidSensor = false;
-    for (uint8_t i = 0; i < count; i++) {
-        if (sensors[i].valid) {
-            hasValidSensor = true;
-            
-            // Check for extreme temperatures
-            if (sensors[i].temperature < TEMP_MIN_SAFE || 
-                sensors[i].temperature > TEMP_MAX_SAFE) {
-    updateFault(FaultBit(FAULT_SENSOR_RANGE_BIT), true);
-    if (_rangeFaultSince == 0) _rangeFaultSince = millis();
-        return; // continue non-blocking strategy (no STATUS_ERROR)
-            }
-        }
-    }
-    
-    if (!hasValidSensor) {
-    updateFault(FaultBit(FAULT_SENSOR_MISSING_BIT), true);
-    if (_sensorMissingSince == 0) _sensorMissingSince = millis();
-    // Disable outputs safely but do not mark STATUS_ERROR
-    activateHeating(false);
-    activateCooling(false);
-    activateFan(0);
-    }
+    _events.push({ millis(), _state.faultMask, code });   // Full ring: dropped and counted, never blocks
 }
 
 void TemperatureController::setMode(SystemMode mode) {
@@ -303,6 +330,7 @@ void TemperatureController::setMode(SystemMode mode) {
         // Reset PID when changing modes
         _pidLastError = 0;
         _pidIntegral = 0;
+        _configPub.publish(_config);
         
         DEBUG_PRINT("Mode changed to: ");
         DEBUG_PRINTLN(mode);
@@ -313,12 +341,14 @@ void TemperatureController::setTargetTemperature(float temp) {
     temp = constrain(temp, TEMP_MIN_SAFE, TEMP_MAX_SAFE);
     _config.targetTemp = temp;
     _config.TargetTemperature = temp;
+    _configPub.publish(_config);
     DEBUG_PRINT("Target temperature set to: ");
     DEBUG_PRINTLN(temp);
 }
 
 void TemperatureController::setFanSpeed(uint8_t speed) {
     _config.fanSpeed = constrain(speed, 0, 100);
+    _configPub.publish(_config);
     DEBUG_PRINT("Fan speed set to: ");
     DEBUG_PRINTLN(_config.fanSpeed);
 }
@@ -326,6 +356,7 @@ void TemperatureController::setFanSpeed(uint8_t speed) {
 void TemperatureController::setHysteresis(float value) {
     _config.tempHysteresis = constrain(value, 0.5, 5.0);
     _config.TemperatureHysteresis = _config.tempHysteresis;
+    _configPub.publish(_config);
     DEBUG_PRINT("Hysteresis set to: ");
     DEBUG_PRINTLN(_config.tempHysteresis);
 }
@@ -380,24 +411,6 @@ float TemperatureController::calculatePID(float error) {
     return constrain(output, -100, 100);
 }
 
-float TemperatureController::calculateAverageTemp(const SensorData sensors[], uint8_t count) {
-    float sum = 0;
-    uint8_t validCount = 0;
-    
-    for (uint8_t i = 0; i < count; i++) {
-        if (sensors[i].valid) {
-            sum += sensors[i].temperature;
-            validCount++;
-        }
-    }
-    
-    if (validCount > 0) {
-        return sum / validCount;
-    }
-    
-    return 0.0;
-}
-
 bool TemperatureController::shouldStartDefrost() {
     // Check if enough time has passed since last defrost
     if (millis() - _state.lastDefrost >= _config.defrostInterval) {
@@ -424,97 +437,29 @@ void TemperatureController::clearAllFaults() {
     }
 }
 
-bool TemperatureController::hasValidSensor(const SensorData sensors[], uint8_t count) const {
-    for (uint8_t i = 0; i < count; ++i) if (sensors[i].valid) return true;
-    return false;
-}
-
-void TemperatureController::evaluateFaults(const SensorData sensors[], uint8_t count) {
-    unsigned long now = millis();
-    bool anyValid = false;
-    bool rangeFault = false;
-    float avg = calculateAverageTemp(sensors, count);
-    float overThresh = _config.targetTemp + OVER_TEMPERATURE_MARGIN;
-    float underThresh = _config.targetTemp - UNDER_TEMPERATURE_MARGIN;
-
-    // Sensor presence & range
+FaultInputs TemperatureController::gatherFaultInputs(const SensorData sensors[], uint8_t count) const {
+    FaultInputs in {};
+    float sum = 0;
     for (uint8_t i = 0; i < count; ++i) {
-        if (sensors[i].valid) {
-            anyValid = true;
-            if (sensors[i].temperature < TEMP_MIN_SAFE || sensors[i].temperature > TEMP_MAX_SAFE) {
-                rangeFault = true;
-            }
-        }
-    }
-    if (!anyValid) {
-        if (_sensorMissingSince == 0) _sensorMissingSince = now;
-        if (now - _sensorMissingSince >= SENSOR_MISSING_DEBOUNCE_MS) updateFault(FaultBit(FAULT_SENSOR_MISSING_BIT), true);
-    } else {
-        _sensorMissingSince = 0; // resolution candidate; clearing handled in clearResolvedFaults
-    }
-    if (rangeFault) {
-        if (_rangeFaultSince == 0) _rangeFaultSince = now;
-        if (now - _rangeFaultSince >= RANGE_FAULT_DEBOUNCE_MS) updateFault(FaultBit(FAULT_SENSOR_RANGE_BIT), true);
-    } else {
-        _rangeFaultSince = 0;
-    }
-
-    // Over / Under temperature (relative to target)
-    if (anyValid) {
-        if (avg > overThresh) {
-            if (_overTempSince == 0) _overTempSince = now;
-            if (now - _overTempSince >= FAULT_DEBOUNCE_MS) updateFault(FaultBit(FAULT_OVER_TEMPERATURE_BIT), true);
-        } else {
-            _overTempSince = 0;
-        }
-        if (avg < underThresh) {
-            if (_underTempSince == 0) _underTempSince = now;
-            if (now - _underTempSince >= FAULT_DEBOUNCE_MS) updateFault(FaultBit(FAULT_UNDER_TEMPERATURE_BIT), true);
-        } else {
-            _underTempSince = 0;
-        }
-    }
-
-    // Defrost timeout fault
-    if (_state.defrostActive) {
-        if (now - _defrostStartTime > (_config.defrostDuration + DEFROST_TIMEOUT_GRACE_MS)) {
-            if (_defrostOverrunSince == 0) _defrostOverrunSince = now;
-            if (now - _defrostOverrunSince >= FAULT_DEBOUNCE_MS) updateFault(FaultBit(FAULT_DEFROST_TIMEOUT_BIT), true);
-        }
-    } else {
-        _defrostOverrunSince = 0;
-    }
-
-    // Short cycle detection (cooling relay gating) – set fault if request arrives before minimum off time elapsed
-    // Implemented via gateShortCycle called when cooling activation desired (see updateAutoMode modifications below if extended)
+        if (!sensors[i].valid) continue;
+        float t = sensors[i].temperature;
+        if (in.validCount == 0 || t < in.minTemp) in.minTemp = t;
+        if (in.validCount == 0 || t > in.maxTemp) in.maxTemp = t;
+        sum += t;
+        in.validCount++;
+    }
+    in.avgTemp = in.validCount ? sum / in.validCount : 0.0f;
+    in.targetTemp = _config.targetTemp;
+    in.hysteresis = _config.tempHysteresis;
+    in.defrostActive = _state.defrostActive;
+    in.defrostElapsedMs = _state.defrostActive ? (uint32_t)(millis() - _defrostStartTime) : 0;
+    in.defrostLimitMs = _config.defrostDuration + DEFROST_TIMEOUT_GRACE_MS;
+    return in;
 }
 
-void TemperatureController::clearResolvedFaults() {
-    unsigned long now = millis();
-    // Clear sensor missing when we have a valid sensor for debounce period
-    if (faultActive(FaultBit(FAULT_SENSOR_MISSING_BIT))) {
-        if (_sensorMissingSince == 0 && hasValidSensor(nullptr, 0) == false) {
-            // cannot evaluate without sensors list; leave as is (will be cleared next evaluation when integrated with sensor pass)
-        }
-    }
-    // Clear range fault when no range fault flagged this cycle
-    if (!faultActive(FaultBit(FAULT_SENSOR_RANGE_BIT)) || _rangeFaultSince == 0) {
-        // (Range fault clearance is handled indirectly by evaluateFaults resetting _rangeFaultSince)
-    }
-    // Over / Under temperature self-clear when back inside +/- hysteresis band of target for debounce period (reuse timers)
-    float upperClear = _config.targetTemp + (_config.tempHysteresis * 0.5f);
-    float lowerClear = _config.targetTemp - (_config.tempHysteresis * 0.5f);
-    if (faultActive(FaultBit(FAULT_OVER_TEMPERATURE_BIT)) && _state.currentTemp <= upperClear) {
-        updateFault(FaultBit(FAULT_OVER_TEMPERATURE_BIT), false);
-    }
-    if (faultActive(FaultBit(FAULT_UNDER_TEMPERATURE_BIT)) && _state.currentTemp >= lowerClear) {
-        updateFault(FaultBit(FAULT_UNDER_TEMPERATURE_BIT), false);
-    }
-    // Defrost timeout fault clears when a new successful defrost cycle starts and completes under allowed duration
-    if (faultActive(FaultBit(FAULT_DEFROST_TIMEOUT_BIT)) && !_state.defrostActive && _defrostOverrunSince == 0) {
-        // heuristic clear after cycle ended and no overrun timer
-        updateFault(FaultBit(FAULT_DEFROST_TIMEOUT_BIT), false);
-    }
+void TemperatureController::evaluateFaults(const FaultInputs& in) {
+    evaluateFaultRules(FAULT_RULES, FAULT_RULE_COUNT, _faultTimers, in, millis(), _state.faultMask,
+                       [this](uint16_t code) { logEvent(code); });
 }
 
 void TemperatureController::gateShortCycle(bool wantCooling) {
@@ -522,25 +467,22 @@ void TemperatureController::gateShortCycle(bool wantCooling) {
     if (wantCooling) {
         _lastCoolingRequest = now;
         if (!_state.coolingActive) {
-            // Check minimum off time
+            // Minimum off time: a pending start, not a fault; msUntilNextDeadline() wakes us for it
             if (now - _lastCompressorChange < MIN_COMPRESSOR_OFF_TIME_MS) {
-                updateFault(FaultBit(FAULT_COMPRESSOR_SHORT_CYCLE_BIT), true);
-                // Do not enable cooling yet
+                _coolingHeldUntil = _lastCompressorChange + MIN_COMPRESSOR_OFF_TIME_MS;
                 return;
-            } else {
-                updateFault(FaultBit(FAULT_COMPRESSOR_SHORT_CYCLE_BIT), false);
-                activateCooling(true);
-                _lastCompressorChange = now;
             }
+            _coolingHeldUntil = 0;
+            activateCooling(true);
         }
     } else {
+        _coolingHeldUntil = 0; // no pending request being held back
         if (_state.coolingActive) {
             // Respect minimum on time
             if (now - _lastCompressorChange < MIN_COMPRESSOR_ON_TIME_MS) {
                 return; // keep running until min on time met
             }
             activateCooling(false);
-            _lastCompressorChange = now;
         }
     }
-}
\ No newline at end of file
+}
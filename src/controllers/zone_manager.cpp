@@ -0,0 +1,140 @@
+#include "controllers/zone_manager.h"
+
+// Zones driven by the control task
+ZoneManager zones;
+
+ZoneManager::ZoneManager() : _pending(0), _stale(0), _buzzing(0), _count(0), _banksUsed(0), _buzzerPin(-1) {
+    memset(_dueAt, 0, sizeof(_dueAt));
+    memset(_sampleAt, 0, sizeof(_sampleAt));
+    memset(_bankOn, 0, sizeof(_bankOn));
+    memset(_bankLines, 0, sizeof(_bankLines));
+    memset(_inputCount, 0, sizeof(_inputCount));
+    memset(_cost, 0, sizeof(_cost));
+    for (uint8_t z = 0; z < CAPACITY; z++) _ctl[z] = nullptr;
+}
+
+ZoneManager::~ZoneManager() {
+    for (uint8_t z = 1; z < _count; z++) delete _ctl[z];
+}
+
+uint8_t ZoneManager::addZone(const ZoneSetup& setup) {
+    if (_count >= CAPACITY || setup.relays.bank >= MAX_RELAY_BANKS) return NO_ZONE;
+    uint8_t z = _count;
+    if (z == 0) {
+        _ctl[z] = &controller;   // Initialised by setup() (pins configured) before the zones are added
+        _ctl[z]->setPinOutputs(true, false);
+    } else {
+        _ctl[z] = new TemperatureController();
+        _ctl[z]->setPinOutputs(false, false);
+        _ctl[z]->init();
+    }
+    _setup[z] = setup;
+    for (uint8_t line : { setup.relays.compressor, setup.relays.heater, setup.relays.fan }) {
+        if (line <= 7) _bankLines[setup.relays.bank] |= (uint8_t)(1u << line);
+    }
+    _dueAt[z] = millis();
+    _sampleAt[z] = millis();
+    _stale |= (uint16_t)(1u << z);   // No sample yet: inputs empty until the first submit()
+    if (setup.relays.bank + 1 > _banksUsed) _banksUsed = setup.relays.bank + 1;
+    _count++;
+    return z;
+}
+
+void ZoneManager::submit(uint8_t z, const SensorData sensors[], uint8_t count, uint32_t nowMs) {
+    if (z >= _count) return;
+    if (count > MAX_SENSORS) count = MAX_SENSORS;
+    memcpy(_input[z], sensors, count * sizeof(SensorData));
+    _inputCount[z] = count;
+    _sampleAt[z] = nowMs;
+    _pending |= (uint16_t)(1u << z);
+    _stale &= (uint16_t)~(1u << z);
+}
+
+uint32_t ZoneManager::step(uint32_t nowMs, uint32_t maxWaitMs) {
+    uint32_t wait = maxWaitMs;
+    for (uint8_t z = 0; z < _count; z++) {
+        const uint16_t bit = (uint16_t)(1u << z);
+        // Sensor side stalled for this zone: stop trusting its last sample so sensor-missing debounces
+        if (!(_stale & bit) && nowMs - _sampleAt[z] > SENSOR_TIMEOUT) {
+            for (uint8_t i = 0; i < _inputCount[z]; i++) _input[z][i].valid = false;
+            _stale |= bit;
+            _pending |= bit;
+        }
+        if ((_pending & bit) || (int32_t)(nowMs - _dueAt[z]) >= 0) runZone(z, nowMs, maxWaitMs);
+
+        uint32_t remaining = (int32_t)(_dueAt[z] - nowMs) > 0 ? _dueAt[z] - nowMs : 0;
+        if (!(_stale & bit)) {
+            uint32_t staleIn = _sampleAt[z] + SENSOR_TIMEOUT + 1 - nowMs;
+            if (staleIn < remaining) remaining = staleIn;
+        }
+        if (remaining < wait) wait = remaining;
+    }
+    _pending = 0;
+    writeBuzzer();
+    return wait;
+}
+
+void ZoneManager::runZone(uint8_t z, uint32_t nowMs, uint32_t maxWaitMs) {
+    uint32_t t0 = costTicks();
+    TemperatureController& c = *_ctl[z];
+    c.runControlCycle(_input[z], _inputCount[z]);
+    _dueAt[z] = nowMs + c.msUntilNextDeadline(maxWaitMs);
+    applyOutputs(z);
+    if (c.buzzerOn()) _buzzing |= (uint16_t)(1u << z);
+    else _buzzing &= (uint16_t)~(1u << z);
+    uint32_t ticks = costTicks() - t0;
+
+    ZoneCost& k = _cost[z];
+    k.steps++;
+    k.lastTicks = ticks;
+    if (ticks > k.maxTicks) k.maxTicks = ticks;
+    k.totalTicks += ticks;
+}
+
+void ZoneManager::applyOutputs(uint8_t z) {
+    const ZoneRelayMap& m = _setup[z].relays;
+    ControlState st = _ctl[z]->getState();
+    uint8_t on = _bankOn[m.bank];
+    auto set = [&on](uint8_t line, bool v) {
+        if (line > 7) return;
+        if (v) on |= (uint8_t)(1u << line);
+        else on &= (uint8_t)~(1u << line);
+    };
+    set(m.compressor, st.coolingActive);
+    set(m.heater, st.heatingActive);
+    set(m.fan, st.fanPWM > 0);
+    _bankOn[m.bank] = on;
+}
+
+void ZoneManager::writeBuzzer() {
+    const int8_t level = _buzzing ? HIGH : LOW;
+    if (level == _buzzerPin) return;
+    digitalWrite(BUZZER_PIN, level);
+    _buzzerPin = level;
+}
+
+uint32_t ZoneManager::costTicks() {
+#ifdef UNIT_TEST_NATIVE
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#else
+    return ESP.getCycleCount();
+#endif
+}
+
+uint32_t ZoneManager::ticksPerUs() {
+#ifdef UNIT_TEST_NATIVE
+    return 1000;
+#else
+    return getCpuFrequencyMhz();
+#endif
+}
+
+float ZoneManager::meanCostUs(uint8_t z) const {
+    const ZoneCost& k = _cost[z];
+    return k.steps ? (float)((double)k.totalTicks / k.steps / ticksPerUs()) : 0.0f;
+}
+
+void ZoneManager::resetCost() {
+    memset(_cost, 0, sizeof(_cost));
+}
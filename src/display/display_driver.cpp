@@ -1,6 +1,8 @@
 #include "display/display_driver.h"
 #include "hal/ch422g.h"
 #include "display/gt911.h"
+#include "rtos/task_config.h"
+#include "display/display_timing.h"
 #ifndef BACKLIGHT_FALLBACK_PIN
 #define BACKLIGHT_FALLBACK_PIN DISPLAY_DE_PIN // Override in build_flags with -DBACKLIGHT_FALLBACK_PIN=<gpio>
 #endif
@@ -12,12 +14,145 @@ DisplayDriver display;
 void DisplayDriver::lvgl_flush_cb(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p) {
     DisplayDriver* driver = (DisplayDriver*)disp_drv->user_data;
     if (driver && driver->_lgfx) {
-        uint32_t w = (area->x2 - area->x1 + 1);
-        uint32_t h = (area->y2 - area->y1 + 1);
-        driver->_lgfx->startWrite();
-        driver->_lgfx->setAddrWindow(area->x1, area->y1, w, h);
-        driver->_lgfx->writePixels((uint16_t*)color_p, w * h);
-        driver->_lgfx->endWrite();
+        if (lv_disp_flush_is_last(disp_drv)) driver->_frameCount++;
+        driver->_flushPxTotal += lv_area_get_size(area);
+        if (driver->_flushTask) {
+            // LVGL waits (wait_cb) before handing over another band, so one slot is enough
+            driver->_flushArea = *area;
+            driver->_flushPixels = color_p;
+            driver->_flushLastSeq = lv_disp_flush_is_last(disp_drv) ? driver->_renderingSeq : 0;
+            xTaskNotifyGive(driver->_flushTask);
+            return;   // lv_disp_flush_ready() comes from the flush task
+        }
+        uint32_t t0 = micros();
+        driver->writeArea(*area, color_p);
+        if (lv_disp_flush_is_last(disp_drv)) driver->framePresented(driver->_renderingSeq);
+        uint32_t us = micros() - t0;
+        driver->_flushUsTotal = driver->_flushUsTotal + us;
+        driver->_flushCountTotal = driver->_flushCountTotal + 1;
+        driver->_waitUsTotal += us;   // Inline copy: the render side waits for all of it
+    }
+    lv_disp_flush_ready(disp_drv);
+}
+
+void DisplayDriver::writeArea(const lv_area_t& area, lv_color_t* pixels) {
+    uint32_t w = (area.x2 - area.x1 + 1);
+    uint32_t h = (area.y2 - area.y1 + 1);
+    _lgfx->startWrite();
+    _lgfx->setAddrWindow(area.x1, area.y1, w, h);
+    _lgfx->writePixels((uint16_t*)pixels, w * h);
+    _lgfx->endWrite();
+}
+
+// Flush task (CORE_APP): the only user of _lgfx while a band is in flight
+void DisplayDriver::flushTaskLoop(void* arg) {
+    DisplayDriver* driver = (DisplayDriver*)arg;
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t t0 = micros();
+        driver->writeArea(driver->_flushArea, driver->_flushPixels);
+        if (driver->_flushLastSeq) driver->framePresented(driver->_flushLastSeq);
+        driver->_flushUsTotal = driver->_flushUsTotal + (micros() - t0);
+        driver->_flushCountTotal = driver->_flushCountTotal + 1;
+        lv_disp_flush_ready(&driver->disp_drv);   // Completion: LVGL may reuse this buffer
+        xSemaphoreGive(driver->_flushDone);
+    }
+}
+
+#if defined(ENABLE_PARALLEL_RENDER) && LV_REFR_BAND_UNITS > 1
+// Band task (CORE_APP): renders band unit 1's rows of the refresh the LVGL task is running
+void DisplayDriver::bandTaskLoop(void* arg) {
+    DisplayDriver* driver = (DisplayDriver*)arg;
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        lv_refr_band_unit(driver->disp, 1);
+        xSemaphoreGive(driver->_bandDone);
+    }
+}
+
+void DisplayDriver::lvgl_band_start_cb(lv_disp_drv_t* disp_drv, uint8_t units) {
+    DisplayDriver* driver = (DisplayDriver*)disp_drv->user_data;
+    LV_UNUSED(units);   // disp_drv.band_units is 2: only unit 1 exists
+    xTaskNotifyGive(driver->_bandTask);
+}
+
+// The LVGL task finished its own band; block until unit 1 is done too
+void DisplayDriver::lvgl_band_wait_cb(lv_disp_drv_t* disp_drv) {
+    DisplayDriver* driver = (DisplayDriver*)disp_drv->user_data;
+    xSemaphoreTake(driver->_bandDone, portMAX_DELAY);
+}
+#endif
+
+// LVGL spins on draw_buf->flushing calling this; block on the completion instead of burning core 0
+void DisplayDriver::lvgl_wait_cb(lv_disp_drv_t* disp_drv) {
+    DisplayDriver* driver = (DisplayDriver*)disp_drv->user_data;
+    uint32_t t0 = micros();
+    xSemaphoreTake(driver->_flushDone, pdMS_TO_TICKS(5));
+    driver->_waitUsTotal += micros() - t0;
+}
+
+// Called by lv_refr at the end of a refresh that had invalidated areas; px = pixels rendered
+void DisplayDriver::lvgl_monitor_cb(lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px) {
+    (void)time;   // ms resolution; the wrapper below times the same refresh in us
+    DisplayDriver* driver = (DisplayDriver*)disp_drv->user_data;
+    driver->_monitorPx = px;
+    driver->_monitorHit = true;
+}
+
+// Replaces the refresh timer callback: times _lv_disp_refr_timer() and attributes flush and wait
+// time by the change in the running totals. With the async flush the last band of a frame is still
+// being copied when the refresh returns, so its copy time lands in the next frame's flushUs.
+void DisplayDriver::profiledRefrTimer(lv_timer_t* timer) {
+    lv_disp_t* d = (lv_disp_t*)timer->user_data;
+    DisplayDriver* driver = (DisplayDriver*)d->driver->user_data;
+    const uint32_t flush0 = driver->_flushUsTotal, flushes0 = driver->_flushCountTotal, wait0 = driver->_waitUsTotal;
+    const uint32_t flushPx0 = driver->_flushPxTotal;
+    driver->_monitorHit = false;
+    driver->photonFlushed();   // Previous frame's async last band
+    driver->_renderingSeq = driver->_refreshSeq + 1;
+    uint32_t t0 = micros();
+    _lv_disp_refr_timer(timer);
+    uint32_t us = micros() - t0;
+    driver->_refreshSeq++;
+    driver->photonFlushed();
+    if (!driver->_monitorHit) return;   // Nothing was invalidated
+    FrameSample s;
+    s.seq = driver->_refreshSeq;
+    s.pixels = driver->_monitorPx;
+    s.flushedPixels = driver->_flushPxTotal - flushPx0;
+    s.waitUs = driver->_waitUsTotal - wait0;
+    s.renderUs = us > s.waitUs ? us - s.waitUs : 0;
+    s.flushUs = driver->_flushUsTotal - flush0;
+    s.flushes = (uint16_t)(driver->_flushCountTotal - flushes0);
+    s.totalUs = us;
+    driver->_profiler.record(s);
+}
+
+// Direct mode: color_p is the whole off-screen framebuffer and LVGL has already drawn area into it
+// in place. Only the cache lines need writing back before the DMA can scan the buffer; the last
+// area of a frame flips it on screen. LVGL then copies the redrawn areas into the other buffer.
+void DisplayDriver::lvgl_direct_flush_cb(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_p) {
+    DisplayDriver* driver = (DisplayDriver*)disp_drv->user_data;
+    driver->_flushPxTotal += lv_area_get_size(area);
+    if (area->y1 < driver->_dirtyY1) driver->_dirtyY1 = area->y1;
+    if (area->y2 > driver->_dirtyY2) driver->_dirtyY2 = area->y2;
+    if (lv_disp_flush_is_last(disp_drv)) {
+        // Rows synced from the previous frame were written by the CPU as well
+        int32_t y1 = min(driver->_dirtyY1, driver->_prevDirtyY1);
+        int32_t y2 = max(driver->_dirtyY2, driver->_prevDirtyY2);
+        uint32_t t0 = micros();
+        driver->_scanout.writeBack((uint16_t*)color_p, y1, y2);
+        driver->_scanout.flip((uint16_t*)color_p, DISPLAY_FLIP_TIMEOUT_MS);
+        driver->framePresented(driver->_renderingSeq);
+        uint32_t us = micros() - t0;
+        driver->_flushUsTotal = driver->_flushUsTotal + us;
+        driver->_flushCountTotal = driver->_flushCountTotal + 1;
+        driver->_waitUsTotal += us;   // Render side cannot reuse the front buffer before VSYNC
+        driver->_prevDirtyY1 = driver->_dirtyY1;
+        driver->_prevDirtyY2 = driver->_dirtyY2;
+        driver->_dirtyY1 = INT32_MAX;
+        driver->_dirtyY2 = -1;
+        driver->_frameCount++;
     }
     lv_disp_flush_ready(disp_drv);
 }
@@ -26,29 +161,73 @@ void DisplayDriver::lvgl_touch_cb(lv_indev_drv_t* indev_drv, lv_indev_data_t* da
     DisplayDriver* driver = (DisplayDriver*)indev_drv->user_data;
     if (driver) {
 #ifdef ENABLE_TOUCH
-        // Only poll controller if IRQ flagged (interrupt-driven) or periodic fallback every ~50ms.
-        static uint32_t lastPoll = 0;
-        bool shouldPoll = driver->_touchIRQFlag;
-        uint32_t now = millis();
-        if (!shouldPoll && (now - lastPoll) > 50) shouldPoll = true; // fallback
-        if (shouldPoll) {
-            driver->_touchIRQFlag = false; // clear flag
-            uint16_t tx, ty; bool pressed=false;
-            if (gt911.readTouch(tx, ty, pressed) && pressed) {
-                data->state = LV_INDEV_STATE_PR;
-                data->point.x = tx;
-                data->point.y = ty;
-                lastPoll = now;
-                return;
+        driver->_touchIRQFlag = false;
+        if (!driver->_touchTask) driver->_touch.service(micros());   // No touch task: read here instead
+        // One report per call; LVGL calls straight back while more are queued, so a quick tap's
+        // press and release are both seen. No new report = the last state still holds.
+        TouchFrame f;
+        if (driver->_touch.next(f)) {
+            data->continue_reading = driver->_touch.pending();
+            if (f.count && driver->_power.activity(millis())) driver->_swallowTouch = true;
+            if (driver->_swallowTouch) {
+                // This touch woke the screen: LVGL sees nothing of it, not even the release
+                if (!f.count) driver->_swallowTouch = false;
+                f.count = 0;
+            } else {
+                driver->_latency.delivered(f, micros());
             }
-            lastPoll = now;
+            driver->_touchState = f;
         }
+        const TouchFrame& s = driver->_touchState;
+        if (s.count) {
+            data->state = LV_INDEV_STATE_PR;
+            data->point.x = s.points[0].x;
+            data->point.y = s.points[0].y;
+            return;
+        }
+        // Released and the GT911 IRQ will report the next touch: stop the read timer so it no longer
+        // wakes the LVGL task every LV_INDEV_DEF_READ_PERIOD. update() resumes it on the next report.
+        if (!data->continue_reading && driver->_touchIrqAttached && driver->_renderTask) lv_timer_pause(indev_drv->read_timer);
 #endif
         data->state = LV_INDEV_STATE_REL;
     }
 }
 
-DisplayDriver::DisplayDriver() {
+// LVGL calls this for every event it sends while processing an input device: the first one after a
+// report is its dispatch
+void DisplayDriver::lvgl_feedback_cb(lv_indev_drv_t* indev_drv, uint8_t code) {
+    (void)code;
+    DisplayDriver* driver = (DisplayDriver*)indev_drv->user_data;
+    if (driver->_latency.awaitingDispatch()) driver->_latency.dispatched(micros());
+}
+
+// Called by _lv_inv_area() for every invalidated area (and by lv_refr when sizing bands); the area is
+// left as is. An invalidation made while LVGL processes the traced report is its first visible effect.
+void DisplayDriver::lvgl_rounder_cb(lv_disp_drv_t* disp_drv, lv_area_t* area) {
+    (void)area;
+    DisplayDriver* driver = (DisplayDriver*)disp_drv->user_data;
+    if (driver->_latency.awaitingInvalidation() && lv_indev_get_act()) {
+        driver->_latency.invalidated(micros(), driver->_refreshSeq + 1);
+    }
+}
+
+// Touch task (CORE_UI): sleeps until the GT911 IRQ, or polls while a finger is down
+void DisplayDriver::touchTaskLoop(void* arg) {
+    DisplayDriver* driver = (DisplayDriver*)arg;
+    uint32_t sleepMs = TouchPipeline<TwoWire>::WAIT_FOREVER;
+    while (true) {
+        TickType_t wait = sleepMs == TouchPipeline<TwoWire>::WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(sleepMs);
+        bool irq = ulTaskNotifyTake(pdTRUE, wait) > 0;
+        const uint32_t queued = driver->_touch.queued();
+        sleepMs = driver->_touch.service(irq ? driver->_touchIrqUs : micros());
+        if (driver->_touch.queued() != queued) {
+            driver->_touchIRQFlag = true;   // update() resumes the paused read timer
+            driver->requestRender();
+        }
+    }
+}
+
+DisplayDriver::DisplayDriver() : _touch(gt911) {
     _lgfx = nullptr;
     buf1 = nullptr;
     buf2 = nullptr;
@@ -61,6 +240,29 @@ DisplayDriver::DisplayDriver() {
 }
 
 DisplayDriver::~DisplayDriver() {
+    if (_touchTask) {
+        vTaskDelete(_touchTask);
+    }
+    if (_flushTask) {
+        vTaskDelete(_flushTask);
+    }
+    if (_flushDone) {
+        vSemaphoreDelete(_flushDone);
+    }
+#if defined(ENABLE_PARALLEL_RENDER) && LV_REFR_BAND_UNITS > 1
+    if (_bandTask) {
+        vTaskDelete(_bandTask);
+    }
+    if (_bandDone) {
+        vSemaphoreDelete(_bandDone);
+    }
+    if (_unitBuf1) {
+        heap_caps_free(_unitBuf1);
+    }
+    if (_unitBuf2) {
+        heap_caps_free(_unitBuf2);
+    }
+#endif
     if (_mutex) {
         vSemaphoreDelete(_mutex);
     }
@@ -93,6 +295,15 @@ bool DisplayDriver::init() {
         DEBUG_PRINTLN("ERROR: LVGL initialization failed!");
         return false;
     }
+    PowerConfig pc {};
+#ifdef ENABLE_DISPLAY_POWER
+    pc.dimAfterMs = DISPLAY_DIM_AFTER_MS;
+    pc.offAfterMs = DISPLAY_OFF_AFTER_MS;
+#endif
+    pc.activePct = 100;
+    pc.dimPct = DISPLAY_DIM_LEVEL;
+    pc.fadeMs = DISPLAY_FADE_MS;
+    _power.begin(pc, (1 << DISPLAY_BL_PWM_RESOLUTION) - 1, millis());
     _initialized = true;
     DEBUG_PRINTLN("=== Display Initialization Complete ===");
     return true;
@@ -160,6 +371,11 @@ bool DisplayDriver::initTouch() {
         // Attach interrupt if pin supports
         pinMode(TOUCH_IRQ_PIN, INPUT_PULLUP);
         attachInterrupt(TOUCH_IRQ_PIN, DisplayDriver::touch_isr_trampoline, FALLING);
+        _touchIrqAttached = true;
+        if (!_touch.begin(TOUCH_QUEUE_DEPTH)) {
+            DEBUG_PRINTLN("WARNING: no memory for the touch queue, reports will be dropped");
+        }
+        startTouchTask();
     } else {
         DEBUG_PRINTLN("WARNING: GT911 touch controller not found");
     }
@@ -171,33 +387,36 @@ bool DisplayDriver::initTouch() {
 bool DisplayDriver::initLVGL() {
     DEBUG_PRINTLN("Step 4: Initializing LVGL...");
     lv_init();
-    size_t buffer_size = DISPLAY_WIDTH * DISPLAY_HEIGHT / 10;
-    buf1 = (lv_color_t*)heap_caps_malloc(buffer_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
-    if (!buf1) {
-        DEBUG_PRINTLN("ERROR: Failed to allocate LVGL buffer 1 in PSRAM");
-        return false;
-    }
-    buf2 = (lv_color_t*)heap_caps_malloc(buffer_size * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
-    if (!buf2) {
-        DEBUG_PRINTLN("ERROR: Failed to allocate LVGL buffer 2 in PSRAM");
-        heap_caps_free(buf1); buf1 = nullptr;
-        return false;
-    }
-    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, buffer_size);
     lv_disp_drv_init(&disp_drv);
     disp_drv.hor_res = DISPLAY_WIDTH;
     disp_drv.ver_res = DISPLAY_HEIGHT;
-    disp_drv.flush_cb = lvgl_flush_cb;
     disp_drv.draw_buf = &draw_buf;
     disp_drv.user_data = this;
+    disp_drv.monitor_cb = lvgl_monitor_cb;
+    disp_drv.rounder_cb = lvgl_rounder_cb;
+    startFlushTask();
+    startBandTask();
+    if (!applyDrawBuffers(DISPLAY_DRAW_BUF_STRATEGY, DISPLAY_DRAW_BUF_LINES)) {
+        DEBUG_PRINTLN("ERROR: Failed to allocate LVGL draw buffers");
+        return false;
+    }
     disp = lv_disp_drv_register(&disp_drv);
     if (!disp) {
         DEBUG_PRINTLN("ERROR: Failed to register LVGL display driver");
         return false;
     }
+    // Refresh period: the configured one, stretched to the panel frame time if the panel is slower
+    uint32_t refreshHz = calc_refresh_hz(DEFAULT_RGB_TIMING);
+    if (refreshHz) {
+        uint32_t periodMs = (1000 + refreshHz - 1) / refreshHz;
+        if (periodMs < LV_DISP_DEF_REFR_PERIOD) periodMs = LV_DISP_DEF_REFR_PERIOD;
+        lv_timer_set_period(_lv_disp_get_refr_timer(disp), periodMs);
+    }
+    lv_timer_set_cb(_lv_disp_get_refr_timer(disp), profiledRefrTimer);
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = lvgl_touch_cb;
+    indev_drv.feedback_cb = lvgl_feedback_cb;
     indev_drv.user_data = this;
     indev = lv_indev_drv_register(&indev_drv);
     if (!indev) {
@@ -208,42 +427,466 @@ bool DisplayDriver::initLVGL() {
     return true;
 }
 
-void DisplayDriver::update() {
+bool DisplayDriver::initDirectMode() {
+#if defined(ENABLE_RGB_PANEL) && defined(ENABLE_LVGL_DIRECT_MODE)
+    if (!_scanout.begin(DISPLAY_WIDTH, DISPLAY_HEIGHT, DISPLAY_VSYNC_PIN, DEFAULT_RGB_TIMING.vsync_active_low)) {
+        DEBUG_PRINTLN("Direct mode unavailable, using partial buffers");
+        return false;
+    }
+    // LVGL writes lv_color_t as-is; the panel framebuffer must hold the same RGB565 byte order
+    _lgfx->drawPixel(0, 0, (uint16_t)0xF800);
+    bool sameOrder = _scanout.front()[0] == 0xF800;
+    _lgfx->drawPixel(0, 0, (uint16_t)0x0000);
+    if (!sameOrder) {
+        DEBUG_PRINTLN("Direct mode unavailable: framebuffer byte order differs from LV_COLOR_16_SWAP");
+        _scanout.end();
+        return false;
+    }
+    _directMode = true;
+    DEBUG_PRINTLN("LVGL direct mode on panel framebuffers");
+    return true;
+#else
+    return false;
+#endif
+}
+
+static const char* strategyName(DrawBufferStrategy s) {
+    switch (s) {
+        case DRAW_BUF_DIRECT:      return "direct";
+        case DRAW_BUF_PSRAM_BANDS: return "psram-bands";
+        case DRAW_BUF_SRAM_TILES:  return "sram-tiles";
+    }
+    return "?";
+}
+
+// Two band buffers of `lines` rows. fitToHeap shrinks the band to what the heap can spare
+// (keeping DISPLAY_SRAM_RESERVE_BYTES free) and steps down further if allocation still fails.
+bool DisplayDriver::allocBands(uint16_t lines, uint32_t caps, bool fitToHeap) {
+    const size_t lineBytes = DISPLAY_WIDTH * sizeof(lv_color_t);
+    if (lines > DISPLAY_HEIGHT) lines = DISPLAY_HEIGHT;
+    if (fitToHeap) {
+        size_t freeBytes = heap_caps_get_free_size(caps);
+        size_t budget = freeBytes > DISPLAY_SRAM_RESERVE_BYTES ? (freeBytes - DISPLAY_SRAM_RESERVE_BYTES) / 2 : 0;
+        size_t largest = heap_caps_get_largest_free_block(caps);
+        if (budget > largest) budget = largest;
+        if (lines > budget / lineBytes) lines = budget / lineBytes;
+    }
+    while (lines >= DISPLAY_DRAW_BUF_MIN_LINES) {
+        buf1 = (lv_color_t*)heap_caps_malloc(lines * lineBytes, caps);
+        buf2 = buf1 ? (lv_color_t*)heap_caps_malloc(lines * lineBytes, caps) : nullptr;
+        if (buf2) {
+            _bufLines = lines;
+            return true;
+        }
+        if (buf1) heap_caps_free(buf1);
+        buf1 = nullptr;
+        if (!fitToHeap) break;
+        lines = lines * 3 / 4;
+    }
+    return false;
+}
+
+// Band unit 1's pair of band buffers, the size of buf1/buf2. Only taken from what the heap can
+// spare: without them LVGL renders partial-mode bands on the LVGL task alone.
+bool DisplayDriver::allocUnitBands(uint32_t caps) {
+#if defined(ENABLE_PARALLEL_RENDER) && LV_REFR_BAND_UNITS > 1
+    const size_t bytes = (size_t)DISPLAY_WIDTH * _bufLines * sizeof(lv_color_t);
+    if (!_bandTask) return false;
+    if ((caps & MALLOC_CAP_INTERNAL) && heap_caps_get_free_size(caps) < 2 * bytes + DISPLAY_SRAM_RESERVE_BYTES) {
+        return false;
+    }
+    _unitBuf1 = (lv_color_t*)heap_caps_malloc(bytes, caps);
+    _unitBuf2 = _unitBuf1 ? (lv_color_t*)heap_caps_malloc(bytes, caps) : nullptr;
+    if (_unitBuf2) return true;
+    if (_unitBuf1) heap_caps_free(_unitBuf1);
+    _unitBuf1 = nullptr;
+    return false;
+#else
+    LV_UNUSED(caps);
+    return false;
+#endif
+}
+
+bool DisplayDriver::isParallelRender() const {
+#if defined(ENABLE_PARALLEL_RENDER) && LV_REFR_BAND_UNITS > 1
+    return _bandTask && (_directMode || _unitBuf1);
+#else
+    return false;
+#endif
+}
+
+void DisplayDriver::releaseDrawBuffers() {
+    while (_flushTask && disp_drv.draw_buf && disp_drv.draw_buf->flushing) lvgl_wait_cb(&disp_drv);
+    if (buf1) heap_caps_free(buf1);
+    if (buf2) heap_caps_free(buf2);
+    buf1 = buf2 = nullptr;
+#if defined(ENABLE_PARALLEL_RENDER) && LV_REFR_BAND_UNITS > 1
+    if (_unitBuf1) heap_caps_free(_unitBuf1);
+    if (_unitBuf2) heap_caps_free(_unitBuf2);
+    _unitBuf1 = _unitBuf2 = nullptr;
+#endif
+    if (_directMode) _scanout.end();   // Bus_RGB scans its own framebuffer again
+    _directMode = false;
+    _bufLines = 0;
+}
+
+// Installs a draw buffer strategy; anything that cannot be allocated falls back to PSRAM bands.
+// Caller holds the LVGL lock once the display is registered.
+bool DisplayDriver::applyDrawBuffers(DrawBufferStrategy strategy, uint16_t lines) {
+    releaseDrawBuffers();
+    bool ok = false;
+    if (strategy == DRAW_BUF_DIRECT) ok = initDirectMode();
+    else if (strategy == DRAW_BUF_SRAM_TILES) ok = allocBands(lines, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA, true);
+    if (!ok && strategy != DRAW_BUF_PSRAM_BANDS) {
+        DEBUG_PRINTF("Draw buffers: %s unavailable, using psram-bands\n", strategyName(strategy));
+    }
+    if (!ok) {
+        if (strategy == DRAW_BUF_DIRECT || lines < DISPLAY_DRAW_BUF_MIN_LINES) lines = DISPLAY_DRAW_BUF_LINES;
+        strategy = DRAW_BUF_PSRAM_BANDS;
+        if (!allocBands(lines, MALLOC_CAP_SPIRAM, false)) return false;
+    }
+    if (!_directMode) {
+        allocUnitBands(strategy == DRAW_BUF_SRAM_TILES ? MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA : MALLOC_CAP_SPIRAM);
+    }
+
+    if (_directMode) {
+        // Back buffer first: LVGL's first frame goes off screen, then flips
+        lv_disp_draw_buf_init(&draw_buf, _scanout.buffer(1), _scanout.buffer(0), DISPLAY_WIDTH * DISPLAY_HEIGHT);
+        _bufLines = DISPLAY_HEIGHT;
+    } else {
+        lv_disp_draw_buf_init(&draw_buf, buf1, buf2, (uint32_t)DISPLAY_WIDTH * _bufLines);
+#if defined(ENABLE_PARALLEL_RENDER) && LV_REFR_BAND_UNITS > 1
+        if (_unitBuf1) lv_disp_draw_buf_set_band_bufs(&draw_buf, 1, _unitBuf1, _unitBuf2);
+#endif
+    }
+    disp_drv.direct_mode = _directMode ? 1 : 0;
+    disp_drv.flush_cb = _directMode ? lvgl_direct_flush_cb : lvgl_flush_cb;
+    disp_drv.wait_cb = (!_directMode && _flushTask) ? lvgl_wait_cb : nullptr;
+    _bufStrategy = strategy;
+    if (disp) {
+        _lv_ll_clear(&disp->sync_areas);   // Direct-mode sync areas refer to the old buffers
+        lv_obj_invalidate(lv_scr_act());
+    }
+    DEBUG_PRINTF("Draw buffers: %s, %u lines%s\n", strategyName(strategy), (unsigned)_bufLines,
+                 isParallelRender() ? ", parallel render" : "");
+    return true;
+}
+
+bool DisplayDriver::setDrawBuffers(DrawBufferStrategy strategy, uint16_t lines) {
+    if (!_initialized) return false;
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    bool ok = applyDrawBuffers(strategy, lines);
+    xSemaphoreGive(_mutex);
+    return ok && _bufStrategy == strategy;
+}
+
+// Test scene for the buffer benchmark: gradient, buttons with text, arc, bar, chart
+static lv_obj_t* buildBenchmarkScene() {
+    lv_obj_t* scr = lv_obj_create(nullptr);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x102040), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0x000000), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+    for (int i = 0; i < 12; i++) {
+        lv_obj_t* btn = lv_btn_create(scr);
+        lv_obj_set_size(btn, 180, 60);
+        lv_obj_set_pos(btn, 10 + (i % 4) * 195, 10 + (i / 4) * 75);
+        lv_obj_t* label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "Zone %d  -18.%d C", i + 1, i);
+        lv_obj_center(label);
+    }
+    lv_obj_t* arc = lv_arc_create(scr);
+    lv_obj_set_size(arc, 200, 200);
+    lv_obj_set_pos(arc, 10, 250);
+    lv_arc_set_value(arc, 65);
+    lv_obj_t* bar = lv_bar_create(scr);
+    lv_obj_set_size(bar, 300, 24);
+    lv_obj_set_pos(bar, 240, 260);
+    lv_bar_set_value(bar, 40, LV_ANIM_OFF);
+    lv_obj_t* chart = lv_chart_create(scr);
+    lv_obj_set_size(chart, 540, 160);
+    lv_obj_set_pos(chart, 240, 300);
+    lv_chart_series_t* ser = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_CYAN), LV_CHART_AXIS_PRIMARY_Y);
+    for (int i = 0; i < 10; i++) lv_chart_set_next_value(chart, ser, (i * 37) % 100);
+    return scr;
+}
+
+void DisplayDriver::benchmarkDrawBuffers(uint16_t frames) {
+    if (!_initialized || !frames) return;
+    struct Case { DrawBufferStrategy strategy; uint16_t lines; };
+    static const Case cases[] = {
+        { DRAW_BUF_PSRAM_BANDS, 48 }, { DRAW_BUF_PSRAM_BANDS, 96 },
+        { DRAW_BUF_SRAM_TILES, 16 }, { DRAW_BUF_SRAM_TILES, 32 }, { DRAW_BUF_SRAM_TILES, 64 },
+        { DRAW_BUF_DIRECT, DISPLAY_HEIGHT },
+    };
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    const DrawBufferStrategy prevStrategy = _bufStrategy;
+    const uint16_t prevLines = _bufLines;
+    lv_obj_t* prevScr = lv_scr_act();
+    lv_obj_t* scr = buildBenchmarkScene();
+    lv_scr_load(scr);
+    Serial.printf("[DISPBENCH] %u full-screen frames per case\n", (unsigned)frames);
+    for (const Case& c : cases) {
+        if (!applyDrawBuffers(c.strategy, c.lines) || _bufStrategy != c.strategy) {
+            Serial.printf("[DISPBENCH] %-11s %3u lines: unavailable\n", strategyName(c.strategy), (unsigned)c.lines);
+            continue;
+        }
+        lv_refr_now(disp);   // Warm-up (first frame after a switch also syncs direct-mode buffers)
+        const uint32_t flush0 = _flushUsTotal, wait0 = _waitUsTotal;
+        uint32_t t0 = micros();
+        for (uint16_t i = 0; i < frames; i++) {
+            lv_obj_invalidate(scr);
+            lv_refr_now(disp);
+        }
+        while (_flushTask && draw_buf.flushing) lvgl_wait_cb(&disp_drv);
+        uint32_t us = micros() - t0;
+        uint32_t waitUs = _waitUsTotal - wait0;
+        double frameMs = us / 1000.0 / frames;
+        Serial.printf("[DISPBENCH] %-11s %3u lines: %6.2f ms/frame %6.2f Mpx/s render %6.2f ms flush %6.2f ms wait %6.2f ms\n",
+                      strategyName(c.strategy), (unsigned)_bufLines, frameMs,
+                      (double)DISPLAY_WIDTH * DISPLAY_HEIGHT * frames / us,
+                      (us - waitUs) / 1000.0 / frames, (_flushUsTotal - flush0) / 1000.0 / frames, waitUs / 1000.0 / frames);
+    }
+    lv_scr_load(prevScr);
+    lv_obj_del(scr);
+    applyDrawBuffers(prevStrategy, prevLines);
+    xSemaphoreGive(_mutex);
+}
+
+void DisplayDriver::dumpFrameProfile(bool withFrames) {
     if (!_initialized) return;
+    static const struct { FrameField field; const char* name; } rows[] = {
+        { FRAME_TOTAL, "total us" }, { FRAME_RENDER, "render us" }, { FRAME_FLUSH, "flush us" },
+        { FRAME_WAIT, "wait us" }, { FRAME_PIXELS, "pixels" }, { FRAME_FLUSHED, "flushed" },
+    };
+    // Copy the ring under the lock and print from the copy: Serial output of up to
+    // FRAME_PROFILE_FRAMES rows would otherwise hold the LVGL task off for the whole dump
+    static FrameProfiler snap;   // loop() only (minute report and console)
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    snap = _profiler;
+    const uint32_t refreshes = _refreshSeq;
+    const DrawBufferStrategy strategy = _bufStrategy;
+    xSemaphoreGive(_mutex);
+
+    Serial.printf("[FRAMES] %u frames held (%lu since boot, %lu refreshes), %s\n", (unsigned)snap.count(),
+                  (unsigned long)snap.recorded(), (unsigned long)refreshes, strategyName(strategy));
+    for (const auto& r : rows) {
+        FramePercentiles p = snap.percentiles(r.field);
+        Serial.printf("[FRAMES] %-9s p50 %7lu p90 %7lu p99 %7lu max %7lu\n", r.name, (unsigned long)p.p50,
+                      (unsigned long)p.p90, (unsigned long)p.p99, (unsigned long)p.max);
+    }
+    if (withFrames) {
+        Serial.println("[FRAMES] seq,pixels,flushed_px,render_us,flush_us,wait_us,total_us,flushes");
+        for (uint16_t i = 0; i < snap.count(); i++) {
+            const FrameSample& f = snap.at(i);
+            Serial.printf("[FRAMES] %lu,%lu,%lu,%lu,%lu,%lu,%lu,%u\n", (unsigned long)f.seq, (unsigned long)f.pixels,
+                          (unsigned long)f.flushedPixels, (unsigned long)f.renderUs, (unsigned long)f.flushUs,
+                          (unsigned long)f.waitUs, (unsigned long)f.totalUs, (unsigned)f.flushes);
+        }
+    }
+}
+
+void DisplayDriver::dumpInputLatency(bool withHistogram) {
+    if (!_initialized) return;
+    xSemaphoreTake(_mutex, portMAX_DELAY);
+    Serial.printf("[TOUCH] %lu traced, %lu without redraw, %lu over %u ms; reports %lu (%lu dropped)\n",
+                  (unsigned long)_latency.completed(), (unsigned long)_latency.unanswered(),
+                  (unsigned long)_latency.overTarget(), (unsigned)INPUT_LATENCY_TARGET_MS,
+                  (unsigned long)_touch.queued(), (unsigned long)_touch.dropped());
+    static const char* const powerNames[] = { "active", "dimmed", "off" };
+    Serial.printf("[POWER] %s for %lu s, idle %lu s, backlight %u.%u%% (duty %u), %lu wakes from off\n",
+                  powerNames[_power.state()], (unsigned long)((millis() - _power.stateSinceMs()) / 1000),
+                  (unsigned long)((millis() - _power.lastActivityMs()) / 1000), _power.level() / 10, _power.level() % 10,
+                  _power.duty(), (unsigned long)_power.wakes());
+    if (_latency.completed()) {
+        // Percentiles are upper bounds from the histogram bins
+        for (uint8_t s = 0; s < LAT_STAGES; s++) {
+            const LatencyStage st = (LatencyStage)s;
+            Serial.printf("[TOUCH] %-10s p50 <=%6.1f p90 <=%6.1f p99 <=%6.1f max %6.1f ms (last %6.1f)\n", InputLatencyTrace::stageName(st),
+                          _latency.percentileUs(st, 50) / 1000.0f, _latency.percentileUs(st, 90) / 1000.0f,
+                          _latency.percentileUs(st, 99) / 1000.0f, _latency.maxUs(st) / 1000.0f,
+                          _latency.last()->stageUs[s] / 1000.0f);
+        }
+    }
+    if (withHistogram) {
+        Serial.print("[TOUCH] photon ms");
+        for (uint8_t b = 0; b < InputLatencyTrace::BINS; b++) {
+            if (b < InputLatencyTrace::BINS - 1) Serial.printf(" <=%lu:%lu", (unsigned long)(InputLatencyTrace::binEdgeUs(b) / 1000),
+                                                               (unsigned long)_latency.binCount(LAT_PHOTON, b));
+            else Serial.printf(" more:%lu", (unsigned long)_latency.binCount(LAT_PHOTON, b));
+        }
+        Serial.println();
+    }
+    xSemaphoreGive(_mutex);
+}
+
+bool DisplayDriver::startTouchTask() {
+    if (xTaskCreatePinnedToCore(touchTaskLoop, "touch", STACK_TOUCH_TASK, this, PRIO_TOUCH, &_touchTask, CORE_UI) != pdPASS) {
+        DEBUG_PRINTLN("WARNING: touch task not started, reading GT911 from the LVGL task");
+        _touchTask = nullptr;
+        return false;
+    }
+    return true;
+}
+
+bool DisplayDriver::startFlushTask() {
+#ifdef ENABLE_ASYNC_FLUSH
+    _flushDone = xSemaphoreCreateBinary();
+    if (!_flushDone) return false;
+    if (xTaskCreatePinnedToCore(flushTaskLoop, "flush", STACK_FLUSH_TASK, this, PRIO_FLUSH, &_flushTask, CORE_APP) != pdPASS) {
+        DEBUG_PRINTLN("WARNING: flush task not started, flushing inline");
+        vSemaphoreDelete(_flushDone);
+        _flushDone = nullptr;
+        _flushTask = nullptr;
+        return false;
+    }
+    DEBUG_PRINTLN("Async band flush on CORE_APP");
+    return true;
+#else
+    return false;
+#endif
+}
+
+// The band task only draws while the LVGL task waits in band_wait_cb, so it runs under the same _mutex
+bool DisplayDriver::startBandTask() {
+#if defined(ENABLE_PARALLEL_RENDER) && LV_REFR_BAND_UNITS > 1
+    _bandDone = xSemaphoreCreateBinary();
+    if (!_bandDone) return false;
+    if (xTaskCreatePinnedToCore(bandTaskLoop, "band", STACK_BAND_TASK, this, PRIO_BAND, &_bandTask, CORE_APP) != pdPASS) {
+        DEBUG_PRINTLN("WARNING: band task not started, rendering on the LVGL task only");
+        vSemaphoreDelete(_bandDone);
+        _bandDone = nullptr;
+        _bandTask = nullptr;
+        return false;
+    }
+    disp_drv.band_units = 2;
+    disp_drv.band_start_cb = lvgl_band_start_cb;
+    disp_drv.band_wait_cb = lvgl_band_wait_cb;
+    DEBUG_PRINTLN("Parallel band render on CORE_APP");
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint32_t DisplayDriver::update() {
+    if (!_initialized) return LV_NO_TIMER_READY;
+    uint32_t t0 = micros();
     xSemaphoreTake(_mutex, portMAX_DELAY);
-    lv_timer_handler();
+    const uint32_t powerMs = servicePower(millis());
+    if (_power.renderSuspended()) {
+        // Screen off: no LVGL timers and no refresh until a touch or wake()
+        _lastFps = 0.0f;
+        _frameCount = 0;
+        _lastFpsCalcMs = 0;
+        xSemaphoreGive(_mutex);
+        _busyUsTotal += micros() - t0;
+        return powerMs;
+    }
+    if (_touchIRQFlag && indev && indev_drv.read_timer->paused) {
+        lv_timer_resume(indev_drv.read_timer);
+        lv_timer_ready(indev_drv.read_timer);
+    }
+    uint32_t waitBefore = _waitUsTotal;
+    uint32_t t1 = micros();
+    uint32_t nextMs = lv_timer_handler();
+    if (powerMs < nextMs) nextMs = powerMs;   // Next fade step or idle transition
+    photonFlushed();
+    _renderUsTotal += (micros() - t1) - (_waitUsTotal - waitBefore);
     _lastUpdate = millis();
     _needsRedraw = false;
-    _frameCount++;
     if (_lastFpsCalcMs == 0) _lastFpsCalcMs = _lastUpdate;
+    _wakeupsTotal++;
     if (_lastUpdate - _lastFpsCalcMs >= 1000) {
         _lastFps = (_frameCount * 1000.0f) / (_lastUpdate - _lastFpsCalcMs);
+        _timing.windowMs = _lastUpdate - _lastFpsCalcMs;
         _frameCount = 0;
         _lastFpsCalcMs = _lastUpdate;
+        const uint32_t totals[6] = { _renderUsTotal, _flushUsTotal, _waitUsTotal, _flushCountTotal,
+                                     _busyUsTotal, _wakeupsTotal };
+        _timing.renderUs = totals[0] - _windowStart[0];
+        _timing.flushUs = totals[1] - _windowStart[1];
+        _timing.waitUs = totals[2] - _windowStart[2];
+        _timing.flushes = totals[3] - _windowStart[3];
+        _timing.busyUs = totals[4] - _windowStart[4];
+        _timing.wakeups = totals[5] - _windowStart[5];
+        memcpy(_windowStart, totals, sizeof(totals));
     }
     xSemaphoreGive(_mutex);
+    _busyUsTotal += micros() - t0;
+    return nextMs;
 }
 
-void DisplayDriver::setBrightness(uint8_t brightness) {
-    if (!_initialized || !_lgfx) return;
-    DEBUG_PRINTF("Setting brightness to %d%%\n", brightness);
+// LVGL task, under _mutex. Returns ms until the next fade step or idle transition.
+uint32_t DisplayDriver::servicePower(uint32_t nowMs) {
+    const int16_t pct = _brightnessRequest;
+    if (pct >= 0) {
+        _brightnessRequest = -1;
+        _power.setActiveLevel((uint8_t)pct, nowMs);
+    }
+    if (_sleepRequest) {
+        _sleepRequest = false;
+        _power.sleep(nowMs);
+    }
+    if (_wakeRequest) {
+        _wakeRequest = false;
+        _power.activity(nowMs);
+    }
+    if (_power.renderSuspended()) {
+        // LVGL's read callback is not running: look at the reports here. A press wakes the screen
+        // and is swallowed until it is released.
+        if (!_touchTask && _touchIRQFlag) {
+            _touchIRQFlag = false;
+            _touch.service(micros());
+        }
+        TouchFrame f;
+        bool pressed = false, down = false;
+        while (_touch.next(f)) {
+            pressed |= f.count != 0;
+            down = f.count != 0;
+        }
+        if (pressed && _power.activity(nowMs)) _swallowTouch = down;
+    }
+    const uint32_t due = _power.service(nowMs);
+    applyBacklight(_power.duty());
+    setPanelScan(!_power.renderSuspended());
+    return due;
+}
+
+void DisplayDriver::applyBacklight(uint16_t duty) {
+    if (duty == _appliedDuty) return;
+    _appliedDuty = duty;
     if (ch422g.isPresent()) {
-        ch422g.setBacklight(brightness);
+        ch422g.setBacklight(duty ? 100 : 0);   // Expander line: on/off only, no dimming
     } else {
-        // Simple ramp for stability (avoid sudden inrush to LED backlight)
-        static uint8_t lastDuty = 255;
-        uint8_t target = map(brightness, 0, 100, 0, 255);
-        int step = (target > lastDuty) ? 4 : -4;
-        while (lastDuty != target) {
-            int next = (int)lastDuty + step;
-            if ((step > 0 && next > target) || (step < 0 && next < target)) next = target;
-            lastDuty = (uint8_t)next;
-            ledcWrite(DISPLAY_BL_PWM_CHANNEL, lastDuty);
-            delay(1); // short micro-ramp; negligible impact, smooths transitions
-        }
+        ledcWrite(DISPLAY_BL_PWM_CHANNEL, duty);
     }
 }
 
+// Stops the panel while the backlight is off: LCD_CAM/GDMA scan-out halted (PSRAM bandwidth and
+// power), panel disabled through the expander. The framebuffer is kept and shown again on restart.
+void DisplayDriver::setPanelScan(bool on) {
+    if (on != _panelOff) return;
+    if (on) {
+        _scanout.resumeScan();
+        if (ch422g.isPresent()) ch422g.setDisplayEnable(true);
+        DEBUG_PRINTLN("Display on");
+    } else {
+        while (_flushTask && disp_drv.draw_buf->flushing) lvgl_wait_cb(&disp_drv);
+        if (ch422g.isPresent()) ch422g.setDisplayEnable(false);
+        if (!_scanout.pauseScan()) DEBUG_PRINTLN("WARNING: scan-out not stopped");
+        DEBUG_PRINTLN("Display off");
+    }
+    _panelOff = !on;
+}
+
+void DisplayDriver::setBrightness(uint8_t brightness) {
+    if (!_initialized || !_lgfx) return;
+    DEBUG_PRINTF("Setting brightness to %d%%\n", brightness);
+    // Faded in by the LVGL task (DISPLAY_FADE_MS for a full swing), gamma-corrected
+    _brightnessRequest = brightness > 100 ? 100 : brightness;
+    requestRender();
+}
+
 // Static ISR trampoline
 void IRAM_ATTR DisplayDriver::touch_isr_trampoline() {
     // Retrieve global instance
@@ -254,19 +897,43 @@ void DisplayDriver::handleTouchIRQ() {
     _touchIRQFlag = true;
 }
 
+void IRAM_ATTR DisplayDriver::setTouchIRQFlag() {
+    _touchIrqUs = micros();
+    // The touch task reads the report and then wakes the LVGL task; without it LVGL reads directly
+    TaskHandle_t wake = _touchTask;
+    if (!wake) {
+        _touchIRQFlag = true;
+        wake = _renderTask;
+    }
+    if (wake) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(wake, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    }
+}
+
 void DisplayDriver::clear() {
     if (!_initialized || !_lgfx) return;
     xSemaphoreTake(_mutex, portMAX_DELAY);
-    _lgfx->fillScreen(0x0000);
+    if (_directMode) {
+        lv_obj_invalidate(lv_scr_act());   // The scanned buffer belongs to LVGL; redraw instead
+    } else {
+        // A band may still be in flight on the flush task
+        while (_flushTask && disp_drv.draw_buf->flushing) lvgl_wait_cb(&disp_drv);
+        _lgfx->fillScreen(0x0000);
+    }
     xSemaphoreGive(_mutex);
 }
 
 void DisplayDriver::sleep() {
     if (!_initialized || !_lgfx) return;
     DEBUG_PRINTLN("Display entering sleep mode");
+    _sleepRequest = true;
+    requestRender();
 }
 
 void DisplayDriver::wake() {
     if (!_initialized || !_lgfx) return;
-    DEBUG_PRINTLN("Display waking up");
+    _wakeRequest = true;
+    requestRender();
 }
@@ -0,0 +1,177 @@
+#include "display/rgb_scanout.h"
+#include <esp_heap_caps.h>
+#include <soc/gdma_struct.h>
+#include <soc/gdma_channel.h>
+#include <soc/lcd_cam_struct.h>
+#include <soc/io_mux_reg.h>
+#include <esp32s3/rom/cache.h>
+
+static portMUX_TYPE scanoutMux = portMUX_INITIALIZER_UNLOCKED;
+
+void RgbScanout::end() {
+    if (!_active) return;
+    detachInterrupt(_vsyncPin);
+    if (_front != 0) {
+        portENTER_CRITICAL(&scanoutMux);
+        retarget(_fb[0]);
+        portEXIT_CRITICAL(&scanoutMux);
+    }
+    if (_ownsFb1) heap_caps_free(_fb[1]);
+    vSemaphoreDelete(_flipped);
+    _fb[1] = nullptr;
+    _ownsFb1 = false;
+    _flipped = nullptr;
+    _pendingFb = nullptr;
+    _active = false;
+}
+
+// GDMA out-channel currently feeding LCD_CAM (Bus_RGB allocates it at init)
+int RgbScanout::findLcdChannel() {
+    for (int ch = 0; ch < SOC_GDMA_PAIRS_PER_GROUP; ch++) {
+        if (GDMA.channel[ch].out.peri_sel.sel == SOC_GDMA_TRIG_PERIPH_LCD0) return ch;
+    }
+    return -1;
+}
+
+bool RgbScanout::begin(uint16_t width, uint16_t height, uint8_t vsyncPin, bool vsyncActiveLow) {
+    if (_active) return true;
+    int ch = findLcdChannel();
+    if (ch < 0) {
+        DEBUG_PRINTLN("RGB scanout: no GDMA channel on LCD_CAM");
+        return false;
+    }
+
+    // Walk the ring once: it must close on itself and cover one contiguous framebuffer
+    dma_descriptor_t* start = (dma_descriptor_t*)GDMA.channel[ch].out.dscr;
+    dma_descriptor_t* d = start;
+    uintptr_t lo = UINTPTR_MAX, hi = 0;
+    size_t bytes = 0;
+    uint32_t n = 0;
+    while (d && n < 4096) {
+        uintptr_t b = (uintptr_t)d->buffer;
+        if (b < lo) lo = b;
+        if (b + d->dw0.length > hi) hi = b + d->dw0.length;
+        bytes += d->dw0.length;
+        n++;
+        d = d->next;
+        if (d == start) break;
+    }
+    const size_t expect = (size_t)width * height * sizeof(uint16_t);
+    if (d != start || bytes != expect || hi - lo != expect) {
+        DEBUG_PRINTF("RGB scanout: descriptor ring not usable (%u descs, %u bytes)\n", (unsigned)n, (unsigned)bytes);
+        return false;
+    }
+
+    uint16_t* back = (uint16_t*)heap_caps_aligned_alloc(64, expect, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!back) {
+        DEBUG_PRINTLN("RGB scanout: no PSRAM for second framebuffer");
+        return false;
+    }
+    _flipped = xSemaphoreCreateBinary();
+    if (!_flipped) {
+        heap_caps_free(back);
+        return false;
+    }
+    _ring = start;
+    _fb[0] = (uint16_t*)lo;
+    _fb[1] = back;
+    _ownsFb1 = true;
+    _front = 0;
+    _fbBytes = expect;
+    _stride = width;
+    memcpy(back, _fb[0], expect);   // Both buffers start identical; LVGL only syncs what it redraws
+    Cache_WriteBack_Addr((uint32_t)(uintptr_t)back, expect);
+
+    // VSYNC is routed to LCD_CAM through the GPIO matrix; enabling the pad input lets the GPIO
+    // interrupt see the same edge without taking the pin away from the peripheral.
+    PIN_INPUT_ENABLE(GPIO_PIN_MUX_REG[vsyncPin]);
+    _vsyncPin = vsyncPin;
+    attachInterruptArg(vsyncPin, vsyncIsr, this, vsyncActiveLow ? FALLING : RISING);
+    _active = true;
+    DEBUG_PRINTF("RGB scanout: %u descriptors, framebuffers %p / %p\n", (unsigned)n, _fb[0], _fb[1]);
+    return true;
+}
+
+void RgbScanout::writeBack(const uint16_t* fb, int32_t y1, int32_t y2) const {
+    if (!_active || y2 < y1) return;
+    Cache_WriteBack_Addr((uint32_t)(uintptr_t)(fb + (size_t)y1 * _stride), (uint32_t)(y2 - y1 + 1) * _stride * sizeof(uint16_t));
+}
+
+// Repoints every descriptor at the same offset in the other framebuffer (ISR or critical section)
+void IRAM_ATTR RgbScanout::retarget(uint16_t* to) {
+    uint8_t* from = (uint8_t*)_fb[_front];
+    dma_descriptor_t* d = _ring;
+    do {
+        d->buffer = (uint8_t*)to + ((uint8_t*)d->buffer - from);
+        d = d->next;
+    } while (d != _ring);
+    _front = to == _fb[0] ? 0 : 1;
+    _flips = _flips + 1;
+}
+
+void IRAM_ATTR RgbScanout::vsyncIsr(void* arg) {
+    RgbScanout* self = (RgbScanout*)arg;
+    portENTER_CRITICAL_ISR(&scanoutMux);
+    uint16_t* fb = self->_pendingFb;
+    if (fb) {
+        self->retarget(fb);
+        self->_pendingFb = nullptr;
+    }
+    portEXIT_CRITICAL_ISR(&scanoutMux);
+    if (fb) {
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR(self->_flipped, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    }
+}
+
+void RgbScanout::flip(uint16_t* fb, uint32_t timeoutMs) {
+    if (!_active || fb == _fb[_front]) return;
+    xSemaphoreTake(_flipped, 0);     // Drop a stale give
+    _pendingFb = fb;
+    if (xSemaphoreTake(_flipped, pdMS_TO_TICKS(timeoutMs)) == pdTRUE) return;
+    portENTER_CRITICAL(&scanoutMux);
+    if (_pendingFb) {
+        retarget(fb);
+        _pendingFb = nullptr;
+        _missedVsync++;
+    }
+    portEXIT_CRITICAL(&scanoutMux);
+}
+
+bool RgbScanout::pauseScan() {
+    if (_scanPaused) return true;
+    int ch = findLcdChannel();
+    if (ch < 0) return false;
+    // The restart point is the descriptor holding the first line: lowest buffer address in the ring
+    dma_descriptor_t* start = (dma_descriptor_t*)GDMA.channel[ch].out.dscr;
+    dma_descriptor_t* head = start;
+    dma_descriptor_t* d = start;
+    for (uint32_t n = 0; d && n < 4096; n++) {
+        if ((uintptr_t)d->buffer < (uintptr_t)head->buffer) head = d;
+        d = d->next;
+        if (d == start) break;
+    }
+    if (d != start) return false;
+    LCD_CAM.lcd_user.lcd_start = 0;
+    LCD_CAM.lcd_user.lcd_update = 1;
+    GDMA.channel[ch].out.link.stop = 1;
+    _scanHead = head;
+    _scanChannel = ch;
+    _scanPaused = true;
+    return true;
+}
+
+bool RgbScanout::resumeScan() {
+    if (!_scanPaused) return true;
+    const int ch = _scanChannel;
+    GDMA.channel[ch].out.conf0.out_rst = 1;
+    GDMA.channel[ch].out.conf0.out_rst = 0;
+    GDMA.channel[ch].out.link.addr = (uint32_t)(uintptr_t)_scanHead & 0xFFFFF;
+    LCD_CAM.lcd_misc.lcd_afifo_reset = 1;
+    GDMA.channel[ch].out.link.start = 1;
+    LCD_CAM.lcd_user.lcd_update = 1;
+    LCD_CAM.lcd_user.lcd_start = 1;
+    _scanPaused = false;
+    return true;
+}
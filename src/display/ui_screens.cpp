@@ -1,33 +1,18 @@
 #include "display/ui_screens.h"
 #include "controllers/temperature_controller.h"
 #include "config/feature_flags.h"
+#ifndef UNIT_TEST_NATIVE
 #include "display/display_driver.h"
+#endif
+#include "sensors/sensor_registry.h"
 #ifdef ENABLE_DIAG_OVERLAY
 #include <esp_heap_caps.h>
+#include "src/draw/sw/lv_draw_sw.h"
 #endif
 
-// Font fallbacks: map unavailable large Montserrat fonts to enabled ones to avoid build failures in minimal config.
-#ifndef lv_font_montserrat_48
-    #define lv_font_montserrat_48 lv_font_montserrat_16
-#endif
-#ifndef lv_font_montserrat_32
-    #define lv_font_montserrat_32 lv_font_montserrat_16
-#endif
-#ifndef lv_font_montserrat_28
-    #define lv_font_montserrat_28 lv_font_montserrat_16
-#endif
-#ifndef lv_font_montserrat_24
-    #define lv_font_montserrat_24 lv_font_montserrat_16
-#endif
-#ifndef lv_font_montserrat_20
-    #define lv_font_montserrat_20 lv_font_montserrat_16
-#endif
-#ifndef lv_font_montserrat_18
-    #define lv_font_montserrat_18 lv_font_montserrat_16
-#endif
-#ifndef lv_font_montserrat_14
-    #define lv_font_montserrat_14 lv_font_montserrat_16
-#endif
+// Sizes above 16 px are subsets of Montserrat with the characters these screens use, generated by
+// generate_ui_fonts.py at build time; anything else falls back to the 16 px font
+#include "ui_fonts.h"
 
 // Global UI instance
 UIScreens ui;
@@ -50,15 +35,14 @@ UIScreens::UIScreens() {
     fanSlider = nullptr;
     fanSliderLabel = nullptr;
     
-    for (int i = 0; i < 4; i++) {
-        sensorLabels[i] = nullptr;
-    }
+    sensorList = nullptr;
     faultOverlay = nullptr;
     faultLabel = nullptr;
     serviceMenuActive = false;
     hotspotPressedTime = 0;
     alarmZone = nullptr;
     alarmZoneLabel = nullptr;
+    updateStats = UiUpdateStats{0, 0, 0};
 #ifdef ENABLE_DIAG_OVERLAY
     diagLabel = nullptr;
     diagTimer = nullptr;
@@ -81,6 +65,14 @@ bool UIScreens::init() {
     createDataScreen();
     createFaultOverlay();
     createServiceHotspot();
+    tempBinding.bind(tempLabel);
+    targetBinding.bind(targetTempLabel);
+    statusBinding.bind(statusLabel);
+    timeBinding.bind(timeLabel);
+    sensorBinding.bind(sensorList);
+    faultBinding.bind(faultLabel);
+    alarmBinding.bind(alarmZoneLabel);
+    faultVisibility.bind(faultOverlay);
 #ifdef ENABLE_DIAG_OVERLAY
     createDiagOverlay();
 #endif
@@ -103,8 +95,48 @@ void UIScreens::createDiagOverlay() {
         if (!ui || !ui->diagLabel) return;
         float fps = display.getFPS();
         size_t freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
-        static char buf[96];
-        snprintf(buf, sizeof(buf), "FPS: %.1f Free: %u KB", fps, (unsigned)(freeHeap/1024));
+        static char buf[336];
+        const DisplayTiming& tm = display.getTiming();
+        uint32_t hidden = tm.flushUs > tm.waitUs ? tm.flushUs - tm.waitUs : 0;
+        if (display.isDirectMode()) {
+            snprintf(buf, sizeof(buf), "FPS: %.1f direct (%u late vsync) Free: %u KB\nrender %lu ms flip %lu ms /s", fps,
+                     (unsigned)display.getMissedVsync(), (unsigned)(freeHeap/1024),
+                     (unsigned long)(tm.renderUs / 1000), (unsigned long)(tm.waitUs / 1000));
+        } else {
+            snprintf(buf, sizeof(buf), "FPS: %.1f%s Free: %u KB\nrender %lu flush %lu overlap %lu ms /s", fps,
+                     display.isAsyncFlush() ? " async" : "", (unsigned)(freeHeap/1024),
+                     (unsigned long)(tm.renderUs / 1000), (unsigned long)(tm.flushUs / 1000), (unsigned long)(hidden / 1000));
+        }
+        // Per-frame tails: which stage the slow frames spend their time in
+        const FrameProfiler& prof = display.getFrameProfile();
+        if (prof.count()) {
+            FramePercentiles render = prof.percentiles(FRAME_RENDER);
+            FramePercentiles flush = prof.percentiles(FRAME_FLUSH);
+            FramePercentiles wait = prof.percentiles(FRAME_WAIT);
+            FramePercentiles px = prof.percentiles(FRAME_PIXELS);
+            size_t len = strlen(buf);
+            snprintf(buf + len, sizeof(buf) - len, "\nframe p50/p99 ms: render %.1f/%.1f flush %.1f/%.1f wait %.1f/%.1f px %luk/%luk",
+                     render.p50 / 1000.0f, render.p99 / 1000.0f, flush.p50 / 1000.0f, flush.p99 / 1000.0f,
+                     wait.p50 / 1000.0f, wait.p99 / 1000.0f, (unsigned long)(px.p50 / 1000), (unsigned long)(px.p99 / 1000));
+        }
+        // Touch to photon (upper bounds from the histogram); target INPUT_LATENCY_TARGET_MS
+        const InputLatencyTrace& lat = display.getInputLatency();
+        if (lat.completed()) {
+            size_t len = strlen(buf);
+            snprintf(buf + len, sizeof(buf) - len, "\ntouch->photon p50/p99 %lu/%lu ms, %lu traced %lu over %u",
+                     (unsigned long)(lat.percentileUs(LAT_PHOTON, 50) / 1000), (unsigned long)(lat.percentileUs(LAT_PHOTON, 99) / 1000),
+                     (unsigned long)lat.completed(), (unsigned long)lat.overTarget(), (unsigned)INPUT_LATENCY_TARGET_MS);
+        }
+#if LV_DRAW_SW_GLYPH_CACHE_SIZE
+        // Glyph mask cache: hit rate since boot and what it holds (all band units)
+        lv_draw_sw_glyph_cache_stats_t glyphs;
+        lv_draw_sw_glyph_cache_get_stats(&glyphs);
+        if (glyphs.hits + glyphs.misses) {
+            size_t len = strlen(buf);
+            snprintf(buf + len, sizeof(buf) - len, "\nglyph cache %.1f%% hit, %.1f KB",
+                     glyphs.hits * 100.0f / (glyphs.hits + glyphs.misses), glyphs.size / 1024.0f);
+        }
+#endif
         lv_label_set_text(ui->diagLabel, buf);
     }, 1000, this);
 }
@@ -121,7 +153,7 @@ void UIScreens::createStyles() {
     // Large temperature display style
     lv_style_init(&styleTempLarge);
     lv_style_set_text_color(&styleTempLarge, lv_color_hex(0x00FFFF));  // Cyan
-    lv_style_set_text_font(&styleTempLarge, &lv_font_montserrat_48);
+    lv_style_set_text_font(&styleTempLarge, &ui_font_montserrat_48);
     lv_style_set_text_align(&styleTempLarge, LV_TEXT_ALIGN_CENTER);
     
     // Button style
@@ -166,7 +198,7 @@ void UIScreens::createMainScreen() {
     // Main temperature label (huge font)
     tempLabel = lv_label_create(tempContainer);
     lv_label_set_text(tempLabel, "-18.2°C");
-    lv_obj_set_style_text_font(tempLabel, &lv_font_montserrat_48, 0);
+    lv_obj_set_style_text_font(tempLabel, &ui_font_montserrat_48, 0);
     lv_obj_set_style_text_color(tempLabel, lv_color_hex(0x00FFFF), 0);
     lv_obj_align(tempLabel, LV_ALIGN_CENTER, 0, -40);
 
@@ -197,14 +229,14 @@ void UIScreens::createMainScreen() {
     // Target temperature label
     targetTempLabel = lv_label_create(tempContainer);
     lv_label_set_text(targetTempLabel, "Target: -18.0°C");
-    lv_obj_set_style_text_font(targetTempLabel, &lv_font_montserrat_24, 0);
+    lv_obj_set_style_text_font(targetTempLabel, &ui_font_montserrat_24, 0);
     lv_obj_set_style_text_color(targetTempLabel, lv_color_hex(0x808080), 0);
     lv_obj_align(targetTempLabel, LV_ALIGN_CENTER, 0, 20);
     
     // Status label
     statusLabel = lv_label_create(tempContainer);
     lv_label_set_text(statusLabel, "COOLING");
-    lv_obj_set_style_text_font(statusLabel, &lv_font_montserrat_28, 0);
+    lv_obj_set_style_text_font(statusLabel, &ui_font_montserrat_28, 0);
     lv_obj_set_style_text_color(statusLabel, lv_color_hex(0x00FF00), 0);
     lv_obj_align(statusLabel, LV_ALIGN_CENTER, 0, 80);
     
@@ -226,25 +258,22 @@ void UIScreens::createMainScreen() {
     lv_obj_set_style_text_color(timeLabel, lv_color_white(), 0);
     lv_obj_align(timeLabel, LV_ALIGN_TOP_LEFT, 20, 10);
     
-    // Sensor displays
-    for (int i = 0; i < 4; i++) {
-        lv_obj_t* sensorBox = lv_obj_create(sidePanel);
-        lv_obj_set_size(sensorBox, 160, 80);
-        lv_obj_add_style(sensorBox, &styleSensor, 0);
-        
-        // Sensor ID label
-        lv_obj_t* idLabel = lv_label_create(sensorBox);
-        lv_label_set_text_fmt(idLabel, "Sensor %d", i + 1);
-        lv_obj_set_style_text_font(idLabel, &lv_font_montserrat_14, 0);
-        lv_obj_align(idLabel, LV_ALIGN_TOP_LEFT, 5, 5);
-        
-        // Temperature value
-        sensorLabels[i] = lv_label_create(sensorBox);
-        lv_label_set_text(sensorLabels[i], "--.-°C");
-        lv_obj_set_style_text_font(sensorLabels[i], &lv_font_montserrat_20, 0);
-        lv_obj_set_style_text_color(sensorLabels[i], lv_color_hex(0x00FFFF), 0);
-    lv_obj_align(sensorLabels[i], LV_ALIGN_BOTTOM_MID, 0, -5);
-    }
+    // Sensor list: one line per registered probe (any count), scrolls when it outgrows the box
+    lv_obj_t* sensorBox = lv_obj_create(sidePanel);
+    lv_obj_set_size(sensorBox, 160, 350);
+    lv_obj_add_style(sensorBox, &styleSensor, 0);
+    lv_obj_set_scroll_dir(sensorBox, LV_DIR_VER);
+    
+    lv_obj_t* idLabel = lv_label_create(sensorBox);
+    lv_label_set_text(idLabel, "Sensors");
+    lv_obj_set_style_text_font(idLabel, &lv_font_montserrat_14, 0);
+    lv_obj_align(idLabel, LV_ALIGN_TOP_LEFT, 5, 5);
+    
+    sensorList = lv_label_create(sensorBox);
+    lv_label_set_text(sensorList, "--.-°C");
+    lv_obj_set_style_text_font(sensorList, &lv_font_montserrat_14, 0);
+    lv_obj_set_style_text_color(sensorList, lv_color_hex(0x00FFFF), 0);
+    lv_obj_align(sensorList, LV_ALIGN_TOP_LEFT, 5, 28);
     
     // Settings button
     lv_obj_t* settingsBtn = lv_btn_create(sidePanel);
@@ -279,7 +308,7 @@ void UIScreens::createFaultOverlay() {
     lv_label_set_long_mode(faultLabel, LV_LABEL_LONG_SCROLL_CIRCULAR);
     lv_label_set_text(faultLabel, "NO FAULTS ACTIVE");
     lv_obj_set_style_text_color(faultLabel, lv_color_hex(0xFFCCCC), 0);
-    lv_obj_set_style_text_font(faultLabel, &lv_font_montserrat_20, 0);
+    lv_obj_set_style_text_font(faultLabel, &ui_font_montserrat_20, 0);
     lv_obj_align(faultLabel, LV_ALIGN_CENTER, 0, 0);
 }
 
@@ -304,7 +333,7 @@ void UIScreens::createSettingsScreen() {
     // Title
     lv_obj_t* title = lv_label_create(settingsScreen);
     lv_label_set_text(title, "Settings");
-    lv_obj_set_style_text_font(title, &lv_font_montserrat_32, 0);
+    lv_obj_set_style_text_font(title, &ui_font_montserrat_32, 0);
     lv_obj_set_style_text_color(title, lv_color_white(), 0);
     lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 20);
     
@@ -387,7 +416,7 @@ void UIScreens::createDataScreen() {
     // Title
     lv_obj_t* title = lv_label_create(dataScreen);
     lv_label_set_text(title, "Data Log");
-    lv_obj_set_style_text_font(title, &lv_font_montserrat_32, 0);
+    lv_obj_set_style_text_font(title, &ui_font_montserrat_32, 0);
     lv_obj_set_style_text_color(title, lv_color_white(), 0);
     lv_obj_align(title, LV_ALIGN_TOP_MID, 0, 20);
     
@@ -434,10 +463,12 @@ void UIScreens::createDataScreen() {
 
 void UIScreens::update(const SystemData& data) {
     if (!currentScreen) return;
+    InvalidationMeter meter;
+    meter.begin(lv_obj_get_disp(currentScreen));
     
-    // Update main temperature display
-    lv_label_set_text_fmt(tempLabel, "%.1f°C", data.control.currentTemp);
-    lv_label_set_text_fmt(targetTempLabel, "Target: %.1f°C", data.config.targetTemp);
+    // Update main temperature display (0.1 °C, as shown)
+    tempBinding.setFixed(data.control.currentTemp, 1, "", "°C");
+    targetBinding.setFixed(data.config.targetTemp, 1, "Target: ", "°C");
     
     // Set temperature label color based on state
     lv_color_t tempColor;
@@ -452,7 +483,6 @@ void UIScreens::update(const SystemData& data) {
     } else {
     tempColor = lv_color_hex(0xFF0000); // Red for too warm
     }
-    lv_obj_set_style_text_color(tempLabel, tempColor, 0);
     
     // Update status text
     const char* statusText = "UNKNOWN";
@@ -479,34 +509,43 @@ void UIScreens::update(const SystemData& data) {
             statusText = "ERROR";
             statusColor = lv_color_hex(0xFF0000);
             break;
+        default:
+            break;
     }
     
-    lv_label_set_text(statusLabel, statusText);
-    lv_obj_set_style_text_color(statusLabel, statusColor, 0);
+    statusBinding.setKeyed(data.control.status, statusText);
+    statusBinding.setColor(statusColor);
     
     // Update time
     if (data.timeString.length() > 0) {
-        lv_label_set_text(timeLabel, data.timeString.c_str());
+        timeBinding.setText(data.timeString.c_str());
     }
     
     // Update sensor data
-    for (uint8_t i = 0; i < data.activeSensors && i < 4; i++) {
-        if (data.sensors[i].valid) {
-            lv_label_set_text_fmt(sensorLabels[i], "%.1f°C", data.sensors[i].temperature);
-        } else {
-            lv_label_set_text(sensorLabels[i], "--.-°C");
-        }
+    if (data.sensors && data.sensors->count()) {
+        static char sensorText[MAX_REGISTRY_SENSORS * 24];
+        data.sensors->formatZoneList(sensorText, sizeof(sensorText));
+        sensorBinding.setText(sensorText);
     }
 
     // Fault overlay update (non-blocking)
     updateFaultOverlay(data);
-    updateAlarmVisuals(data);
+    updateAlarmVisuals(data, tempColor);   // Alarm pulse overrides the band colour
+    tempBinding.setColor(tempColor);
+
+    // Text changes re-lay out their labels; do it now so the meter sees the moved areas too
+    lv_obj_update_layout(currentScreen);
+    lv_obj_update_layout(faultOverlay);
+    uint32_t px = meter.end();
+    updateStats.updates++;
+    updateStats.lastInvalidatedPx = px;
+    updateStats.invalidatedPx += px;
 }
 
 void UIScreens::updateFaultOverlay(const SystemData& data) {
     if (!faultOverlay || !faultLabel) return;
     if (data.control.faultMask == 0 && data.control.status != STATUS_ERROR) {
-        lv_obj_add_flag(faultOverlay, LV_OBJ_FLAG_HIDDEN);
+        faultVisibility.set(false);
         return;
     }
     static char buf[160];
@@ -532,33 +571,32 @@ void UIScreens::updateFaultOverlay(const SystemData& data) {
         pos = 5;
     }
     buf[pos] = '\0';
-    lv_label_set_text(faultLabel, buf);
-    lv_obj_clear_flag(faultOverlay, LV_OBJ_FLAG_HIDDEN);
+    faultBinding.setText(buf);
+    faultVisibility.set(true);   // The control task wakes the screen on the fault's rising edge
 }
 
-void UIScreens::updateAlarmVisuals(const SystemData& data) {
+void UIScreens::updateAlarmVisuals(const SystemData& data, lv_color_t& tempColor) {
     if (!alarmZone || !alarmZoneLabel) return;
     if (data.control.alarmActive) {
         if (!data.control.alarmSilenced) {
             unsigned long phase = (millis() / (ALARM_PULSE_INTERVAL_MS / 2)) % 2;
-            lv_color_t c = phase ? lv_color_hex(0xFF0000) : lv_color_hex(0x800000);
-            lv_obj_set_style_text_color(tempLabel, c, 0);
-            lv_label_set_text(alarmZoneLabel, "SILENCE");
-            lv_obj_set_style_text_color(alarmZoneLabel, lv_color_hex(0xFF0000), 0);
+            tempColor = phase ? lv_color_hex(0xFF0000) : lv_color_hex(0x800000);
+            alarmBinding.setText("SILENCE");
+            alarmBinding.setColor(lv_color_hex(0xFF0000));
         } else {
-            lv_obj_set_style_text_color(tempLabel, lv_color_hex(0xFF0000), 0);
+            tempColor = lv_color_hex(0xFF0000);
             long remaining = (long)(data.control.alarmSilenceUntil - millis());
             if (remaining < 0) remaining = 0;
             int minutes = remaining / 60000;
             int seconds = (remaining / 1000) % 60;
             static char tbuf[16];
             snprintf(tbuf, sizeof(tbuf), "%02d:%02d", minutes, seconds);
-            lv_label_set_text(alarmZoneLabel, tbuf);
-            lv_obj_set_style_text_color(alarmZoneLabel, lv_color_white(), 0);
+            alarmBinding.setText(tbuf);
+            alarmBinding.setColor(lv_color_white());
         }
     } else {
-        // Clear alarm visuals (retain current temp label color set earlier by state logic)
-        lv_label_set_text(alarmZoneLabel, "");
+        // Clear alarm visuals (the temp label keeps its band colour)
+        alarmBinding.setText("");
     }
 }
 
@@ -633,13 +671,13 @@ void UIScreens::showErrorScreen(const char* error) {
     lv_obj_t* errorTitle = lv_label_create(errorBox);
     lv_label_set_text(errorTitle, "SYSTEM ERROR");
     lv_obj_set_style_text_color(errorTitle, lv_color_hex(0xFF0000), 0);
-    lv_obj_set_style_text_font(errorTitle, &lv_font_montserrat_24, 0);
+    lv_obj_set_style_text_font(errorTitle, &ui_font_montserrat_24, 0);
     lv_obj_align(errorTitle, LV_ALIGN_TOP_MID, 0, 20);
     
     lv_obj_t* errorMsg = lv_label_create(errorBox);
     lv_label_set_text(errorMsg, error);
     lv_obj_set_style_text_color(errorMsg, lv_color_white(), 0);
-    lv_obj_set_style_text_font(errorMsg, &lv_font_montserrat_18, 0);
+    lv_obj_set_style_text_font(errorMsg, &ui_font_montserrat_18, 0);
     lv_label_set_long_mode(errorMsg, LV_LABEL_LONG_WRAP);
     lv_obj_set_width(errorMsg, 460);
     lv_obj_align(errorMsg, LV_ALIGN_CENTER, 0, 0);
@@ -63,9 +63,20 @@
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*Render independent horizontal bands of a refresh on both cores: the LVGL task and a band task on
+ *CORE_APP (DisplayDriver::startBandTask()). Each extra unit gets its own draw context and, with
+ *partial buffers, its own pair of band buffers.*/
+#define LV_REFR_BAND_UNITS 2
+#define LV_REFR_BAND_MIN_ROWS 16
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
- *It removes the need to manually update the tick with `lv_tick_inc()`)*/
+ *It removes the need to manually update the tick with `lv_tick_inc()`)
+ *Host builds (UNIT_TEST_NATIVE) drive lv_tick_inc() from the test's virtual clock instead.*/
+#ifdef UNIT_TEST_NATIVE
+#define LV_TICK_CUSTOM 0
+#else
 #define LV_TICK_CUSTOM 1
+#endif
 #if LV_TICK_CUSTOM
     #define LV_TICK_CUSTOM_INCLUDE <Arduino.h>         /*Header for the system time function*/
     #define LV_TICK_CUSTOM_SYS_TIME_EXPR (millis())    /*Expression evaluating to current system time in ms*/
@@ -103,6 +114,19 @@
     #define LV_CIRCLE_CACHE_SIZE 4
 #endif /*LV_DRAW_COMPLEX*/
 
+/*Blend RGB565 fills and images with dedicated kernels (src/draw/sw/lv_draw_sw_blend_rgb565.c):
+ *portable C on the ESP32-S3, 128 bit vector kernels on SSE2/NEON hosts. Same pixels as the generic path.*/
+#define LV_DRAW_SW_BLEND_RGB565 1
+
+/*Cache the unpacked masks of redrawn glyphs (temperature readout, sensor list) per band unit.
+ *On the board they live in internal RAM: no PSRAM cache misses while blending them.*/
+#define LV_DRAW_SW_GLYPH_CACHE_SIZE (8 * 1024)
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST_NATIVE)
+    #define LV_DRAW_SW_GLYPH_CACHE_INCLUDE <esp_heap_caps.h>
+    #define LV_DRAW_SW_GLYPH_CACHE_ALLOC(size) heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+    #define LV_DRAW_SW_GLYPH_CACHE_FREE heap_caps_free
+#endif
+
 /**
  * "Simple layers" are used when a widget has `style_opa < 255` to buffer the widget into a layer
  * and blend it as an image with the given opacity.
@@ -271,7 +295,18 @@
 #define LV_ATTRIBUTE_MEM_ALIGN
 
 /*Place performance critical functions into a faster memory (e.g RAM)*/
-#define LV_ATTRIBUTE_FAST_MEM
+#if defined(ESP_PLATFORM) && !defined(UNIT_TEST_NATIVE)
+    /*Blend, mask and letter loops run from IRAM: no flash cache misses while PSRAM traffic from the
+     *draw and frame buffers shares the same cache*/
+    #include "esp_attr.h"
+    #define LV_ATTRIBUTE_FAST_MEM IRAM_ATTR
+#else
+    #define LV_ATTRIBUTE_FAST_MEM
+#endif
+
+/*Storage class of LVGL's band unit index: ESP-IDF gives every task its own copy of `__thread`
+ *variables (the index is a uint8_t: 1 byte in each task's TLS area)*/
+#define LV_ATTRIBUTE_THREAD_LOCAL __thread
 
 /*Prefix variables that are used in GPU accelerated operations, often these need to be placed in RAM sections that are DMA accessible*/
 #define LV_ATTRIBUTE_DMA
@@ -333,8 +368,9 @@
  *Compiler error will be triggered if a font needs it.*/
 #define LV_FONT_FMT_TXT_LARGE 0
 
-/*Enables/disables support for compressed fonts.*/
-#define LV_USE_FONT_COMPRESSED 0
+/*Enables/disables support for compressed fonts.
+ *The larger UI sizes are subsets generated by generate_ui_fonts.py (lib/ui_fonts), some compressed.*/
+#define LV_USE_FONT_COMPRESSED 1
 
 /*Enable subpixel rendering*/
 #define LV_USE_FONT_SUBPX 0
@@ -2,6 +2,7 @@
 #include <lvgl.h>
 #include "display/display_driver.h"
 #include "rtos/task_config.h"
+#include "rtos/seqlock.h"
 #include "utils/system_utils.h"  // canonical include
 #include "config/feature_flags.h"
 #ifdef ENABLE_OTA
@@ -17,16 +18,21 @@
 #ifdef ENABLE_RTC
 #include "sensors/rtc_clock.h"
 #endif
+#include "controllers/temperature_controller.h"
+#include "controllers/zone_manager.h"
 #ifdef ENABLE_SD_LOGGING
 bool startLoggingTask();
 #endif
 
 extern DisplayDriver display;
-#ifdef ENABLE_DS18B20
-extern TemperatureSensor tempSensor;
-#endif
 #ifdef ENABLE_RELAYS
 extern RelayController relays;
+// Bank 0 is `relays`; further zones' banks sit at the following PCF8574 addresses
+static RelayController extraRelayBanks[MAX_RELAY_BANKS - 1] = {
+    RelayController(PCF8574_ADDRESS + 1), RelayController(PCF8574_ADDRESS + 2), RelayController(PCF8574_ADDRESS + 3),
+    RelayController(PCF8574_ADDRESS + 4), RelayController(PCF8574_ADDRESS + 5), RelayController(PCF8574_ADDRESS + 6),
+    RelayController(PCF8574_ADDRESS + 7)};
+static RelayController& relayBank(uint8_t bank) { return bank ? extraRelayBanks[bank - 1] : relays; }
 #endif
 #ifdef ENABLE_RTC
 extern RTCClock rtcClock;
@@ -41,81 +47,167 @@ static TaskHandle_t timeTaskHandle = nullptr;
 static char gTimeLabel[25];
 #endif
 
-// Simple shared data placeholder (put in internal RAM for faster control access)
+// Control snapshot for other tasks (put in internal RAM for faster control access).
+// Written only by controlTask; readers take gState.read() and never see a torn record.
 struct __attribute__((aligned(4))) SharedState {
     float currentTemp;
     float targetTemp;
     uint32_t lastSensorUpdate;
 };
-static SharedState gState; // BSS -> internal RAM
+static SeqLock<SharedState> gState; // BSS -> internal RAM
+
+// Newest sensor snapshot handed from sensorTask to controlTask (POD so it can travel by queue copy),
+// one row per control zone
+struct SensorSample {
+    float temperature[MAX_CONTROL_ZONES][MAX_SENSORS];
+    uint8_t validMask[MAX_CONTROL_ZONES];
+    uint8_t count[MAX_CONTROL_ZONES];
+    uint8_t zoneCount;
+    uint32_t takenMs;
+    uint32_t takenUs;
+};
+static QueueHandle_t gSampleQueue = nullptr; // depth 1 mailbox: xQueueOverwrite keeps only the latest
+
+// Control task wakeup / latency counters (reported from loop())
+struct ControlTaskStats {
+    uint32_t wakeups;
+    uint32_t deadlineWakeups;
+    uint32_t lastLatencyUs;   // sample taken -> relays written
+    uint32_t maxLatencyUs;
+};
+static ControlTaskStats gControlStats;
 
 // LVGL / Display task (Core 0) – high priority
 static void lvglTask(void *arg) {
+#ifdef ENABLE_ADAPTIVE_LVGL_PACING
+    display.setRenderTask(xTaskGetCurrentTaskHandle());
+#else
     TickType_t last = xTaskGetTickCount();
+#endif
     while (true) {
-        display.update();
+        uint32_t nextMs = display.update();
 #ifdef ENABLE_RTC
         // Update a small on-screen clock if root label exists (simple demo)
         // (In production integrate with proper UI screen abstraction.)
         static lv_obj_t * clkLabel = nullptr;
-        if (!clkLabel) {
-            clkLabel = lv_label_create(lv_scr_act());
-            lv_obj_align(clkLabel, LV_ALIGN_TOP_RIGHT, -4, 4);
+        static char shown[sizeof(gTimeLabel)] = "";
+        if (strcmp(shown, gTimeLabel) != 0) {
+            display.lock();
+            if (!clkLabel) {
+                clkLabel = lv_label_create(lv_scr_act());
+                lv_obj_align(clkLabel, LV_ALIGN_TOP_RIGHT, -4, 4);
+            }
+            strcpy(shown, gTimeLabel);
+            lv_label_set_text(clkLabel, shown);
+            display.unlock();
         }
-        lv_label_set_text(clkLabel, gTimeLabel);
 #endif
         SystemUtils::watchdogReset();
+#ifdef ENABLE_ADAPTIVE_LVGL_PACING
+        // Sleep until LVGL's next timer, a touch IRQ or display.unlock()/requestRender() from another task
+        if (nextMs > PERIOD_LVGL_MAX_SLEEP) nextMs = PERIOD_LVGL_MAX_SLEEP;
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(nextMs ? nextMs : 1));
+#else
+        (void)nextMs;
         vTaskDelayUntil(&last, pdMS_TO_TICKS(PERIOD_LVGL));
+#endif
     }
 }
 
-// Control task (Core 1) – placeholder control loop
+// Control task (Core 1) – event driven: wakes on a new sensor sample or the earliest zone deadline,
+// then steps only the zones that have something to do (ZoneManager)
 static void controlTask(void *arg) {
-    TickType_t last = xTaskGetTickCount();
+    static SensorSample sample {};
+    static SensorData sensors[MAX_SENSORS];
+    uint32_t waitMs = PERIOD_CONTROL_MAX_SLEEP;
+    uint32_t lastValidSampleMs = millis();
+    uint32_t lastFaults = 0;
     while (true) {
-        // Target temperature enforcement placeholder
-        if (gState.targetTemp != -18.0f) gState.targetTemp = -18.0f;
+        bool fresh = xQueueReceive(gSampleQueue, &sample, pdMS_TO_TICKS(waitMs)) == pdTRUE;
+        gControlStats.wakeups++;
+        if (fresh) {
+            for (uint8_t z = 0; z < sample.zoneCount; ++z) {
+                for (uint8_t i = 0; i < sample.count[z]; ++i) {
+                    sensors[i].temperature = sample.temperature[z][i];
+                    sensors[i].valid = (sample.validMask[z] >> i) & 1;
+                    sensors[i].timestamp = sample.takenMs;
+                    if (sensors[i].valid) sensors[i].lastValidReading = sample.takenMs;
+                    sensors[i].sensorId = i;
+                }
+                zones.submit(z, sensors, sample.count[z], sample.takenMs);
+            }
+        } else {
+            gControlStats.deadlineWakeups++;
+        }
+        // Stale zones (no sample for SENSOR_TIMEOUT) are invalidated inside step()
+        waitMs = zones.step(millis(), PERIOD_CONTROL_MAX_SLEEP);
+        ControlState st = controller.getState();
+        // A new fault in any zone lights a dimmed or dark screen; the UI only refreshes the overlay
+        uint32_t faults = 0;
+        for (uint8_t z = 0; z < zones.count(); ++z) faults |= zones.zone(z).getFaultMask();
+        if (faults & ~lastFaults) display.wake();
+        lastFaults = faults;
 #ifdef ENABLE_RELAYS
-        // Example: if current temp > target + hysteresis -> cooling (compressor ON)
-        float hysteresis = 1.0f;
-        bool needCooling = (gState.currentTemp > (gState.targetTemp + hysteresis));
-        relays.setRelay(RELAY_COMPRESSOR, needCooling);
-        // Example hotgas / heater placeholder (off)
-        relays.setRelay(RELAY_HOTGAS, false);
-        relays.setRelay(RELAY_ELECTRIC_HEATER, false);
-        // Fans follow compressor for now
-        relays.setRelay(RELAY_FAN_MAIN, needCooling);
+        for (uint8_t b = 0; b < zones.banksUsed(); ++b) relayBank(b).setLines(zones.bankLines(b), zones.bankOutputs(b));
 #endif
+        if (fresh) {
+            uint32_t lat = micros() - sample.takenUs;
+            gControlStats.lastLatencyUs = lat;
+            if (lat > gControlStats.maxLatencyUs) gControlStats.maxLatencyUs = lat;
+        }
+        if (fresh && sample.validMask[0]) lastValidSampleMs = sample.takenMs;
+        gState.publish(SharedState{st.currentTemp, controller.getConfig().targetTemp, lastValidSampleMs});
         SystemUtils::watchdogReset();
-        vTaskDelayUntil(&last, pdMS_TO_TICKS(PERIOD_CONTROL));
     }
 }
 
-// Sensor task (Core 1)
+// Sensor task (Core 1) – publishes each new sample to the control task.
+// With DS18B20 the task sleeps between pipeline steps (conversion runs on the probes), so it only
+// holds the core for the ~11 ms scratchpad reads instead of the whole 750 ms conversion.
 static void sensorTask(void *arg) {
+#ifndef ENABLE_DS18B20
     TickType_t last = xTaskGetTickCount();
-#ifdef ENABLE_DS18B20
-    // Sensors initialized in setup
 #endif
+    static SensorSample sample;
     while (true) {
+        memset(&sample, 0, sizeof(sample));
 #ifdef ENABLE_DS18B20
-        tempSensor.update();
-        if (tempSensor.getSensorCount() > 0) {
-            auto d = tempSensor.getSensorData(0); // first sensor as control reference
-            if (d.valid) {
-                gState.currentTemp = d.temperature;
-                gState.lastSensorUpdate = millis();
+        bool cycleDone = false;
+        uint32_t waitMs = updateTemperatureBuses(cycleDone);
+        if (cycleDone) {
+            // Controller inputs: each control zone's probes from the registry (all buses)
+            SensorData probes[MAX_SENSORS];
+            sample.zoneCount = zones.count();
+            for (uint8_t z = 0; z < sample.zoneCount; ++z) {
+                sample.count[z] = sensorRegistry.collectZone(zones.sensorZone(z), probes, MAX_SENSORS);
+                for (uint8_t i = 0; i < sample.count[z]; ++i) {
+                    sample.temperature[z][i] = probes[i].temperature;
+                    if (probes[i].valid) sample.validMask[z] |= (1u << i);
+                }
             }
+            sample.takenMs = millis();
+            sample.takenUs = micros();
+            xQueueOverwrite(gSampleQueue, &sample);
         }
+        SystemUtils::watchdogReset();
+        TickType_t ticks = pdMS_TO_TICKS(waitMs);
+        vTaskDelay(ticks ? ticks : 1);
 #else
         // Simulated temperature if sensors disabled
         static float temp = -15.0f;
         temp -= 0.1f; if (temp < -19.0f) temp = -15.0f;
-        gState.currentTemp = temp;
-        gState.lastSensorUpdate = millis();
-#endif
+        sample.zoneCount = zones.count();
+        for (uint8_t z = 0; z < sample.zoneCount; ++z) {
+            sample.count[z] = 1;
+            sample.temperature[z][0] = temp;
+            sample.validMask[z] = 1;
+        }
+        sample.takenMs = millis();
+        sample.takenUs = micros();
+        xQueueOverwrite(gSampleQueue, &sample);
         SystemUtils::watchdogReset();
         vTaskDelayUntil(&last, pdMS_TO_TICKS(PERIOD_SENSOR));
+#endif
     }
 }
 
@@ -125,6 +217,7 @@ static void timeTask(void *arg) {
     TickType_t last = xTaskGetTickCount();
     while (true) {
         strcpy(gTimeLabel, rtcClock.isoTimestamp().c_str());
+        display.requestRender();
         SystemUtils::watchdogReset();
         vTaskDelayUntil(&last, pdMS_TO_TICKS(1000));
     }
@@ -154,8 +247,9 @@ void setup() {
 #endif
 
 #ifdef ENABLE_DS18B20
-    if (tempSensor.init()) {
-        Serial.printf("DS18B20 sensors active: %d\n", tempSensor.getSensorCount());
+    uint16_t probes = initTemperatureBuses();
+    if (probes) {
+        Serial.printf("DS18B20 sensors active: %d on %d bus(es)\n", probes, tempSensorBusCount);
     } else {
         Serial.println("No DS18B20 sensors detected");
     }
@@ -169,17 +263,35 @@ void setup() {
         Serial.println("Display init FAILED");
     } else {
         Serial.println("Display init OK");
+#ifdef DISPLAY_BENCHMARK_AT_BOOT
+        display.benchmarkDrawBuffers(30);
+#endif
         lv_obj_t * label = lv_label_create(lv_scr_act());
         lv_label_set_text(label, "Dual-Core Split Running");
         lv_obj_center(label);
     }
 
+    // Controller outputs (relay/fan/buzzer pins) to a safe state and the defrost schedule from now
+    controller.init();
+
+    // Control zones (zone 0 = global controller); zone controllers are allocated here, once
+    static const ZoneSetup kZones[] = CONTROL_ZONES;
+    for (const ZoneSetup& zs : kZones) {
+        uint8_t z = zones.addZone(zs);
+        if (z == ZoneManager::NO_ZONE) { Serial.println("Zone table larger than MAX_CONTROL_ZONES"); break; }
+    }
+#ifdef ENABLE_RELAYS
+    for (uint8_t b = 1; b < zones.banksUsed(); ++b) {
+        if (relayBank(b).begin(Wire)) relayBank(b).allOff();
+    }
+#endif
+    Serial.printf("Control zones: %u on %u relay bank(s)\n", zones.count(), zones.banksUsed());
+
     // Initialize shared state
-    gState.currentTemp = -16.0f;
-    gState.targetTemp = -18.0f;
-    gState.lastSensorUpdate = millis();
+    gState.publish(SharedState{-16.0f, -18.0f, millis()});
 
     // Create tasks
+    gSampleQueue = xQueueCreate(1, sizeof(SensorSample));
     BaseType_t ok;
     ok = xTaskCreatePinnedToCore(lvglTask, "lvgl", STACK_LVGL_TASK, nullptr, PRIO_LVGL, &lvglTaskHandle, CORE_UI);
     if (ok != pdPASS) Serial.println("Failed to create lvglTask");
@@ -203,12 +315,6 @@ void setup() {
     }
 #endif
 
-    // Buzzer pin (direct GPIO on Waveshare board)
-#ifdef BUZZER_PIN
-    pinMode(BUZZER_PIN, OUTPUT);
-    digitalWrite(BUZZER_PIN, LOW); // off
-#endif
-
 #ifdef ENABLE_OTA
     Serial.println("[OTA] Starting WiFi connection for OTA...");
     WiFi.mode(WIFI_STA);
@@ -240,6 +346,35 @@ void setup() {
 
 void loop() {
     SystemUtils::watchdogReset();
+#ifdef DEBUG_MODE
+    static uint32_t lastReport = 0;
+    static uint32_t lastWakeups = 0;
+    if (millis() - lastReport >= 60000) {
+        Serial.printf("[CTRL] wakeups/min=%lu (deadline %lu) latency last=%luus max=%luus\n",
+                      (unsigned long)(gControlStats.wakeups - lastWakeups), (unsigned long)gControlStats.deadlineWakeups,
+                      (unsigned long)gControlStats.lastLatencyUs, (unsigned long)gControlStats.maxLatencyUs);
+        for (uint8_t z = 0; z < zones.count(); ++z) {
+            const ZoneCost& k = zones.cost(z);
+            Serial.printf("[ZONE %u] steps=%lu mean=%.1fus max=%.1fus faults=0x%02lx\n", z, (unsigned long)k.steps,
+                          zones.meanCostUs(z), (float)k.maxTicks / ZoneManager::ticksPerUs(),
+                          (unsigned long)zones.zone(z).getFaultMask());
+        }
+        zones.resetCost();
+        const DisplayTiming& tm = display.getTiming();
+        if (tm.windowMs) {
+            Serial.printf("[LVGL] wakeups/s=%.1f core0 busy=%.1f%% fps=%.1f\n", tm.wakeups * 1000.0f / tm.windowMs,
+                          tm.busyUs / (tm.windowMs * 10.0f), display.getFPS());
+        }
+        display.dumpFrameProfile(false);
+        display.dumpInputLatency(false);
+        lastWakeups = gControlStats.wakeups;
+        lastReport = millis();
+    }
+    // 'f' on the console: every frame held by the profiler, as CSV; 'l': touch latency histogram
+    int cmd = Serial.available() ? Serial.read() : -1;
+    if (cmd == 'f') display.dumpFrameProfile(true);
+    else if (cmd == 'l') display.dumpInputLatency(true);
+#endif
 #ifdef ENABLE_OTA
     if (WiFi.isConnected()) ArduinoOTA.handle();
 #endif
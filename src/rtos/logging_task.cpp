@@ -4,18 +4,14 @@
 #include "utils/system_utils.h"
 #include "types/types.h"
 #include "controllers/temperature_controller.h"
-#ifdef ENABLE_DS18B20
-#include "sensors/temperature_sensor.h"
-#endif
+#include "controllers/zone_manager.h"
+#include "sensors/sensor_registry.h"
 #ifdef ENABLE_RTC
 #include "sensors/rtc_clock.h"
 #endif
 
 // Keep declarations for controller and peripherals (they may be defined elsewhere)
 extern TemperatureController controller;
-#ifdef ENABLE_DS18B20
-extern TemperatureSensor tempSensor;
-#endif
 #ifdef ENABLE_RTC
 extern RTCClock rtcClock;
 #endif
@@ -26,21 +22,11 @@ static TaskHandle_t logTaskHandle = nullptr;
 #ifdef ENABLE_SD_LOGGING
 // Snapshot builder & task only when SD logging enabled
 static void buildSystemData(SystemData &out) {
-    memset(&out, 0, sizeof(out));
-    auto state = controller.getState();
-    auto cfg = controller.getConfig();
-    out.control = state;
-    out.config = cfg;
-#ifdef ENABLE_DS18B20
-    uint8_t count = tempSensor.getSensorCount();
-    out.activeSensors = count;
-    for (uint8_t i = 0; i < count && i < 4; ++i) {
-        auto d = tempSensor.getSensorData(i);
-        out.sensors[i] = d;
-    }
-#else
-    out.activeSensors = 0;
-#endif
+    // Field-wise reset: SystemData still holds Strings, so no memset
+    out.control = controller.getState();
+    out.config = controller.getConfig();
+    out.sensors = &sensorRegistry;
+    out.activeSensors = sensorRegistry.count();
 #ifdef ENABLE_RTC
     out.timeString = rtcClock.isoTimestamp();
     if (out.timeString.length() >= 10) out.dateString = out.timeString.substring(0,10);
@@ -51,16 +37,27 @@ static void buildSystemData(SystemData &out) {
 
 static void logTask(void *arg) {
     TickType_t last = xTaskGetTickCount();
-    size_t lastEventCount = 0;
+    uint32_t lastDropped[ZoneManager::CAPACITY] = {0};
+    static TemperatureController::EventEntry batch[32];
     SystemData snap;
     while (true) {
         buildSystemData(snap);
         SystemUtils::logData(snap);
-        size_t evCount = controller.getEventLogCount();
-        while (lastEventCount < evCount) {
-            auto rec = controller.getEvent(lastEventCount);
-            SystemUtils::logEventRecord(rec.ts, rec.code, rec.mask);
-            lastEventCount++;
+        // Every zone has its own ring; zone 0 is the global controller
+        for (uint8_t z = 0; z < zones.count(); z++) {
+            TemperatureController& c = zones.zone(z);
+            size_t n;
+            while ((n = c.drainEvents(batch, sizeof(batch) / sizeof(batch[0]))) > 0) {
+                for (size_t i = 0; i < n; i++) {
+                    SystemUtils::logEventRecord(batch[i].seq, batch[i].value.ts, batch[i].value.code, batch[i].value.mask, z);
+                }
+            }
+            uint32_t dropped = c.eventsDropped();
+            if (dropped != lastDropped[z]) {
+                // Lost events show up as gaps in the zone's seq column
+                Serial.printf("[LOG] %lu zone %u events dropped (ring full)\n", (unsigned long)(dropped - lastDropped[z]), (unsigned)z);
+                lastDropped[z] = dropped;
+            }
         }
         vTaskDelayUntil(&last, pdMS_TO_TICKS(PERIOD_LOG));
     }
@@ -0,0 +1,181 @@
+#include "sensors/sensor_registry.h"
+
+// Global registry shared by the sensor, control, UI and logging tasks
+SensorRegistry sensorRegistry;
+
+SensorRegistry::SensorRegistry() {
+    const SensorFilterConfig def = sensor_filter::sanitize(
+        {SENSOR_FILTER_MEDIAN_WINDOW, SENSOR_FILTER_EMA_ALPHA, SENSOR_FILTER_MAX_RATE_C_PER_S});
+    for (uint8_t z = 0; z < MAX_SENSOR_ZONES; z++) _zoneFilter[z] = def;
+    clear();
+}
+
+void SensorRegistry::clear() {
+    _count = 0;
+    _layout = 0;
+    _lookups = 0;
+    _probes = 0;
+    for (uint16_t i = 0; i < SLOTS; i++) _slots[i] = EMPTY;
+}
+
+uint32_t SensorRegistry::hashRom(const uint8_t rom[SENSOR_ROM_LEN]) {
+    // FNV-1a over the whole ROM; family code and CRC bytes alone are not distinctive
+    uint32_t h = 2166136261u;
+    for (uint8_t i = 0; i < SENSOR_ROM_LEN; i++) {
+        h ^= rom[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Slot holding rom, or the empty slot where it would be inserted
+uint16_t SensorRegistry::slotFor(const uint8_t rom[SENSOR_ROM_LEN]) const {
+    uint16_t slot = (uint16_t)(hashRom(rom) & (SLOTS - 1));
+    _lookups++;
+    while (true) {
+        _probes++;
+        uint16_t idx = _slots[slot];
+        if (idx == EMPTY || memcmp(_rom[idx], rom, SENSOR_ROM_LEN) == 0) return slot;
+        slot = (slot + 1) & (SLOTS - 1);
+    }
+}
+
+uint16_t SensorRegistry::add(const uint8_t rom[SENSOR_ROM_LEN], uint8_t bus, uint8_t zone) {
+    uint16_t slot = slotFor(rom);
+    if (_slots[slot] != EMPTY) return _slots[slot];
+    if (_count >= CAPACITY) return NOT_FOUND;
+
+    uint16_t idx = _count++;
+    memcpy(_rom[idx], rom, SENSOR_ROM_LEN);
+    _tempC[idx] = 0.0f;
+    _rawC[idx] = 0.0f;
+    sensor_filter::reset(_filter[idx]);
+    _lastValid[idx] = 0;
+    _zone[idx] = zone < MAX_SENSOR_ZONES ? zone : 0;
+    _bus[idx] = bus;
+    _valid[idx] = false;
+    _slots[slot] = idx;
+    _layout++;
+    return idx;
+}
+
+uint16_t SensorRegistry::find(const uint8_t rom[SENSOR_ROM_LEN]) const {
+    uint16_t idx = _slots[slotFor(rom)];
+    return idx == EMPTY ? NOT_FOUND : idx;
+}
+
+bool SensorRegistry::setZone(uint16_t idx, uint8_t zone) {
+    if (idx >= _count || zone >= MAX_SENSOR_ZONES) return false;
+    if (_zone[idx] != zone) {
+        _zone[idx] = zone;
+        sensor_filter::reset(_filter[idx]);
+        _layout++;
+    }
+    return true;
+}
+
+bool SensorRegistry::setZoneFilter(uint8_t zone, const SensorFilterConfig& cfg) {
+    if (zone >= MAX_SENSOR_ZONES) return false;
+    _zoneFilter[zone] = sensor_filter::sanitize(cfg);
+    return true;
+}
+
+void SensorRegistry::setReading(uint16_t idx, float tempC, uint32_t nowMs) {
+    if (idx >= _count) return;
+    // A probe coming back from a timeout restarts from its new values instead of ramping from the old one
+    if (!_valid[idx] && _filter[idx].primed) sensor_filter::reset(_filter[idx]);
+    _rawC[idx] = tempC;
+    float filtered = sensor_filter::step(_filter[idx], _zoneFilter[_zone[idx]], tempC, nowMs);
+    if (!_filter[idx].primed) return;   // Priming: no value yet, validity unchanged
+    _tempC[idx] = filtered;
+    _lastValid[idx] = nowMs;
+    _valid[idx] = true;
+}
+
+void SensorRegistry::markFailed(uint16_t idx, uint32_t nowMs) {
+    if (idx >= _count) return;
+    if (nowMs - _lastValid[idx] > SENSOR_TIMEOUT) _valid[idx] = false;
+}
+
+uint16_t SensorRegistry::validCount() const {
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < _count; i++) n += _valid[i];
+    return n;
+}
+
+uint16_t SensorRegistry::zoneCount(uint8_t zone) const {
+    uint16_t n = 0;
+    for (uint16_t i = 0; i < _count; i++) n += (_zone[i] == zone);
+    return n;
+}
+
+SensorData SensorRegistry::get(uint16_t i) const {
+    SensorData d{};
+    if (i >= _count) return d;
+    d.temperature = _tempC[i];
+    d.valid = _valid[i];
+    d.timestamp = _lastValid[i];
+    d.lastValidReading = _lastValid[i];
+    d.sensorId = (uint8_t)i;
+    memcpy(d.rom, _rom[i], SENSOR_ROM_LEN);
+    return d;
+}
+
+uint8_t SensorRegistry::collectZone(uint8_t zone, SensorData out[], uint8_t max) const {
+    uint8_t n = 0;
+    for (uint16_t i = 0; i < _count && n < max; i++) {
+        if (_zone[i] == zone) out[n++] = get(i);
+    }
+    return n;
+}
+
+size_t SensorRegistry::formatLogHeader(char* buf, size_t len) const {
+    static const char hex[] = "0123456789abcdef";
+    size_t pos = 0;
+    if (len) buf[0] = '\0';
+    for (uint16_t i = 0; i < _count; i++) {
+        const size_t col = (i ? 1 : 0) + 2 + SENSOR_ROM_LEN * 2;
+        if (pos + col + 1 > len) break;
+        if (i) buf[pos++] = ',';
+        buf[pos++] = 't';
+        buf[pos++] = '_';
+        for (uint8_t b = 0; b < SENSOR_ROM_LEN; b++) {
+            buf[pos++] = hex[_rom[i][b] >> 4];
+            buf[pos++] = hex[_rom[i][b] & 0x0F];
+        }
+        buf[pos] = '\0';
+    }
+    return pos;
+}
+
+size_t SensorRegistry::formatLogValues(char* buf, size_t len) const {
+    size_t pos = 0;
+    if (len) buf[0] = '\0';
+    for (uint16_t i = 0; i < _count; i++) {
+        char cell[12];
+        int n = _valid[i] ? snprintf(cell, sizeof(cell), "%s%.2f", i ? "," : "", _tempC[i])
+                          : snprintf(cell, sizeof(cell), "%s", i ? "," : "");
+        if (n < 0 || pos + (size_t)n + 1 > len) break;
+        memcpy(buf + pos, cell, (size_t)n + 1);
+        pos += (size_t)n;
+    }
+    return pos;
+}
+
+size_t SensorRegistry::formatZoneList(char* buf, size_t len, uint8_t zone) const {
+    size_t pos = 0;
+    if (len) buf[0] = '\0';
+    for (uint16_t i = 0; i < _count; i++) {
+        if (zone != ALL_ZONES && _zone[i] != zone) continue;
+        char line[32];
+        int n = _valid[i]
+            ? snprintf(line, sizeof(line), "%sZ%u %02x%02x %6.1f°C", pos ? "\n" : "",
+                       _zone[i], _rom[i][2], _rom[i][1], _tempC[i])
+            : snprintf(line, sizeof(line), "%sZ%u %02x%02x   --.-°C", pos ? "\n" : "",
+                       _zone[i], _rom[i][2], _rom[i][1]);
+        if (n < 0 || pos + (size_t)n + 1 > len) break;
+        memcpy(buf + pos, line, (size_t)n + 1);
+        pos += (size_t)n;
+    }
+    return pos;
+}
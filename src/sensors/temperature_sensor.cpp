@@ -1,40 +1,69 @@
 #include "sensors/temperature_sensor.h"
 
-// Global sensor instance
-TemperatureSensor tempSensor;
+// Global bus instances
+static const uint8_t kBusPins[] = DS18B20_BUS_PINS;
+static_assert(sizeof(kBusPins) <= MAX_ONEWIRE_BUSES, "DS18B20_BUS_PINS lists more buses than MAX_ONEWIRE_BUSES");
+TemperatureSensor tempSensors[MAX_ONEWIRE_BUSES];
+uint8_t tempSensorBusCount = 0;
+static uint8_t gBusDoneMask = 0;
+
+uint16_t initTemperatureBuses() {
+    uint16_t probes = 0;
+    tempSensorBusCount = sizeof(kBusPins);
+    for (uint8_t b = 0; b < tempSensorBusCount; b++) {
+        if (tempSensors[b].init(kBusPins[b], b)) {
+            probes += tempSensors[b].getSensorCount();
+        }
+    }
+    return probes;
+}
+
+uint32_t updateTemperatureBuses(bool& cycleDone) {
+    uint32_t waitMs = TEMP_READ_INTERVAL;
+    uint8_t populated = 0;
+    for (uint8_t b = 0; b < tempSensorBusCount; b++) {
+        if (tempSensors[b].getSensorCount() == 0) continue;
+        populated |= (uint8_t)(1u << b);
+        uint32_t w = tempSensors[b].update();
+        if (w < waitMs) waitMs = w;
+        if (tempSensors[b].takeSample()) gBusDoneMask |= (uint8_t)(1u << b);
+    }
+    cycleDone = populated && (gBusDoneMask & populated) == populated;
+    if (cycleDone) gBusDoneMask = 0;
+    return waitMs;
+}
 
 TemperatureSensor::TemperatureSensor() {
     _oneWire = nullptr;
     _dallas = nullptr;
     _sensorCount = 0;
+    _busId = 0;
+    _registry = nullptr;
     _lastReadTime = 0;
     
     // Initialize sensor data structures
-    for (int i = 0; i < MAX_SENSORS; i++) {
-        _sensors[i].temperature = 0.0;
-        _sensors[i].humidity = 0.0;
-        _sensors[i].valid = false;
-        _sensors[i].timestamp = 0;
-        _sensors[i].lastValidReading = 0;
+    for (int i = 0; i < MAX_PROBES_PER_BUS; i++) {
+        _sensors[i] = SensorData{};
         _sensors[i].sensorId = i;
-        _sensors[i].address = "";
+        _regIndex[i] = SensorRegistry::NOT_FOUND;
     }
 }
 
-bool TemperatureSensor::init() {
-    DEBUG_PRINTLN("Initializing Temperature Sensors...");
+bool TemperatureSensor::init(uint8_t pin, uint8_t busId, SensorRegistry* registry) {
+    DEBUG_PRINTF("Initializing Temperature Sensors on bus %d (GPIO %d)...\n", busId, pin);
+    _busId = busId;
+    _registry = registry;
     
     // Create OneWire instance
-    _oneWire = new OneWire(DS18B20_PIN);
+    _oneWire = new OneWire(pin);
     
     // Create DallasTemperature instance
     _dallas = new DallasTemperature(_oneWire);
     
-    // Start the library
+    // Start the library; conversions are timed by the pipeline, never waited for inside the driver
     _dallas->begin();
-    
-    // Set resolution to 12 bits for highest accuracy
-    _dallas->setResolution(12);
+    _dallas->setWaitForConversion(false);
+    _bus.dallas = _dallas;
     
     // Scan for sensors
     scanSensors();
@@ -46,7 +75,7 @@ bool TemperatureSensor::init() {
     
     DEBUG_PRINTF("Found %d temperature sensor(s)\n", _sensorCount);
     
-    // Perform initial reading
+    // Kick off the first conversion (results arrive via takeSample())
     update();
     
     return true;
@@ -61,44 +90,59 @@ void TemperatureSensor::scanSensors() {
     DEBUG_PRINTF("Scanning for DS18B20 sensors... Found %d device(s)\n", deviceCount);
     
     // Iterate through devices
-    for (uint8_t i = 0; i < deviceCount && i < MAX_SENSORS; i++) {
-        if (_dallas->getAddress(_addresses[i], i)) {
-            _sensors[i].address = addressToString(_addresses[i]);
-            _sensors[i].sensorId = i;
-            _sensorCount++;
-            
-            DEBUG_PRINTF("Sensor %d: %s\n", i, _sensors[i].address.c_str());
+    for (uint8_t i = 0; i < deviceCount && _sensorCount < MAX_PROBES_PER_BUS; i++) {
+        uint8_t n = _sensorCount;
+        if (!_dallas->getAddress(_addresses[n], i)) continue;
+        if (_pipeline.add(_addresses[n], DS18B20_DEFAULT_RESOLUTION) < 0) {
+            DEBUG_PRINTF("Sensor %d: resolution write failed, skipped\n", i);
+            continue;
         }
+        memcpy(_sensors[n].rom, _addresses[n], SENSOR_ROM_LEN);
+        _sensors[n].sensorId = n;
+        _regIndex[n] = _registry ? _registry->add(_addresses[n], _busId, _busId) : SensorRegistry::NOT_FOUND;
+        _sensorCount++;
+        
+        char rom[SENSOR_ROM_STR_LEN];
+        DEBUG_PRINTF("Sensor %d.%d: %s\n", _busId, n, formatSensorRom(_sensors[n].rom, rom));
     }
 }
 
-void TemperatureSensor::update() {
-    // Check if enough time has passed since last reading
-    if (millis() - _lastReadTime < TEMP_READ_INTERVAL) {
-        return;
+uint32_t TemperatureSensor::update() {
+    uint32_t waitMs = _pipeline.service(millis());
+    if (!_pipeline.takeCycle()) {
+        return waitMs;
     }
     
-    // Request temperatures from all sensors
-    _dallas->requestTemperatures();
-    
-    // Read each sensor
+    // Cycle complete: copy out every probe's result (CRC failures keep the last value until timeout)
+    unsigned long now = millis();
     for (uint8_t i = 0; i < _sensorCount; i++) {
-        float temp = _dallas->getTempC(_addresses[i]);
+        const Ds18b20Channel& ch = _pipeline.channel(i);
         
-        if (isValidReading(temp)) {
-            _sensors[i].temperature = temp;
+        if (ch.ok && isValidReading(ch.tempC)) {
+            _sensors[i].temperature = ch.tempC;
             _sensors[i].valid = true;
-            _sensors[i].timestamp = millis();
-            _sensors[i].lastValidReading = millis();
+            _sensors[i].timestamp = ch.collectedAt;
+            _sensors[i].lastValidReading = ch.collectedAt;
+            if (_registry) _registry->setReading(_regIndex[i], ch.tempC, ch.collectedAt);
         } else {
             // Check for timeout
-            if (millis() - _sensors[i].lastValidReading > SENSOR_TIMEOUT) {
+            if (now - _sensors[i].lastValidReading > SENSOR_TIMEOUT) {
                 _sensors[i].valid = false;
             }
+            if (_registry) _registry->markFailed(_regIndex[i], now);
         }
     }
     
-    _lastReadTime = millis();
+    _lastReadTime = now;
+    _sampleReady = true;
+    return waitMs;
+}
+
+bool TemperatureSensor::setResolution(uint8_t index, uint8_t bits) {
+    if (index >= _sensorCount) {
+        return false;
+    }
+    return _pipeline.setResolution(index, bits);
 }
 
 SensorData TemperatureSensor::getSensorData(uint8_t index) const {
@@ -107,9 +151,7 @@ SensorData TemperatureSensor::getSensorData(uint8_t index) const {
     }
     
     // Return invalid sensor data
-    SensorData invalid;
-    invalid.valid = false;
-    return invalid;
+    return SensorData{};
 }
 
 float TemperatureSensor::getAverageTemperature() const {
@@ -139,16 +181,6 @@ bool TemperatureSensor::hasValidData() const {
     return false;
 }
 
-String TemperatureSensor::addressToString(DeviceAddress addr) {
-    String str = "";
-    for (uint8_t i = 0; i < 8; i++) {
-        if (addr[i] < 16) str += "0";
-        str += String(addr[i], HEX);
-        if (i < 7) str += ":";
-    }
-    return str;
-}
-
 bool TemperatureSensor::isValidReading(float temp) {
     // DS18B20 returns -127 for errors
     if (temp == DEVICE_DISCONNECTED_C || temp == -127.0) {
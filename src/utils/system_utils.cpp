@@ -11,6 +11,7 @@
 #endif
 #include "display/display_pins.h"
 #include "utils/pin_validation.h"
+#include "sensors/sensor_registry.h"
 
 void SystemUtils::initSerial() {
     Serial.begin(115200);
@@ -189,6 +190,16 @@ bool SystemUtils::initSDCard() {
 #endif
 }
 
+#ifdef ENABLE_SD_LOGGING
+static void formatLogHeader(const SystemData& data, char* line, size_t size) {
+    int n = snprintf(line, size, "timestamp,date,time,activeSensors,curTemp,avgTemp,targetTemp,alarm,faultMask,freeHeap,freePSRAM");
+    if (data.sensors && data.sensors->count() && n > 0 && (size_t)n + 1 < size) {
+        line[n++] = ',';
+        data.sensors->formatLogHeader(line + n, size - n);
+    }
+}
+#endif
+
 bool SystemUtils::logData(const SystemData& data) {
 #ifdef ENABLE_SD_LOGGING
     if (isLowMemory()) {
@@ -208,27 +219,52 @@ bool SystemUtils::logData(const SystemData& data) {
         snprintf(fname, sizeof(fname), "/logs/log.csv");
     }
 
+    // Probe columns follow the registry, so a layout change (probe added / rezoned) starts a fresh
+    // file rather than appending rows under a stale header. After boot the layout is unknown until
+    // the existing file's header line is compared with the one this layout would write; the same
+    // holds whenever the (date-based) file name changes.
+    static uint32_t headerLayout = UINT32_MAX;
+    static char headerFile[sizeof(fname)] = "";
+    if (strcmp(headerFile, fname) != 0) {
+        headerLayout = UINT32_MAX;
+        strncpy(headerFile, fname, sizeof(headerFile));
+    }
+    static char line[96 + MAX_REGISTRY_SENSORS * 20];
+    uint32_t layout = data.sensors ? data.sensors->layoutVersion() : 0;
     bool newFile = !SD.exists(fname);
+    if (!newFile && headerLayout == UINT32_MAX) {
+        File r = SD.open(fname, FILE_READ);
+        if (r) {
+            String existing = r.readStringUntil('\n');
+            r.close();
+            existing.trim();
+            formatLogHeader(data, line, sizeof(line));
+            if (existing == line) headerLayout = layout;
+        }
+    }
     File f = SD.open(fname, FILE_APPEND);
     if (!f) {
         Serial.printf("[SD] Open failed: %s\n", fname);
         return false;
     }
 
-    // Rotate if oversized
-    if (!newFile && f.size() > LOG_FILE_MAX_SIZE) {
+    // Rotate if oversized or the column layout changed
+    if (!newFile && (f.size() > LOG_FILE_MAX_SIZE || layout != headerLayout)) {
         f.close();
-        // Create incremented suffix
+        // First free incremented suffix; once all 99 are taken the last one is overwritten
+        char rotated[40];
         for (int i = 1; i < 100; ++i) {
-            char rotated[40];
             snprintf(rotated, sizeof(rotated), "%s.%02d", fname, i);
-            if (!SD.exists(rotated)) {
-                SD.rename(fname, rotated);
-                Serial.printf("[SD] Rotated %s -> %s\n", fname, rotated);
-                newFile = true; // ensures header on fresh file
-                break;
-            }
+            if (!SD.exists(rotated)) break;
+            if (i == 99) SD.remove(rotated);
         }
+        if (SD.rename(fname, rotated)) {
+            Serial.printf("[SD] Rotated %s -> %s\n", fname, rotated);
+        } else {
+            SD.remove(fname);   // Never keep appending under a stale header
+            Serial.printf("[SD] Rotation failed, truncated %s\n", fname);
+        }
+        newFile = true; // ensures header on fresh file
         f = SD.open(fname, FILE_APPEND);
         if (!f) {
             Serial.printf("[SD] Re-open failed after rotation: %s\n", fname);
@@ -236,8 +272,11 @@ bool SystemUtils::logData(const SystemData& data) {
         }
     }
 
+    // Variable-width rows: fixed columns + one column per registered probe
     if (newFile) {
-        f.println("timestamp,date,time,activeSensors,s0Temp,s1Temp,s2Temp,s3Temp,curTemp,avgTemp,targetTemp,alarm,faultMask,freeHeap,freePSRAM");
+        formatLogHeader(data, line, sizeof(line));
+        f.println(line);
+        headerLayout = layout;
     }
 
     auto ts = data.timeString.length() ? data.timeString : String(millis());
@@ -247,15 +286,15 @@ bool SystemUtils::logData(const SystemData& data) {
         timePart = data.timeString.substring(11, 19);
     }
 
-    char line[256];
-    float sTemps[4] = {NAN,NAN,NAN,NAN};
-    for (int i=0;i<4;i++) if (data.sensors[i].valid) sTemps[i] = data.sensors[i].temperature;
-    snprintf(line, sizeof(line), "%s,%s,%s,%u,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%d,0x%08lX,%lu,%lu",
+    int n = snprintf(line, sizeof(line), "%s,%s,%s,%u,%.2f,%.2f,%.2f,%d,0x%08lX,%lu,%lu",
              ts.c_str(), dateStr.c_str(), timePart.c_str(), data.activeSensors,
-             sTemps[0], sTemps[1], sTemps[2], sTemps[3],
              data.control.currentTemp, data.control.averageTemp, data.config.targetTemp,
              data.control.alarmActive ? 1 : 0, data.control.faultMask,
              (unsigned long)getFreeHeap(), (unsigned long)getFreePSRAM());
+    if (data.sensors && data.sensors->count() && n > 0 && (size_t)n + 1 < sizeof(line)) {
+        line[n++] = ',';
+        data.sensors->formatLogValues(line + n, sizeof(line) - n);
+    }
     f.println(line);
     f.flush(); // flush returns void in ESP32 SD
     f.close();
@@ -266,7 +305,7 @@ bool SystemUtils::logData(const SystemData& data) {
 #endif
 }
 
-bool SystemUtils::logEventRecord(unsigned long ts, uint16_t code, uint32_t faultMask) {
+bool SystemUtils::logEventRecord(uint32_t seq, unsigned long ts, uint16_t code, uint32_t faultMask, uint8_t zone) {
 #ifdef ENABLE_SD_LOGGING
     if (isLowMemory()) {
         Serial.println("[SD] Skipping event log due to low memory");
@@ -280,15 +319,16 @@ bool SystemUtils::logEventRecord(unsigned long ts, uint16_t code, uint32_t fault
     bool newFile = !SD.exists(fname);
     File f = SD.open(fname, FILE_APPEND);
     if (!f) return false;
-    if (newFile) f.println("millis,code,faultMask");
-    char line[64];
-    snprintf(line, sizeof(line), "%lu,0x%04X,0x%08lX", ts, code, (unsigned long)faultMask);
+    // seq and zone are appended last so readers of the original three columns keep working
+    if (newFile) f.println("millis,code,faultMask,seq,zone");
+    char line[80];
+    snprintf(line, sizeof(line), "%lu,0x%04X,0x%08lX,%lu,%u", ts, code, (unsigned long)faultMask, (unsigned long)seq, (unsigned)zone);
     f.println(line);
     f.flush();
     f.close();
     return true;
 #else
-    (void)ts; (void)code; (void)faultMask; return false;
+    (void)seq; (void)ts; (void)code; (void)faultMask; (void)zone; return false;
 #endif
 }
 
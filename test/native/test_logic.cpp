@@ -1,22 +1,15 @@
 #include <unity.h>
 #include <cmath>
 
-// Arduino minimal stubs
-unsigned long fakeMillis = 0;
-extern "C" unsigned long millis() { return fakeMillis; }
-extern "C" void pinMode(int, int) {}
-extern "C" void digitalWrite(int, int) {}
-extern "C" void ledcSetup(int,int,int) {}
-extern "C" void ledcAttachPin(int,int) {}
-extern "C" void ledcWrite(int,int) {}
-extern "C" void delay(unsigned long ms) { fakeMillis += ms; }
-
 // Include headers then implementation of controller only
 #include "controllers/temperature_controller.h"
 #include "config/config.h"
 #include "types/types.h"
 #include "../src/controllers/temperature_controller.cpp"
 
+// Virtual clock provided by test_support/arduino_stub.h
+#define fakeMillis __fakeMillis
+
 static SensorData makeSensor(float t, bool valid=true) { SensorData s{}; s.temperature=t; s.valid=valid; return s; }
 
 void test_pid_symmetry() {
@@ -35,7 +28,8 @@ void test_pid_symmetry() {
 void test_overtemp_fault_fast() {
     TemperatureController c; c.init(); c.setTargetTemperature(-10.0f);
     SensorData s[1]= { makeSensor(5.0f,true) }; // 15C above target
-    while (fakeMillis < FAULT_DEBOUNCE_MS + 10) { fakeMillis+=TEMP_UPDATE_INTERVAL; c.updateWithMultipleSensors(s,1);}    
+    unsigned long start = fakeMillis;
+    while (fakeMillis - start < FAULT_DEBOUNCE_MS + TEMP_UPDATE_INTERVAL + 10) { fakeMillis+=TEMP_UPDATE_INTERVAL; c.updateWithMultipleSensors(s,1);}    
     TEST_ASSERT_TRUE(c.faultActive(FaultBit(FAULT_OVER_TEMPERATURE_BIT)));
 }
 
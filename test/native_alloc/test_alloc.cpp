@@ -0,0 +1,96 @@
+// Heap-allocation audit of the control path. Global operator new is replaced with a counting
+// version; after a warm-up the controller must run whole cycles (sensor record copies, fault
+// evaluation, event log, snapshot publication) without a single allocation.
+#include <unity.h>
+#include <atomic>
+#include <new>
+#include <cstdlib>
+#include "controllers/temperature_controller.h"
+#include "config/config.h"
+#include "types/types.h"
+#include "../src/controllers/temperature_controller.cpp"
+
+static std::atomic<uint32_t> gAllocCount{0};
+
+void* operator new(std::size_t n) {
+    gAllocCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t n) { return operator new(n); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+static SensorData makeSensor(uint8_t id, float t) {
+    SensorData s{};
+    s.sensorId = id;
+    s.temperature = t;
+    s.valid = true;
+    s.timestamp = millis();
+    s.lastValidReading = s.timestamp;
+    for (uint8_t i = 0; i < SENSOR_ROM_LEN; ++i) s.rom[i] = (uint8_t)(0x28 + id + i);
+    return s;
+}
+
+// Temperature profile that walks through cooling, in-band, over-temp (fault + alarm) and recovery
+static float profile(uint32_t cycle) {
+    uint32_t phase = cycle % 8000;
+    if (phase < 2000) return -14.0f;
+    if (phase < 4000) return -18.0f;
+    if (phase < 6000) return 2.0f;
+    return -19.0f;
+}
+
+void test_counter_sees_heap_use() {
+    uint32_t before = gAllocCount.load();
+    String s(64, 'x');
+    TEST_ASSERT_TRUE(gAllocCount.load() > before);
+}
+
+void test_sensor_record_is_pod() {
+    TEST_ASSERT_TRUE(std::is_trivially_copyable<SensorData>::value);
+    SensorData s = makeSensor(0, -18.0f);
+    char buf[SENSOR_ROM_STR_LEN];
+    TEST_ASSERT_EQUAL_STRING("28:29:2a:2b:2c:2d:2e:2f", formatSensorRom(s.rom, buf));
+    TEST_ASSERT_EQUAL_size_t(SENSOR_ROM_STR_LEN - 1, strlen(buf));
+}
+
+void test_control_cycle_allocates_nothing_in_steady_state() {
+    __fakeMillis = 0;
+    TemperatureController c; c.init(); c.setTargetTemperature(-18.0f);
+    SensorData bus[MAX_SENSORS];
+    auto cycle = [&](uint32_t n) {
+        __fakeMillis += TEMP_UPDATE_INTERVAL;
+        for (uint8_t i = 0; i < MAX_SENSORS; ++i) bus[i] = makeSensor(i, profile(n) + 0.1f * i);
+        SensorData copy[MAX_SENSORS];
+        for (uint8_t i = 0; i < MAX_SENSORS; ++i) copy[i] = bus[i];
+        if (n & 1) c.updateWithMultipleSensors(copy, MAX_SENSORS);
+        else c.update(copy[0]);
+        ControlState st = c.getState();
+        SystemConfig cfg = c.getConfig();
+        (void)st; (void)cfg;
+        (void)c.msUntilNextDeadline(2000);
+        char rom[SENSOR_ROM_STR_LEN];
+        formatSensorRom(bus[n % MAX_SENSORS].rom, rom);
+    };
+    for (uint32_t n = 0; n < 200; ++n) cycle(n);   // Warm-up (first-use statics, if any)
+
+    uint32_t before = gAllocCount.load();
+    const uint32_t CYCLES = 20000;
+    for (uint32_t n = 200; n < 200 + CYCLES; ++n) cycle(n);
+    uint32_t allocs = gAllocCount.load() - before;
+    printf("[ALLOC] %u control cycles, %u allocations, %u events logged\n",
+           (unsigned)CYCLES, (unsigned)allocs, (unsigned)c.eventSequence());
+    TEST_ASSERT_TRUE(c.eventSequence() > 0);   // Fault/alarm paths were exercised
+    TEST_ASSERT_EQUAL_UINT32(0, allocs);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_counter_sees_heap_use);
+    RUN_TEST(test_sensor_record_is_pod);
+    RUN_TEST(test_control_cycle_allocates_nothing_in_steady_state);
+    return UNITY_END();
+}
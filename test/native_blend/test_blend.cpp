@@ -0,0 +1,273 @@
+// RGB565 blend kernels (lib/lvgl/src/draw/sw/lv_draw_sw_blend_rgb565.c) against LVGL's generic
+// lv_draw_sw_blend_basic(): bit-exact output for opaque/opacity/masked fills and plain/opacity/
+// masked image maps on random buffers, clipped and unaligned areas and every opacity; then Mpx/s
+// of the generic path, the portable kernels and the vector kernels across area sizes and mask
+// densities (run-length masks, like glyphs and anti-aliased edges).
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <lvgl.h>
+#include "src/draw/sw/lv_draw_sw.h"
+#include "src/core/lv_refr.h"
+
+typedef void (*BlendFn)(lv_draw_ctx_t*, const lv_draw_sw_blend_dsc_t*);
+
+static const lv_coord_t BUF_W = 800;   // One draw band of the panel
+static const lv_coord_t BUF_H = 40;
+
+static lv_disp_drv_t dispDrv;
+static lv_disp_draw_buf_t drawBuf;
+static lv_color_t dispBuf[BUF_W * 10];
+
+static uint32_t rngState = 0x12345678;
+static uint32_t rnd() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+static void flushNone(lv_disp_drv_t* drv, const lv_area_t*, lv_color_t*) { lv_disp_flush_ready(drv); }
+
+// A draw context over one band, as lv_refr sets it up while rendering
+struct Target {
+    std::vector<lv_color_t> px;
+    lv_area_t bufArea;
+    lv_area_t clip;
+    lv_draw_sw_ctx_t ctx;
+
+    Target() : px((size_t)BUF_W * BUF_H) {
+        lv_area_set(&bufArea, 0, 0, BUF_W - 1, BUF_H - 1);
+        clip = bufArea;
+        memset(&ctx, 0, sizeof(ctx));
+        ctx.base_draw.buf = px.data();
+        ctx.base_draw.buf_area = &bufArea;
+        ctx.base_draw.clip_area = &clip;
+    }
+    void blend(BlendFn fn, const lv_draw_sw_blend_dsc_t& dsc) { fn(&ctx.base_draw, &dsc); }
+};
+
+// Random mask: `density` of the bytes non-zero, half of those fully covered
+static void makeMask(std::vector<lv_opa_t>& m, size_t n, float density) {
+    m.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        bool on = (rnd() % 1000) < (uint32_t)(density * 1000);
+        m[i] = !on ? 0 : ((rnd() & 1) ? (lv_opa_t)LV_OPA_COVER : (lv_opa_t)(1 + rnd() % 254));
+    }
+}
+
+// Mask made of runs (mean 8 px) like glyphs and rounded edges: `density` of the runs covered,
+// one anti-aliased pixel where a run changes
+static void makeRunMask(std::vector<lv_opa_t>& m, size_t n, float density) {
+    m.resize(n);
+    bool on = false;
+    for (size_t i = 0; i < n;) {
+        size_t len = 1 + rnd() % 15;
+        bool next = (rnd() % 1000) < (uint32_t)(density * 1000);
+        if (next != on && i < n) m[i++] = (lv_opa_t)(1 + rnd() % 254);
+        on = next;
+        for (size_t k = 0; k < len && i < n; k++) m[i++] = on ? LV_OPA_COVER : 0;
+    }
+}
+
+static void randomPixels(std::vector<lv_color_t>& px, bool blackRuns) {
+    for (lv_color_t& c : px) c.full = blackRuns && (rnd() % 4) ? 0 : (uint16_t)rnd();
+}
+
+struct Case {
+    lv_area_t area;
+    lv_area_t clip;
+    lv_opa_t opa;
+    bool map;
+    bool masked;
+    lv_draw_mask_res_t maskRes;
+};
+
+// Runs one case through `fn` on a fresh copy of the same random inputs
+static void runCase(const Case& c, BlendFn fn, uint32_t seed, std::vector<lv_color_t>& out) {
+    rngState = seed;
+    Target t;
+    randomPixels(t.px, (seed & 3) == 0);   // Some backgrounds mostly black, for the fill cache start
+    t.clip = c.clip;
+    const uint32_t n = lv_area_get_size(&c.area);
+    std::vector<lv_color_t> src(n);
+    randomPixels(src, false);
+    std::vector<lv_opa_t> mask;
+    makeMask(mask, n, (float)(rnd() % 100) / 100.0f);
+
+    lv_draw_sw_blend_dsc_t dsc;
+    memset(&dsc, 0, sizeof(dsc));
+    dsc.blend_area = &c.area;
+    dsc.src_buf = c.map ? src.data() : nullptr;
+    dsc.color.full = (uint16_t)rnd();
+    dsc.mask_buf = c.masked ? mask.data() : nullptr;
+    dsc.mask_res = c.maskRes;
+    dsc.mask_area = &c.area;
+    dsc.opa = c.opa;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    t.blend(fn, dsc);
+    out = t.px;
+}
+
+static uint32_t countDiffs(const std::vector<lv_color_t>& a, const std::vector<lv_color_t>& b) {
+    uint32_t d = 0;
+    for (size_t i = 0; i < a.size(); i++) d += a[i].full != b[i].full;
+    return d;
+}
+
+void test_bit_exact_all_opacities() {
+    uint32_t cases = 0;
+    std::vector<lv_color_t> ref, portable, simd;
+    for (int opa = 0; opa <= 255; opa++) {
+        for (int kind = 0; kind < 4; kind++) {
+            for (int rep = 0; rep < 3; rep++) {
+                uint32_t seed = 0x9E3779B9u * (uint32_t)(opa * 16 + kind * 4 + rep + 1);
+                rngState = seed;
+                Case c;
+                // Odd widths and unaligned starts, partly outside the clip area
+                lv_coord_t x1 = (lv_coord_t)(rnd() % 700), y1 = (lv_coord_t)(rnd() % 30);
+                lv_area_set(&c.area, x1, y1, x1 + 1 + (lv_coord_t)(rnd() % 120), y1 + (lv_coord_t)(rnd() % 12));
+                lv_area_set(&c.clip, x1 + (lv_coord_t)(rnd() % 3), 0, BUF_W - 1 - (lv_coord_t)(rnd() % 50), BUF_H - 1);
+                c.opa = (lv_opa_t)opa;
+                c.map = kind & 1;
+                c.masked = kind & 2;
+                c.maskRes = LV_DRAW_MASK_RES_CHANGED;
+                runCase(c, lv_draw_sw_blend_basic, seed, ref);
+                runCase(c, lv_draw_sw_blend_rgb565_portable, seed, portable);
+                runCase(c, lv_draw_sw_blend_rgb565, seed, simd);
+                char msg[96];
+                snprintf(msg, sizeof(msg), "opa %d %s%s rep %d", opa, c.map ? "map" : "fill", c.masked ? " masked" : "", rep);
+                TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, countDiffs(ref, portable), msg);
+                TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, countDiffs(ref, simd), msg);
+                cases++;
+            }
+        }
+    }
+    printf("[BLEND] %lu cases bit-exact (vector kernels %s)\n", (unsigned long)cases,
+           lv_draw_sw_blend_rgb565_has_simd() ? "on" : "off, portable only");
+}
+
+void test_mask_results_and_other_modes() {
+    std::vector<lv_color_t> ref, fast;
+    const lv_draw_mask_res_t results[] = { LV_DRAW_MASK_RES_TRANSP, LV_DRAW_MASK_RES_FULL_COVER, LV_DRAW_MASK_RES_CHANGED };
+    for (lv_draw_mask_res_t res : results) {
+        Case c;
+        lv_area_set(&c.area, 3, 1, 200, 20);
+        lv_area_set(&c.clip, 0, 0, BUF_W - 1, BUF_H - 1);
+        c.opa = 200;
+        c.map = false;
+        c.masked = true;
+        c.maskRes = res;
+        runCase(c, lv_draw_sw_blend_basic, 77, ref);
+        runCase(c, lv_draw_sw_blend_rgb565, 77, fast);
+        TEST_ASSERT_EQUAL_UINT32(0, countDiffs(ref, fast));
+    }
+    // Blend modes without kernels go through the generic path
+    Target a, b;
+    randomPixels(a.px, false);
+    b.px = a.px;
+    lv_area_t area;
+    lv_area_set(&area, 10, 5, 300, 30);
+    lv_draw_sw_blend_dsc_t dsc;
+    memset(&dsc, 0, sizeof(dsc));
+    dsc.blend_area = &area;
+    dsc.color.full = 0x1234;
+    dsc.opa = 180;
+    dsc.blend_mode = LV_BLEND_MODE_ADDITIVE;
+    a.blend(lv_draw_sw_blend_basic, dsc);
+    b.blend(lv_draw_sw_blend_rgb565, dsc);
+    TEST_ASSERT_EQUAL_UINT32(0, countDiffs(a.px, b.px));
+}
+
+// Mpx/s of one operation through `fn`, repeated on the same buffers
+static double mpxPerSec(BlendFn fn, Target& t, const lv_draw_sw_blend_dsc_t& dsc, uint32_t px) {
+    const uint32_t reps = 8000000 / px + 1;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < reps; i++) t.blend(fn, dsc);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count();
+    return (double)px * reps / us;
+}
+
+// Best of interleaved runs of the three paths, so a scheduling hiccup does not decide a comparison
+static void bestOf(Target& t, const lv_draw_sw_blend_dsc_t& dsc, uint32_t px, double out[3]) {
+    static const BlendFn fns[3] = { lv_draw_sw_blend_basic, lv_draw_sw_blend_rgb565_portable, lv_draw_sw_blend_rgb565 };
+    for (int i = 0; i < 3; i++) out[i] = 0;
+    for (int r = 0; r < 5; r++) {
+        for (int i = 0; i < 3; i++) {
+            double v = mpxPerSec(fns[i], t, dsc, px);
+            if (v > out[i]) out[i] = v;
+        }
+    }
+}
+
+void test_benchmark_kernels() {
+    struct Size { const char* name; lv_coord_t w, h; };
+    static const Size sizes[] = { { "16x16", 16, 16 }, { "120x40", 120, 40 }, { "800x40", 800, 40 } };
+    // portable: the portable entry (what Xtensa runs) blends this with its own kernel
+    struct Op { const char* name; bool map; lv_opa_t opa; float density; bool portable; };
+    static const Op ops[] = {
+        { "fill opaque", false, LV_OPA_COVER, -1, false },       // Portable: only the unmasked fill with opacity
+        { "fill opa 50%", false, LV_OPA_50, -1, true },
+        { "fill mask 10% opa", false, LV_OPA_70, 0.1f, false },  // Masked opaque fills stay on the generic path
+        { "fill mask 50% opa", false, LV_OPA_70, 0.5f, false },
+        { "fill mask 100% opa", false, LV_OPA_70, 1.0f, false },
+        { "map opaque", true, LV_OPA_COVER, -1, false },
+        { "map opa 50%", true, LV_OPA_50, -1, false },
+        { "map mask 50%", true, LV_OPA_COVER, 0.5f, false },
+    };
+    uint32_t slower = 0;
+    printf("[BLEND] %-18s %-7s %9s %9s %9s %6s %6s\n", "op", "area", "generic", "portable", "vector", "port", "vec");
+    for (const Op& op : ops) {
+        for (const Size& s : sizes) {
+            rngState = 42;
+            Target t;
+            randomPixels(t.px, false);
+            lv_area_t area;
+            lv_area_set(&area, 1, 0, s.w, s.h - 1);   // Unaligned start, like most widget edges
+            std::vector<lv_color_t> src((size_t)s.w * s.h);
+            randomPixels(src, false);
+            std::vector<lv_opa_t> mask;
+            if (op.density >= 0) makeRunMask(mask, src.size(), op.density);
+            lv_draw_sw_blend_dsc_t dsc;
+            memset(&dsc, 0, sizeof(dsc));
+            dsc.blend_area = &area;
+            dsc.src_buf = op.map ? src.data() : nullptr;
+            dsc.color.full = 0x5AEB;
+            dsc.mask_buf = mask.empty() ? nullptr : mask.data();
+            dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+            dsc.mask_area = &area;
+            dsc.opa = op.opa;
+            const uint32_t px = (uint32_t)s.w * s.h;
+            double mpx[3];
+            bestOf(t, dsc, px, mpx);
+            const double generic = mpx[0], portable = mpx[1], vec = mpx[2];
+            printf("[BLEND] %-18s %-7s %9.0f %9.0f %9.0f %5.2fx %5.2fx Mpx/s\n", op.name, s.name, generic, portable, vec,
+                   portable / generic, vec / generic);
+            // A portable kernel that loses to the generic path should not be routed to (5% timing noise)
+            if (op.portable && portable < generic * 0.95) {
+                printf("[BLEND] portable %s %s slower than generic\n", op.name, s.name);
+                slower++;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, slower);
+}
+
+int main() {
+    lv_init();
+    lv_disp_draw_buf_init(&drawBuf, dispBuf, nullptr, BUF_W * 10);
+    lv_disp_drv_init(&dispDrv);
+    dispDrv.hor_res = BUF_W;
+    dispDrv.ver_res = BUF_H;
+    dispDrv.draw_buf = &drawBuf;
+    dispDrv.flush_cb = flushNone;
+    lv_disp_t* disp = lv_disp_drv_register(&dispDrv);
+    _lv_refr_set_disp_refreshing(disp);   // The blend functions read the driver of the refreshing display
+    UNITY_BEGIN();
+    RUN_TEST(test_bit_exact_all_opacities);
+    RUN_TEST(test_mask_results_and_other_modes);
+    RUN_TEST(test_benchmark_kernels);
+    return UNITY_END();
+}
@@ -0,0 +1,231 @@
+// DS18B20 conversion pipeline against the mock 1-Wire bus (test_support/mock_onewire.h).
+// Measures how long the sensor task is blocked on the bus and how stale each reading is when it is
+// published, for the async pipeline versus the legacy blocking requestTemperatures() pattern.
+#include <unity.h>
+#include <stdio.h>
+#include "sensors/ds18b20_pipeline.h"
+#include "test_support/mock_onewire.h"
+
+typedef MockOneWireBus<4> Bus;
+typedef Ds18b20Pipeline<Bus, 4> Pipeline;
+
+struct SensorTaskStats {
+    uint64_t blockedUs = 0;
+    uint32_t cycles = 0;
+    uint32_t readings = 0;
+    uint32_t latencyMaxMs = 0;     // Conversion complete -> scratchpad collected
+    uint64_t latencySumMs = 0;
+    uint32_t ageMaxMs = 0;         // Conversion start -> sample published
+    uint32_t wakeups = 0;
+    double blockedPct(uint32_t seconds) const { return 100.0 * blockedUs / (seconds * 1e6); }
+};
+
+// Sensor task loop: service, publish on a completed cycle, sleep for the returned time (1 tick min)
+static SensorTaskStats runPipeline(Bus& bus, Pipeline& p, uint32_t seconds) {
+    SensorTaskStats st;
+    uint64_t blocked0 = bus.blockedUs;
+    uint32_t end = bus.nowMs() + seconds * 1000;
+    while (bus.nowMs() < end) {
+        uint32_t wait = p.service(bus.nowMs());
+        st.wakeups++;
+        if (p.takeCycle()) {
+            st.cycles++;
+            uint32_t age = bus.nowMs() - p.cycleStart();
+            if (age > st.ageMaxMs) st.ageMaxMs = age;
+            for (uint8_t i = 0; i < p.count(); i++) {
+                const Ds18b20Channel& ch = p.channel(i);
+                if (!ch.ok) continue;
+                uint32_t lat = ch.collectedAt - ch.readyAt;
+                st.readings++;
+                st.latencySumMs += lat;
+                if (lat > st.latencyMaxMs) st.latencyMaxMs = lat;
+            }
+        }
+        bus.advanceMs(wait ? wait : 1);
+    }
+    st.blockedUs = bus.blockedUs - blocked0;
+    return st;
+}
+
+// Legacy TemperatureSensor::update(): requestTemperatures() waits out the 12-bit conversion, then
+// getTempC() reads every scratchpad
+static SensorTaskStats runBlocking(Bus& bus, uint32_t seconds) {
+    SensorTaskStats st;
+    uint64_t blocked0 = bus.blockedUs;
+    for (uint32_t s = 0; s < seconds; s++) {
+        uint32_t start = bus.nowMs();
+        bus.startConversion();
+        bus.advanceMs(ds18b20::conversionMs(12));
+        bus.blockedUs += ds18b20::conversionMs(12) * 1000ULL;
+        for (uint8_t i = 0; i < bus.count; i++) {
+            uint8_t sp[ds18b20::SCRATCHPAD_LEN];
+            float t;
+            bus.readScratchpad(bus.dev[i].rom, sp);
+            if (ds18b20::decode(sp, t)) st.readings++;
+        }
+        st.cycles++;
+        st.wakeups++;
+        uint32_t age = bus.nowMs() - start;
+        if (age > st.ageMaxMs) st.ageMaxMs = age;
+        uint32_t used = bus.nowMs() - start;
+        if (used < 1000) bus.advanceMs(1000 - used);
+    }
+    st.blockedUs = bus.blockedUs - blocked0;
+    return st;
+}
+
+static void addAll(Bus& bus, Pipeline& p) {
+    for (uint8_t i = 0; i < bus.count; i++) TEST_ASSERT_TRUE(p.add(bus.dev[i].rom, bus.dev[i].resolution) >= 0);
+}
+
+void test_crc8_and_decode() {
+    // Maxim AN27 example ROM: family 0x02, serial 1C B8 01 00 00 00, CRC 0xA2
+    const uint8_t rom[7] = {0x02, 0x1C, 0xB8, 0x01, 0x00, 0x00, 0x00};
+    TEST_ASSERT_EQUAL_HEX8(0xA2, ds18b20::crc8(rom, 7));
+
+    uint8_t sp[9] = {0x91, 0x01, 0x4B, 0x46, ds18b20::configRegister(12), 0xFF, 0x0C, 0x10, 0};
+    sp[8] = ds18b20::crc8(sp, 8);
+    float t = 0;
+    TEST_ASSERT_TRUE(ds18b20::decode(sp, t));
+    TEST_ASSERT_EQUAL_FLOAT(25.0625f, t);
+    sp[0] = 0x5E; sp[1] = 0xFF; sp[8] = ds18b20::crc8(sp, 8);   // -10.125
+    TEST_ASSERT_TRUE(ds18b20::decode(sp, t));
+    TEST_ASSERT_EQUAL_FLOAT(-10.125f, t);
+    sp[4] = ds18b20::configRegister(9); sp[8] = ds18b20::crc8(sp, 8);   // 9-bit: 0.5 C steps
+    TEST_ASSERT_TRUE(ds18b20::decode(sp, t));
+    TEST_ASSERT_EQUAL_FLOAT(-10.5f, t);
+    sp[8] ^= 1;
+    TEST_ASSERT_FALSE(ds18b20::decode(sp, t));
+    uint8_t zeros[9] = {};
+    TEST_ASSERT_FALSE(ds18b20::decode(zeros, t));
+    sp[0] = 0x50; sp[1] = 0x05; sp[4] = ds18b20::configRegister(12); sp[8] = ds18b20::crc8(sp, 8);
+    TEST_ASSERT_FALSE(ds18b20::decode(sp, t));          // Power-on +85 C: not a conversion
+    TEST_ASSERT_TRUE(ds18b20::decode(sp, t, true));
+    TEST_ASSERT_EQUAL_FLOAT(85.0f, t);
+}
+
+void test_blocked_time_vs_blocking_driver() {
+    const uint32_t seconds = 60;
+    Bus legacyBus;
+    for (uint8_t i = 0; i < 4; i++) legacyBus.addProbe(i, 12, -18.0f + i);
+    SensorTaskStats legacy = runBlocking(legacyBus, seconds);
+
+    Bus bus;
+    for (uint8_t i = 0; i < 4; i++) bus.addProbe(i, 12, -18.0f + i);
+    Pipeline p(bus);
+    addAll(bus, p);
+    SensorTaskStats st = runPipeline(bus, p, seconds);
+
+    printf("[DS18B20] blocking: %.1f%% of task time on the bus, %u readings, age max %u ms\n",
+           legacy.blockedPct(seconds), (unsigned)legacy.readings, (unsigned)legacy.ageMaxMs);
+    printf("[DS18B20] pipeline: %.2f%% of task time on the bus, %u readings, %u wakeups, "
+           "collect latency mean %.1f / max %u ms, age max %u ms\n",
+           st.blockedPct(seconds), (unsigned)st.readings, (unsigned)st.wakeups,
+           st.readings ? (double)st.latencySumMs / st.readings : 0.0, (unsigned)st.latencyMaxMs,
+           (unsigned)st.ageMaxMs);
+    TEST_ASSERT_TRUE(legacy.blockedPct(seconds) > 75.0);
+    TEST_ASSERT_TRUE(st.blockedPct(seconds) < 6.0);
+    TEST_ASSERT_UINT32_WITHIN(1, seconds, st.cycles);
+    TEST_ASSERT_EQUAL_UINT32(st.cycles * 4, st.readings);
+    for (uint8_t i = 0; i < 4; i++) TEST_ASSERT_EQUAL_UINT32(0, bus.dev[i].earlyReads);
+    TEST_ASSERT_TRUE(st.latencyMaxMs <= 4 * 13);   // Queued behind at most three ~11 ms reads + ticks
+}
+
+void test_mixed_resolution_collects_each_probe_when_ready() {
+    Bus bus;
+    bus.addProbe(0, 9, -20.0f);
+    bus.addProbe(1, 10, -19.0f);
+    bus.addProbe(2, 12, -18.0f);
+    Pipeline p(bus);
+    addAll(bus, p);
+    SensorTaskStats st = runPipeline(bus, p, 10);
+    TEST_ASSERT_TRUE(st.cycles >= 9);
+    const Ds18b20Channel& fast = p.channel(0);
+    const Ds18b20Channel& mid = p.channel(1);
+    const Ds18b20Channel& slow = p.channel(2);
+    TEST_ASSERT_TRUE(fast.ok && mid.ok && slow.ok);
+    TEST_ASSERT_EQUAL_FLOAT(-20.0f, fast.tempC);
+    TEST_ASSERT_EQUAL_FLOAT(-18.0f, slow.tempC);
+    TEST_ASSERT_UINT32_WITHIN(15, p.cycleStart() + 94, fast.collectedAt);
+    TEST_ASSERT_UINT32_WITHIN(15, p.cycleStart() + 188, mid.collectedAt);
+    TEST_ASSERT_UINT32_WITHIN(15, p.cycleStart() + 750, slow.collectedAt);
+    for (uint8_t i = 0; i < 3; i++) TEST_ASSERT_EQUAL_UINT32(0, bus.dev[i].earlyReads);
+    // Changing a probe's resolution moves its collection point from the next cycle on
+    TEST_ASSERT_TRUE(p.setResolution(2, 11));
+    runPipeline(bus, p, 2);
+    TEST_ASSERT_UINT32_WITHIN(15, p.cycleStart() + 375, p.channel(2).collectedAt);
+}
+
+void test_crc_retry_and_give_up() {
+    Bus bus;
+    bus.addProbe(0, 12, -18.0f);
+    MockDs18b20& flaky = bus.addProbe(1, 12, -17.0f);
+    Pipeline p(bus, 1000, 2);
+    addAll(bus, p);
+    runPipeline(bus, p, 2);
+    TEST_ASSERT_TRUE(p.channel(1).ok);
+
+    flaky.corruptReads = 2;   // Within the retry budget: reading survives
+    runPipeline(bus, p, 1);
+    TEST_ASSERT_TRUE(p.channel(1).ok);
+    TEST_ASSERT_EQUAL_UINT16(2, p.channel(1).crcErrors);
+    TEST_ASSERT_EQUAL_UINT16(0, p.channel(1).failures);
+    TEST_ASSERT_TRUE(p.channel(0).ok);
+
+    flaky.corruptReads = 3;   // Retries exhausted: dropped for this cycle only
+    runPipeline(bus, p, 1);
+    TEST_ASSERT_FALSE(p.channel(1).ok);
+    TEST_ASSERT_EQUAL_UINT16(1, p.channel(1).failures);
+    TEST_ASSERT_TRUE(p.channel(0).ok);
+    runPipeline(bus, p, 1);
+    TEST_ASSERT_TRUE(p.channel(1).ok);
+}
+
+void test_probe_reset_reads_as_not_ready() {
+    Bus bus;
+    bus.addProbe(0, 12, -18.0f);
+    bus.addProbe(1, 12, -17.0f);
+    Pipeline p(bus, 1000, 2);
+    addAll(bus, p);
+    runPipeline(bus, p, 2);
+    TEST_ASSERT_TRUE(p.channel(1).ok);
+
+    // Probe 1 browns out after Convert T: its scratchpad reads back +85 C with a good CRC
+    while (!p.converting()) { uint32_t w = p.service(bus.nowMs()); bus.advanceMs(w ? w : 1); }
+    bus.powerCycle(1);
+    while (p.converting()) { uint32_t w = p.service(bus.nowMs()); bus.advanceMs(w ? w : 1); }
+    TEST_ASSERT_FALSE(p.channel(1).ok);
+    TEST_ASSERT_EQUAL_UINT16(1, p.channel(1).notReady);
+    TEST_ASSERT_EQUAL_UINT8(1, p.channel(1).attempts);      // No CRC retries on an unchanged scratchpad
+    TEST_ASSERT_EQUAL_UINT16(0, p.channel(1).crcErrors);
+    TEST_ASSERT_TRUE(p.channel(0).ok);
+
+    runPipeline(bus, p, 1);   // Next conversion runs normally
+    TEST_ASSERT_TRUE(p.channel(1).ok);
+    TEST_ASSERT_EQUAL_FLOAT(-17.0f, p.channel(1).tempC);
+}
+
+void test_missing_probe_fails_without_stalling_others() {
+    Bus bus;
+    bus.addProbe(0, 12, -18.0f);
+    MockDs18b20& gone = bus.addProbe(1, 12, -17.0f);
+    Pipeline p(bus);
+    addAll(bus, p);
+    gone.present = false;
+    SensorTaskStats st = runPipeline(bus, p, 5);
+    TEST_ASSERT_TRUE(st.cycles >= 4);
+    TEST_ASSERT_TRUE(p.channel(0).ok);
+    TEST_ASSERT_FALSE(p.channel(1).ok);
+    TEST_ASSERT_TRUE(p.channel(1).failures >= 4);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_crc8_and_decode);
+    RUN_TEST(test_blocked_time_vs_blocking_driver);
+    RUN_TEST(test_mixed_resolution_collects_each_probe_when_ready);
+    RUN_TEST(test_crc_retry_and_give_up);
+    RUN_TEST(test_probe_reset_reads_as_not_ready);
+    RUN_TEST(test_missing_probe_fails_without_stalling_others);
+    return UNITY_END();
+}
@@ -0,0 +1,134 @@
+// SPSC event ring: sequence numbers, overflow accounting, batched drain, and a producer/consumer
+// thread pair checking that nothing is lost, duplicated or reordered beyond the counted drops.
+// Also checks the controller no longer loses events when more than the old 32 arrive between drains.
+#include <unity.h>
+#include <thread>
+#include <atomic>
+#include <stdio.h>
+#include "rtos/event_ring.h"
+#include "controllers/temperature_controller.h"
+#include "../src/controllers/temperature_controller.cpp"
+
+struct Ev {
+    uint32_t a;
+    uint32_t b;   // ~a, detects torn slots
+    uint16_t code;
+};
+typedef SpscRing<Ev> Ring;
+
+void test_capacity_rounds_up_and_copies_are_empty() {
+    Ring r(100);
+    TEST_ASSERT_EQUAL_UINT32(128, r.capacity());
+    TEST_ASSERT_TRUE(r.push({1, ~1u, 7}));
+    Ring copy(r);
+    TEST_ASSERT_EQUAL_UINT32(128, copy.capacity());
+    TEST_ASSERT_EQUAL_UINT32(0, copy.size());
+    TEST_ASSERT_EQUAL_UINT32(1, r.size());
+
+    Ring late;   // Global-style instance: no storage until begin(), pushes are counted drops
+    TEST_ASSERT_EQUAL_UINT32(0, late.capacity());
+    TEST_ASSERT_FALSE(late.push({1, 0, 1}));
+    TEST_ASSERT_EQUAL_UINT32(1, late.dropped());
+    TEST_ASSERT_EQUAL_UINT32(0, Ring(late).capacity());
+    TEST_ASSERT_TRUE(late.begin(100));
+    TEST_ASSERT_EQUAL_UINT32(128, late.capacity());
+    TEST_ASSERT_TRUE(late.push({2, 0, 2}));
+}
+
+void test_overflow_counts_drops_and_leaves_gaps() {
+    Ring r(8);
+    for (uint32_t i = 0; i < 12; i++) r.push({i, ~i, 0});
+    TEST_ASSERT_EQUAL_UINT32(8, r.size());
+    TEST_ASSERT_EQUAL_UINT32(4, r.dropped());
+    TEST_ASSERT_EQUAL_UINT32(12, r.nextSequence());
+
+    Ring::Entry out[5];
+    TEST_ASSERT_EQUAL_size_t(5, r.drain(out, 5));   // Batched: oldest first
+    for (uint32_t i = 0; i < 5; i++) TEST_ASSERT_EQUAL_UINT32(i, out[i].seq);
+    r.push({100, ~100u, 0});                         // Room again: seq 12 follows dropped 8..11
+    TEST_ASSERT_EQUAL_size_t(4, r.drain(out, 5));
+    TEST_ASSERT_EQUAL_UINT32(7, out[2].seq);
+    TEST_ASSERT_EQUAL_UINT32(12, out[3].seq);
+    TEST_ASSERT_EQUAL_UINT32(100, out[3].value.a);
+    TEST_ASSERT_EQUAL_size_t(0, r.drain(out, 5));
+}
+
+// Producer pushes as fast as it can; consumer drains in batches with pauses so the ring overflows
+static void runPair(uint32_t capacity, uint32_t total, uint32_t consumerPauseEvery) {
+    Ring r(capacity);
+    std::atomic<bool> done {false};
+    std::thread producer([&] {
+        for (uint32_t i = 0; i < total; i++) r.push({i, ~i, (uint16_t)i});
+        done.store(true);
+    });
+
+    uint32_t received = 0, gaps = 0, lastSeq = 0, batches = 0;
+    bool first = true, bad = false;
+    Ring::Entry batch[64];
+    while (true) {
+        bool finished = done.load();
+        size_t n = r.drain(batch, 64);
+        for (size_t i = 0; i < n; i++) {
+            const Ring::Entry& e = batch[i];
+            // Payload was produced by push #seq; a torn or stale slot would not match
+            if (e.value.a != e.seq || e.value.b != ~e.seq || e.value.code != (uint16_t)e.seq) bad = true;
+            if (!first && e.seq <= lastSeq) bad = true;        // Strictly increasing, no duplicates
+            if (!first && e.seq != lastSeq + 1) gaps += e.seq - lastSeq - 1;
+            if (first && e.seq != 0) gaps += e.seq;
+            lastSeq = e.seq;
+            first = false;
+        }
+        received += (uint32_t)n;
+        if (n) batches++;
+        if (consumerPauseEvery && batches % consumerPauseEvery == 0) std::this_thread::yield();
+        if (finished && n == 0) break;
+    }
+    producer.join();
+    if (!first && lastSeq + 1 < total) gaps += total - 1 - lastSeq;
+    printf("[EVENTS] cap %5u: %u pushed, %u received in %u batches, %u dropped\n", (unsigned)capacity,
+           (unsigned)total, (unsigned)received, (unsigned)batches, (unsigned)r.dropped());
+    TEST_ASSERT_FALSE(bad);
+    TEST_ASSERT_EQUAL_UINT32(total, r.nextSequence());
+    TEST_ASSERT_EQUAL_UINT32(total, received + r.dropped());
+    TEST_ASSERT_EQUAL_UINT32(r.dropped(), gaps);            // Every drop is visible as a sequence gap
+}
+
+void test_concurrent_producer_consumer() {
+    runPair(16, 2000000, 1);      // Tiny ring: heavy overflow
+    runPair(1024, 2000000, 4);
+    runPair(65536, 2000000, 0);
+}
+
+void test_controller_keeps_more_than_32_events() {
+    TemperatureController c;
+    TEST_ASSERT_EQUAL_UINT32(0, c.eventCapacity());   // Ring storage comes from init()
+    c.init(); c.setTargetTemperature(-18.0f);
+    TEST_ASSERT_TRUE(c.eventCapacity() >= CONTROLLER_EVENT_RING_CAPACITY);
+    SensorData hot{}; hot.valid = true; hot.temperature = -18.0f + OVER_TEMPERATURE_MARGIN + 1.0f;
+    SensorData ok{}; ok.valid = true; ok.temperature = -18.0f;
+    // Over-temperature latch/release cycles, each producing two events, with no drain in between
+    for (int i = 0; i < 60; i++) {
+        unsigned long start = __fakeMillis;
+        while (__fakeMillis - start < FAULT_DEBOUNCE_MS + 10) { __fakeMillis += 5; c.runControlCycle(&hot, 1); }
+        __fakeMillis += 5; c.runControlCycle(&ok, 1);
+    }
+    TemperatureController::EventEntry ev[32];
+    uint32_t total = 0, expect = 0;
+    size_t n;
+    while ((n = c.drainEvents(ev, 32)) > 0) {
+        for (size_t i = 0; i < n; i++) TEST_ASSERT_EQUAL_UINT32(expect++, ev[i].seq);
+        total += (uint32_t)n;
+    }
+    TEST_ASSERT_TRUE(total >= 120);
+    TEST_ASSERT_EQUAL_UINT32(c.eventSequence(), total);
+    TEST_ASSERT_EQUAL_UINT32(0, c.eventsDropped());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_capacity_rounds_up_and_copies_are_empty);
+    RUN_TEST(test_overflow_counts_drops_and_leaves_gaps);
+    RUN_TEST(test_concurrent_producer_consumer);
+    RUN_TEST(test_controller_keeps_more_than_32_events);
+    return UNITY_END();
+}
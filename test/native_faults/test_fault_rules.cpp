@@ -0,0 +1,137 @@
+// Fault rule table: set/clear debounce per rule, the clear paths that used to be no-ops (sensor
+// missing, range), event codes, and the evaluation cost of one pass as the table grows.
+#include <unity.h>
+#include <chrono>
+#include <stdio.h>
+#include "controllers/temperature_controller.h"
+#include "config/config.h"
+#include "types/types.h"
+#include "../src/controllers/temperature_controller.cpp"
+
+#define fakeMillis __fakeMillis
+
+static SensorData makeSensor(float t, bool valid = true) { SensorData s{}; s.temperature = t; s.valid = valid; return s; }
+
+static void runFor(TemperatureController& c, SensorData* s, uint8_t n, uint32_t ms) {
+    unsigned long start = fakeMillis;
+    while (fakeMillis - start < ms) { fakeMillis += 5; c.runControlCycle(s, n); }
+}
+
+// Drains the controller's event stream; true when code was among the drained events
+static bool logged(TemperatureController& c, uint16_t code) {
+    TemperatureController::EventEntry ev[16];
+    bool found = false;
+    size_t n;
+    while ((n = c.drainEvents(ev, 16)) > 0) for (size_t i = 0; i < n; i++) found |= ev[i].value.code == code;
+    return found;
+}
+
+void test_sensor_missing_sets_and_clears() {
+    TemperatureController c; c.init(); c.setTargetTemperature(-18.0f);
+    SensorData s[2] = { makeSensor(0, false), makeSensor(0, false) };
+    runFor(c, s, 2, SENSOR_MISSING_DEBOUNCE_MS / 2);
+    TEST_ASSERT_FALSE(c.faultActive(FaultBit(FAULT_SENSOR_MISSING_BIT)));
+    runFor(c, s, 2, SENSOR_MISSING_DEBOUNCE_MS);
+    TEST_ASSERT_TRUE(c.faultActive(FaultBit(FAULT_SENSOR_MISSING_BIT)));
+    TEST_ASSERT_TRUE(logged(c, 0xF000 | FAULT_SENSOR_MISSING_BIT));
+
+    s[1] = makeSensor(-18.0f);
+    runFor(c, s, 2, FAULT_CLEAR_DEBOUNCE_MS / 2);
+    TEST_ASSERT_TRUE(c.faultActive(FaultBit(FAULT_SENSOR_MISSING_BIT)));   // Clear is debounced too
+    runFor(c, s, 2, FAULT_CLEAR_DEBOUNCE_MS);
+    TEST_ASSERT_FALSE(c.faultActive(FaultBit(FAULT_SENSOR_MISSING_BIT)));
+    TEST_ASSERT_TRUE(logged(c, 0xF000 | FAULT_SENSOR_MISSING_BIT | FAULT_EVENT_CLEARED));
+}
+
+void test_range_fault_clears_and_flap_restarts_debounce() {
+    TemperatureController c; c.init(); c.setTargetTemperature(-18.0f);
+    SensorData s[2] = { makeSensor(-18.0f), makeSensor(TEMP_MAX_SAFE + 20.0f) };
+    runFor(c, s, 2, RANGE_FAULT_DEBOUNCE_MS + 10);
+    TEST_ASSERT_TRUE(c.faultActive(FaultBit(FAULT_SENSOR_RANGE_BIT)));
+
+    s[1] = makeSensor(-18.0f);
+    runFor(c, s, 2, FAULT_CLEAR_DEBOUNCE_MS / 2);
+    s[1] = makeSensor(TEMP_MIN_SAFE - 5.0f);        // Flaps back out of range: clear timer restarts
+    fakeMillis += 5; c.runControlCycle(s, 2);
+    s[1] = makeSensor(-18.0f);
+    runFor(c, s, 2, FAULT_CLEAR_DEBOUNCE_MS / 2 + 5);
+    TEST_ASSERT_TRUE(c.faultActive(FaultBit(FAULT_SENSOR_RANGE_BIT)));
+    runFor(c, s, 2, FAULT_CLEAR_DEBOUNCE_MS);
+    TEST_ASSERT_FALSE(c.faultActive(FaultBit(FAULT_SENSOR_RANGE_BIT)));
+}
+
+void test_over_temp_clear_hysteresis() {
+    TemperatureController c; c.init(); c.setTargetTemperature(-18.0f);
+    SensorData s[1] = { makeSensor(-18.0f + OVER_TEMPERATURE_MARGIN + 1.0f) };
+    runFor(c, s, 1, FAULT_DEBOUNCE_MS + 10);
+    TEST_ASSERT_TRUE(c.faultActive(FaultBit(FAULT_OVER_TEMPERATURE_BIT)));
+    // Below the set threshold but still above target + hysteresis/2: stays latched
+    s[0] = makeSensor(-18.0f + OVER_TEMPERATURE_MARGIN - 1.0f);
+    runFor(c, s, 1, 50);
+    TEST_ASSERT_TRUE(c.faultActive(FaultBit(FAULT_OVER_TEMPERATURE_BIT)));
+    s[0] = makeSensor(-18.0f);
+    fakeMillis += 5; c.runControlCycle(s, 1);
+    TEST_ASSERT_FALSE(c.faultActive(FaultBit(FAULT_OVER_TEMPERATURE_BIT)));
+    // Sensors lost while latched: no data, no decision
+    s[0] = makeSensor(-18.0f + OVER_TEMPERATURE_MARGIN + 1.0f);
+    runFor(c, s, 1, FAULT_DEBOUNCE_MS + 10);
+    s[0] = makeSensor(0, false);
+    runFor(c, s, 1, 50);
+    TEST_ASSERT_TRUE(c.faultActive(FaultBit(FAULT_OVER_TEMPERATURE_BIT)));
+}
+
+void test_deadline_tracks_pending_rules() {
+    TemperatureController c; c.init(); c.setTargetTemperature(-18.0f);
+    SensorData s[1] = { makeSensor(-18.0f + OVER_TEMPERATURE_MARGIN + 1.0f) };
+    fakeMillis += 5; c.runControlCycle(s, 1);
+    TEST_ASSERT_EQUAL_UINT32(FAULT_DEBOUNCE_MS, c.msUntilNextDeadline(100000));
+    fakeMillis += 10;
+    TEST_ASSERT_EQUAL_UINT32(FAULT_DEBOUNCE_MS - 10, c.msUntilNextDeadline(100000));
+}
+
+// Synthetic tables of n rules (the controller's rules repeated over distinct bits)
+static FaultRule gBench[32];
+static FaultRuleTimer gBenchTimers[32];
+
+static double benchPass(uint8_t n) {
+    for (uint8_t i = 0; i < n; i++) {
+        gBench[i] = FAULT_RULES[i % FAULT_RULE_COUNT];
+        gBench[i].bit = (FaultCodeBits)i;
+    }
+    memset(gBenchTimers, 0, sizeof(gBenchTimers));
+    FaultInputs in[4] = {};
+    in[0] = {-18.0f, -18.5f, -17.5f, 4, -18.0f, 1.0f, false, 0, 1000};
+    in[1] = {-10.0f, -11.0f, 12.0f, 4, -18.0f, 1.0f, true, 2000, 1000};
+    in[2] = {0.0f, 0.0f, 0.0f, 0, -18.0f, 1.0f, false, 0, 1000};
+    in[3] = {-25.0f, -40.0f, -20.0f, 2, -18.0f, 1.0f, true, 10, 1000};
+    uint32_t mask = 0, events = 0;
+    const int CYCLES = 400000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < CYCLES; i++) {
+        evaluateFaultRules(gBench, n, gBenchTimers, in[(i >> 6) & 3], (uint32_t)i, mask, [&](uint16_t) { events++; });
+    }
+    double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count();
+    TEST_ASSERT_TRUE(events > 0);
+    return ns / CYCLES;
+}
+
+void test_benchmark_rule_count_scaling() {
+    const uint8_t sizes[] = {FAULT_RULE_COUNT, 10, 20, 32};
+    double perPass[4];
+    for (int i = 0; i < 4; i++) {
+        perPass[i] = benchPass(sizes[i]);
+        printf("[FAULTS] %2u rules: %6.1f ns/pass, %5.2f ns/rule\n", (unsigned)sizes[i], perPass[i], perPass[i] / sizes[i]);
+    }
+    // One pass is linear in the table size
+    TEST_ASSERT_TRUE(perPass[3] / 32 < perPass[0] / FAULT_RULE_COUNT * 3.0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_sensor_missing_sets_and_clears);
+    RUN_TEST(test_range_fault_clears_and_flap_restarts_debounce);
+    RUN_TEST(test_over_temp_clear_hysteresis);
+    RUN_TEST(test_deadline_tracks_pending_rules);
+    RUN_TEST(test_benchmark_rule_count_scaling);
+    return UNITY_END();
+}
@@ -0,0 +1,219 @@
+// Per-probe filter stage: median glitch rejection, rate clamp, EMA, registry integration (re-prime
+// after timeout, per-zone settings, controller never sees a glitch) and a cycles-per-sample benchmark.
+#include <unity.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include "sensors/sensor_filter.h"
+#include "sensors/sensor_registry.h"
+#include "../src/sensors/sensor_registry.cpp"
+#include "controllers/temperature_controller.h"
+#include "../src/controllers/temperature_controller.cpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint64_t cycles() { return __rdtsc(); }
+#define HAVE_CYCLES 1
+#else
+static inline uint64_t cycles() { return 0; }
+#define HAVE_CYCLES 0
+#endif
+
+static const SensorFilterConfig PASS = {1, 1.0f, 0.0f};
+
+static void makeRom(uint16_t id, uint8_t rom[SENSOR_ROM_LEN]) {
+    memset(rom, 0, SENSOR_ROM_LEN);
+    rom[0] = 0x28;
+    rom[1] = (uint8_t)id;
+    rom[2] = (uint8_t)(id >> 8);
+}
+
+void test_median_drops_single_glitch() {
+    SensorFilterState s;
+    sensor_filter::reset(s);
+    const SensorFilterConfig c = sensor_filter::sanitize({3, 1.0f, 0.0f});
+    uint32_t t = 0;
+    for (int i = 0; i < 5; i++) sensor_filter::step(s, c, -18.0f, t += 1000);
+    TEST_ASSERT_EQUAL_FLOAT(-18.0f, sensor_filter::step(s, c, 85.0f, t += 1000));   // DS18B20 power-on value
+    TEST_ASSERT_EQUAL_FLOAT(-18.0f, sensor_filter::step(s, c, -18.0f, t += 1000));
+    // A real step shows up after the median's one-sample delay
+    sensor_filter::step(s, c, -12.0f, t += 1000);
+    TEST_ASSERT_EQUAL_FLOAT(-12.0f, sensor_filter::step(s, c, -12.0f, t += 1000));
+}
+
+// A bad first reading (85 °C scratchpad before the first conversion) must not become the baseline
+void test_bad_first_sample_held_until_primed() {
+    SensorFilterState s;
+    sensor_filter::reset(s);
+    const SensorFilterConfig c = sensor_filter::sanitize(
+        {SENSOR_FILTER_MEDIAN_WINDOW, SENSOR_FILTER_EMA_ALPHA, SENSOR_FILTER_MAX_RATE_C_PER_S});
+    const float first = sensor_filter::step(s, c, 85.0f, 1000);
+    const float second = sensor_filter::step(s, c, -18.0f, 2000);
+    TEST_ASSERT_TRUE(isnan(first));
+    TEST_ASSERT_TRUE(isnan(second));
+    TEST_ASSERT_FALSE(s.primed);
+    TEST_ASSERT_EQUAL_FLOAT(-18.0f, sensor_filter::step(s, c, -18.0f, 3000));
+    TEST_ASSERT_EQUAL_FLOAT(-18.0f, sensor_filter::step(s, c, -18.0f, 4000));
+    TEST_ASSERT_EQUAL_UINT16(0, s.clamped);
+
+    // Unsanitized window of 0: behaves as 1 instead of reading past the window
+    sensor_filter::reset(s);
+    const SensorFilterConfig raw = {0, 1.0f, 0.0f};
+    for (int i = 0; i < 10; i++) TEST_ASSERT_EQUAL_FLOAT(-18.0f + i, sensor_filter::step(s, raw, -18.0f + i, i * 1000));
+}
+
+void test_rate_clamp_and_ema() {
+    SensorFilterState s;
+    sensor_filter::reset(s);
+    SensorFilterConfig c = sensor_filter::sanitize({1, 1.0f, 0.5f});
+    TEST_ASSERT_EQUAL_FLOAT(-18.0f, sensor_filter::step(s, c, -18.0f, 1000));   // Primes
+    TEST_ASSERT_EQUAL_FLOAT(-17.5f, sensor_filter::step(s, c, -10.0f, 2000));   // 0.5 °C per 1 s
+    TEST_ASSERT_EQUAL_FLOAT(-16.5f, sensor_filter::step(s, c, -10.0f, 4000));   // Scales with the gap
+    TEST_ASSERT_EQUAL_UINT16(2, s.clamped);
+
+    sensor_filter::reset(s);
+    c = sensor_filter::sanitize({1, 0.25f, 0.0f});
+    sensor_filter::step(s, c, 0.0f, 0);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, sensor_filter::step(s, c, 4.0f, 1000));
+    float y = 0;
+    for (int i = 0; i < 60; i++) y = sensor_filter::step(s, c, 4.0f, 2000 + i * 1000);
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 4.0f, y);
+}
+
+void test_sanitize_and_passthrough() {
+    SensorFilterConfig c = sensor_filter::sanitize({0, 0.0f, -1.0f});
+    TEST_ASSERT_EQUAL_UINT8(1, c.medianWindow);
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, c.emaAlpha);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, c.maxRateCPerS);
+    TEST_ASSERT_EQUAL_UINT8(SENSOR_FILTER_MAX_WINDOW, sensor_filter::sanitize({200, 1.0f, 0}).medianWindow);
+    TEST_ASSERT_EQUAL_UINT8(3, sensor_filter::sanitize({4, 1.0f, 0}).medianWindow);
+
+    SensorFilterState s;
+    sensor_filter::reset(s);
+    for (int i = 0; i < 20; i++) {
+        float x = (i % 3) ? -18.0f + i : 85.0f;
+        TEST_ASSERT_EQUAL_FLOAT(x, sensor_filter::step(s, PASS, x, (uint32_t)i * 1000));
+    }
+}
+
+void test_registry_zones_and_reprime() {
+    static SensorRegistry r;
+    r.clear();
+    uint8_t rom[SENSOR_ROM_LEN];
+    makeRom(1, rom);
+    uint16_t a = r.add(rom, 0, 0);
+    makeRom(2, rom);
+    uint16_t b = r.add(rom, 0, 1);
+    TEST_ASSERT_TRUE(r.setZoneFilter(1, PASS));
+    TEST_ASSERT_FALSE(r.setZoneFilter(MAX_SENSOR_ZONES, PASS));
+
+    uint32_t t = 0;
+    for (int i = 0; i < 4; i++) { t += 1000; r.setReading(a, -18.0f, t); r.setReading(b, -18.0f, t); }
+    t += 1000;
+    r.setReading(a, 85.0f, t);
+    r.setReading(b, 85.0f, t);
+    TEST_ASSERT_EQUAL_FLOAT(-18.0f, r.temperature(a));    // Zone 0: default filter
+    TEST_ASSERT_EQUAL_FLOAT(85.0f, r.rawTemperature(a));
+    TEST_ASSERT_EQUAL_FLOAT(85.0f, r.temperature(b));     // Zone 1: passthrough
+
+    // After a timeout the probe restarts from its new values rather than ramping from the old one,
+    // and stays invalid until the filter is primed again (a bad first value is outvoted)
+    r.markFailed(a, t + SENSOR_TIMEOUT + 1);
+    TEST_ASSERT_FALSE(r.valid(a));
+    t += SENSOR_TIMEOUT;
+    r.setReading(a, 85.0f, t += 1000);
+    r.setReading(a, -5.0f, t += 1000);
+    TEST_ASSERT_FALSE(r.valid(a));
+    r.setReading(a, -5.0f, t += 1000);
+    TEST_ASSERT_TRUE(r.valid(a));
+    TEST_ASSERT_EQUAL_FLOAT(-5.0f, r.temperature(a));
+
+    // A new probe's first reading is held the same way
+    makeRom(3, rom);
+    uint16_t d = r.add(rom, 0, 0);
+    r.setReading(d, 85.0f, t);
+    TEST_ASSERT_FALSE(r.valid(d));
+}
+
+// The glitch that used to reach calculateAverageTemp never reaches the controller
+void test_controller_never_sees_glitch() {
+    static SensorRegistry r;
+    r.clear();
+    uint8_t rom[SENSOR_ROM_LEN];
+    for (uint16_t i = 0; i < 2; i++) { makeRom(10 + i, rom); r.add(rom, 0, 0); }
+    TemperatureController c;
+    c.init();
+    c.setTargetTemperature(-18.0f);
+    SensorData z[MAX_SENSORS];
+    float maxSeen = -100.0f;
+    for (int i = 0; i < 200; i++) {
+        __fakeMillis += TEMP_UPDATE_INTERVAL;
+        float t0 = (i % 17 == 5) ? 85.0f : -18.0f;     // Isolated glitches on probe 0
+        float t1 = (i % 23 == 9) ? 40.0f : -18.2f;     // and on probe 1
+        r.setReading(0, t0, __fakeMillis);
+        r.setReading(1, t1, __fakeMillis);
+        uint8_t n = r.collectZone(0, z, MAX_SENSORS);
+        c.runControlCycle(z, n);
+        if (!z[0].valid && !z[1].valid) continue;   // Filters still priming: no average yet
+        float avg = c.getState().averageTemp;
+        if (avg > maxSeen) maxSeen = avg;
+    }
+    TEST_ASSERT_TRUE(maxSeen < -18.0f + OVER_TEMPERATURE_MARGIN);
+    TEST_ASSERT_FALSE(c.faultActive(FaultBit(FAULT_OVER_TEMPERATURE_BIT)));
+    TEST_ASSERT_FALSE(c.faultActive(FaultBit(FAULT_SENSOR_RANGE_BIT)));
+}
+
+// Host cost per sample for each stage combination over a noisy trace with glitches
+void test_benchmark_cycles_per_sample() {
+    const int N = 200000;
+    static float trace[N];
+    uint32_t seed = 12345;
+    for (int i = 0; i < N; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        float noise = ((seed >> 16) & 0xFF) / 255.0f * 0.25f - 0.125f;
+        trace[i] = -18.0f + 2.0f * sinf(i * 0.001f) + noise + ((seed >> 8) % 500 == 0 ? 100.0f : 0.0f);
+    }
+    struct Case { const char* name; SensorFilterConfig cfg; } cases[] = {
+        {"passthrough", PASS},
+        {"median3", {3, 1.0f, 0.0f}},
+        {"median7", {7, 1.0f, 0.0f}},
+        {"ema", {1, 0.5f, 0.0f}},
+        {"rate", {1, 1.0f, 0.5f}},
+        {"default", {SENSOR_FILTER_MEDIAN_WINDOW, SENSOR_FILTER_EMA_ALPHA, SENSOR_FILTER_MAX_RATE_C_PER_S}},
+        {"median7+ema+rate", {7, 0.5f, 0.5f}},
+    };
+    for (const Case& k : cases) {
+        const SensorFilterConfig cfg = sensor_filter::sanitize(k.cfg);
+        SensorFilterState s;
+        sensor_filter::reset(s);
+        volatile float sink = 0;
+        float maxOut = -100.0f;
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t c0 = cycles();
+        for (int i = 0; i < N; i++) {
+            float y = sensor_filter::step(s, cfg, trace[i], (uint32_t)i * 1000u);
+            if (y > maxOut) maxOut = y;
+        }
+        uint64_t c1 = cycles();
+        double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - t0).count();
+        sink = maxOut;
+        (void)sink;
+        printf("[FILTER] %-17s %6.1f ns/sample", k.name, ns / N);
+        if (HAVE_CYCLES) printf(", %6.1f TSC cycles/sample", (double)(c1 - c0) / N);
+        printf(", max out %.2f C\n", maxOut);
+        if (cfg.medianWindow > 1) TEST_ASSERT_TRUE(maxOut < -15.0f);   // Every isolated glitch dropped
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_median_drops_single_glitch);
+    RUN_TEST(test_bad_first_sample_held_until_primed);
+    RUN_TEST(test_rate_clamp_and_ema);
+    RUN_TEST(test_sanitize_and_passthrough);
+    RUN_TEST(test_registry_zones_and_reprime);
+    RUN_TEST(test_controller_never_sees_glitch);
+    RUN_TEST(test_benchmark_cycles_per_sample);
+    return UNITY_END();
+}
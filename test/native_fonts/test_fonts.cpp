@@ -0,0 +1,289 @@
+// Subset UI fonts (lib/ui_fonts, generated by generate_ui_fonts.py) against the full Montserrat
+// fonts of lib/lvgl they are cut from: same metrics and kerning for every glyph they keep, same
+// pixels after requantizing to their bpp (decompressed where compressed), the fallback font for
+// everything else, and the same label pixels where the bpp is kept. Then flash bytes, ns per glyph
+// lookup and us per label refresh (glyph cache off) of the subset against the full font, and of the
+// subset with the glyph cache on.
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <lvgl.h>
+#include "src/draw/sw/lv_draw_sw.h"
+#include "ui_fonts.h"
+
+// The full fonts, disabled in lv_conf.h, each in its own namespace for its static tables
+namespace full48 {
+#undef LV_FONT_MONTSERRAT_48
+#define LV_FONT_MONTSERRAT_48 1
+#include "src/font/lv_font_montserrat_48.c"
+}
+namespace full32 {
+#undef LV_FONT_MONTSERRAT_32
+#define LV_FONT_MONTSERRAT_32 1
+#include "src/font/lv_font_montserrat_32.c"
+}
+namespace full28 {
+#undef LV_FONT_MONTSERRAT_28
+#define LV_FONT_MONTSERRAT_28 1
+#include "src/font/lv_font_montserrat_28.c"
+}
+namespace full24 {
+#undef LV_FONT_MONTSERRAT_24
+#define LV_FONT_MONTSERRAT_24 1
+#include "src/font/lv_font_montserrat_24.c"
+}
+namespace full20 {
+#undef LV_FONT_MONTSERRAT_20
+#define LV_FONT_MONTSERRAT_20 1
+#include "src/font/lv_font_montserrat_20.c"
+}
+namespace full18 {
+#undef LV_FONT_MONTSERRAT_18
+#define LV_FONT_MONTSERRAT_18 1
+#include "src/font/lv_font_montserrat_18.c"
+}
+
+struct FontPair {
+    int size;
+    const lv_font_t* subset;
+    const lv_font_t* full;
+    uint32_t bytes;
+    uint32_t fullBytes;
+    const char* label;   // A text the UI shows in this font
+};
+
+static const FontPair fonts[] = {
+    { 48, &ui_font_montserrat_48, &full48::lv_font_montserrat_48, UI_FONT_MONTSERRAT_48_BYTES,
+      UI_FONT_MONTSERRAT_48_FULL_BYTES, "-18.4°C" },
+    { 32, &ui_font_montserrat_32, &full32::lv_font_montserrat_32, UI_FONT_MONTSERRAT_32_BYTES,
+      UI_FONT_MONTSERRAT_32_FULL_BYTES, "Settings" },
+    { 28, &ui_font_montserrat_28, &full28::lv_font_montserrat_28, UI_FONT_MONTSERRAT_28_BYTES,
+      UI_FONT_MONTSERRAT_28_FULL_BYTES, "COOLING" },
+    { 24, &ui_font_montserrat_24, &full24::lv_font_montserrat_24, UI_FONT_MONTSERRAT_24_BYTES,
+      UI_FONT_MONTSERRAT_24_FULL_BYTES, "Target: -18.0°C" },
+    { 20, &ui_font_montserrat_20, &full20::lv_font_montserrat_20, UI_FONT_MONTSERRAT_20_BYTES,
+      UI_FONT_MONTSERRAT_20_FULL_BYTES, "Sensor fault: Z1 a212" },
+    { 18, &ui_font_montserrat_18, &full18::lv_font_montserrat_18, UI_FONT_MONTSERRAT_18_BYTES,
+      UI_FONT_MONTSERRAT_18_FULL_BYTES, "Check the wiring and restart" },
+};
+
+static const lv_coord_t DISP_W = 480;
+static const lv_coord_t DISP_H = 80;
+
+static lv_disp_drv_t dispDrv;
+static lv_disp_draw_buf_t drawBuf;
+static lv_color_t dispBuf[DISP_W * DISP_H];
+static lv_disp_t* disp;
+static std::vector<uint16_t> fb((size_t)DISP_W * DISP_H);
+
+static void flushCopy(lv_disp_drv_t* drv, const lv_area_t* area, lv_color_t* px) {
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        for (lv_coord_t x = area->x1; x <= area->x2; x++) fb[(size_t)y * DISP_W + x] = (px++)->full;
+    }
+    lv_disp_flush_ready(drv);
+}
+
+// Code points of a subset font, from its cmaps
+static std::vector<uint32_t> codePoints(const lv_font_t* font) {
+    const lv_font_fmt_txt_dsc_t* dsc = (const lv_font_fmt_txt_dsc_t*)font->dsc;
+    std::vector<uint32_t> out;
+    for (uint16_t i = 0; i < dsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t& c = dsc->cmaps[i];
+        if (c.type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            for (uint16_t k = 0; k < c.range_length; k++) out.push_back(c.range_start + k);
+        } else {
+            TEST_ASSERT_EQUAL(LV_FONT_FMT_TXT_CMAP_SPARSE_TINY, c.type);
+            for (uint16_t k = 0; k < c.list_length; k++) out.push_back(c.range_start + c.unicode_list[k]);
+        }
+    }
+    return out;
+}
+
+static std::vector<uint8_t> unpack(const uint8_t* bits, uint32_t n, uint8_t bpp) {
+    std::vector<uint8_t> px(n);
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t bit = i * bpp;
+        px[i] = (uint8_t)((bits[bit / 8] >> (8 - bpp - bit % 8)) & ((1 << bpp) - 1));
+    }
+    return px;
+}
+
+// Same rounding as requantize() in generate_ui_fonts.py
+static uint8_t requantize(uint8_t v, uint8_t srcBpp, uint8_t bpp) {
+    const uint32_t topSrc = (1u << srcBpp) - 1, top = (1u << bpp) - 1;
+    return (uint8_t)((v * top + topSrc / 2) / topSrc);
+}
+
+void test_metrics_and_kerning_match_full_font() {
+    for (const FontPair& f : fonts) {
+        TEST_ASSERT_EQUAL(f.full->line_height, f.subset->line_height);
+        TEST_ASSERT_EQUAL(f.full->base_line, f.subset->base_line);
+        const std::vector<uint32_t> cps = codePoints(f.subset);
+        TEST_ASSERT_TRUE(cps.size() > 10);
+        for (uint32_t a : cps) {
+            lv_font_glyph_dsc_t s, g;
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(f.subset, &s, a, 0));
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(f.full, &g, a, 0));
+            TEST_ASSERT_TRUE(s.resolved_font == f.subset);
+            TEST_ASSERT_EQUAL(g.adv_w, s.adv_w);
+            TEST_ASSERT_EQUAL(g.box_w, s.box_w);
+            TEST_ASSERT_EQUAL(g.box_h, s.box_h);
+            TEST_ASSERT_EQUAL(g.ofs_x, s.ofs_x);
+            TEST_ASSERT_EQUAL(g.ofs_y, s.ofs_y);
+            for (uint32_t b : cps) {
+                TEST_ASSERT_EQUAL(lv_font_get_glyph_width(f.full, a, b), lv_font_get_glyph_width(f.subset, a, b));
+            }
+        }
+    }
+}
+
+void test_bitmaps_match_requantized_full_font() {
+    for (const FontPair& f : fonts) {
+        for (uint32_t cp : codePoints(f.subset)) {
+            lv_font_glyph_dsc_t s, g;
+            lv_font_get_glyph_dsc(f.subset, &s, cp, 0);
+            lv_font_get_glyph_dsc(f.full, &g, cp, 0);
+            const uint32_t n = (uint32_t)s.box_w * s.box_h;
+            if (!n) continue;
+            // The compressed bitmap is decompressed into a shared buffer: copy it before the next lookup
+            const uint8_t* sb = lv_font_get_glyph_bitmap(f.subset, cp);
+            TEST_ASSERT_NOT_NULL(sb);
+            const std::vector<uint8_t> sub = unpack(sb, n, s.bpp);
+            const std::vector<uint8_t> full = unpack(lv_font_get_glyph_bitmap(f.full, cp), n, g.bpp);
+            for (uint32_t i = 0; i < n; i++) {
+                if (sub[i] != requantize(full[i], g.bpp, s.bpp)) {
+                    printf("size %d U+%04X px %u\n", f.size, (unsigned)cp, (unsigned)i);
+                    TEST_FAIL_MESSAGE("bitmap differs");
+                }
+            }
+        }
+    }
+}
+
+void test_missing_glyphs_use_fallback() {
+    for (const FontPair& f : fonts) {
+        const std::vector<uint32_t> cps = codePoints(f.subset);
+        uint32_t missing = 0;
+        for (uint32_t cp = 0x21; cp < 0x7F; cp++) {
+            bool kept = false;
+            for (uint32_t k : cps) kept |= k == cp;
+            if (kept) continue;
+            missing++;
+            lv_font_glyph_dsc_t d;
+            TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(f.subset, &d, cp, 0));
+            TEST_ASSERT_TRUE(d.resolved_font == &lv_font_montserrat_16);
+        }
+        // The 18 px font keeps all of ASCII, the others only what the UI shows
+        if (f.size != 18) TEST_ASSERT_TRUE(missing > 0);
+    }
+}
+
+// One label on the test display: the font and text, everything else at the theme defaults
+struct Label {
+    lv_obj_t* obj;
+    Label(const lv_font_t* font, const char* text) {
+        obj = lv_label_create(lv_scr_act());
+        lv_obj_set_style_text_font(obj, font, 0);
+        lv_label_set_text(obj, text);
+        lv_obj_set_pos(obj, 4, 4);
+        lv_refr_now(disp);
+    }
+    ~Label() {
+        lv_obj_del(obj);
+        lv_refr_now(disp);
+    }
+    void redraw() {
+        lv_obj_invalidate(obj);
+        lv_refr_now(disp);
+    }
+};
+
+void test_labels_render_like_full_font() {
+    lv_draw_sw_glyph_cache_set_size(0);
+    for (const FontPair& f : fonts) {
+        if (f.subset->dsc && ((const lv_font_fmt_txt_dsc_t*)f.subset->dsc)->bpp !=
+                                 ((const lv_font_fmt_txt_dsc_t*)f.full->dsc)->bpp) {
+            continue;   // Requantized: compared glyph by glyph above
+        }
+        std::vector<uint16_t> full;
+        {
+            Label l(f.full, f.label);
+            full = fb;
+        }
+        Label l(f.subset, f.label);
+        TEST_ASSERT_TRUE(full == fb);
+    }
+    lv_draw_sw_glyph_cache_set_size(LV_DRAW_SW_GLYPH_CACHE_SIZE);
+}
+
+static double nsPerLookup(const lv_font_t* font, const char* text) {
+    std::vector<uint32_t> letters;
+    for (uint32_t i = 0; text[i];) letters.push_back(_lv_txt_encoded_next(text, &i));
+    const uint32_t reps = 20000;
+    volatile uintptr_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < reps; r++) {
+        for (size_t i = 0; i < letters.size(); i++) {
+            lv_font_glyph_dsc_t d;
+            lv_font_get_glyph_dsc(font, &d, letters[i], i + 1 < letters.size() ? letters[i + 1] : 0);
+            sink = sink + (uintptr_t)lv_font_get_glyph_bitmap(font, letters[i]);
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count();
+    return ns / ((double)reps * letters.size());
+}
+
+static double usPerLabel(const lv_font_t* font, const char* text) {
+    Label l(font, text);
+    const uint32_t reps = 300;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t r = 0; r < reps; r++) l.redraw();
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - t0).count() / reps;
+}
+
+void test_benchmark_subset_vs_full() {
+    lv_draw_sw_glyph_cache_set_size(0);   // Every redraw looks up and decodes every glyph
+    printf("[FONT] %-4s %-4s %8s %8s %8s %8s %8s %8s %8s %8s\n", "size", "bpp", "flash", "full", "ns/gl", "full",
+           "us/lbl", "full", "ratio", "cached");
+    uint32_t bytes = 0, fullBytes = 0;
+    for (const FontPair& f : fonts) {
+        const lv_font_fmt_txt_dsc_t* dsc = (const lv_font_fmt_txt_dsc_t*)f.subset->dsc;
+        const double lookup = nsPerLookup(f.subset, f.label);
+        const double lookupFull = nsPerLookup(f.full, f.label);
+        const double render = usPerLabel(f.subset, f.label);
+        const double renderFull = usPerLabel(f.full, f.label);
+        lv_draw_sw_glyph_cache_set_size(LV_DRAW_SW_GLYPH_CACHE_SIZE);   // What the UI redraws with
+        const double cached = usPerLabel(f.subset, f.label);
+        lv_draw_sw_glyph_cache_set_size(0);
+        printf("[FONT] %-4d %-3d%s %8u %8u %8.0f %8.0f %8.1f %8.1f %7.2fx %8.1f  \"%s\"\n", f.size, dsc->bpp,
+               dsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN ? " " : "c", (unsigned)f.bytes, (unsigned)f.fullBytes,
+               lookup, lookupFull, render, renderFull, render / renderFull, cached, f.label);
+        bytes += f.bytes;
+        fullBytes += f.fullBytes;
+        TEST_ASSERT_TRUE(f.bytes < f.fullBytes);
+    }
+    printf("[FONT] flash %u of %u bytes (%.1f%%)\n", (unsigned)bytes, (unsigned)fullBytes, 100.0 * bytes / fullBytes);
+    // The temperature readout is the label redrawn most: kept plain so its uncached draws skip the RLE decode
+    TEST_ASSERT_EQUAL(LV_FONT_FMT_TXT_PLAIN, ((const lv_font_fmt_txt_dsc_t*)ui_font_montserrat_48.dsc)->bitmap_format);
+    lv_draw_sw_glyph_cache_set_size(LV_DRAW_SW_GLYPH_CACHE_SIZE);
+}
+
+int main() {
+    lv_init();
+    lv_disp_draw_buf_init(&drawBuf, dispBuf, nullptr, DISP_W * DISP_H);
+    lv_disp_drv_init(&dispDrv);
+    dispDrv.hor_res = DISP_W;
+    dispDrv.ver_res = DISP_H;
+    dispDrv.draw_buf = &drawBuf;
+    dispDrv.flush_cb = flushCopy;
+    disp = lv_disp_drv_register(&dispDrv);
+    UNITY_BEGIN();
+    RUN_TEST(test_metrics_and_kerning_match_full_font);
+    RUN_TEST(test_bitmaps_match_requantized_full_font);
+    RUN_TEST(test_missing_glyphs_use_fallback);
+    RUN_TEST(test_labels_render_like_full_font);
+    RUN_TEST(test_benchmark_subset_vs_full);
+    return UNITY_END();
+}
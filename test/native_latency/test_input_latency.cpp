@@ -0,0 +1,117 @@
+// Touch-to-photon trace (include/display/input_latency.h): stage order, one trace in flight,
+// unanswered reports, matching the flush to the refresh that drew the area, stale traces, histogram
+// percentiles; ns per traced report.
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "display/input_latency.h"
+
+static TouchFrame report(uint32_t irqUs, uint32_t readUs, uint8_t points = 1) {
+    TouchFrame f {};
+    f.us = irqUs;
+    f.readUs = readUs;
+    f.count = points;
+    return f;
+}
+
+// One report through every stage, each `stepUs` after the previous, drawn by refresh `frame`
+static void traceOne(InputLatencyTrace& t, uint32_t irqUs, uint32_t stepUs, uint32_t frame) {
+    t.delivered(report(irqUs, irqUs + stepUs), irqUs + 2 * stepUs);
+    t.dispatched(irqUs + 3 * stepUs);
+    t.invalidated(irqUs + 4 * stepUs, frame);
+    t.flushed(frame, irqUs + 5 * stepUs);
+}
+
+void test_stages_are_delays_from_irq() {
+    InputLatencyTrace t;
+    TEST_ASSERT_NULL(t.last());
+    t.delivered(report(1000, 1400), 9000);
+    TEST_ASSERT_TRUE(t.awaitingDispatch());
+    t.dispatched(9100);
+    t.dispatched(9500);   // Later events of the same report
+    TEST_ASSERT_TRUE(t.awaitingInvalidation());
+    t.invalidated(9300, 7);
+    t.flushed(6, 20000);   // Earlier refresh: not the frame with the area
+    TEST_ASSERT_EQUAL_UINT32(0, t.completed());
+    t.flushed(7, 31000);
+    TEST_ASSERT_EQUAL_UINT32(1, t.completed());
+    const LatencySample* s = t.last();
+    TEST_ASSERT_EQUAL_UINT32(400, s->stageUs[LAT_READ]);
+    TEST_ASSERT_EQUAL_UINT32(8000, s->stageUs[LAT_INDEV]);
+    TEST_ASSERT_EQUAL_UINT32(8100, s->stageUs[LAT_DISPATCH]);
+    TEST_ASSERT_EQUAL_UINT32(8300, s->stageUs[LAT_INVALIDATE]);
+    TEST_ASSERT_EQUAL_UINT32(30000, s->stageUs[LAT_PHOTON]);
+    t.flushed(8, 40000);   // Nothing in flight
+    TEST_ASSERT_EQUAL_UINT32(1, t.completed());
+}
+
+void test_unanswered_and_sampling() {
+    InputLatencyTrace t;
+    // No event sent (touch on empty space), then an event but no redraw
+    t.delivered(report(0, 100), 200);
+    t.delivered(report(8000, 8100), 8200);
+    t.dispatched(8300);
+    t.delivered(report(16000, 16100), 16200);
+    TEST_ASSERT_EQUAL_UINT32(2, t.unanswered());
+    // Waiting for its frame: later reports are not traced
+    t.dispatched(16300);
+    t.invalidated(16400, 3);
+    t.delivered(report(24000, 24100, 0), 24200);
+    t.flushed(3, 30000);
+    TEST_ASSERT_EQUAL_UINT32(1, t.completed());
+    TEST_ASSERT_EQUAL_UINT32(16000, t.last()->irqUs);
+    TEST_ASSERT_EQUAL_UINT32(2, t.unanswered());
+}
+
+void test_stale_trace_is_dropped() {
+    InputLatencyTrace t;
+    t.delivered(report(0, 0), 0);
+    t.dispatched(10);
+    t.invalidated(20, 5);   // Its frame never reports back
+    t.delivered(report(InputLatencyTrace::STALE_US, InputLatencyTrace::STALE_US), InputLatencyTrace::STALE_US + 10);
+    TEST_ASSERT_EQUAL_UINT32(1, t.unanswered());
+    TEST_ASSERT_TRUE(t.awaitingDispatch());
+}
+
+void test_histogram_percentiles() {
+    InputLatencyTrace t;
+    // 90 traces at 12 ms to photon, 9 at 45 ms, 1 at 180 ms
+    uint32_t irq = 0, frame = 1;
+    for (int i = 0; i < 100; i++, irq += 300000, frame++) {
+        uint32_t photon = i < 90 ? 12000 : (i < 99 ? 45000 : 180000);
+        traceOne(t, irq, photon / 5, frame);
+    }
+    TEST_ASSERT_EQUAL_UINT32(100, t.completed());
+    TEST_ASSERT_EQUAL_UINT32(1, t.overTarget());
+    TEST_ASSERT_EQUAL_UINT32(16000, t.percentileUs(LAT_PHOTON, 50));
+    TEST_ASSERT_EQUAL_UINT32(16000, t.percentileUs(LAT_PHOTON, 90));
+    TEST_ASSERT_EQUAL_UINT32(50000, t.percentileUs(LAT_PHOTON, 99));   // Upper edge of the 40..50 ms bin
+    TEST_ASSERT_EQUAL_UINT32(180000, t.percentileUs(LAT_PHOTON, 100));   // Open-ended bin: the max seen
+    TEST_ASSERT_EQUAL_UINT32(180000, t.maxUs(LAT_PHOTON));
+    uint32_t total = 0;
+    for (uint8_t b = 0; b < InputLatencyTrace::BINS; b++) total += t.binCount(LAT_PHOTON, b);
+    TEST_ASSERT_EQUAL_UINT32(100, total);
+    TEST_ASSERT_EQUAL_UINT32(1, t.binCount(LAT_PHOTON, InputLatencyTrace::BINS - 1));
+    t.clear();
+    TEST_ASSERT_EQUAL_UINT32(0, t.percentileUs(LAT_PHOTON, 50));
+}
+
+void test_benchmark_trace_cost() {
+    InputLatencyTrace t;
+    const uint32_t n = 1000000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < n; i++) traceOne(t, i * 100, 3 + (i & 15), i + 1);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / n;
+    TEST_ASSERT_EQUAL_UINT32(n, t.completed());
+    printf("[LATENCY] %.1f ns per traced report (5 hooks + histogram update)\n", ns);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_stages_are_delays_from_irq);
+    RUN_TEST(test_unanswered_and_sampling);
+    RUN_TEST(test_stale_trace_is_dropped);
+    RUN_TEST(test_histogram_percentiles);
+    RUN_TEST(test_benchmark_trace_cost);
+    return UNITY_END();
+}
@@ -0,0 +1,179 @@
+// Display power state machine (include/display/display_power.h): idle transitions and their
+// deadlines, gamma-corrected fades without blocking, turning around a fade-out on wake, render
+// suspension; backlight energy over a simulated shift against an always-on screen.
+#include <unity.h>
+#include <stdio.h>
+#include "display/display_power.h"
+
+static const uint16_t MAX_DUTY = 255;
+
+static PowerConfig config() {
+    PowerConfig c {};
+    c.dimAfterMs = 60000;
+    c.offAfterMs = 300000;
+    c.activePct = 100;
+    c.dimPct = 20;
+    c.fadeMs = 400;
+    return c;
+}
+
+// Calls service() at the deadlines it asks for until `untilMs`
+static void runUntil(DisplayPower& p, uint32_t& nowMs, uint32_t untilMs) {
+    while (nowMs < untilMs) {
+        uint32_t due = p.service(nowMs);
+        if (due == DisplayPower::NO_DEADLINE || nowMs + due > untilMs) break;
+        nowMs += due;
+    }
+    nowMs = untilMs;
+    p.service(nowMs);
+}
+
+void test_idle_transitions_and_deadlines() {
+    DisplayPower p;
+    p.begin(config(), MAX_DUTY, 1000);
+    TEST_ASSERT_EQUAL(POWER_ACTIVE, p.state());
+    TEST_ASSERT_EQUAL_UINT16(MAX_DUTY, p.duty());
+    TEST_ASSERT_EQUAL_UINT32(60000, p.service(1000));   // Sleeps until the dim deadline
+    TEST_ASSERT_EQUAL_UINT32(50000, p.service(11000));
+
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_FADE_STEP_MS, p.service(61000));
+    TEST_ASSERT_EQUAL(POWER_DIMMED, p.state());
+    TEST_ASSERT_TRUE(p.fading());
+    uint32_t now = 61000;
+    runUntil(p, now, 62000);
+    TEST_ASSERT_FALSE(p.fading());
+    TEST_ASSERT_EQUAL_UINT16(200, p.level());
+    TEST_ASSERT_EQUAL_UINT32(300000 - 61000, p.service(62000));   // Next: off
+
+    runUntil(p, now, 301000);
+    TEST_ASSERT_EQUAL(POWER_OFF, p.state());
+    TEST_ASSERT_FALSE(p.renderSuspended());   // Still fading out: LVGL keeps running
+    runUntil(p, now, 302000);
+    TEST_ASSERT_TRUE(p.renderSuspended());
+    TEST_ASSERT_EQUAL_UINT16(0, p.duty());
+    TEST_ASSERT_EQUAL_UINT32(DisplayPower::NO_DEADLINE, p.service(400000));
+}
+
+void test_activity_resets_idle() {
+    DisplayPower p;
+    p.begin(config(), MAX_DUTY, 0);
+    TEST_ASSERT_FALSE(p.activity(50000));   // Was not dark
+    TEST_ASSERT_EQUAL_UINT32(60000, p.service(50000));
+    p.service(100000);
+    TEST_ASSERT_EQUAL(POWER_ACTIVE, p.state());
+    p.service(110000);
+    TEST_ASSERT_EQUAL(POWER_DIMMED, p.state());
+    // A touch while dimmed brightens without being swallowed
+    TEST_ASSERT_FALSE(p.activity(120000));
+    TEST_ASSERT_EQUAL(POWER_ACTIVE, p.state());
+    TEST_ASSERT_EQUAL_UINT32(0, p.wakes());
+}
+
+void test_fade_is_gamma_corrected_and_monotonic() {
+    DisplayPower p;
+    PowerConfig c = config();
+    p.begin(c, MAX_DUTY, 0);
+    p.sleep(0);
+    uint16_t lastLevel = p.level(), lastDuty = p.duty();
+    uint32_t steps = 0;
+    for (uint32_t t = 0; p.fading(); t += DISPLAY_FADE_STEP_MS, steps++) {
+        p.service(t);
+        TEST_ASSERT_TRUE(p.level() <= lastLevel);
+        TEST_ASSERT_TRUE(p.duty() <= lastDuty);
+        lastLevel = p.level();
+        lastDuty = p.duty();
+    }
+    TEST_ASSERT_EQUAL_UINT32((c.fadeMs + DISPLAY_FADE_STEP_MS - 1) / DISPLAY_FADE_STEP_MS + 1, steps);
+    // Half perceived brightness is well under half duty
+    TEST_ASSERT_EQUAL_UINT16(55, p.dutyFor(500));
+    TEST_ASSERT_EQUAL_UINT16(1, p.dutyFor(1));   // Lowest step stays on
+    TEST_ASSERT_EQUAL_UINT16(0, p.dutyFor(0));
+    TEST_ASSERT_EQUAL_UINT16(MAX_DUTY, p.dutyFor(1000));
+}
+
+void test_wake_during_fade_out_turns_around() {
+    DisplayPower p;
+    p.begin(config(), MAX_DUTY, 0);
+    p.sleep(1000);
+    p.service(1200);   // Half way down
+    TEST_ASSERT_EQUAL_UINT16(500, p.level());
+    TEST_ASSERT_TRUE(p.activity(1200));   // Still counts as dark: the touch is swallowed
+    TEST_ASSERT_EQUAL_UINT32(1, p.wakes());
+    p.service(1200);
+    TEST_ASSERT_EQUAL_UINT16(500, p.level());   // No jump
+    p.service(1300);
+    TEST_ASSERT_EQUAL_UINT16(750, p.level());   // Back up at the same rate
+    p.service(1400);
+    TEST_ASSERT_FALSE(p.fading());
+    TEST_ASSERT_EQUAL_UINT16(1000, p.level());
+}
+
+void test_suspended_until_activity() {
+    DisplayPower p;
+    p.begin(config(), MAX_DUTY, 0);
+    p.sleep(0);
+    p.service(1000);
+    TEST_ASSERT_TRUE(p.renderSuspended());
+    TEST_ASSERT_TRUE(p.activity(5000));
+    TEST_ASSERT_FALSE(p.renderSuspended());
+    TEST_ASSERT_EQUAL(POWER_ACTIVE, p.state());
+    TEST_ASSERT_EQUAL_UINT32(5000, p.stateSinceMs());
+    // Idle timers restart from the wake
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_FADE_STEP_MS, p.service(5000));
+    p.service(6000);
+    TEST_ASSERT_EQUAL_UINT32(59000, p.service(6000));
+}
+
+void test_set_active_level_and_disabled_timers() {
+    DisplayPower p;
+    PowerConfig c = config();
+    c.dimAfterMs = c.offAfterMs = 0;   // ENABLE_DISPLAY_POWER off: fades only
+    p.begin(c, MAX_DUTY, 0);
+    TEST_ASSERT_EQUAL_UINT32(DisplayPower::NO_DEADLINE, p.service(0));
+    p.setActiveLevel(50, 0);
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_FADE_STEP_MS, p.service(0));
+    p.service(200);   // 50 % of a full swing takes half of fadeMs
+    TEST_ASSERT_FALSE(p.fading());
+    TEST_ASSERT_EQUAL_UINT16(500, p.level());
+    p.service(10000000);
+    TEST_ASSERT_EQUAL(POWER_ACTIVE, p.state());
+    p.setActiveLevel(150, 0);
+    TEST_ASSERT_EQUAL_UINT8(100, p.config().activePct);
+}
+
+// 8 h shift, one interaction every 20 min: time the render loop is suspended, backlight energy
+// (duty-seconds) against a screen left at full brightness, and service() calls it took
+void test_benchmark_shift() {
+    DisplayPower p;
+    p.begin(config(), MAX_DUTY, 0);
+    const uint32_t shiftMs = 8UL * 3600 * 1000, stepMs = 100;
+    uint64_t dutyMs = 0;
+    uint32_t suspendedMs = 0, calls = 0, next = 0;
+    for (uint32_t t = 0; t < shiftMs; t += stepMs) {
+        if (t % (20UL * 60 * 1000) == 0) p.activity(t);
+        if (t >= next) {
+            uint32_t due = p.service(t);
+            calls++;
+            next = t + (due < 1000 ? due : 1000);   // PERIOD_LVGL_MAX_SLEEP cap of the LVGL task
+        }
+        dutyMs += (uint64_t)p.duty() * stepMs;
+        if (p.renderSuspended()) suspendedMs += stepMs;
+    }
+    const double energy = (double)dutyMs / ((double)MAX_DUTY * shiftMs);
+    TEST_ASSERT_TRUE(energy < 0.1);
+    TEST_ASSERT_TRUE(suspendedMs > shiftMs / 2);
+    printf("[POWER] 8 h shift: backlight energy %.1f%% of always-on, LVGL suspended %.1f%% of the time, %lu service() calls\n",
+           energy * 100.0, suspendedMs * 100.0 / shiftMs, (unsigned long)calls);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_transitions_and_deadlines);
+    RUN_TEST(test_activity_resets_idle);
+    RUN_TEST(test_fade_is_gamma_corrected_and_monotonic);
+    RUN_TEST(test_wake_during_fade_out_turns_around);
+    RUN_TEST(test_suspended_until_activity);
+    RUN_TEST(test_set_active_level_and_disabled_timers);
+    RUN_TEST(test_benchmark_shift);
+    return UNITY_END();
+}
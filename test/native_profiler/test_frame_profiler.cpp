@@ -0,0 +1,106 @@
+// Per-frame render profile (include/display/frame_profiler.h): ring order and wraparound, nearest-rank
+// percentiles per stage, and the cost of recording a frame and of one percentile query on a full ring.
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "display/frame_profiler.h"
+
+static FrameSample frame(uint32_t seq, uint32_t renderUs, uint32_t flushUs, uint32_t waitUs, uint32_t px) {
+    FrameSample s{};
+    s.seq = seq;
+    s.pixels = px;
+    s.renderUs = renderUs;
+    s.flushUs = flushUs;
+    s.waitUs = waitUs;
+    s.totalUs = renderUs + waitUs;
+    s.flushes = 1;
+    return s;
+}
+
+void test_empty_profile() {
+    FrameProfiler p;
+    TEST_ASSERT_EQUAL_UINT16(0, p.count());
+    TEST_ASSERT_NULL(p.latest());
+    FramePercentiles q = p.percentiles(FRAME_RENDER);
+    TEST_ASSERT_EQUAL_UINT32(0, q.p50);
+    TEST_ASSERT_EQUAL_UINT32(0, q.max);
+}
+
+void test_ring_keeps_newest_frames_in_order() {
+    FrameProfiler p;
+    const uint32_t n = FrameProfiler::CAPACITY + 37;
+    for (uint32_t i = 1; i <= n; i++) p.record(frame(i, i, 0, 0, 0));
+    TEST_ASSERT_EQUAL_UINT16(FrameProfiler::CAPACITY, p.count());
+    TEST_ASSERT_EQUAL_UINT32(n, p.recorded());
+    TEST_ASSERT_EQUAL_UINT32(n - FrameProfiler::CAPACITY + 1, p.at(0).seq);
+    for (uint16_t i = 1; i < p.count(); i++) TEST_ASSERT_EQUAL_UINT32(p.at(i - 1).seq + 1, p.at(i).seq);
+    TEST_ASSERT_EQUAL_UINT32(n, p.latest()->seq);
+    p.clear();
+    TEST_ASSERT_EQUAL_UINT16(0, p.count());
+}
+
+void test_percentiles_per_stage() {
+    FrameProfiler p;
+    // 100 frames: render 1..100 ms, bus steady at 4 ms except two slow transfers
+    for (uint32_t i = 1; i <= 100; i++) {
+        uint32_t flush = (i == 40 || i == 80) ? 25000 : 4000;
+        p.record(frame(i, i * 1000, flush, flush / 4, i * 800));
+    }
+    FramePercentiles r = p.percentiles(FRAME_RENDER);
+    TEST_ASSERT_EQUAL_UINT32(50000, r.p50);
+    TEST_ASSERT_EQUAL_UINT32(90000, r.p90);
+    TEST_ASSERT_EQUAL_UINT32(99000, r.p99);
+    TEST_ASSERT_EQUAL_UINT32(100000, r.max);
+
+    FramePercentiles f = p.percentiles(FRAME_FLUSH);
+    TEST_ASSERT_EQUAL_UINT32(4000, f.p50);
+    TEST_ASSERT_EQUAL_UINT32(4000, f.p90);
+    TEST_ASSERT_EQUAL_UINT32(25000, f.p99);     // The slow bus frames show up in the tail only
+    TEST_ASSERT_EQUAL_UINT32(25000, f.max);
+
+    TEST_ASSERT_EQUAL_UINT32(40000, p.percentiles(FRAME_PIXELS).p50);
+    TEST_ASSERT_EQUAL_UINT32(1000, p.percentiles(FRAME_WAIT).p50);
+    // Queries reorder a scratch copy only; the ring keeps arrival order
+    TEST_ASSERT_EQUAL_UINT32(1, p.at(0).seq);
+    TEST_ASSERT_EQUAL_UINT32(100, p.latest()->seq);
+}
+
+void test_single_frame_percentiles() {
+    FrameProfiler p;
+    p.record(frame(7, 1234, 0, 0, 0));
+    FramePercentiles r = p.percentiles(FRAME_TOTAL);
+    TEST_ASSERT_EQUAL_UINT32(1234, r.p50);
+    TEST_ASSERT_EQUAL_UINT32(1234, r.p99);
+    TEST_ASSERT_EQUAL_UINT32(1234, r.max);
+}
+
+void test_benchmark_record_and_query() {
+    static FrameProfiler p;
+    const uint32_t frames = 1000000;
+    uint32_t x = 12345;
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < frames; i++) {
+        x = x * 1664525u + 1013904223u;
+        p.record(frame(i, x >> 16, x & 0xFFFF, x >> 24, x >> 12));
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    const int queries = 2000;
+    uint32_t sink = 0;
+    for (int i = 0; i < queries; i++) sink += p.percentiles((FrameField)(i % 5)).p99;
+    auto t2 = std::chrono::steady_clock::now();
+    double recordNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / frames;
+    double queryUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / queries;
+    printf("[FRAMEPROF] record %.1f ns/frame, percentiles over %u frames %.2f us/query (%u)\n",
+           recordNs, (unsigned)FrameProfiler::CAPACITY, queryUs, (unsigned)(sink & 1));
+    TEST_ASSERT_TRUE(recordNs < 1000.0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_profile);
+    RUN_TEST(test_ring_keeps_newest_frames_in_order);
+    RUN_TEST(test_percentiles_per_stage);
+    RUN_TEST(test_single_frame_percentiles);
+    RUN_TEST(test_benchmark_record_and_query);
+    return UNITY_END();
+}
@@ -0,0 +1,211 @@
+// Sensor registry: ROM lookup, zones, variable-width output, and a scaling benchmark that scans and
+// updates 8..64 probes spread over four mock 1-Wire buses.
+#include <unity.h>
+#include <chrono>
+#include <memory>
+#include <stdio.h>
+#include "sensors/sensor_registry.h"
+#include "../src/sensors/sensor_registry.cpp"
+#include "sensors/ds18b20_pipeline.h"
+#include "test_support/mock_onewire.h"
+
+static const uint8_t BUSES = 4;
+typedef MockOneWireBus<MAX_PROBES_PER_BUS> Bus;
+typedef Ds18b20Pipeline<Bus, MAX_PROBES_PER_BUS> Pipeline;
+struct BusRig {
+    Bus bus;
+    Pipeline pipe {bus};
+};
+
+static void makeRom(uint16_t id, uint8_t rom[SENSOR_ROM_LEN]) {
+    rom[0] = 0x28;
+    for (uint8_t i = 1; i < 7; i++) rom[i] = (uint8_t)((id * 37 + i * 11) ^ (id >> 3));
+    rom[6] = (uint8_t)id;   // Keep every id unique
+    rom[7] = ds18b20::crc8(rom, 7);
+}
+
+// Registry bookkeeping only: readings pass through unfiltered and are valid at once (native_filter
+// covers the filter stage and its priming)
+static void passthrough(SensorRegistry& r) {
+    for (uint8_t z = 0; z < MAX_SENSOR_ZONES; z++) r.setZoneFilter(z, {1, 1.0f, 0.0f});
+}
+
+void test_lookup_zones_and_duplicates() {
+    SensorRegistry r;
+    passthrough(r);
+    uint8_t rom[SENSOR_ROM_LEN];
+    for (uint16_t i = 0; i < 10; i++) {
+        makeRom(i, rom);
+        TEST_ASSERT_EQUAL_UINT16(i, r.add(rom, i % 2, i < 4 ? 0 : 1));
+    }
+    makeRom(3, rom);
+    TEST_ASSERT_EQUAL_UINT16(3, r.add(rom, 1, 5));   // Known ROM: same index, no re-registration
+    TEST_ASSERT_EQUAL_UINT16(10, r.count());
+    TEST_ASSERT_EQUAL_UINT16(3, r.find(rom));
+    TEST_ASSERT_EQUAL_UINT8(0, r.zone(3));
+    makeRom(99, rom);
+    TEST_ASSERT_EQUAL_UINT16(SensorRegistry::NOT_FOUND, r.find(rom));
+
+    for (uint16_t i = 0; i < 10; i++) r.setReading(i, -20.0f + i, 1000);
+    SensorData z[MAX_SENSORS];
+    TEST_ASSERT_EQUAL_UINT8(4, r.collectZone(0, z, MAX_SENSORS));
+    TEST_ASSERT_EQUAL_FLOAT(-17.0f, z[3].temperature);
+    TEST_ASSERT_TRUE(z[3].valid);
+    TEST_ASSERT_EQUAL_UINT8(MAX_SENSORS, r.collectZone(1, z, MAX_SENSORS));   // Capped at max
+    uint32_t layout = r.layoutVersion();
+    TEST_ASSERT_TRUE(r.setZone(9, 2));
+    TEST_ASSERT_TRUE(r.layoutVersion() != layout);
+    TEST_ASSERT_EQUAL_UINT16(1, r.zoneCount(2));
+
+    // Readings expire only after SENSOR_TIMEOUT without a good value
+    r.markFailed(0, 1000 + SENSOR_TIMEOUT);
+    TEST_ASSERT_TRUE(r.valid(0));
+    r.markFailed(0, 1001 + SENSOR_TIMEOUT);
+    TEST_ASSERT_FALSE(r.valid(0));
+}
+
+void test_capacity_limit() {
+    SensorRegistry r;
+    uint8_t rom[SENSOR_ROM_LEN];
+    for (uint16_t i = 0; i < SensorRegistry::CAPACITY; i++) {
+        makeRom(i, rom);
+        TEST_ASSERT_TRUE(r.add(rom, 0, 0) != SensorRegistry::NOT_FOUND);
+    }
+    makeRom(SensorRegistry::CAPACITY, rom);
+    TEST_ASSERT_EQUAL_UINT16(SensorRegistry::NOT_FOUND, r.add(rom, 0, 0));
+    for (uint16_t i = 0; i < SensorRegistry::CAPACITY; i++) {
+        makeRom(i, rom);
+        TEST_ASSERT_EQUAL_UINT16(i, r.find(rom));
+    }
+}
+
+void test_variable_width_output() {
+    SensorRegistry r;
+    passthrough(r);
+    uint8_t rom[SENSOR_ROM_LEN];
+    for (uint16_t i = 0; i < 3; i++) { makeRom(i, rom); r.add(rom, 0, (uint8_t)i); }
+    r.setReading(0, -18.5f, 10);
+    r.setReading(2, 3.25f, 10);
+    char buf[256];
+    size_t n = r.formatLogHeader(buf, sizeof(buf));
+    TEST_ASSERT_EQUAL_size_t(3 * 18 + 2, n);
+    TEST_ASSERT_EQUAL_INT(0, strncmp(buf, "t_28", 4));
+    TEST_ASSERT_EQUAL_STRING("-18.50,,3.25", (r.formatLogValues(buf, sizeof(buf)), buf));
+    // Cut on a whole column: room for one value only
+    TEST_ASSERT_EQUAL_size_t(6, r.formatLogValues(buf, 7));
+    TEST_ASSERT_EQUAL_STRING("-18.50", buf);
+    r.formatZoneList(buf, sizeof(buf), 2);
+    TEST_ASSERT_NOT_NULL(strstr(buf, "Z2"));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "3.2"));
+    TEST_ASSERT_NULL(strchr(buf, '\n'));
+    r.formatZoneList(buf, sizeof(buf));
+    TEST_ASSERT_NOT_NULL(strstr(buf, "--.-"));
+}
+
+struct ScaleResult {
+    double scanNsPerProbe;
+    double updateNsPerProbe;
+    double lookupNs;
+    double probesPerLookup;
+    uint64_t busUsPerCycle;   // Worst bus, deterministic wire time
+};
+
+static double nsSince(std::chrono::steady_clock::time_point t0) {
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - t0).count();
+}
+
+// Scan (registry + pipeline registration) and steady-state update cycles for n probes on 4 buses
+static ScaleResult runScale(uint16_t n) {
+    static SensorRegistry reg;
+    ScaleResult res{};
+    const int REPS = 50;
+    double scanNs = 0, updateNs = 0, lookupNs = 0;
+    uint64_t busUs = 0;
+    char line[96 + MAX_REGISTRY_SENSORS * 20];
+
+    for (int rep = 0; rep < REPS; rep++) {
+        std::unique_ptr<BusRig> rig[BUSES];
+        for (uint8_t b = 0; b < BUSES; b++) rig[b].reset(new BusRig());
+        for (uint16_t i = 0; i < n; i++) rig[i % BUSES]->bus.addProbe((uint8_t)i, 12, -18.0f + (i % 7) * 0.25f);
+        uint16_t idx[BUSES][MAX_PROBES_PER_BUS];
+
+        auto t0 = std::chrono::steady_clock::now();
+        reg.clear();
+        for (uint8_t b = 0; b < BUSES; b++) {
+            for (uint8_t i = 0; i < rig[b]->bus.count; i++) {
+                rig[b]->pipe.add(rig[b]->bus.dev[i].rom, 12);
+                idx[b][i] = reg.add(rig[b]->bus.dev[i].rom, b, b);
+            }
+        }
+        scanNs += nsSince(t0);
+
+        // Conversion timing is the probes' business; measure the host work of a full cycle
+        const int CYCLES = 5;
+        uint64_t busBefore[BUSES];
+        for (uint8_t b = 0; b < BUSES; b++) busBefore[b] = rig[b]->bus.blockedUs;
+        t0 = std::chrono::steady_clock::now();
+        for (int c = 0; c < CYCLES; c++) {
+            uint32_t now = 1000u * (c + 1);
+            for (uint8_t b = 0; b < BUSES; b++) {
+                rig[b]->pipe.service(now);                                       // Convert T
+                uint32_t ready = now + ds18b20::conversionMs(12);
+                rig[b]->bus.advanceMs(ds18b20::conversionMs(12));                   // Read converted values, not +85 C
+                while (rig[b]->pipe.converting()) rig[b]->pipe.service(ready);       // Collect every probe
+                rig[b]->pipe.takeCycle();
+                for (uint8_t i = 0; i < rig[b]->pipe.count(); i++) {
+                    const Ds18b20Channel& ch = rig[b]->pipe.channel(i);
+                    if (ch.ok) reg.setReading(idx[b][i], ch.tempC, ready);
+                    else reg.markFailed(idx[b][i], ready);
+                }
+            }
+            reg.formatLogValues(line, sizeof(line));
+        }
+        updateNs += nsSince(t0) / CYCLES;
+        for (uint8_t b = 0; b < BUSES; b++) {
+            uint64_t us = (rig[b]->bus.blockedUs - busBefore[b]) / CYCLES;
+            if (us > busUs) busUs = us;
+        }
+
+        uint32_t l0 = reg.lookups(), p0 = reg.probes();
+        t0 = std::chrono::steady_clock::now();
+        volatile uint32_t sink = 0;
+        for (uint8_t b = 0; b < BUSES; b++)
+            for (uint8_t i = 0; i < rig[b]->bus.count; i++) sink += reg.find(rig[b]->bus.dev[i].rom);
+        lookupNs += nsSince(t0) / n;
+        res.probesPerLookup = (double)(reg.probes() - p0) / (reg.lookups() - l0);
+        TEST_ASSERT_EQUAL_UINT16(n, reg.count());
+        TEST_ASSERT_EQUAL_UINT16(n, reg.validCount());
+    }
+    res.scanNsPerProbe = scanNs / REPS / n;
+    res.updateNsPerProbe = updateNs / REPS / n;
+    res.lookupNs = lookupNs / REPS;
+    res.busUsPerCycle = busUs;
+    return res;
+}
+
+void test_scan_and_update_scale_linearly() {
+    const uint16_t sizes[] = {8, 16, 32, 64};
+    ScaleResult r[4];
+    for (int i = 0; i < 4; i++) {
+        r[i] = runScale(sizes[i]);
+        printf("[REGISTRY] %2u probes: scan %.0f ns/probe, cycle %.0f ns/probe, lookup %.0f ns (%.2f slots), "
+               "bus %.1f ms/cycle\n", (unsigned)sizes[i], r[i].scanNsPerProbe, r[i].updateNsPerProbe,
+               r[i].lookupNs, r[i].probesPerLookup, r[i].busUsPerCycle / 1000.0);
+    }
+    // Wire time per bus is exactly Convert T + one scratchpad read per probe
+    const uint64_t readUs = 960 + (1 + 8 + 1 + 9) * 520, convUs = 960 + 2 * 520;
+    for (int i = 0; i < 4; i++) TEST_ASSERT_EQUAL_UINT64(convUs + (sizes[i] / BUSES) * readUs, r[i].busUsPerCycle);
+    // Hash stays O(1) at full capacity; per-probe host cost does not grow with probe count
+    TEST_ASSERT_TRUE(r[3].probesPerLookup < 1.5);
+    TEST_ASSERT_TRUE(r[3].updateNsPerProbe < r[0].updateNsPerProbe * 3.0);
+    TEST_ASSERT_TRUE(r[3].scanNsPerProbe < r[0].scanNsPerProbe * 3.0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_lookup_zones_and_duplicates);
+    RUN_TEST(test_capacity_limit);
+    RUN_TEST(test_variable_width_output);
+    RUN_TEST(test_scan_and_update_scale_linearly);
+    return UNITY_END();
+}
@@ -0,0 +1,168 @@
+// Seqlock snapshot publication: one writer thread, several reader threads.
+// Every published record derives all of its fields from a single counter, so a reader that sees
+// fields from two different publishes (a torn read) fails immediately.
+#include <unity.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "rtos/seqlock.h"
+#include "controllers/temperature_controller.h"
+#include "config/config.h"
+#include "types/types.h"
+#include "../src/controllers/temperature_controller.cpp"
+
+static const uint32_t PUBLISHES = 2000000;
+static const int READERS = 3;
+
+static ControlState makeState(uint32_t n) {
+    ControlState s{};
+    s.status = (SystemStatus)(n % 4);
+    s.currentTemp = (float)(n & 0xFFFF);
+    s.averageTemp = s.currentTemp + 0.5f;
+    s.heatingActive = (n & 1) != 0;
+    s.coolingActive = !s.heatingActive;
+    s.defrostActive = (n & 2) != 0;
+    s.fanPWM = (uint8_t)n;
+    s.lastUpdate = n;
+    s.lastDefrost = ~n;
+    s.errorCode = (uint16_t)(n >> 3);
+    s.faultMask = n * 2654435761u;
+    s.alarmActive = s.defrostActive;
+    s.alarmSilenced = !s.defrostActive;
+    s.alarmSince = n + 7;
+    s.alarmSilenceUntil = n ^ 0xA5A5A5A5u;
+    return s;
+}
+
+static bool consistent(const ControlState& s) {
+    uint32_t n = (uint32_t)s.lastUpdate;
+    ControlState e = makeState(n);
+    return s.status == e.status && s.currentTemp == e.currentTemp && s.averageTemp == e.averageTemp &&
+           s.heatingActive == e.heatingActive && s.coolingActive == e.coolingActive &&
+           s.defrostActive == e.defrostActive && s.fanPWM == e.fanPWM &&
+           s.lastDefrost == e.lastDefrost && s.errorCode == e.errorCode && s.faultMask == e.faultMask &&
+           s.alarmActive == e.alarmActive && s.alarmSilenced == e.alarmSilenced &&
+           s.alarmSince == e.alarmSince && s.alarmSilenceUntil == e.alarmSilenceUntil;
+}
+
+static SystemConfig makeConfig(uint32_t n) {
+    SystemConfig c{};
+    c.mode = (SystemMode)(n % 3);
+    c.targetTemp = -(float)(n & 0x3FF);
+    c.tempHysteresis = (float)(n & 7);
+    c.fanSpeed = (uint8_t)(n % 101);
+    c.buzzerEnabled = (n & 1) != 0;
+    c.loggingEnabled = (n & 1) == 0;
+    c.defrostInterval = n;
+    c.defrostDuration = n * 3;
+    c.TargetTemperature = c.targetTemp;
+    c.TemperatureHysteresis = c.tempHysteresis;
+    c.DefrostIntervalMilliseconds = n;
+    c.DefrostDurationMilliseconds = n * 3;
+    return c;
+}
+
+static bool consistent(const SystemConfig& c) {
+    SystemConfig e = makeConfig(c.defrostInterval);
+    return c.mode == e.mode && c.targetTemp == e.targetTemp && c.tempHysteresis == e.tempHysteresis &&
+           c.fanSpeed == e.fanSpeed && c.buzzerEnabled == e.buzzerEnabled &&
+           c.loggingEnabled == e.loggingEnabled && c.defrostDuration == e.defrostDuration &&
+           c.TargetTemperature == e.TargetTemperature && c.TemperatureHysteresis == e.TemperatureHysteresis &&
+           c.DefrostIntervalMilliseconds == e.DefrostIntervalMilliseconds &&
+           c.DefrostDurationMilliseconds == e.DefrostDurationMilliseconds;
+}
+
+template <typename T, typename Make>
+static void stress(Make make, uint32_t& readsOut, uint32_t& tornOut, uint32_t& regressOut) {
+    SeqLock<T> lock(make(0));
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> reads{0}, torn{0}, regress{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < READERS; ++r) {
+        readers.emplace_back([&]() {
+            uint32_t lastSeq = 0, localReads = 0, localTorn = 0, localRegress = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                T v = lock.read();
+                uint32_t seq = lock.sequence();
+                if (!consistent(v)) localTorn++;
+                if (seq < lastSeq) localRegress++;
+                lastSeq = seq;
+                localReads++;
+            }
+            reads += localReads; torn += localTorn; regress += localRegress;
+        });
+    }
+    std::thread writer([&]() {
+        for (uint32_t n = 1; n <= PUBLISHES; ++n) lock.publish(make(n));
+        done = true;
+    });
+    writer.join();
+    for (auto& t : readers) t.join();
+    readsOut = reads; tornOut = torn; regressOut = regress;
+    TEST_ASSERT_EQUAL_UINT32(PUBLISHES + 1, lock.sequence());
+    TEST_ASSERT_TRUE(consistent(lock.read()));
+    printf("[SEQLOCK] %u publishes, %u reads, %u retries, %u torn\n",
+           (unsigned)PUBLISHES, (unsigned)readsOut, (unsigned)lock.retries(), (unsigned)tornOut);
+}
+
+void test_single_thread_roundtrip() {
+    SeqLock<ControlState> lock;
+    TEST_ASSERT_EQUAL_UINT32(1, lock.sequence());
+    lock.publish(makeState(42));
+    ControlState s;
+    TEST_ASSERT_TRUE(lock.tryRead(s));
+    TEST_ASSERT_TRUE(consistent(s));
+    TEST_ASSERT_EQUAL_UINT32(42, s.lastUpdate);
+    TEST_ASSERT_EQUAL_UINT32(2, lock.sequence());
+    TEST_ASSERT_EQUAL_UINT32(0, lock.retries());
+}
+
+void test_control_state_never_torn() {
+    uint32_t reads = 0, torn = 0, regress = 0;
+    stress<ControlState>(makeState, reads, torn, regress);
+    TEST_ASSERT_TRUE(reads > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, torn);
+    TEST_ASSERT_EQUAL_UINT32(0, regress);
+}
+
+void test_system_config_never_torn() {
+    uint32_t reads = 0, torn = 0, regress = 0;
+    stress<SystemConfig>(makeConfig, reads, torn, regress);
+    TEST_ASSERT_TRUE(reads > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, torn);
+    TEST_ASSERT_EQUAL_UINT32(0, regress);
+}
+
+// Controller: getState() is the snapshot of the last completed cycle, and silenceAlarm() only
+// takes effect inside the control cycle (the single writer of ControlState).
+void test_controller_publishes_per_cycle() {
+    __fakeMillis = 0;
+    TemperatureController c; c.init(); c.setTargetTemperature(-10.0f);
+    TEST_ASSERT_EQUAL_FLOAT(-10.0f, c.getConfig().targetTemp);
+    uint32_t seq0 = c.getStateSequence();
+    SensorData s[1] = {};
+    s[0].temperature = 5.0f; s[0].valid = true;
+    for (uint32_t t = 0; t <= FAULT_DEBOUNCE_MS + ALARM_TRIGGER_GRACE_MS + 2 * TEMP_UPDATE_INTERVAL; t += TEMP_UPDATE_INTERVAL) {
+        __fakeMillis += TEMP_UPDATE_INTERVAL;
+        c.runControlCycle(s, 1);
+    }
+    TEST_ASSERT_TRUE(c.getStateSequence() > seq0);
+    TEST_ASSERT_EQUAL_UINT32(__fakeMillis, c.getState().lastUpdate);
+    TEST_ASSERT_TRUE(c.getState().alarmActive);
+
+    c.silenceAlarm();
+    TEST_ASSERT_FALSE(c.getState().alarmSilenced);
+    TEST_ASSERT_EQUAL_UINT32(0, c.msUntilNextDeadline(2000));
+    __fakeMillis += 1;
+    c.runControlCycle(s, 1);
+    TEST_ASSERT_TRUE(c.getState().alarmSilenced);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_single_thread_roundtrip);
+    RUN_TEST(test_control_state_never_torn);
+    RUN_TEST(test_system_config_never_torn);
+    RUN_TEST(test_controller_publishes_per_cycle);
+    return UNITY_END();
+}
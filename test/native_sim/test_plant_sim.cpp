@@ -0,0 +1,67 @@
+// Closed-loop freezer replay: runs the real controller against test_support/freezer_plant.h.
+// Uses production timing constants (min on/off, debounce, defrost) rather than the shortened
+// UNIT_TEST overrides so cycle counts and alarm totals match what a cabinet would see.
+#undef UNIT_TEST
+
+#include <unity.h>
+#include "controllers/temperature_controller.h"
+#include "config/config.h"
+#include "types/types.h"
+#include "../src/controllers/temperature_controller.cpp"
+#include "test_support/freezer_plant.h"
+
+static PlantRunStats replay(uint32_t days, bool eventDriven = false) {
+    __fakeMillis = 0;
+    TemperatureController c;
+    c.init();
+    FreezerPlant plant;
+    PlantReplayOptions opt;
+    opt.days = days;
+    opt.eventDriven = eventDriven;
+    return runPlantReplay(c, plant, opt);
+}
+
+void test_plant_replay_30_days() {
+    PlantRunStats st = replay(30);
+    printPlantReport("polling", st);
+    TEST_ASSERT_EQUAL_UINT64(30ULL * 86400000ULL, st.plantMs);
+    TEST_ASSERT_EQUAL_UINT64(st.plantMs / 250, st.updates);
+    TEST_ASSERT_TRUE(st.compressorCycles > 0);
+    TEST_ASSERT_TRUE(st.shortestCompressorOffMs >= MIN_COMPRESSOR_OFF_TIME_MS);
+    TEST_ASSERT_TRUE(st.shortestCompressorOnMs >= MIN_COMPRESSOR_ON_TIME_MS);
+    TEST_ASSERT_EQUAL_UINT32(0, st.faultEdges[FAULT_COMPRESSOR_SHORT_CYCLE_BIT]); // Held starts are not faults
+    TEST_ASSERT_TRUE(st.defrostCycles >= 100); // 6 h interval over 30 days
+    TEST_ASSERT_TRUE(st.timeInBand() > 0.5);
+    TEST_ASSERT_TRUE(st.maxAirC < TEMP_MAX_SAFE);
+}
+
+void test_event_driven_replay_cuts_wakeups_and_latency() {
+    PlantRunStats poll = replay(30);
+    PlantRunStats ev = replay(30, true);
+    printPlantReport("event-driven", ev);
+    TEST_ASSERT_TRUE(ev.updates * 2 < poll.updates);
+    TEST_ASSERT_TRUE(ev.meanLatencyMs() < poll.meanLatencyMs());
+    TEST_ASSERT_TRUE(ev.shortestCompressorOffMs >= MIN_COMPRESSOR_OFF_TIME_MS);
+    TEST_ASSERT_TRUE(ev.shortestCompressorOnMs >= MIN_COMPRESSOR_ON_TIME_MS);
+    TEST_ASSERT_EQUAL_UINT32(0, ev.faultEdges[FAULT_COMPRESSOR_SHORT_CYCLE_BIT]);
+    TEST_ASSERT_TRUE(ev.timeInBand() > 0.5);
+    TEST_ASSERT_TRUE(ev.defrostCycles >= poll.defrostCycles);
+}
+
+void test_plant_replay_is_deterministic() {
+    PlantRunStats a = replay(2);
+    PlantRunStats b = replay(2);
+    TEST_ASSERT_EQUAL_UINT32(a.compressorCycles, b.compressorCycles);
+    TEST_ASSERT_EQUAL_UINT32(a.alarmCount, b.alarmCount);
+    TEST_ASSERT_EQUAL_UINT64(a.inBandMs, b.inBandMs);
+    TEST_ASSERT_EQUAL_FLOAT(a.minAirC, b.minAirC);
+    TEST_ASSERT_EQUAL_FLOAT(a.maxAirC, b.maxAirC);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_plant_replay_is_deterministic);
+    RUN_TEST(test_plant_replay_30_days);
+    RUN_TEST(test_event_driven_replay_cuts_wakeups_and_latency);
+    return UNITY_END();
+}
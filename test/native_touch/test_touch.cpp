@@ -0,0 +1,315 @@
+// GT911 driver and touch pipeline against the register model in test_support/gt911_sim.h.
+// Checks multi-point decode, the burst/ack sequence, queue order and timestamps, the release poll
+// for a lost IRQ, and compares a drag gesture through the old pattern (LVGL read callback polls the
+// controller itself) with the IRQ-driven touch task: reports delivered, bus time on the LVGL task,
+// and report-to-LVGL latency.
+#include <unity.h>
+#include <stdio.h>
+#include "display/touch_pipeline.h"
+#include "test_support/gt911_sim.h"
+
+typedef GT911T<Gt911Sim> Gt911;
+typedef TouchPipeline<Gt911Sim> Pipeline;
+
+static TouchPoint pt(uint16_t x, uint16_t y, uint8_t id) {
+    TouchPoint p;
+    p.x = x;
+    p.y = y;
+    p.id = id;
+    p.touched = true;
+    return p;
+}
+
+void test_probe_falls_back_to_second_address() {
+    Gt911Sim bus;
+    Gt911 dev;
+    bus.address = GT911_ADDRESS_2;
+    TEST_ASSERT_TRUE(dev.begin(bus));
+    bus.present = false;
+    Gt911 absent;
+    TEST_ASSERT_FALSE(absent.begin(bus));
+    TouchFrame f;
+    TEST_ASSERT_EQUAL(GT911_READ_ERROR, absent.readFrame(f, 0));
+}
+
+void test_multi_point_decode() {
+    Gt911Sim bus;
+    Gt911 dev;
+    TEST_ASSERT_TRUE(dev.begin(bus));
+    const TouchPoint pts[3] = { pt(10, 20, 0), pt(799, 479, 1), pt(400, 240, 7) };
+    bus.report(pts, 3);
+    bus.resetCounters();
+    TouchFrame f;
+    TEST_ASSERT_EQUAL(GT911_READ_OK, dev.readFrame(f, 1234));
+    TEST_ASSERT_EQUAL_UINT32(1234, f.us);
+    TEST_ASSERT_EQUAL_UINT8(3, f.count);
+    for (uint8_t i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_UINT16(pts[i].x, f.points[i].x);
+        TEST_ASSERT_EQUAL_UINT16(pts[i].y, f.points[i].y);
+        TEST_ASSERT_EQUAL_UINT8(pts[i].id, f.points[i].id);
+    }
+    // Status + first point, the other two points, ack: 5 address phases, 9 + 16 bytes read
+    TEST_ASSERT_EQUAL_UINT32(5, bus.transactions);
+    TEST_ASSERT_EQUAL_UINT32(2 + 9 + 2 + 16 + 3, bus.bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, bus.acks);
+    TEST_ASSERT_FALSE(bus.latched());
+}
+
+void test_single_point_is_one_burst() {
+    Gt911Sim bus;
+    Gt911 dev;
+    dev.begin(bus);
+    const TouchPoint p = pt(300, 200, 0);
+    bus.report(&p, 1);
+    bus.resetCounters();
+    TouchFrame f;
+    TEST_ASSERT_EQUAL(GT911_READ_OK, dev.readFrame(f, 0));
+    TEST_ASSERT_EQUAL_UINT8(1, f.count);
+    TEST_ASSERT_EQUAL_UINT32(3, bus.transactions);   // Register address, 9-byte read, ack
+    TEST_ASSERT_EQUAL_UINT32(2 + 9 + 3, bus.bytes);
+}
+
+void test_idle_read_leaves_status_alone() {
+    Gt911Sim bus;
+    Gt911 dev;
+    dev.begin(bus);
+    TouchFrame f;
+    TEST_ASSERT_EQUAL(GT911_READ_IDLE, dev.readFrame(f, 0));
+    TEST_ASSERT_EQUAL_UINT32(0, bus.acks);
+    bus.release();
+    TEST_ASSERT_EQUAL(GT911_READ_OK, dev.readFrame(f, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, f.count);
+    TEST_ASSERT_EQUAL(GT911_READ_IDLE, dev.readFrame(f, 0));   // Acked: nothing new until the next report
+    TEST_ASSERT_EQUAL_UINT32(3, dev.reads());
+    TEST_ASSERT_EQUAL_UINT32(1, dev.reports());
+}
+
+void test_out_of_range_points_dropped() {
+    Gt911Sim bus;
+    Gt911 dev;
+    dev.begin(bus);
+    const TouchPoint pts[3] = { pt(DISPLAY_WIDTH, 10, 0), pt(50, 60, 1), pt(10, DISPLAY_HEIGHT + 5, 2) };
+    bus.report(pts, 3);
+    TouchFrame f;
+    TEST_ASSERT_EQUAL(GT911_READ_OK, dev.readFrame(f, 0));
+    TEST_ASSERT_EQUAL_UINT8(1, f.count);
+    TEST_ASSERT_EQUAL_UINT16(50, f.points[0].x);
+    TEST_ASSERT_EQUAL_UINT8(1, f.points[0].id);
+}
+
+void test_bus_error_keeps_report_latched() {
+    Gt911Sim bus;
+    Gt911 dev;
+    dev.begin(bus);
+    const TouchPoint p = pt(1, 2, 0);
+    bus.report(&p, 1);
+    bus.present = false;
+    TouchFrame f;
+    TEST_ASSERT_EQUAL(GT911_READ_ERROR, dev.readFrame(f, 0));
+    TEST_ASSERT_EQUAL_UINT32(1, dev.errors());
+    bus.present = true;
+    TEST_ASSERT_TRUE(bus.latched());
+    TEST_ASSERT_EQUAL(GT911_READ_OK, dev.readFrame(f, 0));
+    TEST_ASSERT_EQUAL_UINT16(1, f.points[0].x);
+}
+
+void test_queue_order_timestamps_and_drops() {
+    Gt911Sim bus;
+    Gt911 dev;
+    dev.begin(bus);
+    Pipeline pipe(dev, 4);
+    for (uint16_t i = 0; i < 6; i++) {
+        const TouchPoint p = pt(100 + i, 50, 0);
+        bus.report(&p, 1);
+        TEST_ASSERT_EQUAL_UINT32(TOUCH_RELEASE_POLL_MS, pipe.service(1000u * i));
+    }
+    TEST_ASSERT_EQUAL_UINT32(6, pipe.queued());
+    TEST_ASSERT_EQUAL_UINT32(2, pipe.dropped());   // Ring of 4: the two newest did not fit
+    TouchFrame f;
+    for (uint16_t i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(pipe.next(f));
+        TEST_ASSERT_EQUAL_UINT32(1000u * i, f.us);
+        TEST_ASSERT_EQUAL_UINT16(100 + i, f.points[0].x);
+    }
+    TEST_ASSERT_FALSE(pipe.pending());
+    TEST_ASSERT_FALSE(pipe.next(f));
+}
+
+void test_release_poll_recovers_lost_irq() {
+    Gt911Sim bus;
+    Gt911 dev;
+    dev.begin(bus);
+    Pipeline pipe(dev, 8);
+    TEST_ASSERT_EQUAL_UINT32(Pipeline::WAIT_FOREVER, pipe.service(0));   // Spurious wake, nothing latched
+    const TouchPoint p = pt(10, 10, 0);
+    bus.report(&p, 1);
+    TEST_ASSERT_EQUAL_UINT32(TOUCH_RELEASE_POLL_MS, pipe.service(10));
+    // The release report latches but its IRQ edge is lost: the poll timeout picks it up
+    bus.release();
+    TEST_ASSERT_EQUAL_UINT32(Pipeline::WAIT_FOREVER, pipe.service(10 + TOUCH_RELEASE_POLL_MS * 1000));
+    TouchFrame f;
+    TEST_ASSERT_TRUE(pipe.next(f));
+    TEST_ASSERT_EQUAL_UINT8(1, f.count);
+    TEST_ASSERT_TRUE(pipe.next(f));
+    TEST_ASSERT_EQUAL_UINT8(0, f.count);
+}
+
+// ---- Drag gesture: old read-callback polling vs. touch task + queue ----
+
+struct GestureStats {
+    uint32_t reports = 0;          // Reports the controller produced
+    uint32_t delivered = 0;        // Reports LVGL saw
+    uint32_t twoFinger = 0;        // Delivered reports with the second finger
+    uint32_t lvglReads = 0;
+    uint64_t lvglBusUs = 0;        // Bus time inside the LVGL read callback
+    uint64_t taskBusUs = 0;        // Bus time on the touch task
+    uint32_t idleTransactions = 0;
+    uint64_t latencySumUs = 0;     // Newest report -> LVGL read, per read that got one
+    uint32_t latencyMaxUs = 0;
+    uint32_t latencyReads = 0;
+
+    void latency(uint32_t us) {
+        latencySumUs += us;
+        latencyReads++;
+        if (us > latencyMaxUs) latencyMaxUs = us;
+    }
+};
+
+static const uint32_t DRAG_MS = 600;
+static const uint32_t REPORT_MS = 8;    // Report interval while a finger is down
+static const uint32_t IDLE_MS = 2000;
+static const uint32_t READ_PERIOD_MS = 30;   // LV_INDEV_DEF_READ_PERIOD in src/lv_conf.h
+
+// The old callback: status + 7 bytes of point 0 on an IRQ flag or every 50 ms, clear regardless
+static bool legacyRead(Gt911Sim& bus, uint16_t& x, uint16_t& y) {
+    bus.beginTransmission(bus.address);
+    bus.write(0x81);
+    bus.write(0x4E);
+    bus.endTransmission(false);
+    uint8_t buf[8];
+    bus.requestFrom(bus.address, 8);
+    for (int i = 0; i < 8; i++) buf[i] = (uint8_t)bus.read();
+    bus.beginTransmission(bus.address);
+    bus.write(0x81);
+    bus.write(0x4E);
+    bus.write(0x00);
+    bus.endTransmission();
+    if ((buf[0] & 0x0F) == 0) return false;
+    x = (uint16_t)(buf[3] << 8 | buf[2]);
+    y = (uint16_t)(buf[5] << 8 | buf[4]);
+    return true;
+}
+
+// 1 ms steps: two fingers drag for DRAG_MS, reporting every REPORT_MS, then release and idle. LVGL's
+// read timer runs every READ_PERIOD_MS while a finger is down and is paused once released
+// (resumed by the next IRQ/report), as in DisplayDriver.
+static GestureStats runGesture(bool pipelined) {
+    GestureStats st;
+    Gt911Sim bus;
+    Gt911 dev;
+    dev.begin(bus);
+    Pipeline pipe(dev);   // As DisplayDriver: queue allocated by begin(), not the constructor
+    TEST_ASSERT_TRUE(pipe.begin(TOUCH_QUEUE_DEPTH));
+    bool timerPaused = true, irqFlag = false;
+    uint32_t nextRead = 0, lastPoll = 0, reportAt = 0;
+    for (uint32_t ms = 0; ms < DRAG_MS + REPORT_MS + IDLE_MS; ms++) {
+        const uint32_t us = ms * 1000;
+        // Controller
+        if (ms <= DRAG_MS && ms % REPORT_MS == 0) {
+            if (ms < DRAG_MS) {
+                const TouchPoint pts[2] = { pt((uint16_t)(100 + ms), 200, 0), pt((uint16_t)(100 + ms), 300, 1) };
+                bus.report(pts, 2);
+            } else {
+                bus.release();
+            }
+            st.reports++;
+            reportAt = us;
+            // IRQ edge
+            if (pipelined) {
+                const uint64_t b = bus.busUs;
+                pipe.service(us);
+                st.taskBusUs += bus.busUs - b;
+            } else {
+                irqFlag = true;
+            }
+        }
+        const bool wake = pipelined ? pipe.pending() : irqFlag;
+        if (wake && timerPaused) {
+            timerPaused = false;   // update(): resume + ready
+            nextRead = ms;
+        }
+        if (timerPaused || ms < nextRead) continue;
+        nextRead = ms + READ_PERIOD_MS;
+
+        // LVGL read callback
+        const uint32_t tx0 = bus.transactions;
+        const uint64_t b = bus.busUs;
+        bool pressed = false;
+        if (pipelined) {
+            TouchFrame f;
+            bool any = false;
+            do {   // continue_reading
+                st.lvglReads++;
+                if (!pipe.next(f)) break;
+                any = true;
+                st.delivered++;
+                if (f.count > 1) st.twoFinger++;
+                pressed = f.count > 0;
+            } while (pipe.pending());
+            if (any) st.latency(us - f.us);
+            else pressed = true;   // Held, no new report yet
+        } else {
+            st.lvglReads++;
+            if (irqFlag || ms - lastPoll > 50) {
+                irqFlag = false;
+                const bool fresh = bus.latched();
+                uint16_t x, y;
+                pressed = legacyRead(bus, x, y);
+                lastPoll = ms;
+                if (fresh) {
+                    st.delivered++;
+                    st.latency(us - reportAt);
+                }
+            }
+        }
+        st.lvglBusUs += bus.busUs - b;
+        if (ms > DRAG_MS + REPORT_MS) st.idleTransactions += bus.transactions - tx0;
+        if (!pressed) timerPaused = true;
+    }
+    return st;
+}
+
+static void print(const char* name, const GestureStats& s) {
+    printf("[TOUCH] %-10s %3u/%3u reports to LVGL (%3u two-finger), %3u LVGL reads, LVGL-task bus %6.2f ms, "
+           "touch-task bus %6.2f ms, latency avg %5.1f ms max %5.1f ms, idle transactions %u\n",
+           name, (unsigned)s.delivered, (unsigned)s.reports, (unsigned)s.twoFinger, (unsigned)s.lvglReads,
+           s.lvglBusUs / 1000.0, s.taskBusUs / 1000.0, s.latencyReads ? s.latencySumUs / 1000.0 / s.latencyReads : 0.0,
+           s.latencyMaxUs / 1000.0, (unsigned)s.idleTransactions);
+}
+
+void test_gesture_old_poll_vs_touch_task() {
+    const GestureStats legacy = runGesture(false);
+    const GestureStats task = runGesture(true);
+    print("read_cb", legacy);
+    print("touch task", task);
+    TEST_ASSERT_EQUAL_UINT32(task.reports, task.delivered);   // Every report, with its IRQ time
+    TEST_ASSERT_EQUAL_UINT32(task.reports - 1, task.twoFinger);
+    TEST_ASSERT_EQUAL_UINT64(0, task.lvglBusUs);
+    TEST_ASSERT_EQUAL_UINT32(0, task.idleTransactions);
+    TEST_ASSERT_TRUE(legacy.delivered < legacy.reports);
+    TEST_ASSERT_TRUE(legacy.lvglBusUs > 0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_probe_falls_back_to_second_address);
+    RUN_TEST(test_multi_point_decode);
+    RUN_TEST(test_single_point_is_one_burst);
+    RUN_TEST(test_idle_read_leaves_status_alone);
+    RUN_TEST(test_out_of_range_points_dropped);
+    RUN_TEST(test_bus_error_keeps_report_latched);
+    RUN_TEST(test_queue_order_timestamps_and_drops);
+    RUN_TEST(test_release_poll_recovers_lost_irq);
+    RUN_TEST(test_gesture_old_poll_vs_touch_task);
+    return UNITY_END();
+}
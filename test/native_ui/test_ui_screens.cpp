@@ -0,0 +1,483 @@
+// Headless UIScreens: the real screens from src/display/ui_screens.cpp built against lib/lvgl, drawn
+// into a RAM framebuffer (include/test_support/headless_lvgl.h) and driven by scripted touches.
+// Checks navigation, reports per-frame render time and invalidated area for each screen and for
+// the periodic data update, checks that unchanged data invalidates nothing (ui_binding.h), traces
+// taps to the frame that shows them (input_latency.h), and compares every screen with its
+// reference screenshot in reference/. Redraws once more with parallel band units (LV_REFR_BAND_UNITS)
+// and checks they leave the same pixels, then replays a recorded invalidation trace against
+// full-screen redraws for flushes and pixels rendered and flushed per frame, and times data updates with and without the glyph mask cache (LV_DRAW_SW_GLYPH_CACHE_SIZE).
+//
+// UI_UPDATE_REFERENCES=1 rewrites the references from the current build. On a mismatch the actual
+// frame is written to .pio/ui_shots/<name>.ppm.
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "test_support/headless_lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include "../src/controllers/temperature_controller.cpp"
+#include "../src/sensors/sensor_registry.cpp"
+#include "../src/display/ui_screens.cpp"
+
+static HeadlessLvgl hl;
+static SensorRegistry probes;
+static SystemData sys;
+
+static std::string referenceDir() {
+    const char* d = getenv("UI_REFERENCE_DIR");
+    return d ? d : "test/native_ui/reference";
+}
+
+static void checkShot(const char* name) {
+    const std::string ref = referenceDir() + "/" + name + ".rl565";
+    const char* update = getenv("UI_UPDATE_REFERENCES");
+    if (update && update[0] == '1') {
+        TEST_ASSERT_TRUE_MESSAGE(hl.saveShot(ref), ref.c_str());
+        printf("[UI] %-8s reference written to %s\n", name, ref.c_str());
+        return;
+    }
+    ShotDiff d = hl.compareShot(ref);
+    if (!d.loaded || d.pixels) {
+        const std::string out = std::string(".pio/ui_shots/") + name + ".ppm";
+        hl.savePpm(out);
+        printf("[UI] %-8s %s: %u px differ in (%d,%d)-(%d,%d), actual frame in %s\n", name,
+               d.loaded ? "mismatch" : "no reference", (unsigned)d.pixels, (int)d.bounds.x1, (int)d.bounds.y1,
+               (int)d.bounds.x2, (int)d.bounds.y2, out.c_str());
+    }
+    TEST_ASSERT_TRUE_MESSAGE(d.loaded, "reference missing (run with UI_UPDATE_REFERENCES=1)");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, d.pixels, name);
+}
+
+// Frames rendered since `from`: invalidated pixels and render time
+static void reportFrames(const char* what, uint32_t from) {
+    const FrameProfiler& p = hl.profile();
+    uint64_t px = 0, renderUs = 0, flushUs = 0;
+    uint32_t frames = 0, worstUs = 0;
+    for (uint16_t i = 0; i < p.count(); i++) {
+        const FrameSample& f = p.at(i);
+        if (f.seq <= from) continue;
+        frames++;
+        px += f.pixels;
+        renderUs += f.renderUs;
+        flushUs += f.flushUs;
+        if (f.totalUs > worstUs) worstUs = f.totalUs;
+    }
+    printf("[UI] %-22s %3u frames %8llu px (%5.1f%% of screen/frame) render %7.1f us/frame flush %6.1f us/frame worst %u us\n",
+           what, (unsigned)frames, (unsigned long long)px,
+           frames ? 100.0 * px / frames / (HeadlessLvgl::W * HeadlessLvgl::H) : 0.0,
+           frames ? (double)renderUs / frames : 0.0, frames ? (double)flushUs / frames : 0.0, (unsigned)worstUs);
+}
+
+static uint32_t lastSeq() {
+    const FrameSample* f = hl.profile().latest();
+    return f ? f->seq : 0;
+}
+
+// Rendered pixels of the frames after `from`
+static uint64_t pixelsSince(uint32_t from) {
+    uint64_t px = 0;
+    for (uint16_t i = 0; i < hl.profile().count(); i++) {
+        if (hl.profile().at(i).seq > from) px += hl.profile().at(i).pixels;
+    }
+    return px;
+}
+
+static void fillSystemData(float temp) {
+    sys.sensors = &probes;
+    sys.control.status = STATUS_COOLING;
+    sys.control.currentTemp = temp;
+    sys.control.coolingActive = true;
+    sys.control.faultMask = 0;
+    sys.config = controller.getConfig();
+    sys.timeString = "2025-08-07 06:15:12";
+}
+
+void test_main_screen() {
+    controller.init();
+    // Unfiltered probes: one reading each is enough to show them on the data screen
+    for (uint8_t z = 0; z < MAX_SENSOR_ZONES; z++) probes.setZoneFilter(z, {1, 1.0f, 0.0f});
+    for (uint16_t i = 0; i < 3; i++) {
+        uint8_t rom[SENSOR_ROM_LEN] = { 0x28, (uint8_t)(0x10 + i), (uint8_t)(0xA0 + i), 0, 0, 0, 0, 0 };
+        uint16_t idx = probes.add(rom, 0, i / 2);
+        probes.setReading(idx, -18.0f - i * 0.5f, (uint32_t)hl.nowMs());
+    }
+    uint32_t from = lastSeq();
+    TEST_ASSERT_TRUE(ui.init());
+    fillSystemData(-18.4f);
+    ui.update(sys);
+    hl.advance(200);
+    TEST_ASSERT_TRUE(ui.getCurrentScreen() != nullptr);
+    TEST_ASSERT_TRUE(pixelsSince(from) >= (uint64_t)HeadlessLvgl::W * HeadlessLvgl::H);
+    reportFrames("main: first frame", from);
+    checkShot("main");
+}
+
+void test_periodic_update_is_partial() {
+    // The control task's once-a-second refresh of the main screen with a new reading
+    uint32_t from = lastSeq();
+    const UiUpdateStats before = ui.getUpdateStats();
+    for (int s = 0; s < 10; s++) {
+        fillSystemData(-18.4f + s * 0.1f);
+        ui.update(sys);
+        hl.advance(1000);
+    }
+    uint64_t px = pixelsSince(from);
+    reportFrames("main: 1 Hz data update", from);
+    const UiUpdateStats& after = ui.getUpdateStats();
+    printf("[UI] update() invalidated %.0f px per call\n", (double)(after.invalidatedPx - before.invalidatedPx) / 10);
+    TEST_ASSERT_TRUE(px > 0);
+    TEST_ASSERT_TRUE(px < 10ull * HeadlessLvgl::W * HeadlessLvgl::H / 4);   // Well under a full frame per update
+}
+
+void test_unchanged_update_invalidates_nothing() {
+    // Same reading at display precision (0.1 °C): no LVGL call, nothing dirty, no frame
+    fillSystemData(-18.0f);
+    ui.update(sys);
+    hl.advance(200);
+    uint32_t from = lastSeq();
+    const UiBindingStats b0 = uiBindingStats();
+    for (int s = 0; s < 20; s++) {
+        fillSystemData(-18.0f + ((s & 1) ? 0.02f : -0.03f));
+        ui.update(sys);
+        TEST_ASSERT_EQUAL_UINT32(0, ui.getUpdateStats().lastInvalidatedPx);
+        hl.advance(100);
+    }
+    TEST_ASSERT_EQUAL_UINT32(b0.writes, uiBindingStats().writes);
+    TEST_ASSERT_TRUE(uiBindingStats().skips > b0.skips);
+    TEST_ASSERT_EQUAL_UINT64(0, pixelsSince(from));
+
+    // A 0.1 °C step touches the temperature label only
+    fillSystemData(-17.9f);
+    ui.update(sys);
+    uint32_t px = ui.getUpdateStats().lastInvalidatedPx;
+    printf("[UI] 0.1 C step: %u px invalidated, %u widget writes\n", (unsigned)px,
+           (unsigned)(uiBindingStats().writes - b0.writes));
+    TEST_ASSERT_TRUE(px > 0);
+    TEST_ASSERT_TRUE(px < 600u * 380u);   // Inside the temperature panel
+    TEST_ASSERT_EQUAL_UINT32(b0.writes + 1, uiBindingStats().writes);
+    hl.advance(200);
+    TEST_ASSERT_TRUE(pixelsSince(from) <= px);
+}
+
+void test_fixed_point_format() {
+    char buf[32];
+    formatFixed(buf, sizeof(buf), quantize(-18.44f, 1), 1, "", "C");
+    TEST_ASSERT_EQUAL_STRING("-18.4C", buf);
+    formatFixed(buf, sizeof(buf), quantize(-0.04f, 1), 1, "T ", "");
+    TEST_ASSERT_EQUAL_STRING("T 0.0", buf);
+    formatFixed(buf, sizeof(buf), quantize(-0.06f, 1), 1, "", "");
+    TEST_ASSERT_EQUAL_STRING("-0.1", buf);
+    formatFixed(buf, sizeof(buf), quantize(3.14159f, 2), 2, "", "");
+    TEST_ASSERT_EQUAL_STRING("3.14", buf);
+    formatFixed(buf, sizeof(buf), quantize(42.6f, 0), 0, "", "%");
+    TEST_ASSERT_EQUAL_STRING("43%", buf);
+}
+
+void test_tap_settings_and_back() {
+    lv_obj_t* mainScr = ui.getCurrentScreen();
+    uint32_t from = lastSeq();
+    hl.tap(700, 405);   // Settings button, bottom of the right-hand panel
+    TEST_ASSERT_TRUE(ui.getCurrentScreen() != mainScr);
+    hl.advance(200);
+    reportFrames("settings: open", from);
+    checkShot("settings");
+
+    hl.tap(400, 435);   // Back
+    hl.advance(200);
+    TEST_ASSERT_TRUE(ui.getCurrentScreen() == mainScr);
+}
+
+// Virtual-time touch to photon for the Settings button: press feedback, then the screen change on
+// release. Read and refresh timers run at their lv_conf.h periods, so this is what those cost.
+void test_touch_to_photon() {
+    InputLatencyTrace& lat = hl.latency();
+    lat.clear();
+    lv_obj_t* mainScr = ui.getCurrentScreen();
+    hl.tap(700, 405);
+    hl.advance(200);
+    TEST_ASSERT_TRUE(ui.getCurrentScreen() != mainScr);
+    TEST_ASSERT_EQUAL_UINT32(2, lat.completed());   // Press and release both redrew something
+    const LatencySample* s = lat.last();
+    TEST_ASSERT_EQUAL_UINT8(0, s->points);
+    for (uint8_t i = LAT_INDEV; i < LAT_STAGES; i++) TEST_ASSERT_TRUE(s->stageUs[i] >= s->stageUs[i - 1]);
+    printf("[UI] tap -> photon (virtual ms): worst %.0f, release %.0f (indev %.0f dispatch %.0f invalidate %.0f)\n",
+           lat.maxUs(LAT_PHOTON) / 1000.0, s->stageUs[LAT_PHOTON] / 1000.0, s->stageUs[LAT_INDEV] / 1000.0,
+           s->stageUs[LAT_DISPATCH] / 1000.0, s->stageUs[LAT_INVALIDATE] / 1000.0);
+    TEST_ASSERT_TRUE(lat.maxUs(LAT_PHOTON) <= (LV_INDEV_DEF_READ_PERIOD + LV_DISP_DEF_REFR_PERIOD + 10) * 1000u);
+
+    hl.tap(400, 435);   // Back
+    hl.advance(200);
+    TEST_ASSERT_TRUE(ui.getCurrentScreen() == mainScr);
+}
+
+void test_data_screen() {
+    uint32_t from = lastSeq();
+    ui.showDataScreen();
+    hl.advance(200);
+    reportFrames("data: open", from);
+    checkShot("data");
+    ui.showMainScreen();
+    hl.advance(200);
+}
+
+void test_fault_overlay() {
+    uint32_t from = lastSeq();
+    fillSystemData(-18.0f);
+    sys.control.faultMask = FaultBit(FAULT_SENSOR_MISSING_BIT) | FaultBit(FAULT_OVER_TEMPERATURE_BIT);
+    ui.update(sys);
+    hl.advance(200);
+    uint64_t shown = pixelsSince(from);
+    reportFrames("fault overlay: show", from);
+    checkShot("fault");
+    // The overlay covers the top 60 rows; showing it must not repaint the whole screen
+    TEST_ASSERT_TRUE(shown < (uint64_t)HeadlessLvgl::W * HeadlessLvgl::H);
+
+    sys.control.faultMask = 0;
+    ui.update(sys);
+    hl.advance(200);
+}
+
+// Full-screen redraw cost per screen: invalidate and render n times
+void test_benchmark_screens() {
+    struct Case { const char* name; void (UIScreens::*show)(); };
+    static const Case cases[] = {
+        { "main", &UIScreens::showMainScreen },
+        { "settings", &UIScreens::showSettingsScreen },
+        { "data", &UIScreens::showDataScreen },
+    };
+    const int n = 50;
+    for (const Case& c : cases) {
+        (ui.*c.show)();
+        hl.advance(200);
+        hl.profile().clear();
+        for (int i = 0; i < n; i++) {
+            lv_obj_invalidate(lv_scr_act());
+            hl.refreshNow();
+        }
+        FramePercentiles render = hl.profile().percentiles(FRAME_RENDER);
+        FramePercentiles total = hl.profile().percentiles(FRAME_TOTAL);
+        printf("[UI] bench %-8s full redraw: render p50 %6.2f ms p99 %6.2f ms, frame p50 %6.2f ms (%.1f Mpx/s)\n",
+               c.name, render.p50 / 1000.0, render.p99 / 1000.0, total.p50 / 1000.0,
+               total.p50 ? (double)HeadlessLvgl::W * HeadlessLvgl::H / total.p50 : 0.0);
+        TEST_ASSERT_EQUAL_UINT16(n, hl.profile().count());
+    }
+    ui.showMainScreen();
+    hl.advance(200);
+}
+
+// Redraws of screen switches and the fault overlay with one band unit and with LV_REFR_BAND_UNITS
+// (worker threads standing in for the second core), on partial bands and in direct mode. Every
+// step must leave the same framebuffer whatever the unit count.
+void test_parallel_band_render() {
+    struct Step { const char* name; void (*run)(); };
+    static const Step steps[] = {
+        { "settings", [] { ui.showSettingsScreen(); } },
+        { "data", [] { ui.showDataScreen(); } },
+        { "main", [] { ui.showMainScreen(); } },
+        { "fault show", [] {
+            fillSystemData(-18.0f);
+            sys.control.faultMask = FaultBit(FAULT_SENSOR_MISSING_BIT) | FaultBit(FAULT_OVER_TEMPERATURE_BIT);
+            ui.update(sys);
+        } },
+        { "fault hide", [] {
+            sys.control.faultMask = 0;
+            ui.update(sys);
+        } },
+    };
+    const size_t nSteps = sizeof(steps) / sizeof(steps[0]);
+    const int rounds = 20;
+    const uint8_t maxUnits = LV_REFR_BAND_UNITS;
+    TEST_ASSERT_TRUE(maxUnits > 1);
+    TEST_ASSERT_FALSE(hl.setBandUnits(maxUnits + 1));
+
+    for (int direct = 0; direct < 2; direct++) {
+        std::vector<std::vector<uint16_t>> expected(nSteps);
+        double stepMs[2][nSteps] = {};
+        for (uint8_t units = 1; units <= maxUnits; units += maxUnits - 1) {
+            TEST_ASSERT_TRUE(hl.setBandUnits(units));
+            hl.setDirectMode(direct);
+            hl.refreshNow();
+            for (int r = 0; r < rounds; r++) {
+                for (size_t i = 0; i < nSteps; i++) {
+                    hl.profile().clear();
+                    steps[i].run();
+                    hl.refreshNow();
+                    TEST_ASSERT_EQUAL_UINT16(1, hl.profile().count());
+                    stepMs[units > 1][i] += hl.profile().at(0).totalUs / 1000.0 / rounds;
+
+                    const uint16_t* fb = hl.framebuffer();
+                    std::vector<uint16_t>& exp = expected[i];
+                    if (exp.empty()) exp.assign(fb, fb + (size_t)HeadlessLvgl::W * HeadlessLvgl::H);
+                    else TEST_ASSERT_EQUAL_MEMORY_MESSAGE(exp.data(), fb, exp.size() * sizeof(uint16_t), steps[i].name);
+                }
+            }
+        }
+        for (size_t i = 0; i < nSteps; i++) {
+            printf("[UI] bands %-6s %-10s 1 unit %6.2f ms, %u units %6.2f ms (x%.2f on %u host cores)\n",
+                   direct ? "direct" : "48-row", steps[i].name, stepMs[0][i], (unsigned)maxUnits, stepMs[1][i],
+                   stepMs[1][i] > 0 ? stepMs[0][i] / stepMs[1][i] : 0.0, std::thread::hardware_concurrency());
+        }
+    }
+
+    // The references hold with the worker threads on the board's default buffers
+    hl.setDirectMode(false);
+    fillSystemData(-18.4f);
+    ui.update(sys);
+    hl.refreshNow();
+    checkShot("main");
+    hl.setBandUnits(1);
+}
+
+// A session on the screens recorded as invalidation traces: 1 Hz updates of readings and clock,
+// Settings and back, the data screen, the fault overlay
+static void recordSession(std::vector<std::vector<lv_area_t>>& trace) {
+    hl.recordInvalidations(&trace);
+    char clock[32];
+    for (int s = 0; s < 10; s++) {
+        for (uint16_t i = 0; i < 3; i++) probes.setReading(i, -18.0f - i * 0.5f + s * 0.1f, hl.nowMs());
+        fillSystemData(-18.4f + s * 0.1f);
+        snprintf(clock, sizeof(clock), "2025-08-07 06:15:%02d", 12 + s);
+        sys.timeString = clock;
+        ui.update(sys);
+        hl.advance(1000);
+    }
+    hl.tap(700, 405);   // Settings
+    hl.advance(200);
+    hl.tap(400, 435);   // Back
+    hl.advance(200);
+    ui.showDataScreen();
+    hl.advance(200);
+    ui.showMainScreen();
+    hl.advance(200);
+    sys.control.faultMask = FaultBit(FAULT_SENSOR_MISSING_BIT);
+    ui.update(sys);
+    hl.advance(200);
+    sys.control.faultMask = 0;
+    ui.update(sys);
+    hl.advance(200);
+    hl.recordInvalidations(nullptr);
+}
+
+struct ReplayTotals {
+    uint32_t frames, flushes;
+    uint64_t rendered, flushed, renderUs;
+    std::vector<uint64_t> hashes;   // Framebuffer after each frame
+};
+
+static uint64_t fbHash() {
+    uint64_t h = 1469598103934665603ull;   // FNV-1a
+    const uint16_t* fb = hl.framebuffer();
+    for (size_t i = 0; i < (size_t)HeadlessLvgl::W * HeadlessLvgl::H; i++) h = (h ^ fb[i]) * 1099511628211ull;
+    return h;
+}
+
+// Redraws each frame of trace: its invalidated areas, or the whole screen when fullScreen
+static ReplayTotals replay(const std::vector<std::vector<lv_area_t>>& trace, bool fullScreen) {
+    ReplayTotals t {};
+    for (const std::vector<lv_area_t>& frame : trace) {
+        if (fullScreen) lv_obj_invalidate(lv_scr_act());
+        else for (const lv_area_t& a : frame) _lv_inv_area(hl.disp(), &a);
+        hl.refreshNow();
+        const FrameSample* f = hl.profile().latest();
+        t.frames++;
+        t.flushes += f->flushes;
+        t.rendered += f->pixels;
+        t.flushed += f->flushedPixels;
+        t.renderUs += f->renderUs;
+        t.hashes.push_back(fbHash());
+    }
+    return t;
+}
+
+// The recorded trace redrawn on 48-row bands with the overlap join (lv_refr_join_area), against a
+// full-screen redraw per frame. Reports flushes and pixels rendered and flushed per frame; the only
+// requirement is the same pixels either way.
+void test_invalidation_trace_replay() {
+    std::vector<std::vector<lv_area_t>> trace;
+    recordSession(trace);
+    TEST_ASSERT_TRUE(trace.size() > 10);
+    size_t areas = 0;
+    for (const auto& f : trace) areas += f.size();
+
+    const int rounds = 5;
+    ReplayTotals joined {}, full {};
+    for (int r = 0; r < rounds; r++) {
+        ReplayTotals j = replay(trace, false);
+        ReplayTotals f = replay(trace, true);
+        TEST_ASSERT_EQUAL_UINT32(j.frames, f.frames);
+        for (size_t i = 0; i < j.hashes.size(); i++) TEST_ASSERT_EQUAL_UINT64(f.hashes[i], j.hashes[i]);
+        joined.renderUs += j.renderUs;
+        full.renderUs += f.renderUs;
+        if (r == 0) {
+            joined.frames = j.frames; joined.flushes = j.flushes; joined.rendered = j.rendered; joined.flushed = j.flushed;
+            full.frames = f.frames; full.flushes = f.flushes; full.rendered = f.rendered; full.flushed = f.flushed;
+        }
+    }
+    const ReplayTotals* rows[2] = { &joined, &full };
+    const char* names[2] = { "join", "full" };
+    printf("[UI] trace: %u frames, %u invalidated areas, %u-row bands\n", (unsigned)trace.size(), (unsigned)areas,
+           (unsigned)DISPLAY_DRAW_BUF_LINES);
+    for (int i = 0; i < 2; i++) {
+        const ReplayTotals& t = *rows[i];
+        printf("[UI] trace %-7s %5.2f flushes/frame %8.0f px rendered/frame %8.0f px flushed/frame render %6.3f ms/frame\n",
+               names[i], (double)t.flushes / t.frames, (double)t.rendered / t.frames, (double)t.flushed / t.frames,
+               t.renderUs / 1000.0 / rounds / t.frames);
+    }
+}
+
+// Redraws of the temperature readout and the sensor list on 1 Hz updates with the glyph mask cache
+// off and at its default size (LV_DRAW_SW_GLYPH_CACHE_SIZE). Same pixels either way.
+void test_glyph_cache_redraw() {
+    struct Run { uint64_t renderUs; uint32_t frames; std::vector<uint64_t> hashes; lv_draw_sw_glyph_cache_stats_t stats; };
+    const uint32_t sizes[2] = { 0, LV_DRAW_SW_GLYPH_CACHE_SIZE };
+    const int rounds = 5, updates = 20;
+    Run runs[2] {};
+    for (int r = 0; r < rounds; r++) {
+        for (int c = 0; c < 2; c++) {
+            lv_draw_sw_glyph_cache_set_size(sizes[c]);
+            Run& run = runs[c];
+            for (int s = 0; s < updates; s++) {
+                for (uint16_t i = 0; i < 3; i++) probes.setReading(i, -18.0f - i * 0.5f + (s % 7) * 0.1f, hl.nowMs());
+                fillSystemData(-18.4f + (s % 9) * 0.1f);
+                hl.profile().clear();
+                ui.update(sys);
+                hl.refreshNow();
+                const FrameSample* f = hl.profile().latest();
+                TEST_ASSERT_NOT_NULL(f);
+                run.renderUs += f->renderUs;
+                run.frames++;
+                if (r == 0) run.hashes.push_back(fbHash());
+            }
+            lv_draw_sw_glyph_cache_get_stats(&run.stats);
+        }
+    }
+    for (int i = 0; i < updates; i++) TEST_ASSERT_EQUAL_UINT64(runs[0].hashes[i], runs[1].hashes[i]);
+    const lv_draw_sw_glyph_cache_stats_t& st = runs[1].stats;
+    TEST_ASSERT_EQUAL_UINT32(0, runs[0].stats.hits + runs[0].stats.misses);
+    TEST_ASSERT_TRUE(st.hits > st.misses);
+    TEST_ASSERT_TRUE(st.size <= LV_DRAW_SW_GLYPH_CACHE_SIZE * LV_REFR_BAND_UNITS);
+    for (int c = 0; c < 2; c++) {
+        printf("[UI] glyph cache %5u B: render %6.3f ms/update", (unsigned)sizes[c], runs[c].renderUs / 1000.0 / runs[c].frames);
+        if (c) printf(", %.1f%% hits (%u/%u), %u B held", st.hits * 100.0 / (st.hits + st.misses), (unsigned)st.hits,
+                      (unsigned)(st.hits + st.misses), (unsigned)st.size);
+        printf("\n");
+    }
+    lv_draw_sw_glyph_cache_set_size(LV_DRAW_SW_GLYPH_CACHE_SIZE);
+}
+
+int main() {
+    hl.begin();
+    UNITY_BEGIN();
+    RUN_TEST(test_main_screen);
+    RUN_TEST(test_periodic_update_is_partial);
+    RUN_TEST(test_unchanged_update_invalidates_nothing);
+    RUN_TEST(test_fixed_point_format);
+    RUN_TEST(test_tap_settings_and_back);
+    RUN_TEST(test_touch_to_photon);
+    RUN_TEST(test_data_screen);
+    RUN_TEST(test_fault_overlay);
+    RUN_TEST(test_benchmark_screens);
+    RUN_TEST(test_parallel_band_render);
+    RUN_TEST(test_invalidation_trace_replay);
+    RUN_TEST(test_glyph_cache_redraw);
+    return UNITY_END();
+}
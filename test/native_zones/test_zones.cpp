@@ -0,0 +1,203 @@
+// Multi-zone control: independent controllers per zone, shared relay banks, stepping only zones with
+// a fresh sample or an expired deadline, per-zone stale-input handling, and the per-zone update cost
+// for 1..16 zones each running against its own freezer plant model.
+#include <unity.h>
+#include <stdio.h>
+#include "controllers/zone_manager.h"
+#include "../src/controllers/temperature_controller.cpp"
+#include "../src/controllers/zone_manager.cpp"
+#include "test_support/freezer_plant.h"
+
+#define fakeMillis __fakeMillis
+
+static SensorData makeSensor(float t, bool valid = true) {
+    SensorData s{}; s.temperature = t; s.valid = valid; s.timestamp = fakeMillis; s.lastValidReading = fakeMillis;
+    return s;
+}
+
+static ZoneSetup setupOn(uint8_t sensorZone, uint8_t bank, uint8_t firstLine) {
+    return ZoneSetup{ sensorZone, { bank, firstLine, (uint8_t)(firstLine + 1), (uint8_t)(firstLine + 2) } };
+}
+
+// Feeds each zone a constant reading every 100 ms for ms milliseconds, stepping as the manager asks
+static void runZones(ZoneManager& zm, const float* temps, uint32_t ms, uint16_t silentMask = 0) {
+    unsigned long end = fakeMillis + ms;
+    unsigned long nextSample = fakeMillis;
+    while (fakeMillis < end) {
+        if (fakeMillis >= nextSample) {
+            for (uint8_t z = 0; z < zm.count(); z++) {
+                if (silentMask & (1u << z)) continue;
+                SensorData s = makeSensor(temps[z]);
+                zm.submit(z, &s, 1, (uint32_t)fakeMillis);
+            }
+            nextSample += 100;
+        }
+        uint32_t wait = zm.step((uint32_t)fakeMillis, 2000);
+        unsigned long next = fakeMillis + (wait ? wait : 1);
+        if (next > nextSample) next = nextSample;
+        if (next <= fakeMillis) next = fakeMillis + 1;
+        fakeMillis = next;
+    }
+}
+
+void test_zones_are_independent_and_share_a_bank() {
+    ZoneManager zm;
+    TEST_ASSERT_EQUAL_UINT8(0, zm.addZone(setupOn(0, 0, 0)));
+    TEST_ASSERT_EQUAL_UINT8(1, zm.addZone(setupOn(1, 0, 4)));
+    TEST_ASSERT_EQUAL_UINT8(2, zm.addZone(setupOn(2, 1, 0)));
+    TEST_ASSERT_TRUE(&zm.zone(0) == &controller);
+    TEST_ASSERT_EQUAL_UINT8(2, zm.banksUsed());
+    controller.init();   // Zone 0 is set up by setup(); addZone() inits the others
+    zm.zone(0).setTargetTemperature(-18.0f);
+    zm.zone(1).setTargetTemperature(2.0f);
+    zm.zone(2).setTargetTemperature(-22.0f);
+
+    const float temps[3] = { -10.0f, 2.0f, -15.0f };   // Zone 1 sits on target; 0 and 2 are warm
+    runZones(zm, temps, MIN_COMPRESSOR_OFF_TIME_MS + 500);
+    TEST_ASSERT_TRUE(zm.zone(0).getState().coolingActive);
+    TEST_ASSERT_FALSE(zm.zone(1).getState().coolingActive);
+    TEST_ASSERT_TRUE(zm.zone(2).getState().coolingActive);
+
+    uint8_t bank0 = zm.bankOutputs(0);
+    TEST_ASSERT_TRUE(bank0 & 0x01);                    // Zone 0 compressor on line 0
+    TEST_ASSERT_FALSE(bank0 & 0x10);                   // Zone 1 compressor on line 4 stays off
+    TEST_ASSERT_TRUE(zm.bankOutputs(1) & 0x01);        // Zone 2 on its own bank
+    TEST_ASSERT_EQUAL_UINT8(0, zm.bankOutputs(5));
+    TEST_ASSERT_EQUAL_UINT8(ZoneManager::NO_ZONE, zm.addZone(setupOn(3, MAX_RELAY_BANKS, 0)));
+}
+
+void test_only_pending_or_due_zones_step() {
+    ZoneManager zm;
+    for (uint8_t z = 0; z < 4; z++) zm.addZone(setupOn(z, 0, z * 2));
+    controller.init();
+    for (uint8_t z = 0; z < 4; z++) zm.zone(z).setTargetTemperature(-18.0f);
+    const float temps[4] = { -18.0f, -18.0f, -18.0f, -18.0f };
+    runZones(zm, temps, 1000);          // Settle: no pending debounce, deadlines far out
+
+    zm.resetCost();
+    fakeMillis += 1;
+    SensorData s = makeSensor(-18.0f);
+    zm.submit(2, &s, 1, (uint32_t)fakeMillis);
+    zm.step((uint32_t)fakeMillis, 2000);
+    for (uint8_t z = 0; z < 4; z++) TEST_ASSERT_EQUAL_UINT32(z == 2 ? 1 : 0, zm.cost(z).steps);
+
+    zm.step((uint32_t)fakeMillis, 2000);   // Nothing new: nobody runs
+    TEST_ASSERT_EQUAL_UINT32(1, zm.cost(2).steps);
+}
+
+void test_stalled_zone_faults_alone() {
+    ZoneManager zm;
+    zm.addZone(setupOn(0, 0, 0));
+    zm.addZone(setupOn(1, 0, 4));
+    controller.init();
+    for (uint8_t z = 0; z < 2; z++) zm.zone(z).setTargetTemperature(-18.0f);
+    const float temps[2] = { -18.0f, -18.0f };
+    runZones(zm, temps, 1000);
+
+    // Zone 1's sensors stop reporting; the wait handed back must cover its stale deadline
+    runZones(zm, temps, SENSOR_TIMEOUT - 200, 0x2);
+    TEST_ASSERT_FALSE(zm.zone(1).faultActive(FaultBit(FAULT_SENSOR_MISSING_BIT)));
+    TEST_ASSERT_TRUE(zm.step((uint32_t)fakeMillis, 100000) <= 200 + 1);
+    runZones(zm, temps, 200 + SENSOR_MISSING_DEBOUNCE_MS + 50, 0x2);
+    TEST_ASSERT_TRUE(zm.zone(1).faultActive(FaultBit(FAULT_SENSOR_MISSING_BIT)));
+    TEST_ASSERT_FALSE(zm.zone(0).faultActive(FaultBit(FAULT_SENSOR_MISSING_BIT)));
+
+    // Sensors come back: fresh sample, inputs valid again
+    runZones(zm, temps, FAULT_CLEAR_DEBOUNCE_MS + 100);
+    TEST_ASSERT_FALSE(zm.zone(1).faultActive(FaultBit(FAULT_SENSOR_MISSING_BIT)));
+}
+
+void test_shared_outputs_are_merged() {
+    ZoneManager zm;
+    zm.addZone(ZoneSetup{ 0, { 0, 0, 2, 3 } });   // Compressor, electric heater, main fan
+    zm.addZone(ZoneSetup{ 1, { 0, 6, 7, ZONE_RELAY_NONE } });
+    controller.init();
+    // addZone() initialised zone 1: status set, defrost clock started
+    TEST_ASSERT_EQUAL_UINT32(fakeMillis, zm.zone(1).getState().lastDefrost);
+    // Only mapped lines belong to the zones; hot gas (1), fan aux (4) and alarm (5) are left alone
+    TEST_ASSERT_EQUAL_HEX8(0xCD, zm.bankLines(0));
+    TEST_ASSERT_EQUAL_HEX8(0, zm.bankLines(1));
+
+    // Zone 1 alarms, zone 0 is fine: the shared buzzer follows the OR, not the last zone stepped
+    for (uint8_t z = 0; z < 2; z++) zm.zone(z).setTargetTemperature(-18.0f);
+    const float temps[2] = { -18.0f, 20.0f };
+    runZones(zm, temps, ALARM_TRIGGER_GRACE_MS + 2000);
+    TEST_ASSERT_TRUE(zm.zone(1).getState().alarmActive);
+    TEST_ASSERT_FALSE(zm.zone(0).getState().alarmActive);
+    bool heard = false;
+    for (int i = 0; i < 30 && !heard; i++) {
+        runZones(zm, temps, 100);
+        heard = zm.buzzerOn();
+    }
+    TEST_ASSERT_TRUE(heard);
+}
+
+// Every zone drives its own plant; 1 s samples, event-driven stepping, half a virtual day
+static double benchZones(uint8_t n) {
+    fakeMillis = 0;
+    ZoneManager zm;
+    FreezerPlant* plants[ZoneManager::CAPACITY];
+    for (uint8_t z = 0; z < n; z++) {
+        zm.addZone(setupOn(z, z / 2, (z & 1) * 4));
+        if (z == 0) controller.init();
+        zm.zone(z).setTargetTemperature(-18.0f - (z % 4));
+        FreezerPlantParams p;
+        p.seed += z;
+        plants[z] = new FreezerPlant(p);
+    }
+    const unsigned long endMs = 12UL * 3600000UL;
+    unsigned long nextSample = 0;
+    uint64_t wakeups = 0;
+    while (fakeMillis < endMs) {
+        if (fakeMillis >= nextSample) {
+            for (uint8_t z = 0; z < n; z++) {
+                SensorData s[2] = { makeSensor(plants[z]->sampleSensor(0)), makeSensor(plants[z]->sampleSensor(1)) };
+                zm.submit(z, s, 2, (uint32_t)fakeMillis);
+            }
+            nextSample += 1000;
+        }
+        uint32_t wait = zm.step((uint32_t)fakeMillis, 2000);
+        wakeups++;
+        unsigned long next = fakeMillis + (wait ? wait : 1);
+        if (next > nextSample) next = nextSample;
+        uint32_t dt = (uint32_t)(next - fakeMillis);
+        for (uint8_t z = 0; z < n; z++) {
+            const ControlState& st = zm.zone(z).getState();
+            plants[z]->step(fakeMillis, dt, st.coolingActive, st.heatingActive, st.fanPWM);
+        }
+        fakeMillis = next;
+    }
+
+    uint64_t steps = 0, ticks = 0;
+    uint32_t worst = 0;
+    for (uint8_t z = 0; z < n; z++) {
+        steps += zm.cost(z).steps;
+        ticks += zm.cost(z).totalTicks;
+        if (zm.cost(z).maxTicks > worst) worst = zm.cost(z).maxTicks;
+        TEST_ASSERT_TRUE(zm.cost(z).steps > 0);
+        TEST_ASSERT_TRUE(fabsf(plants[z]->airTemp() - (-18.0f - (z % 4))) < 4.0f);
+        delete plants[z];
+    }
+    printf("[ZONES] %2u zones: %llu wakeups, %llu zone steps, %.1f ns/zone step (worst %u ns), %.2f us/wakeup\n",
+           (unsigned)n, (unsigned long long)wakeups, (unsigned long long)steps,
+           steps ? (double)ticks / steps : 0.0, (unsigned)worst, wakeups ? (double)ticks / wakeups / 1000.0 : 0.0);
+    return steps ? (double)ticks / steps : 0.0;
+}
+
+void test_benchmark_zone_count_scaling() {
+    const uint8_t sizes[] = { 1, 4, 8, 16 };
+    double perStep[4];
+    for (int i = 0; i < 4; i++) perStep[i] = benchZones(sizes[i]);
+    // Stepping a zone costs the same however many other zones are configured
+    TEST_ASSERT_TRUE(perStep[3] < perStep[0] * 3.0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_zones_are_independent_and_share_a_bank);
+    RUN_TEST(test_only_pending_or_due_zones_step);
+    RUN_TEST(test_stalled_zone_faults_alone);
+    RUN_TEST(test_shared_outputs_are_merged);
+    RUN_TEST(test_benchmark_zone_count_scaling);
+    return UNITY_END();
+}
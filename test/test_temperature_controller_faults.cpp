@@ -7,7 +7,7 @@
 #include "../src/controllers/temperature_controller.cpp"
 
 static SensorData makeSensor(float t, bool valid=true) {
-    SensorData s{}; s.temperature = t; s.valid = valid; s.humidity = 0; s.timestamp = millis(); s.lastValidReading = s.timestamp; s.sensorId = 0; s.address = ""; return s;
+    SensorData s{}; s.temperature = t; s.valid = valid; s.humidity = 0; s.timestamp = millis(); s.lastValidReading = s.timestamp; s.sensorId = 0; return s;
 }
 
 static void resetController(float target=-10.0f) {